@@ -361,6 +361,11 @@ bool CPL_DLL GDALIsLineOfSightVisible(
     const int xB, const int yB, const double zB, int *pnxTerrainIntersection,
     int *pnyTerrainIntersection, CSLConstList papszOptions);
 
+bool CPL_DLL GDALIsLineOfSightVisibleBatch(
+    const GDALRasterBandH, int nPoints, const int *panXA, const int *panYA,
+    const double *padfZA, const int *panXB, const int *panYB,
+    const double *padfZB, GByte *pabyVisible, CSLConstList papszOptions);
+
 /************************************************************************/
 /*         Rasterizer API - geometries burned into GDAL raster.         */
 /************************************************************************/
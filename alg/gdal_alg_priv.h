@@ -178,6 +178,13 @@ void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
 
 void CPL_DLL *GDALCloneTransformer(void *pTransformerArg);
 
+void CPL_DLL *
+GDALCreateThreadSafeTransformer(GDALTransformerFunc pfnBaseTransformer,
+                                void *pBaseTransformerArg);
+int CPL_DLL GDALThreadSafeTransform(void *pTransformArg, int bDstToSrc,
+                                    int nPointCount, double *x, double *y,
+                                    double *z, int *panSuccess);
+
 void GDALRefreshGenImgProjTransformer(void *hTransformArg);
 void GDALRefreshApproxTransformer(void *hTransformArg);
 
@@ -21,6 +21,8 @@
 
 #include <algorithm>
 #include <complex>
+#include <utility>
+#include <vector>
 
 template <typename T> bool areEqualReal(double dfNoDataValue, T dfOut);
 
@@ -441,3 +443,85 @@ bool GDALInterpolateAtPoint(GDALRasterBand *pBand,
     }
     return res;
 }
+
+/************************************************************************/
+/*                      GDALInterpolateAtPoints()                       */
+/************************************************************************/
+
+/** Interpolate the band value at many (pixel, line) positions at once.
+ *
+ * The points are evaluated in increasing block order (Morton code of the
+ * block containing each point), so the windows cached by the single-point
+ * implementation - and the underlying raster blocks - are fetched once per
+ * block rather than per point, which is what dominates trajectory-sampling
+ * workloads. Semantics per point (including the complex data path) are
+ * exactly those of GDALInterpolateAtPoint().
+ *
+ * @param pBand Raster band.
+ * @param eResampleAlg Interpolation algorithm.
+ * @param cache Window cache, shared with GDALInterpolateAtPoint().
+ * @param nPoints Number of points.
+ * @param padfX Array of nPoints pixel coordinates.
+ * @param padfY Array of nPoints line coordinates.
+ * @param[out] padfOutputReal Array of nPoints interpolated values.
+ * @param[out] padfOutputImag Array of nPoints imaginary parts, or nullptr.
+ * @param[out] pabySuccess Optional array of nPoints success flags.
+ * @return true if all points were successfully interpolated.
+ *
+ * @since GDAL 3.14
+ */
+bool GDALInterpolateAtPoints(GDALRasterBand *pBand,
+                             GDALRIOResampleAlg eResampleAlg,
+                             std::unique_ptr<DoublePointsCache> &cache,
+                             size_t nPoints, const double *padfX,
+                             const double *padfY, double *padfOutputReal,
+                             double *padfOutputImag, GByte *pabySuccess)
+{
+    if (nPoints == 0)
+        return true;
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    pBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    if (nBlockXSize <= 0)
+        nBlockXSize = 1;
+    if (nBlockYSize <= 0)
+        nBlockYSize = 1;
+
+    const auto SpreadBits = [](GUIntBig v)
+    {
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        v = (v | (v << 2)) & 0x3333333333333333ULL;
+        v = (v | (v << 1)) & 0x5555555555555555ULL;
+        return v;
+    };
+
+    std::vector<std::pair<GUIntBig, size_t>> asOrder(nPoints);
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        const GUIntBig nBlockX = static_cast<GUIntBig>(
+            std::max(0.0, padfX[i]) / nBlockXSize);
+        const GUIntBig nBlockY = static_cast<GUIntBig>(
+            std::max(0.0, padfY[i]) / nBlockYSize);
+        asOrder[i] = {SpreadBits(nBlockX & 0xFFFFFFFFU) |
+                          (SpreadBits(nBlockY & 0xFFFFFFFFU) << 1),
+                      i};
+    }
+    std::sort(asOrder.begin(), asOrder.end());
+
+    bool bRet = true;
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        const size_t iPoint = asOrder[i].second;
+        const bool bOK = GDALInterpolateAtPoint(
+            pBand, eResampleAlg, cache, padfX[iPoint], padfY[iPoint],
+            &padfOutputReal[iPoint],
+            padfOutputImag ? &padfOutputImag[iPoint] : nullptr);
+        if (pabySuccess)
+            pabySuccess[iPoint] = bOK ? 1 : 0;
+        bRet = bRet && bOK;
+    }
+    return bRet;
+}
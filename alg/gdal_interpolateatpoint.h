@@ -41,6 +41,12 @@ bool CPL_DLL GDALInterpolateAtPoint(GDALRasterBand *pBand,
                                     double *pdfOutputReal,
                                     double *pdfOutputImag);
 
+bool CPL_DLL GDALInterpolateAtPoints(
+    GDALRasterBand *pBand, GDALRIOResampleAlg eResampleAlg,
+    std::unique_ptr<DoublePointsCache> &cache, size_t nPoints,
+    const double *padfX, const double *padfY, double *padfOutputReal,
+    double *padfOutputImag, GByte *pabySuccess);
+
 /*! @endcond */
 
 #endif /* ndef GDAL_INTERPOLATEATPOINT_H_INCLUDED */
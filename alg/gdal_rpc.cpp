@@ -1130,7 +1130,8 @@ void GDALDestroyRPCTransformer(void *pTransformAlg)
 static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
                                      double dfPixel, double dfLine,
                                      double dfUserHeight, double *pdfLong,
-                                     double *pdfLat)
+                                     double *pdfLat,
+                                     const double *padfSeedLongLat = nullptr)
 
 {
     // Memo:
@@ -1139,15 +1140,27 @@ static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
 
     /* -------------------------------------------------------------------- */
     /*      Compute an initial approximation based on linear                */
-    /*      interpolation from our reference point.                         */
+    /*      interpolation from our reference point, unless the caller      */
+    /*      provided a better seed (typically the converged result of the  */
+    /*      neighboring point of a scanline).                              */
     /* -------------------------------------------------------------------- */
-    double dfResultX = psTransform->adfPLToLatLongGeoTransform[0] +
-                       psTransform->adfPLToLatLongGeoTransform[1] * dfPixel +
-                       psTransform->adfPLToLatLongGeoTransform[2] * dfLine;
+    double dfResultX;
+    double dfResultY;
+    if (padfSeedLongLat != nullptr)
+    {
+        dfResultX = padfSeedLongLat[0];
+        dfResultY = padfSeedLongLat[1];
+    }
+    else
+    {
+        dfResultX = psTransform->adfPLToLatLongGeoTransform[0] +
+                    psTransform->adfPLToLatLongGeoTransform[1] * dfPixel +
+                    psTransform->adfPLToLatLongGeoTransform[2] * dfLine;
 
-    double dfResultY = psTransform->adfPLToLatLongGeoTransform[3] +
-                       psTransform->adfPLToLatLongGeoTransform[4] * dfPixel +
-                       psTransform->adfPLToLatLongGeoTransform[5] * dfLine;
+        dfResultY = psTransform->adfPLToLatLongGeoTransform[3] +
+                    psTransform->adfPLToLatLongGeoTransform[4] * dfPixel +
+                    psTransform->adfPLToLatLongGeoTransform[5] * dfLine;
+    }
 
     if (psTransform->bRPCInverseVerbose)
     {
@@ -1969,20 +1982,51 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
     /*      approximation.                                                  */
     /* -------------------------------------------------------------------- */
     int bRet = TRUE;
+    // Seed each point's iteration from the converged result of the
+    // previous one: points of a batch are generally neighbors on a
+    // scanline, and the warm start cuts most of the iterations.
+    const bool bWarmStart =
+        CPLTestBool(CPLGetConfigOption("GDAL_RPC_INVERSE_WARM_START", "YES"));
+    bool bSeedValid = false;
+    double dfSeedLong = 0.0;
+    double dfSeedLat = 0.0;
+    double dfSeedPixel = 0.0;
+    double dfSeedLine = 0.0;
     for (int i = 0; i < nPointCount; i++)
     {
         double dfResultX = 0.0;
         double dfResultY = 0.0;
 
+        double adfSeedForPoint[2] = {0.0, 0.0};
+        const double *padfSeed = nullptr;
+        if (bWarmStart && bSeedValid)
+        {
+            const double *padfGT = psTransform->adfPLToLatLongGeoTransform;
+            adfSeedForPoint[0] = dfSeedLong +
+                                 padfGT[1] * (padfX[i] - dfSeedPixel) +
+                                 padfGT[2] * (padfY[i] - dfSeedLine);
+            adfSeedForPoint[1] = dfSeedLat +
+                                 padfGT[4] * (padfX[i] - dfSeedPixel) +
+                                 padfGT[5] * (padfY[i] - dfSeedLine);
+            padfSeed = adfSeedForPoint;
+        }
+
         if (!RPCInverseTransformPoint(psTransform, padfX[i], padfY[i], padfZ[i],
-                                      &dfResultX, &dfResultY))
+                                      &dfResultX, &dfResultY, padfSeed))
         {
             bRet = FALSE;
             panSuccess[i] = FALSE;
             padfX[i] = HUGE_VAL;
             padfY[i] = HUGE_VAL;
+            bSeedValid = false;
             continue;
         }
+
+        bSeedValid = true;
+        dfSeedLong = dfResultX;
+        dfSeedLat = dfResultY;
+        dfSeedPixel = padfX[i];
+        dfSeedLine = padfY[i];
         if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
         {
             bRet = FALSE;
@@ -89,6 +89,14 @@ class GDALFeaturePoint
      */
     double operator[](int nIndex) const;
 
+    /** Direct read-only access to the descriptor array (DESC_SIZE values),
+     * for hot loops that should not pay the per-element range check of
+     * operator[]. */
+    const double *GetDescriptorData() const
+    {
+        return padfDescriptor;
+    }
+
     /** Descriptor length */
     static const int DESC_SIZE = 64;
 
@@ -18,8 +18,10 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
@@ -139,10 +141,164 @@ static void GDALTPSComputeForwardInThread(void *pData)
         psInfo->poForward->solve(psInfo->bForceBuiltinMethod) != 0;
 }
 
+/************************************************************************/
+/*                 GDALCreateTPSTransformerApprox()                     */
+/************************************************************************/
+
+/* Approximate TPS construction for very large GCP sets: solve on a
+ * spatially uniform subset of the GCPs (selected by Morton order of their
+ * pixel/line coordinates), and, when a target error is provided, verify
+ * the residuals at the left-out GCPs, doubling the subset until the
+ * target is met. This turns the O(n^3) dense solve into one on a much
+ * smaller n. */
+static void *GDALCreateTPSTransformerApprox(int nGCPCount,
+                                            const GDAL_GCP *pasGCPList,
+                                            int bReversed,
+                                            CSLConstList papszOptions,
+                                            int nMaxGCPs,
+                                            double dfTargetError)
+{
+    // Spatially uniform ordering of the GCPs
+    double dfMinPixel = pasGCPList[0].dfGCPPixel;
+    double dfMaxPixel = dfMinPixel;
+    double dfMinLine = pasGCPList[0].dfGCPLine;
+    double dfMaxLine = dfMinLine;
+    for (int i = 1; i < nGCPCount; ++i)
+    {
+        dfMinPixel = std::min(dfMinPixel, pasGCPList[i].dfGCPPixel);
+        dfMaxPixel = std::max(dfMaxPixel, pasGCPList[i].dfGCPPixel);
+        dfMinLine = std::min(dfMinLine, pasGCPList[i].dfGCPLine);
+        dfMaxLine = std::max(dfMaxLine, pasGCPList[i].dfGCPLine);
+    }
+    const double dfInvPixel =
+        dfMaxPixel > dfMinPixel ? 65535.0 / (dfMaxPixel - dfMinPixel) : 0;
+    const double dfInvLine =
+        dfMaxLine > dfMinLine ? 65535.0 / (dfMaxLine - dfMinLine) : 0;
+    const auto SpreadBits = [](GUIntBig v)
+    {
+        v = (v | (v << 8)) & 0x00FF00FFU;
+        v = (v | (v << 4)) & 0x0F0F0F0FU;
+        v = (v | (v << 2)) & 0x33333333U;
+        v = (v | (v << 1)) & 0x55555555U;
+        return v;
+    };
+    std::vector<std::pair<GUIntBig, int>> asMortonIdx(nGCPCount);
+    for (int i = 0; i < nGCPCount; ++i)
+    {
+        const GUIntBig nX = static_cast<GUIntBig>(
+            (pasGCPList[i].dfGCPPixel - dfMinPixel) * dfInvPixel);
+        const GUIntBig nY = static_cast<GUIntBig>(
+            (pasGCPList[i].dfGCPLine - dfMinLine) * dfInvLine);
+        asMortonIdx[i] = {SpreadBits(nX) | (SpreadBits(nY) << 1), i};
+    }
+    std::sort(asMortonIdx.begin(), asMortonIdx.end());
+
+    CPLStringList aosSubOptions(papszOptions);
+    aosSubOptions.SetNameValue("MAX_GCPS", nullptr);
+    aosSubOptions.SetNameValue("APPROX_TARGET_ERROR", nullptr);
+
+    int nSubsetCount =
+        nMaxGCPs > 0 ? std::min(nMaxGCPs, nGCPCount) : std::min(1000, nGCPCount);
+
+    while (true)
+    {
+        if (nSubsetCount >= nGCPCount)
+        {
+            return GDALCreateTPSTransformerInt(nGCPCount, pasGCPList,
+                                               bReversed, aosSubOptions.List());
+        }
+
+        std::vector<GDAL_GCP> asSubset;
+        std::vector<bool> abSelected(nGCPCount, false);
+        asSubset.reserve(nSubsetCount);
+        for (int i = 0; i < nSubsetCount; ++i)
+        {
+            const int iGCP =
+                asMortonIdx[static_cast<size_t>(i) * nGCPCount / nSubsetCount]
+                    .second;
+            asSubset.push_back(pasGCPList[iGCP]);
+            abSelected[iGCP] = true;
+        }
+
+        void *psTPS = GDALCreateTPSTransformerInt(
+            static_cast<int>(asSubset.size()), asSubset.data(), bReversed,
+            aosSubOptions.List());
+        if (psTPS == nullptr || dfTargetError <= 0)
+        {
+            if (psTPS)
+                CPLDebug("TPS", "Approximate TPS built on %d of %d GCPs",
+                         static_cast<int>(asSubset.size()), nGCPCount);
+            return psTPS;
+        }
+
+        // Measure the residuals at the GCPs left out
+        double dfMaxError = 0;
+        for (int i = 0; i < nGCPCount && dfMaxError <= dfTargetError; ++i)
+        {
+            if (abSelected[i])
+                continue;
+            double dfX = bReversed ? pasGCPList[i].dfGCPX
+                                   : pasGCPList[i].dfGCPPixel;
+            double dfY = bReversed ? pasGCPList[i].dfGCPY
+                                   : pasGCPList[i].dfGCPLine;
+            double dfZ = 0;
+            int nSuccess = FALSE;
+            if (GDALTPSTransform(psTPS, FALSE, 1, &dfX, &dfY, &dfZ,
+                                 &nSuccess) &&
+                nSuccess)
+            {
+                const double dfExpectedX = bReversed
+                                               ? pasGCPList[i].dfGCPPixel
+                                               : pasGCPList[i].dfGCPX;
+                const double dfExpectedY = bReversed
+                                               ? pasGCPList[i].dfGCPLine
+                                               : pasGCPList[i].dfGCPY;
+                dfMaxError = std::max(
+                    dfMaxError, std::max(std::fabs(dfX - dfExpectedX),
+                                         std::fabs(dfY - dfExpectedY)));
+            }
+        }
+        if (dfMaxError <= dfTargetError)
+        {
+            CPLDebug("TPS",
+                     "Approximate TPS built on %d of %d GCPs "
+                     "(max residual %.3g <= %.3g)",
+                     static_cast<int>(asSubset.size()), nGCPCount, dfMaxError,
+                     dfTargetError);
+            return psTPS;
+        }
+
+        GDALDestroyTPSTransformer(psTPS);
+        nSubsetCount = std::min(nGCPCount, nSubsetCount * 2);
+    }
+}
+
 void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
                                   int bReversed, CSLConstList papszOptions)
 
 {
+    /* -------------------------------------------------------------------- */
+    /*      Approximate mode for very large GCP sets (see                   */
+    /*      GDALCreateTPSTransformerApprox()). MAX_GCPS caps the number of  */
+    /*      GCPs of the dense solve; APPROX_TARGET_ERROR (in units of the   */
+    /*      forward output space) additionally validates the residuals at   */
+    /*      the unused GCPs and enlarges the subset as needed.              */
+    /* -------------------------------------------------------------------- */
+    {
+        const int nMaxGCPs =
+            atoi(CSLFetchNameValueDef(papszOptions, "MAX_GCPS", "0"));
+        const double dfTargetError = CPLAtof(
+            CSLFetchNameValueDef(papszOptions, "APPROX_TARGET_ERROR", "0"));
+        if (nGCPCount > 4 &&
+            ((nMaxGCPs > 0 && nGCPCount > nMaxGCPs) ||
+             (dfTargetError > 0 && nGCPCount > 1000)))
+        {
+            return GDALCreateTPSTransformerApprox(nGCPCount, pasGCPList,
+                                                  bReversed, papszOptions,
+                                                  nMaxGCPs, dfTargetError);
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate transform info.                                        */
     /* -------------------------------------------------------------------- */
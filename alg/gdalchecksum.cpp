@@ -269,8 +269,24 @@ int CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff, int nYOff,
             }
         }
 
-        int *panChunkData = static_cast<GInt32 *>(
-            VSI_MALLOC3_VERBOSE(nChunkXSize, nChunkYSize, nDstDataTypeSize));
+        // For Byte data, read natively and replace the per-value modulo
+        // with an 11 x 256 lookup table: four times less memory traffic
+        // and no integer division in the hot loop, for bit-identical
+        // checksums.
+        const bool bByteFastPath = eDataType == GDT_UInt8 && !bComplex;
+        GByte aabyByteMod[11][256];
+        if (bByteFastPath)
+        {
+            for (int iP = 0; iP < 11; ++iP)
+            {
+                for (int nVal = 0; nVal < 256; ++nVal)
+                    aabyByteMod[iP][nVal] =
+                        static_cast<GByte>(nVal % anPrimes[iP]);
+            }
+        }
+
+        int *panChunkData = static_cast<GInt32 *>(VSI_MALLOC3_VERBOSE(
+            nChunkXSize, nChunkYSize, bByteFastPath ? 1 : nDstDataTypeSize));
         if (panChunkData == nullptr)
         {
             return -1;
@@ -291,10 +307,12 @@ int CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff, int nYOff,
                 const int iXEnd =
                     iXBlock == nXBlocks - 1 ? nXSize : iXStart + nChunkXSize;
                 const int nChunkActualXSize = iXEnd - iXStart;
-                if (GDALRasterIO(
-                        hBand, GF_Read, iXStart, iYStart, nChunkActualXSize,
-                        nChunkActualHeight, panChunkData, nChunkActualXSize,
-                        nChunkActualHeight, eDstDataType, 0, 0) != CE_None)
+                if (GDALRasterIO(hBand, GF_Read, iXStart, iYStart,
+                                 nChunkActualXSize, nChunkActualHeight,
+                                 panChunkData, nChunkActualXSize,
+                                 nChunkActualHeight,
+                                 bByteFastPath ? GDT_UInt8 : eDstDataType, 0,
+                                 0) != CE_None)
                 {
                     CPLError(CE_Failure, CPLE_FileIO,
                              "Checksum value could not be computed due to I/O "
@@ -314,14 +332,35 @@ int CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff, int nYOff,
                     const size_t nOffset = nValsPerIter *
                                            static_cast<size_t>(iY - iYStart) *
                                            nChunkActualXSize;
-                    for (size_t i = 0; i < xIters; ++i)
+                    if (bByteFastPath)
                     {
-                        nChecksum +=
-                            panChunkData[nOffset + i] % anPrimes[iPrime++];
-                        if (iPrime > 10)
-                            iPrime = 0;
+                        // The row total is masked to 16 bit below, and
+                        // addition order within the row does not matter.
+                        const GByte *pabyData =
+                            reinterpret_cast<const GByte *>(panChunkData) +
+                            nOffset;
+                        uint64_t nRowSum = 0;
+                        for (size_t i = 0; i < xIters; ++i)
+                        {
+                            nRowSum += aabyByteMod[iPrime++][pabyData[i]];
+                            if (iPrime > 10)
+                                iPrime = 0;
+                        }
+                        nChecksum = static_cast<int>(
+                            (static_cast<uint64_t>(nChecksum) + nRowSum) &
+                            0xffff);
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < xIters; ++i)
+                        {
+                            nChecksum +=
+                                panChunkData[nOffset + i] % anPrimes[iPrime++];
+                            if (iPrime > 10)
+                                iPrime = 0;
+                        }
+                        nChecksum &= 0xffff;
                     }
-                    nChecksum &= 0xffff;
                 }
             }
 
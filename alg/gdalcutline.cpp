@@ -12,6 +12,12 @@
  ****************************************************************************/
 
 #include "cpl_port.h"
+#include <list>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <map>
+#include <memory>
 #include "gdalwarper.h"
 
 #include <cmath>
@@ -21,6 +27,7 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_md5.h"
 #include "cpl_string.h"
 #include "gdal.h"
 #include "gdal_alg.h"
@@ -337,37 +344,167 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
     /* -------------------------------------------------------------------- */
     GByte *pabyPolyMask = static_cast<GByte *>(CPLCalloc(nXSize, nYSize));
 
-    auto poMEMDS =
-        MEMDataset::Create("warp_temp", nXSize, nYSize, 0, GDT_UInt8, nullptr);
-    GDALRasterBandH hMEMBand =
-        MEMCreateRasterBandEx(poMEMDS, 1, pabyPolyMask, GDT_UInt8, 0, 0, false);
-    poMEMDS->AddMEMBand(hMEMBand);
-
-    GDALDatasetH hMemDS = GDALDataset::ToHandle(poMEMDS);
-    double adfGeoTransform[6] = {0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
-    GDALSetGeoTransform(hMemDS, adfGeoTransform);
+    const bool bAllTouched =
+        CPLFetchBool(psWO->papszWarpOptions, "CUTLINE_ALL_TOUCHED", false);
 
     /* -------------------------------------------------------------------- */
-    /*      Burn the polygon into the mask with 1.0 values.                 */
+    /*      Rasterizing a multi-million vertex cutline costs the same for   */
+    /*      every chunk; tile servers reading a warped VRT rasterize the    */
+    /*      same chunks again and again. Cache the most recent rasterized   */
+    /*      chunk masks, keyed on the chunk extent and a digest of the      */
+    /*      cutline WKB (an address-based key could alias two successive    */
+    /*      cutlines allocated at the same address), and bounded in bytes   */
+    /*      by GDAL_CUTLINE_MASK_CACHE_SIZE.                                */
     /* -------------------------------------------------------------------- */
-    int nTargetBand = 1;
-    double dfBurnValue = 255.0;
-    char **papszRasterizeOptions = nullptr;
+    static std::mutex goMaskCacheMutex;
+    struct CutlineMaskCache
+    {
+        typedef std::pair<std::string, std::shared_ptr<std::vector<GByte>>>
+            Entry;
+        std::list<Entry> oLRU{};
+        std::map<std::string, std::list<Entry>::iterator> oMap{};
+        GIntBig nUsed = 0;
+    };
+    static CutlineMaskCache goMaskCache;
+    GIntBig nMaskCacheBudget = 0;
+    if (CPLTestBool(CPLGetConfigOption("GDAL_CUTLINE_MASK_CACHE", "YES")))
+    {
+        CPL_IGNORE_RET_VAL(CPLParseMemorySize(
+            CPLGetConfigOption("GDAL_CUTLINE_MASK_CACHE_SIZE", "64MB"),
+            &nMaskCacheBudget, nullptr));
+    }
+    const bool bUseMaskCache =
+        nMaskCacheBudget > 0 &&
+        static_cast<GIntBig>(nXSize) * nYSize <= nMaskCacheBudget;
+    std::string osCacheKey;
+    bool bMaskFromCache = false;
+    if (bUseMaskCache)
+    {
+        // Digest of the cutline content: exporting the WKB is much cheaper
+        // than rasterizing it.
+        const size_t nWkbSize = OGR_G_WkbSizeEx(hPolygon);
+        std::vector<GByte> abyWkb;
+        try
+        {
+            abyWkb.resize(nWkbSize);
+        }
+        catch (const std::exception &)
+        {
+            abyWkb.clear();
+        }
+        if (!abyWkb.empty() &&
+            OGR_G_ExportToWkb(hPolygon, wkbNDR, abyWkb.data()) == OGRERR_NONE)
+        {
+            struct CPLMD5Context sContext;
+            CPLMD5Init(&sContext);
+            CPLMD5Update(&sContext, abyWkb.data(), abyWkb.size());
+            unsigned char abyDigest[16];
+            CPLMD5Final(abyDigest, &sContext);
+            std::string osDigest;
+            for (unsigned char byVal : abyDigest)
+                osDigest += CPLSPrintf("%02x", byVal);
+            osCacheKey = osDigest;
+            osCacheKey += CPLSPrintf(
+                "_%.17g_%.17g_%.17g_%.17g_%d_%d_%d_%d_%.17g_%d",
+                sEnvelope.MinX, sEnvelope.MinY, sEnvelope.MaxX, sEnvelope.MaxY,
+                nXOff, nYOff, nXSize, nYSize, psWO->dfCutlineBlendDist,
+                bAllTouched ? 1 : 0);
+        }
+    }
+    if (!osCacheKey.empty())
+    {
+        std::lock_guard<std::mutex> oLock(goMaskCacheMutex);
+        const auto oIter = goMaskCache.oMap.find(osCacheKey);
+        if (oIter != goMaskCache.oMap.end() &&
+            oIter->second->second->size() ==
+                static_cast<size_t>(nXSize) * nYSize)
+        {
+            goMaskCache.oLRU.splice(goMaskCache.oLRU.begin(), goMaskCache.oLRU,
+                                    oIter->second);
+            memcpy(pabyPolyMask, oIter->second->second->data(),
+                   oIter->second->second->size());
+            bMaskFromCache = true;
+        }
+    }
+
+    CPLErr eErr = CE_None;
+    if (!bMaskFromCache)
+    {
+        auto poMEMDS = MEMDataset::Create("warp_temp", nXSize, nYSize, 0,
+                                          GDT_UInt8, nullptr);
+        GDALRasterBandH hMEMBand = MEMCreateRasterBandEx(
+            poMEMDS, 1, pabyPolyMask, GDT_UInt8, 0, 0, false);
+        poMEMDS->AddMEMBand(hMEMBand);
+
+        GDALDatasetH hMemDS = GDALDataset::ToHandle(poMEMDS);
+        double adfGeoTransform[6] = {0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+        GDALSetGeoTransform(hMemDS, adfGeoTransform);
+
+        /* ---------------------------------------------------------------- */
+        /*      Burn the polygon into the mask with 1.0 values.             */
+        /* ---------------------------------------------------------------- */
+        int nTargetBand = 1;
+        double dfBurnValue = 255.0;
+        char **papszRasterizeOptions = nullptr;
+
+        if (bAllTouched)
+            papszRasterizeOptions =
+                CSLSetNameValue(papszRasterizeOptions, "ALL_TOUCHED", "TRUE");
 
-    if (CPLFetchBool(psWO->papszWarpOptions, "CUTLINE_ALL_TOUCHED", false))
-        papszRasterizeOptions =
-            CSLSetNameValue(papszRasterizeOptions, "ALL_TOUCHED", "TRUE");
+        int anXYOff[2] = {nXOff, nYOff};
 
-    int anXYOff[2] = {nXOff, nYOff};
+        eErr = GDALRasterizeGeometries(
+            hMemDS, 1, &nTargetBand, 1, &hPolygon, CutlineTransformer, anXYOff,
+            &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
 
-    CPLErr eErr = GDALRasterizeGeometries(
-        hMemDS, 1, &nTargetBand, 1, &hPolygon, CutlineTransformer, anXYOff,
-        &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
+        CSLDestroy(papszRasterizeOptions);
 
-    CSLDestroy(papszRasterizeOptions);
+        // Close and ensure data flushed to underlying array.
+        GDALClose(hMemDS);
 
-    // Close and ensure data flushed to underlying array.
-    GDALClose(hMemDS);
+        if (!osCacheKey.empty() && eErr == CE_None)
+        {
+            try
+            {
+                auto poCached = std::make_shared<std::vector<GByte>>(
+                    pabyPolyMask,
+                    pabyPolyMask + static_cast<size_t>(nXSize) * nYSize);
+                const GIntBig nSize =
+                    static_cast<GIntBig>(poCached->size());
+                std::lock_guard<std::mutex> oLock(goMaskCacheMutex);
+                const auto oIter = goMaskCache.oMap.find(osCacheKey);
+                if (oIter != goMaskCache.oMap.end())
+                {
+                    goMaskCache.nUsed -= static_cast<GIntBig>(
+                        oIter->second->second->size());
+                    oIter->second->second = std::move(poCached);
+                    goMaskCache.nUsed += nSize;
+                    goMaskCache.oLRU.splice(goMaskCache.oLRU.begin(),
+                                            goMaskCache.oLRU, oIter->second);
+                }
+                else
+                {
+                    goMaskCache.oLRU.emplace_front(osCacheKey,
+                                                   std::move(poCached));
+                    goMaskCache.oMap[osCacheKey] = goMaskCache.oLRU.begin();
+                    goMaskCache.nUsed += nSize;
+                }
+                while (goMaskCache.nUsed > nMaskCacheBudget &&
+                       goMaskCache.oLRU.size() > 1)
+                {
+                    const auto &oBack = goMaskCache.oLRU.back();
+                    goMaskCache.nUsed -=
+                        static_cast<GIntBig>(oBack.second->size());
+                    goMaskCache.oMap.erase(oBack.first);
+                    goMaskCache.oLRU.pop_back();
+                }
+            }
+            catch (const std::exception &)
+            {
+                // ignore: cache is best effort
+            }
+        }
+    }
 
     /* -------------------------------------------------------------------- */
     /*      In the case with no blend distance, we just apply this as a     */
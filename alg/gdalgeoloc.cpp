@@ -1015,11 +1015,213 @@ void GDALInverseBilinearInterpolation(const double x, const double y,
 
 /*! @cond Doxygen_Suppress */
 
+/************************************************************************/
+/*                       Backmap persistence                            */
+/*                                                                      */
+/*      When the GDAL_GEOLOC_BACKMAP_CACHE_FILE configuration option    */
+/*      names a file, the computed backmap is stored there, and later   */
+/*      transformer constructions on the same geolocation array load    */
+/*      it instead of re-rasterizing the whole grid. The header         */
+/*      records the parameters the backmap depends on, and loading is   */
+/*      refused on any mismatch; keeping the cache in sync with the     */
+/*      product is the caller's responsibility.                         */
+/************************************************************************/
+
+namespace
+{
+struct GDALGeoLocBackMapCacheHeader
+{
+    char szMagic[8];  // "GLBMAP1 "
+    int nGeoLocXSize;
+    int nGeoLocYSize;
+    int nBackMapWidth;
+    int nBackMapHeight;
+    int bOriginIsTopLeftCorner;
+    int nPadding;
+    double dfPIXEL_OFFSET;
+    double dfPIXEL_STEP;
+    double dfLINE_OFFSET;
+    double dfLINE_STEP;
+    double dfOversampleFactor;
+    double adfBackMapGeoTransform[6];
+    // Geolocation content fingerprint: X/Y values of the four corners,
+    // so that two same-sized geolocation arrays do not reuse each other's
+    // cached backmap.
+    double adfCornerFingerprint[8];
+};
+}  // namespace
+
+constexpr const char *GLBMAP_MAGIC = "GLBMAP1";
+
+template <class Accessors>
+static void GDALGeoLocComputeCornerFingerprint(
+    const GDALGeoLocTransformInfo *psTransform, double *padfFingerprint)
+{
+    auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+    const int nXLast = psTransform->nGeoLocXSize - 1;
+    const int nYLast = psTransform->nGeoLocYSize - 1;
+    const int anX[4] = {0, nXLast, 0, nXLast};
+    const int anY[4] = {0, 0, nYLast, nYLast};
+    for (int i = 0; i < 4; ++i)
+    {
+        padfFingerprint[2 * i] = pAccessors->geolocXAccessor.Get(anX[i], anY[i]);
+        padfFingerprint[2 * i + 1] =
+            pAccessors->geolocYAccessor.Get(anX[i], anY[i]);
+    }
+}
+
+template <class Accessors>
+bool GDALGeoLoc<Accessors>::LoadBackMapFromCache(
+    GDALGeoLocTransformInfo *psTransform)
+{
+    const char *pszCacheFile =
+        CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_CACHE_FILE", nullptr);
+    if (pszCacheFile == nullptr)
+        return false;
+
+    VSILFILE *fp = VSIFOpenL(pszCacheFile, "rb");
+    if (fp == nullptr)
+        return false;
+
+    bool bOK = false;
+    GDALGeoLocBackMapCacheHeader sHeader;
+    if (VSIFReadL(&sHeader, 1, sizeof(sHeader), fp) == sizeof(sHeader) &&
+        memcmp(sHeader.szMagic, GLBMAP_MAGIC, 8) == 0 &&
+        sHeader.nGeoLocXSize == psTransform->nGeoLocXSize &&
+        sHeader.nGeoLocYSize == psTransform->nGeoLocYSize &&
+        sHeader.nBackMapWidth > 0 && sHeader.nBackMapHeight > 0 &&
+        sHeader.bOriginIsTopLeftCorner ==
+            static_cast<int>(psTransform->bOriginIsTopLeftCorner) &&
+        sHeader.dfPIXEL_OFFSET == psTransform->dfPIXEL_OFFSET &&
+        sHeader.dfPIXEL_STEP == psTransform->dfPIXEL_STEP &&
+        sHeader.dfLINE_OFFSET == psTransform->dfLINE_OFFSET &&
+        sHeader.dfLINE_STEP == psTransform->dfLINE_STEP &&
+        sHeader.dfOversampleFactor == psTransform->dfOversampleFactor)
+    {
+        double adfFingerprint[8];
+        GDALGeoLocComputeCornerFingerprint<Accessors>(psTransform,
+                                                      adfFingerprint);
+        if (memcmp(adfFingerprint, sHeader.adfCornerFingerprint,
+                   sizeof(adfFingerprint)) != 0)
+        {
+            CPLDebug("GEOLOC",
+                     "Backmap cache %s does not match this geolocation "
+                     "array: ignoring it",
+                     pszCacheFile);
+            CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+            return false;
+        }
+        psTransform->nBackMapWidth = sHeader.nBackMapWidth;
+        psTransform->nBackMapHeight = sHeader.nBackMapHeight;
+        memcpy(psTransform->adfBackMapGeoTransform,
+               sHeader.adfBackMapGeoTransform, sizeof(double) * 6);
+
+        auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+        if (pAccessors->AllocateBackMap())
+        {
+            bOK = true;
+            std::vector<float> afRow(sHeader.nBackMapWidth);
+            for (int iPass = 0; iPass < 2 && bOK; ++iPass)
+            {
+                for (int iY = 0; bOK && iY < sHeader.nBackMapHeight; ++iY)
+                {
+                    bOK = VSIFReadL(afRow.data(), sizeof(float),
+                                    afRow.size(),
+                                    fp) == afRow.size();
+                    for (int iX = 0; bOK && iX < sHeader.nBackMapWidth; ++iX)
+                    {
+                        if (iPass == 0)
+                            pAccessors->backMapXAccessor.Set(iX, iY,
+                                                             afRow[iX]);
+                        else
+                            pAccessors->backMapYAccessor.Set(iX, iY,
+                                                             afRow[iX]);
+                    }
+                }
+            }
+            pAccessors->FreeWghtsBackMap();
+        }
+    }
+    CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+    if (bOK)
+        CPLDebug("GEOLOC", "Backmap loaded from %s", pszCacheFile);
+    return bOK;
+}
+
+template <class Accessors>
+void GDALGeoLoc<Accessors>::SaveBackMapToCache(
+    const GDALGeoLocTransformInfo *psTransform)
+{
+    const char *pszCacheFile =
+        CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_CACHE_FILE", nullptr);
+    if (pszCacheFile == nullptr)
+        return;
+
+    VSILFILE *fp = VSIFOpenL(pszCacheFile, "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Warning, CPLE_FileIO,
+                 "Cannot create backmap cache file %s", pszCacheFile);
+        return;
+    }
+
+    GDALGeoLocBackMapCacheHeader sHeader;
+    memset(&sHeader, 0, sizeof(sHeader));
+    memcpy(sHeader.szMagic, GLBMAP_MAGIC, 8);
+    sHeader.nGeoLocXSize = psTransform->nGeoLocXSize;
+    sHeader.nGeoLocYSize = psTransform->nGeoLocYSize;
+    sHeader.nBackMapWidth = psTransform->nBackMapWidth;
+    sHeader.nBackMapHeight = psTransform->nBackMapHeight;
+    sHeader.bOriginIsTopLeftCorner =
+        static_cast<int>(psTransform->bOriginIsTopLeftCorner);
+    sHeader.dfPIXEL_OFFSET = psTransform->dfPIXEL_OFFSET;
+    sHeader.dfPIXEL_STEP = psTransform->dfPIXEL_STEP;
+    sHeader.dfLINE_OFFSET = psTransform->dfLINE_OFFSET;
+    sHeader.dfLINE_STEP = psTransform->dfLINE_STEP;
+    sHeader.dfOversampleFactor = psTransform->dfOversampleFactor;
+    memcpy(sHeader.adfBackMapGeoTransform,
+           psTransform->adfBackMapGeoTransform, sizeof(double) * 6);
+    GDALGeoLocComputeCornerFingerprint<Accessors>(
+        psTransform, sHeader.adfCornerFingerprint);
+
+    bool bOK = VSIFWriteL(&sHeader, 1, sizeof(sHeader), fp) == sizeof(sHeader);
+
+    auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+    std::vector<float> afRow(psTransform->nBackMapWidth);
+    for (int iPass = 0; iPass < 2 && bOK; ++iPass)
+    {
+        for (int iY = 0; bOK && iY < psTransform->nBackMapHeight; ++iY)
+        {
+            for (int iX = 0; iX < psTransform->nBackMapWidth; ++iX)
+            {
+                afRow[iX] = iPass == 0
+                                ? pAccessors->backMapXAccessor.Get(iX, iY)
+                                : pAccessors->backMapYAccessor.Get(iX, iY);
+            }
+            bOK = VSIFWriteL(afRow.data(), sizeof(float), afRow.size(), fp) ==
+                  afRow.size();
+        }
+    }
+    if (VSIFCloseL(fp) != 0 || !bOK)
+    {
+        CPLError(CE_Warning, CPLE_FileIO,
+                 "Error while writing backmap cache file %s", pszCacheFile);
+        VSIUnlink(pszCacheFile);
+    }
+    else
+    {
+        CPLDebug("GEOLOC", "Backmap saved to %s", pszCacheFile);
+    }
+}
+
 template <class Accessors>
 bool GDALGeoLoc<Accessors>::GenerateBackMap(
     GDALGeoLocTransformInfo *psTransform)
 
 {
+    if (LoadBackMapFromCache(psTransform))
+        return true;
+
     CPLDebug("GEOLOC", "Starting backmap generation");
     const int nXSize = psTransform->nGeoLocXSize;
     const int nYSize = psTransform->nGeoLocYSize;
@@ -1582,6 +1784,8 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
     pAccessors->ReleaseBackmapDataset(poBackmapDS);
     CPLDebug("GEOLOC", "Ending backmap generation");
 
+    SaveBackMapToCache(psTransform);
+
     return true;
 }
 
@@ -27,6 +27,9 @@ template <class Accessors> struct GDALGeoLoc
 
     static bool GenerateBackMap(GDALGeoLocTransformInfo *psTransform);
 
+    static bool LoadBackMapFromCache(GDALGeoLocTransformInfo *psTransform);
+    static void SaveBackMapToCache(const GDALGeoLocTransformInfo *psTransform);
+
     static bool PixelLineToXY(const GDALGeoLocTransformInfo *psTransform,
                               const int nGeoLocPixel, const int nGeoLocLine,
                               double &dfX, double &dfY);
@@ -18,6 +18,7 @@
 #include <cfloat>
 #include <climits>
 #include <cmath>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 
@@ -40,6 +41,25 @@
 
 constexpr double TO_RADIANS = M_PI / 180.0;
 
+namespace
+{
+/* Reused buffer for CPLQuadTreeSearchBuffered(): one search happens per
+ * output cell, and allocating/freeing a result array each time is
+ * measurable on large grids. */
+struct QuadTreeSearchBuffer
+{
+    void **pBuffer = nullptr;
+    int nSize = 0;
+
+    ~QuadTreeSearchBuffer()
+    {
+        CPLFree(pBuffer);
+    }
+};
+}  // namespace
+
+static thread_local QuadTreeSearchBuffer goQuadTreeSearchBuffer;
+
 /************************************************************************/
 /*                       GDALGridGetPointBounds()                       */
 /************************************************************************/
@@ -274,7 +294,9 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                  &goQuadTreeSearchBuffer.pBuffer,
+                                  &goQuadTreeSearchBuffer.nSize));
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
@@ -289,7 +311,6 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
             if (dfRsmoothed2 < 0.0000000000001)
             {
                 *pdfValue = padfZ[i];
-                CPLFree(papsPoints);
                 return CE_None;
             }
             // is point within real distance?
@@ -300,7 +321,6 @@ CPLErr GDALGridInverseDistanceToAPowerNearestNeighbor(
             }
         }
     }
-    CPLFree(papsPoints);
 
     double dfNominator = 0.0;
     double dfDenominator = 0.0;
@@ -382,7 +402,9 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                  &goQuadTreeSearchBuffer.pBuffer,
+                                  &goQuadTreeSearchBuffer.nSize));
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
@@ -397,7 +419,6 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
             if (dfRsmoothed2 < 0.0000000000001)
             {
                 *pdfValue = padfZ[i];
-                CPLFree(papsPoints);
                 return CE_None;
             }
             // is point within real distance?
@@ -410,7 +431,6 @@ static CPLErr GDALGridInverseDistanceToAPowerNearestNeighborPerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -668,7 +688,9 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                      &goQuadTreeSearchBuffer.pBuffer,
+                                      &goQuadTreeSearchBuffer.nSize));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -696,7 +718,6 @@ CPLErr GDALGridMovingAverage(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -780,7 +801,9 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                  &goQuadTreeSearchBuffer.pBuffer,
+                                  &goQuadTreeSearchBuffer.nSize));
     if (nFeatureCount != 0)
     {
         for (int k = 0; k < nFeatureCount; k++)
@@ -810,7 +833,6 @@ static CPLErr GDALGridMovingAveragePerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -946,7 +968,9 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
             sAoi.maxy = dfYPoint + dfSearchRadius;
             int nFeatureCount = 0;
             GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-                CPLQuadTreeSearch(hQuadTree, &sAoi, &nFeatureCount));
+                CPLQuadTreeSearchBuffered(hQuadTree, &sAoi, &nFeatureCount,
+                                          &goQuadTreeSearchBuffer.pBuffer,
+                                          &goQuadTreeSearchBuffer.nSize));
             if (nFeatureCount != 0)
             {
                 // Nearest distance will be initialized with the distance to the
@@ -965,12 +989,9 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
                         dfNearestValue = padfZ[idx];
                     }
                 }
-
-                CPLFree(papsPoints);
                 break;
             }
 
-            CPLFree(papsPoints);
             if (poOptions->dfRadius1 > 0 || poOptions->dfRadius2 > 0)
                 break;
             dfSearchRadius *= 2;
@@ -1096,7 +1117,9 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                      &goQuadTreeSearchBuffer.pBuffer,
+                                      &goQuadTreeSearchBuffer.nSize));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1125,7 +1148,6 @@ CPLErr GDALGridDataMetricMinimum(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -1215,7 +1237,9 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                  &goQuadTreeSearchBuffer.pBuffer,
+                                  &goQuadTreeSearchBuffer.nSize));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -1247,7 +1271,6 @@ static CPLErr GDALGridDataMetricMinimumOrMaximumPerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -1415,7 +1438,9 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                      &goQuadTreeSearchBuffer.pBuffer,
+                                      &goQuadTreeSearchBuffer.nSize));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1444,7 +1469,6 @@ CPLErr GDALGridDataMetricMaximum(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -1582,7 +1606,9 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                      &goQuadTreeSearchBuffer.pBuffer,
+                                      &goQuadTreeSearchBuffer.nSize));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1613,7 +1639,6 @@ CPLErr GDALGridDataMetricRange(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -1703,7 +1728,9 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                  &goQuadTreeSearchBuffer.pBuffer,
+                                  &goQuadTreeSearchBuffer.nSize));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -1735,7 +1762,6 @@ static CPLErr GDALGridDataMetricRangePerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -1877,7 +1903,9 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                      &goQuadTreeSearchBuffer.pBuffer,
+                                      &goQuadTreeSearchBuffer.nSize));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -1904,7 +1932,6 @@ CPLErr GDALGridDataMetricCount(const void *poOptionsIn, GUInt32 nPoints,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -1990,7 +2017,9 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                  &goQuadTreeSearchBuffer.pBuffer,
+                                  &goQuadTreeSearchBuffer.nSize));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -2022,7 +2051,6 @@ static CPLErr GDALGridDataMetricCountPerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -2163,7 +2191,9 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                      &goQuadTreeSearchBuffer.pBuffer,
+                                      &goQuadTreeSearchBuffer.nSize));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount; k++)
@@ -2191,7 +2221,6 @@ CPLErr GDALGridDataMetricAverageDistance(const void *poOptionsIn,
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -2279,7 +2308,9 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
     sAoi.maxy = dfYPoint + dfSearchRadius;
     int nFeatureCount = 0;
     GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-        CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+        CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                  &goQuadTreeSearchBuffer.pBuffer,
+                                  &goQuadTreeSearchBuffer.nSize));
     std::multimap<double, double> oMapDistanceToZValuesPerQuadrant[4];
 
     if (nFeatureCount != 0)
@@ -2311,7 +2342,6 @@ static CPLErr GDALGridDataMetricAverageDistancePerQuadrant(
             }
         }
     }
-    CPLFree(papsPoints);
 
     std::multimap<double, double>::iterator aoIter[] = {
         oMapDistanceToZValuesPerQuadrant[0].begin(),
@@ -2454,7 +2484,9 @@ CPLErr GDALGridDataMetricAverageDistancePts(
         sAoi.maxy = dfYPoint + dfSearchRadius;
         int nFeatureCount = 0;
         GDALGridPoint **papsPoints = reinterpret_cast<GDALGridPoint **>(
-            CPLQuadTreeSearch(phQuadTree, &sAoi, &nFeatureCount));
+            CPLQuadTreeSearchBuffered(phQuadTree, &sAoi, &nFeatureCount,
+                                      &goQuadTreeSearchBuffer.pBuffer,
+                                      &goQuadTreeSearchBuffer.nSize));
         if (nFeatureCount != 0)
         {
             for (int k = 0; k < nFeatureCount - 1; k++)
@@ -2489,7 +2521,6 @@ CPLErr GDALGridDataMetricAverageDistancePts(
                 }
             }
         }
-        CPLFree(papsPoints);
     }
     else
     {
@@ -2676,6 +2707,12 @@ struct _GDALGridJob
 {
     GUInt32 nYStart;
 
+    // When not null, rows are distributed dynamically by atomically
+    // incrementing this shared counter (work stealing), instead of the
+    // static nYStart/nYStep interleaving: point density varies wildly
+    // across typical LiDAR extents, and a static split straggles.
+    std::atomic<GUInt32> *pnRowCounter;
+
     GByte *pabyData;
     GUInt32 nYStep;
     GUInt32 nXSize;
@@ -2786,7 +2823,9 @@ static void GDALGridJobProcess(void *user_data)
     const int nDataTypeSize = GDALGetDataTypeSizeBytes(eType);
     const int nLineSpace = nXSize * nDataTypeSize;
 
-    for (GUInt32 nYPoint = nYStart; nYPoint < nYSize; nYPoint += nYStep)
+    std::atomic<GUInt32> *pnRowCounter = psJob->pnRowCounter;
+
+    const auto ProcessRow = [&](GUInt32 nYPoint)
     {
         const double dfYPoint = dfYMin + (nYPoint + 0.5) * dfDeltaY;
 
@@ -2813,8 +2852,27 @@ static void GDALGridJobProcess(void *user_data)
                       pabyData + nYPoint * nLineSpace, eType, nDataTypeSize,
                       nXSize);
 
-        if (*psJob->pbStop || (pfnProgress != nullptr && pfnProgress(psJob)))
-            break;
+        return !(*psJob->pbStop ||
+                 (pfnProgress != nullptr && pfnProgress(psJob)));
+    };
+
+    if (pnRowCounter != nullptr)
+    {
+        while (true)
+        {
+            const GUInt32 nYPoint =
+                pnRowCounter->fetch_add(1, std::memory_order_relaxed);
+            if (nYPoint >= nYSize || !ProcessRow(nYPoint))
+                break;
+        }
+    }
+    else
+    {
+        for (GUInt32 nYPoint = nYStart; nYPoint < nYSize; nYPoint += nYStep)
+        {
+            if (!ProcessRow(nYPoint))
+                break;
+        }
     }
 
     CPLFree(padfValues);
@@ -3608,8 +3666,10 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
 
     int nCounter = 0;
     volatile int bStop = FALSE;
+    std::atomic<GUInt32> oRowCounter{0};
     GDALGridJob sJob;
     sJob.nYStart = 0;
+    sJob.pnRowCounter = nullptr;
     sJob.pabyData = static_cast<GByte *>(pData);
     sJob.nYStep = 1;
     sJob.nXSize = nXSize;
@@ -3652,6 +3712,7 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
             CPLMalloc(sizeof(GDALGridJob) * nThreads));
 
         sJob.nYStep = nThreads;
+        sJob.pnRowCounter = &oRowCounter;
         sJob.hCondMutex = CPLCreateMutex(); /* and  implicitly take the mutex */
         sJob.hCond = CPLCreateCond();
         sJob.pfnProgress = GDALGridProgressMultiThread;
@@ -450,12 +450,21 @@ int GDALComputeMedianCutPCTInternal(
     GByte anGreen[256] = {};
     GByte anBlue[256] = {};
 
-    GByte *pabyRedLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
-    GByte *pabyGreenLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
-    GByte *pabyBlueLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
+    // Read strips of several scanlines per RasterIO call: the per-call
+    // overhead of four band reads per line dominates on large images.
+    const int nLinesAtOnce = std::max(
+        1, std::min(nYSize, 10 * 1000 * 1000 / std::max(1, nXSize)));
+
+    GByte *pabyRedLine = static_cast<GByte *>(
+        VSI_MALLOC2_VERBOSE(nXSize, nLinesAtOnce));
+    GByte *pabyGreenLine = static_cast<GByte *>(
+        VSI_MALLOC2_VERBOSE(nXSize, nLinesAtOnce));
+    GByte *pabyBlueLine = static_cast<GByte *>(
+        VSI_MALLOC2_VERBOSE(nXSize, nLinesAtOnce));
     std::unique_ptr<GByte, VSIFreeReleaser> pabyMask;
     if (hMaskBand)
-        pabyMask.reset(static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize)));
+        pabyMask.reset(static_cast<GByte *>(
+            VSI_MALLOC2_VERBOSE(nXSize, nLinesAtOnce)));
 
     if (pabyRedLine == nullptr || pabyGreenLine == nullptr ||
         pabyBlueLine == nullptr || (hMaskBand && !pabyMask))
@@ -464,7 +473,7 @@ int GDALComputeMedianCutPCTInternal(
         goto end_and_cleanup;
     }
 
-    for (int iLine = 0; iLine < nYSize; iLine++)
+    for (int iLine = 0; iLine < nYSize; iLine += nLinesAtOnce)
     {
         if (!pfnProgress(iLine / static_cast<double>(nYSize),
                          "Generating Histogram", pProgressArg))
@@ -474,21 +483,27 @@ int GDALComputeMedianCutPCTInternal(
             goto end_and_cleanup;
         }
 
-        err = GDALRasterIO(hRed, GF_Read, 0, iLine, nXSize, 1, pabyRedLine,
-                           nXSize, 1, GDT_UInt8, 0, 0);
+        const int nThisLines = std::min(nLinesAtOnce, nYSize - iLine);
+
+        err = GDALRasterIO(hRed, GF_Read, 0, iLine, nXSize, nThisLines,
+                           pabyRedLine, nXSize, nThisLines, GDT_UInt8, 0, 0);
         if (err == CE_None)
-            err = GDALRasterIO(hGreen, GF_Read, 0, iLine, nXSize, 1,
-                               pabyGreenLine, nXSize, 1, GDT_UInt8, 0, 0);
+            err = GDALRasterIO(hGreen, GF_Read, 0, iLine, nXSize, nThisLines,
+                               pabyGreenLine, nXSize, nThisLines, GDT_UInt8,
+                               0, 0);
         if (err == CE_None)
-            err = GDALRasterIO(hBlue, GF_Read, 0, iLine, nXSize, 1,
-                               pabyBlueLine, nXSize, 1, GDT_UInt8, 0, 0);
+            err = GDALRasterIO(hBlue, GF_Read, 0, iLine, nXSize, nThisLines,
+                               pabyBlueLine, nXSize, nThisLines, GDT_UInt8, 0,
+                               0);
         if (err == CE_None && hMaskBand)
-            err = GDALRasterIO(hMaskBand, GF_Read, 0, iLine, nXSize, 1,
-                               pabyMask.get(), nXSize, 1, GDT_UInt8, 0, 0);
+            err = GDALRasterIO(hMaskBand, GF_Read, 0, iLine, nXSize,
+                               nThisLines, pabyMask.get(), nXSize, nThisLines,
+                               GDT_UInt8, 0, 0);
         if (err != CE_None)
             goto end_and_cleanup;
 
-        for (int iPixel = 0; iPixel < nXSize; iPixel++)
+        const int nStripPixels = nXSize * nThisLines;
+        for (int iPixel = 0; iPixel < nStripPixels; iPixel++)
         {
             if ((pabyRedLine[iPixel] == nSrcNoData &&
                  pabyGreenLine[iPixel] == nSrcNoData &&
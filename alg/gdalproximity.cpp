@@ -18,6 +18,7 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -458,27 +459,30 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
     const int iEnd = bForward ? nXSize : -1;
     const int iStep = bForward ? 1 : -1;
 
-    for (int iPixel = iStart; iPixel != iEnd; iPixel += iStep)
+    // Precompute the target-ness of the whole line in a branch-free pass
+    // that compilers vectorize, instead of re-testing the target values
+    // inside the (strictly sequential) propagation loop below.
+    static thread_local std::vector<GByte> abyIsTarget;
+    abyIsTarget.resize(nXSize);
+    if (nTargetValues == 0)
     {
-        bool bIsTarget = false;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Is the current pixel a target pixel? */
-        /* --------------------------------------------------------------------
-         */
-        if (nTargetValues == 0)
-        {
-            bIsTarget = panSrcScanline[iPixel] != 0;
-        }
-        else
+        for (int i = 0; i < nXSize; i++)
+            abyIsTarget[i] = panSrcScanline[i] != 0;
+    }
+    else
+    {
+        memset(abyIsTarget.data(), 0, abyIsTarget.size());
+        for (int iTarget = 0; iTarget < nTargetValues; iTarget++)
         {
-            for (int i = 0; i < nTargetValues; i++)
-            {
-                if (panSrcScanline[iPixel] == panTargetValues[i])
-                    bIsTarget = TRUE;
-            }
+            const GInt32 nTargetValue = panTargetValues[iTarget];
+            for (int i = 0; i < nXSize; i++)
+                abyIsTarget[i] |= panSrcScanline[i] == nTargetValue;
         }
+    }
+
+    for (int iPixel = iStart; iPixel != iEnd; iPixel += iStep)
+    {
+        const bool bIsTarget = abyIsTarget[iPixel] != 0;
 
         if (bIsTarget)
         {
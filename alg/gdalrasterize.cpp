@@ -1333,9 +1333,37 @@ static CPLErr GDALRasterizeGeometriesInternal(
         /* --------------------------------------------------------------------
          */
         pfnProgress(0.0, nullptr, pProgressArg);
-        for (int iShape = 0; iShape < nGeomCount; iShape++)
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Bin the geometries to the chunks of the output their        */
+        /*      envelope touches, so that each chunk is read, burned with   */
+        /*      all its geometries (in their original order, which          */
+        /*      preserves per-pixel burn order and thus MERGE_ALG results)  */
+        /*      and written exactly once. The previous geometry-major loop  */
+        /*      re-read and re-wrote target chunks once per geometry.       */
+        /* --------------------------------------------------------------------
+         */
+        const int nBlocksTotalX =
+            DIV_ROUND_UP(poDS->GetRasterXSize(), nXBlockSize);
+        const int nBlocksTotalY =
+            DIV_ROUND_UP(poDS->GetRasterYSize(), nYBlockSize);
+        const int nChunksX = DIV_ROUND_UP(nBlocksTotalX, nbBlocksX);
+        const int nChunksY = DIV_ROUND_UP(nBlocksTotalY, nbBlocksY);
+        std::vector<std::vector<int>> aanChunkShapes;
+        try
+        {
+            aanChunkShapes.resize(static_cast<size_t>(nChunksX) * nChunksY);
+        }
+        catch (const std::exception &)
         {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                     __func__);
+            eErr = CE_Failure;
+        }
 
+        for (int iShape = 0; eErr == CE_None && iShape < nGeomCount; iShape++)
+        {
             const OGRGeometry *poGeometry =
                 OGRGeometry::FromHandle(pahGeometries[iShape]);
             if (poGeometry == nullptr || poGeometry->IsEmpty())
@@ -1370,89 +1398,101 @@ static CPLErr GDALRasterizeGeometriesInternal(
             if (!sGeomEnvelope.Intersects(sRasterEnvelope))
                 continue;
             sGeomEnvelope.Intersect(sRasterEnvelope);
-            CPLAssert(sGeomEnvelope.MinX >= 0 &&
-                      sGeomEnvelope.MinX <= poDS->GetRasterXSize());
-            CPLAssert(sGeomEnvelope.MinY >= 0 &&
-                      sGeomEnvelope.MinY <= poDS->GetRasterYSize());
-            CPLAssert(sGeomEnvelope.MaxX >= 0 &&
-                      sGeomEnvelope.MaxX <= poDS->GetRasterXSize());
-            CPLAssert(sGeomEnvelope.MaxY >= 0 &&
-                      sGeomEnvelope.MaxY <= poDS->GetRasterYSize());
+
             const int minBlockX = int(sGeomEnvelope.MinX) / nXBlockSize;
             const int minBlockY = int(sGeomEnvelope.MinY) / nYBlockSize;
-            const int maxBlockX = int(sGeomEnvelope.MaxX + 1) / nXBlockSize;
-            const int maxBlockY = int(sGeomEnvelope.MaxY + 1) / nYBlockSize;
-
-            /* ------------------------------------------------------------ */
-            /*      loop over the blocks concerned by the geometry          */
-            /*      (by packs of nbBlocksX x nbBlocksY)                     */
-            /* ------------------------------------------------------------ */
+            const int maxBlockX = std::min(
+                int(sGeomEnvelope.MaxX + 1) / nXBlockSize, nBlocksTotalX - 1);
+            const int maxBlockY = std::min(
+                int(sGeomEnvelope.MaxY + 1) / nYBlockSize, nBlocksTotalY - 1);
 
-            for (int xB = minBlockX; xB <= maxBlockX; xB += nbBlocksX)
+            for (int cyB = minBlockY / nbBlocksY; cyB <= maxBlockY / nbBlocksY;
+                 ++cyB)
             {
-                for (int yB = minBlockY; yB <= maxBlockY; yB += nbBlocksY)
+                for (int cxB = minBlockX / nbBlocksX;
+                     cxB <= maxBlockX / nbBlocksX; ++cxB)
                 {
-
-                    /* --------------------------------------------------------------------
-                     */
-                    /*      ensure to stay in the image */
-                    /* --------------------------------------------------------------------
-                     */
-                    int remSBX = std::min(maxBlockX - xB + 1, nbBlocksX);
-                    int remSBY = std::min(maxBlockY - yB + 1, nbBlocksY);
-                    int nThisXChunkSize = nXBlockSize * remSBX;
-                    int nThisYChunkSize = nYBlockSize * remSBY;
-                    if (xB * nXBlockSize + nThisXChunkSize >
-                        poDS->GetRasterXSize())
-                        nThisXChunkSize =
-                            poDS->GetRasterXSize() - xB * nXBlockSize;
-                    if (yB * nYBlockSize + nThisYChunkSize >
-                        poDS->GetRasterYSize())
-                        nThisYChunkSize =
-                            poDS->GetRasterYSize() - yB * nYBlockSize;
-
-                    /* --------------------------------------------------------------------
-                     */
-                    /*      read image / process buffer / write buffer */
-                    /* --------------------------------------------------------------------
-                     */
-                    eErr = poDS->RasterIO(
-                        GF_Read, xB * nXBlockSize, yB * nYBlockSize,
-                        nThisXChunkSize, nThisYChunkSize, pabyChunkBuf,
-                        nThisXChunkSize, nThisYChunkSize, eType, nBandCount,
-                        panBandList, 0, 0, 0, nullptr);
-                    if (eErr != CE_None)
-                        break;
-
-                    gv_rasterize_one_shape(
-                        pabyChunkBuf, xB * nXBlockSize, yB * nYBlockSize,
-                        nThisXChunkSize, nThisYChunkSize, nBandCount, eType, 0,
-                        0, 0, bAllTouched,
-                        OGRGeometry::FromHandle(pahGeometries[iShape]),
-                        eBurnValueType,
-                        padfGeomBurnValues
-                            ? padfGeomBurnValues +
-                                  static_cast<size_t>(iShape) * nBandCount
-                            : nullptr,
-                        panGeomBurnValues
-                            ? panGeomBurnValues +
-                                  static_cast<size_t>(iShape) * nBandCount
-                            : nullptr,
-                        eBurnValueSource, eMergeAlg, pfnTransformer,
-                        pTransformArg);
-
-                    eErr = poDS->RasterIO(
-                        GF_Write, xB * nXBlockSize, yB * nYBlockSize,
-                        nThisXChunkSize, nThisYChunkSize, pabyChunkBuf,
-                        nThisXChunkSize, nThisYChunkSize, eType, nBandCount,
-                        panBandList, 0, 0, 0, nullptr);
-                    if (eErr != CE_None)
+                    try
+                    {
+                        aanChunkShapes[static_cast<size_t>(cyB) * nChunksX +
+                                       cxB]
+                            .push_back(iShape);
+                    }
+                    catch (const std::exception &)
+                    {
+                        CPLError(CE_Failure, CPLE_OutOfMemory,
+                                 "%s: Out of memory", __func__);
+                        eErr = CE_Failure;
                         break;
+                    }
                 }
+                if (eErr != CE_None)
+                    break;
             }
+        }
 
-            if (!pfnProgress(iShape / static_cast<double>(nGeomCount), "",
-                             pProgressArg))
+        /* --------------------------------------------------------------------
+         */
+        /*      Burn each chunk once with all its geometries.               */
+        /* --------------------------------------------------------------------
+         */
+        const size_t nTotalChunks = aanChunkShapes.size();
+        for (size_t iChunk = 0; eErr == CE_None && iChunk < nTotalChunks;
+             ++iChunk)
+        {
+            const std::vector<int> &anShapes = aanChunkShapes[iChunk];
+            if (anShapes.empty())
+                continue;
+            const int cxB = static_cast<int>(iChunk % nChunksX);
+            const int cyB = static_cast<int>(iChunk / nChunksX);
+            const int xB = cxB * nbBlocksX;
+            const int yB = cyB * nbBlocksY;
+
+            int nThisXChunkSize = nXBlockSize * nbBlocksX;
+            int nThisYChunkSize = nYBlockSize * nbBlocksY;
+            if (xB * nXBlockSize + nThisXChunkSize > poDS->GetRasterXSize())
+                nThisXChunkSize = poDS->GetRasterXSize() - xB * nXBlockSize;
+            if (yB * nYBlockSize + nThisYChunkSize > poDS->GetRasterYSize())
+                nThisYChunkSize = poDS->GetRasterYSize() - yB * nYBlockSize;
+
+            eErr = poDS->RasterIO(GF_Read, xB * nXBlockSize, yB * nYBlockSize,
+                                  nThisXChunkSize, nThisYChunkSize,
+                                  pabyChunkBuf, nThisXChunkSize,
+                                  nThisYChunkSize, eType, nBandCount,
+                                  panBandList, 0, 0, 0, nullptr);
+            if (eErr != CE_None)
+                break;
+
+            for (const int iShape : anShapes)
+            {
+                gv_rasterize_one_shape(
+                    pabyChunkBuf, xB * nXBlockSize, yB * nYBlockSize,
+                    nThisXChunkSize, nThisYChunkSize, nBandCount, eType, 0, 0,
+                    0, bAllTouched,
+                    OGRGeometry::FromHandle(pahGeometries[iShape]),
+                    eBurnValueType,
+                    padfGeomBurnValues
+                        ? padfGeomBurnValues +
+                              static_cast<size_t>(iShape) * nBandCount
+                        : nullptr,
+                    panGeomBurnValues
+                        ? panGeomBurnValues +
+                              static_cast<size_t>(iShape) * nBandCount
+                        : nullptr,
+                    eBurnValueSource, eMergeAlg, pfnTransformer,
+                    pTransformArg);
+            }
+
+            eErr = poDS->RasterIO(GF_Write, xB * nXBlockSize, yB * nYBlockSize,
+                                  nThisXChunkSize, nThisYChunkSize,
+                                  pabyChunkBuf, nThisXChunkSize,
+                                  nThisYChunkSize, eType, nBandCount,
+                                  panBandList, 0, 0, 0, nullptr);
+            if (eErr != CE_None)
+                break;
+
+            if (!pfnProgress((iChunk + 1) / static_cast<double>(nTotalChunks),
+                             "", pProgressArg))
             {
                 CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
                 eErr = CE_Failure;
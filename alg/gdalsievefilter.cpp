@@ -344,6 +344,33 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Free the first-pass per-polygon values early: their only        */
+    /*      later use is the nodata check of the neighbour fix-up loop,     */
+    /*      which a compact bitmask answers, saving 8 bytes per polygon -   */
+    /*      the largest per-polygon array - before the second pass          */
+    /*      allocates its own maps. On noisy rasters the per-polygon        */
+    /*      arrays, not the scanline buffers, are what limits the maximum   */
+    /*      processable raster size.                                        */
+    /* -------------------------------------------------------------------- */
+    std::vector<bool> abNoDataPoly;
+    try
+    {
+        abNoDataPoly.resize(oFirstEnum.nNextPolygonId);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory", __func__);
+        return CE_Failure;
+    }
+    for (int iPoly = 0; iPoly < oFirstEnum.nNextPolygonId; iPoly++)
+    {
+        abNoDataPoly[iPoly] =
+            oFirstEnum.panPolyValue[iPoly] == GP_NODATA_MARKER;
+    }
+    CPLFree(oFirstEnum.panPolyValue);
+    oFirstEnum.panPolyValue = nullptr;
+
     /* -------------------------------------------------------------------- */
     /*      We will use a new enumerator for the second pass primarily      */
     /*      so we can preserve the first pass map.                          */
@@ -478,7 +505,7 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
             continue;
 
         // Ignore nodata polygons.
-        if (oFirstEnum.panPolyValue[iPoly] == GP_NODATA_MARKER)
+        if (abNoDataPoly[iPoly])
             continue;
 
         // Don't try to merge polygons larger than the threshold.
@@ -26,6 +26,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <utility>
 
 #include "cpl_conv.h"
@@ -3100,9 +3102,12 @@ int GDALGenImgProjTransform(void *pTransformArgIn, int bDstToSrc,
     countGDALGenImgProjTransform += nPointCount;
 #endif
 
+    bool bAllValid = true;
     for (int i = 0; i < nPointCount; i++)
     {
-        panSuccess[i] = (padfX[i] != HUGE_VAL && padfY[i] != HUGE_VAL);
+        const int bValid = (padfX[i] != HUGE_VAL && padfY[i] != HUGE_VAL);
+        panSuccess[i] = bValid;
+        bAllValid = bAllValid && bValid;
     }
 
     int ret = TRUE;
@@ -3122,6 +3127,31 @@ int GDALGenImgProjTransform(void *pTransformArgIn, int bDstToSrc,
             if (!pTransformer(pTransformArg, FALSE, nPointCount, padfX, padfY,
                               padfZ, panSuccess))
                 ret = FALSE;
+
+            // The sub-transformer may have invalidated individual points.
+            if (bAllValid)
+            {
+                for (int i = 0; i < nPointCount; i++)
+                    bAllValid = bAllValid && panSuccess[i] != 0;
+            }
+        }
+        else if (bAllValid)
+        {
+            // Branch-free variant of the loop below, that compilers can
+            // auto-vectorize. The dense-scanline case of the warper always
+            // takes it.
+            for (int i = 0; i < nPointCount; i++)
+            {
+                const double dfNewX = padfGeoTransform[0] +
+                                      padfX[i] * padfGeoTransform[1] +
+                                      padfY[i] * padfGeoTransform[2];
+                const double dfNewY = padfGeoTransform[3] +
+                                      padfX[i] * padfGeoTransform[4] +
+                                      padfY[i] * padfGeoTransform[5];
+
+                padfX[i] = dfNewX;
+                padfY[i] = dfNewY;
+            }
         }
         else
         {
@@ -3151,6 +3181,13 @@ int GDALGenImgProjTransform(void *pTransformArgIn, int bDstToSrc,
         if (!psInfo->pReproject(psInfo->pReprojectArg, bDstToSrc, nPointCount,
                                 padfX, padfY, padfZ, panSuccess))
             ret = FALSE;
+
+        // The reprojection may have invalidated individual points.
+        if (bAllValid)
+        {
+            for (int i = 0; i < nPointCount; i++)
+                bAllValid = bAllValid && panSuccess[i] != 0;
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -3168,6 +3205,22 @@ int GDALGenImgProjTransform(void *pTransformArgIn, int bDstToSrc,
                               padfZ, panSuccess))
                 ret = FALSE;
         }
+        else if (bAllValid)
+        {
+            // See the comment on the forward branch-free loop above.
+            for (int i = 0; i < nPointCount; i++)
+            {
+                const double dfNewX = padfInvGeoTransform[0] +
+                                      padfX[i] * padfInvGeoTransform[1] +
+                                      padfY[i] * padfInvGeoTransform[2];
+                const double dfNewY = padfInvGeoTransform[3] +
+                                      padfX[i] * padfInvGeoTransform[4] +
+                                      padfY[i] * padfInvGeoTransform[5];
+
+                padfX[i] = dfNewX;
+                padfY[i] = dfNewY;
+            }
+        }
         else
         {
             for (int i = 0; i < nPointCount; i++)
@@ -4850,6 +4903,129 @@ int GDALUseTransformer(void *pTransformArg, int bDstToSrc, int nPointCount,
                                 panSuccess);
 }
 
+/************************************************************************/
+/*                      Thread-safe transformer                         */
+/*                                                                      */
+/*      Wrapper sharing one immutable base transformer between          */
+/*      threads: each calling thread lazily receives its own clone      */
+/*      (created through GDALCloneTransformer()), so a single           */
+/*      transformer set up once - e.g. by a tile renderer for a given   */
+/*      CRS/grid pair - can be evaluated concurrently without           */
+/*      re-running the transformer setup per request.                   */
+/************************************************************************/
+
+struct GDALThreadSafeTransformInfo
+{
+    GDALTransformerInfo sTI{};
+    GDALTransformerFunc pfnBaseTransformer = nullptr;
+    void *pBaseTransformerArg = nullptr;
+    std::mutex oMutex{};
+    std::map<GIntBig, void *> oMapThreadTransformerArg{};
+};
+
+static void GDALDestroyThreadSafeTransformer(void *pTransformArg)
+{
+    auto *psInfo = static_cast<GDALThreadSafeTransformInfo *>(pTransformArg);
+    for (auto &oPair : psInfo->oMapThreadTransformerArg)
+        GDALDestroyTransformer(oPair.second);
+    GDALDestroyTransformer(psInfo->pBaseTransformerArg);
+    delete psInfo;
+}
+
+static CPLXMLNode *GDALSerializeThreadSafeTransformer(void *pTransformArg)
+{
+    // The wrapper is transparent for serialization: a deserialized
+    // transformer is the base one.
+    auto *psInfo = static_cast<GDALThreadSafeTransformInfo *>(pTransformArg);
+    return GDALSerializeTransformer(psInfo->pfnBaseTransformer,
+                                    psInfo->pBaseTransformerArg);
+}
+
+static void *GDALCreateSimilarThreadSafeTransformer(void *pTransformArg,
+                                                    double dfSrcRatioX,
+                                                    double dfSrcRatioY)
+{
+    auto *psInfo = static_cast<GDALThreadSafeTransformInfo *>(pTransformArg);
+    void *pSimilarBase = GDALCreateSimilarTransformer(
+        psInfo->pBaseTransformerArg, dfSrcRatioX, dfSrcRatioY);
+    if (pSimilarBase == nullptr)
+        return nullptr;
+    return GDALCreateThreadSafeTransformer(psInfo->pfnBaseTransformer,
+                                           pSimilarBase);
+}
+
+/** Thread-safe evaluation entry point matching GDALTransformerFunc().
+ *
+ * Dispatches to a per-thread clone of the base transformer.
+ */
+int GDALThreadSafeTransform(void *pTransformArg, int bDstToSrc,
+                            int nPointCount, double *x, double *y, double *z,
+                            int *panSuccess)
+{
+    auto *psInfo = static_cast<GDALThreadSafeTransformInfo *>(pTransformArg);
+    const GIntBig nThreadId = CPLGetPID();
+
+    void *pThreadTransformerArg = nullptr;
+    {
+        std::lock_guard<std::mutex> oLock(psInfo->oMutex);
+        const auto oIter = psInfo->oMapThreadTransformerArg.find(nThreadId);
+        if (oIter != psInfo->oMapThreadTransformerArg.end())
+        {
+            pThreadTransformerArg = oIter->second;
+        }
+        else
+        {
+            // Clone under the lock, so that concurrent first-use clones do
+            // not read the base transformer at the same time.
+            pThreadTransformerArg =
+                GDALCloneTransformer(psInfo->pBaseTransformerArg);
+            if (pThreadTransformerArg == nullptr)
+            {
+                for (int i = 0; i < nPointCount; ++i)
+                    panSuccess[i] = FALSE;
+                return FALSE;
+            }
+            psInfo->oMapThreadTransformerArg[nThreadId] =
+                pThreadTransformerArg;
+        }
+    }
+
+    return psInfo->pfnBaseTransformer(pThreadTransformerArg, bDstToSrc,
+                                      nPointCount, x, y, z, panSuccess);
+}
+
+/** Wrap a transformer so that it can be evaluated concurrently from
+ * several threads through GDALThreadSafeTransform().
+ *
+ * Takes ownership of pBaseTransformerArg, which must support
+ * GDALCloneTransformer(). The base transformer itself is only used as the
+ * clone source and is never evaluated.
+ */
+void *GDALCreateThreadSafeTransformer(GDALTransformerFunc pfnBaseTransformer,
+                                      void *pBaseTransformerArg)
+{
+    if (pBaseTransformerArg == nullptr ||
+        memcmp(
+            static_cast<GDALTransformerInfo *>(pBaseTransformerArg)
+                ->abySignature,
+            GDAL_GTI2_SIGNATURE, strlen(GDAL_GTI2_SIGNATURE)) != 0)
+        return nullptr;
+
+    auto *psInfo = new GDALThreadSafeTransformInfo();
+    psInfo->pfnBaseTransformer = pfnBaseTransformer;
+    psInfo->pBaseTransformerArg = pBaseTransformerArg;
+
+    memcpy(psInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
+           strlen(GDAL_GTI2_SIGNATURE));
+    psInfo->sTI.pszClassName = "GDALThreadSafeTransformer";
+    psInfo->sTI.pfnTransform = GDALThreadSafeTransform;
+    psInfo->sTI.pfnCleanup = GDALDestroyThreadSafeTransformer;
+    psInfo->sTI.pfnSerialize = GDALSerializeThreadSafeTransformer;
+    psInfo->sTI.pfnCreateSimilar = GDALCreateSimilarThreadSafeTransformer;
+
+    return psInfo;
+}
+
 /************************************************************************/
 /*                        GDALCloneTransformer()                        */
 /************************************************************************/
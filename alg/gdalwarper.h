@@ -538,6 +538,11 @@ class CPL_DLL GDALWarpOperation final
     bool bReportTimings = false;
     unsigned long nLastTimeReported = 0;
 
+    // Measurements of the source reads, for the adaptive chunk sizing of
+    // ChunkAndWarpImage()
+    double dfSrcReadWallTimeSec = 0;
+    GUIntBig nSrcReadBytes = 0;
+
     void *psThreadData = nullptr;
 
     // Coordinates a few special points in target image space, to determine
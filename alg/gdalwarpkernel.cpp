@@ -79,7 +79,7 @@ constexpr double BAND_DENSITY_THRESHOLD = 0.0000000001;
 constexpr float SRC_DENSITY_THRESHOLD_FLOAT = 0.000000001f;
 constexpr double SRC_DENSITY_THRESHOLD_DOUBLE = 0.000000001;
 
-// #define INSTANTIATE_FLOAT64_SSE2_IMPL
+#define INSTANTIATE_FLOAT64_SSE2_IMPL
 
 static const int anGWKFilterRadius[] = {
     0,  // Nearest neighbour
@@ -177,6 +177,10 @@ static CPLErr GWKCubicNoMasksOrDstDensityOnlyFloat(GDALWarpKernel *poWK);
 static CPLErr GWKCubicNoMasksOrDstDensityOnlyDouble(GDALWarpKernel *poWK);
 #endif
 static CPLErr GWKCubicSplineNoMasksOrDstDensityOnlyByte(GDALWarpKernel *poWK);
+static CPLErr GWKLanczosNoMasksOrDstDensityOnlyByte(GDALWarpKernel *poWK);
+static CPLErr GWKLanczosNoMasksOrDstDensityOnlyShort(GDALWarpKernel *poWK);
+static CPLErr GWKLanczosNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *poWK);
+static CPLErr GWKLanczosNoMasksOrDstDensityOnlyFloat(GDALWarpKernel *poWK);
 static CPLErr GWKNearestByte(GDALWarpKernel *poWK);
 static CPLErr GWKNearestNoMasksOrDstDensityOnlyShort(GDALWarpKernel *poWK);
 static CPLErr GWKBilinearNoMasksOrDstDensityOnlyShort(GDALWarpKernel *poWK);
@@ -1356,6 +1360,10 @@ CPLErr GDALWarpKernel::PerformWarp()
         bNoMasksOrDstDensityOnly)
         return GWKCubicSplineNoMasksOrDstDensityOnlyByte(this);
 
+    if (eWorkingDataType == GDT_UInt8 && eResample == GRA_Lanczos &&
+        bNoMasksOrDstDensityOnly)
+        return GWKLanczosNoMasksOrDstDensityOnlyByte(this);
+
     if (eWorkingDataType == GDT_UInt8 && eResample == GRA_NearestNeighbour)
         return GWKNearestByte(this);
 
@@ -1375,6 +1383,10 @@ CPLErr GDALWarpKernel::PerformWarp()
         bNoMasksOrDstDensityOnly)
         return GWKBilinearNoMasksOrDstDensityOnlyShort(this);
 
+    if ((eWorkingDataType == GDT_Int16) && eResample == GRA_Lanczos &&
+        bNoMasksOrDstDensityOnly)
+        return GWKLanczosNoMasksOrDstDensityOnlyShort(this);
+
     if ((eWorkingDataType == GDT_UInt16) && eResample == GRA_Cubic &&
         bNoMasksOrDstDensityOnly)
         return GWKCubicNoMasksOrDstDensityOnlyUShort(this);
@@ -1387,6 +1399,10 @@ CPLErr GDALWarpKernel::PerformWarp()
         bNoMasksOrDstDensityOnly)
         return GWKBilinearNoMasksOrDstDensityOnlyUShort(this);
 
+    if ((eWorkingDataType == GDT_UInt16) && eResample == GRA_Lanczos &&
+        bNoMasksOrDstDensityOnly)
+        return GWKLanczosNoMasksOrDstDensityOnlyUShort(this);
+
     if (eWorkingDataType == GDT_Int8 && eResample == GRA_NearestNeighbour)
         return GWKNearestInt8(this);
 
@@ -1411,6 +1427,10 @@ CPLErr GDALWarpKernel::PerformWarp()
         bNoMasksOrDstDensityOnly)
         return GWKCubicNoMasksOrDstDensityOnlyFloat(this);
 
+    if (eWorkingDataType == GDT_Float32 && eResample == GRA_Lanczos &&
+        bNoMasksOrDstDensityOnly)
+        return GWKLanczosNoMasksOrDstDensityOnlyFloat(this);
+
 #ifdef INSTANTIATE_FLOAT64_SSE2_IMPL
     if (eWorkingDataType == GDT_Float64 && eResample == GRA_Bilinear &&
         bNoMasksOrDstDensityOnly)
@@ -1881,6 +1901,49 @@ inline void ClampRoundAndAvoidNoData(const GDALWarpKernel *poWK, int iBand,
         AvoidNoData<T>(poWK, iBand, iDstOffset);
 }
 
+/************************************************************************/
+/*                     GWKSetPixelValueFromDoubleT()                    */
+/*                                                                      */
+/*      Typed fast path of GWKSetPixelValue() for the common real       */
+/*      destination types: same blend arithmetic, but without the two   */
+/*      per-pixel switches on the working data type.                    */
+/************************************************************************/
+
+template <class T>
+static bool GWKSetPixelValueFromDoubleT(const GDALWarpKernel *poWK, int iBand,
+                                        GPtrDiff_t iDstOffset,
+                                        double dfDensity, double dfReal,
+                                        bool bAvoidNoDataSingleBand)
+{
+    const T *pDst = reinterpret_cast<const T *>(poWK->papabyDstImage[iBand]);
+
+    if (dfDensity < 0.9999)
+    {
+        if (dfDensity < 0.0001)
+            return true;
+
+        double dfDstDensity = 1.0;
+        if (poWK->pafDstDensity != nullptr)
+            dfDstDensity = double(poWK->pafDstDensity[iDstOffset]);
+        else if (poWK->panDstValid != nullptr &&
+                 !CPLMaskGet(poWK->panDstValid, iDstOffset))
+            dfDstDensity = 0.0;
+
+        const double dfDstReal = static_cast<double>(pDst[iDstOffset]);
+
+        // The destination density is really only relative to the portion
+        // not occluded by the overlay.
+        const double dfDstInfluence = (1.0 - dfDensity) * dfDstDensity;
+
+        dfReal = (dfReal * dfDensity + dfDstReal * dfDstInfluence) /
+                 (dfDensity + dfDstInfluence);
+    }
+
+    ClampRoundAndAvoidNoData<T>(poWK, iBand, iDstOffset, dfReal,
+                                bAvoidNoDataSingleBand);
+    return true;
+}
+
 /************************************************************************/
 /*                          GWKSetPixelValue()                          */
 /************************************************************************/
@@ -1891,6 +1954,26 @@ static bool GWKSetPixelValue(const GDALWarpKernel *poWK, int iBand,
                              bool bAvoidNoDataSingleBand)
 
 {
+    // Typed fast paths for the destination types that dominate mosaicking
+    // workloads, where the per-pixel type dispatch below is measurable.
+    switch (poWK->eWorkingDataType)
+    {
+        case GDT_UInt8:
+            return GWKSetPixelValueFromDoubleT<GByte>(
+                poWK, iBand, iDstOffset, dfDensity, dfReal,
+                bAvoidNoDataSingleBand);
+        case GDT_UInt16:
+            return GWKSetPixelValueFromDoubleT<GUInt16>(
+                poWK, iBand, iDstOffset, dfDensity, dfReal,
+                bAvoidNoDataSingleBand);
+        case GDT_Float32:
+            return GWKSetPixelValueFromDoubleT<float>(
+                poWK, iBand, iDstOffset, dfDensity, dfReal,
+                bAvoidNoDataSingleBand);
+        default:
+            break;
+    }
+
     GByte *pabyDst = poWK->papabyDstImage[iBand];
 
     /* -------------------------------------------------------------------- */
@@ -6528,6 +6611,34 @@ static CPLErr GWKCubicSplineNoMasksOrDstDensityOnlyByte(GDALWarpKernel *poWK)
         GWKResampleNoMasksOrDstDensityOnlyThread<GByte, GRA_CubicSpline>);
 }
 
+static CPLErr GWKLanczosNoMasksOrDstDensityOnlyByte(GDALWarpKernel *poWK)
+{
+    return GWKRun(
+        poWK, "GWKLanczosNoMasksOrDstDensityOnlyByte",
+        GWKResampleNoMasksOrDstDensityOnlyThread<GByte, GRA_Lanczos>);
+}
+
+static CPLErr GWKLanczosNoMasksOrDstDensityOnlyShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(
+        poWK, "GWKLanczosNoMasksOrDstDensityOnlyShort",
+        GWKResampleNoMasksOrDstDensityOnlyThread<GInt16, GRA_Lanczos>);
+}
+
+static CPLErr GWKLanczosNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(
+        poWK, "GWKLanczosNoMasksOrDstDensityOnlyUShort",
+        GWKResampleNoMasksOrDstDensityOnlyThread<GUInt16, GRA_Lanczos>);
+}
+
+static CPLErr GWKLanczosNoMasksOrDstDensityOnlyFloat(GDALWarpKernel *poWK)
+{
+    return GWKRun(
+        poWK, "GWKLanczosNoMasksOrDstDensityOnlyFloat",
+        GWKResampleNoMasksOrDstDensityOnlyThread<float, GRA_Lanczos>);
+}
+
 /************************************************************************/
 /*                          GWKNearestByte()                            */
 /*                                                                      */
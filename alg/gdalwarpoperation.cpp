@@ -15,6 +15,7 @@
 #include "gdalwarper.h"
 
 #include <cctype>
+#include <chrono>
 #include <climits>
 #include <cmath>
 #include <cstddef>
@@ -1094,7 +1095,12 @@ CPLErr GDALWarpOperation::ChunkAndWarpImage(int nDstXOff, int nDstYOff,
     /*      Process them one at a time, updating the progress               */
     /*      information for each region.                                    */
     /* -------------------------------------------------------------------- */
+    const bool bAdaptiveChunkSizing = CPLTestBool(CSLFetchNameValueDef(
+        psOptions->papszWarpOptions, "ADAPTIVE_CHUNK_SIZING",
+        CPLGetConfigOption("GDAL_WARP_ADAPTIVE_CHUNK_SIZING", "NO")));
+
     double dfPixelsProcessed = 0.0;
+    bool bHasAdapted = false;
 
     for (int iChunk = 0; pasChunkList != nullptr && iChunk < nChunkListCount;
          iChunk++)
@@ -1106,6 +1112,9 @@ CPLErr GDALWarpOperation::ChunkAndWarpImage(int nDstXOff, int nDstYOff,
         const double dfProgressBase = dfPixelsProcessed / dfTotalPixels;
         const double dfProgressScale = dfChunkPixels / dfTotalPixels;
 
+        dfSrcReadWallTimeSec = 0;
+        nSrcReadBytes = 0;
+
         CPLErr eErr = WarpRegion(
             pasThisChunk->dx, pasThisChunk->dy, pasThisChunk->dsx,
             pasThisChunk->dsy, pasThisChunk->sx, pasThisChunk->sy,
@@ -1116,6 +1125,68 @@ CPLErr GDALWarpOperation::ChunkAndWarpImage(int nDstXOff, int nDstYOff,
             return eErr;
 
         dfPixelsProcessed += dfChunkPixels;
+
+        /* ---------------------------------------------------------------- */
+        /*      Adaptive chunk sizing: if the source read of the first      */
+        /*      chunk was slow (latency-bound remote source), raise the     */
+        /*      memory limit and re-chunk the remaining region with         */
+        /*      bigger chunks, so the per-chunk fixed cost is amortized.    */
+        /* ---------------------------------------------------------------- */
+        if (bAdaptiveChunkSizing && !bHasAdapted && iChunk == 0 &&
+            nChunkListCount > 2 && dfSrcReadWallTimeSec > 0.2 &&
+            nSrcReadBytes > 0)
+        {
+            constexpr double TARGET_READ_DURATION_SEC = 2.0;
+            const double dfGrowthFactor = std::min(
+                8.0, TARGET_READ_DURATION_SEC / dfSrcReadWallTimeSec);
+            if (dfGrowthFactor >= 2.0)
+            {
+                // Check that the remaining chunks exactly tile their
+                // bounding box, which is the case of the usual
+                // band-splitting, so they can be re-collected as one
+                // region.
+                int nMinX = INT_MAX;
+                int nMinY = INT_MAX;
+                int nMaxX = INT_MIN;
+                int nMaxY = INT_MIN;
+                double dfRemainingPixels = 0;
+                for (int i = 1; i < nChunkListCount; ++i)
+                {
+                    const GDALWarpChunk *psChunk = pasChunkList + i;
+                    nMinX = std::min(nMinX, psChunk->dx);
+                    nMinY = std::min(nMinY, psChunk->dy);
+                    nMaxX = std::max(nMaxX, psChunk->dx + psChunk->dsx);
+                    nMaxY = std::max(nMaxY, psChunk->dy + psChunk->dsy);
+                    dfRemainingPixels +=
+                        static_cast<double>(psChunk->dsx) * psChunk->dsy;
+                }
+                if (dfRemainingPixels == static_cast<double>(nMaxX - nMinX) *
+                                             (nMaxY - nMinY))
+                {
+                    CPLDebug("WARP",
+                             "Adaptive chunk sizing: source read at %.1f "
+                             "MB/s in %.2f s, growing warp memory limit "
+                             "by %.1fx",
+                             nSrcReadBytes / 1e6 / dfSrcReadWallTimeSec,
+                             dfSrcReadWallTimeSec, dfGrowthFactor);
+                    psOptions->dfWarpMemoryLimit *= dfGrowthFactor;
+                    WipeChunkList();
+                    CollectChunkList(nMinX, nMinY, nMaxX - nMinX,
+                                     nMaxY - nMinY);
+                    // Restart the loop on the new list; progress keeps
+                    // accounting for the already processed pixels.
+                    dfTotalPixels = dfPixelsProcessed;
+                    for (int i = 0; i < nChunkListCount; ++i)
+                    {
+                        dfTotalPixels +=
+                            static_cast<double>(pasChunkList[i].dsx) *
+                            pasChunkList[i].dsy;
+                    }
+                    iChunk = -1;
+                    bHasAdapted = true;
+                }
+            }
+        }
     }
 
     WipeChunkList();
@@ -1269,6 +1340,53 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     double dfPixelsProcessed = 0.0;
     double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
 
+    /* -------------------------------------------------------------------- */
+    /*      When enabled, prefetch the source window of the chunk after     */
+    /*      the one being started, through GDALDataset::Prefetch(), so     */
+    /*      that high-latency sources have their next read in flight       */
+    /*      while the current chunk is warped and written. The read/warp   */
+    /*      ordering of the two chunk threads (and thus the ordered        */
+    /*      writeback) is unchanged.                                       */
+    /* -------------------------------------------------------------------- */
+    const bool bPrefetchNextChunk = CPLTestBool(CSLFetchNameValueDef(
+        psOptions->papszWarpOptions, "PREFETCH_NEXT_CHUNK",
+        CPLGetConfigOption("GDAL_WARP_PREFETCH_NEXT_CHUNK", "NO")));
+    GDALDataset *poPrefetchSrcDS =
+        bPrefetchNextChunk && psOptions->hSrcDS
+            ? GDALDataset::FromHandle(psOptions->hSrcDS)
+            : nullptr;
+    // Safe with respect to the reader thread concurrently running
+    // WarpRegionToBuffer() -> RasterIO() on the same source dataset:
+    // GDALDataset::Prefetch() serializes its worker's block reads with the
+    // calling thread's RasterIO() through the dataset read-write mutex,
+    // which it enables even on read-only datasets.
+    const auto PrefetchChunkSourceWindow = [this, poPrefetchSrcDS](int iChunkIdx)
+    {
+        if (poPrefetchSrcDS && pasChunkList != nullptr &&
+            iChunkIdx < nChunkListCount)
+        {
+            const GDALWarpChunk *pasThisChunk = pasChunkList + iChunkIdx;
+            // Clamp to the source extent: chunk windows can slightly
+            // exceed it because of resampling margins.
+            const int nSrcX = std::max(0, pasThisChunk->sx);
+            const int nSrcY = std::max(0, pasThisChunk->sy);
+            const int nSrcXSize =
+                std::min(poPrefetchSrcDS->GetRasterXSize() - nSrcX,
+                         pasThisChunk->sx + pasThisChunk->ssx - nSrcX);
+            const int nSrcYSize =
+                std::min(poPrefetchSrcDS->GetRasterYSize() - nSrcY,
+                         pasThisChunk->sy + pasThisChunk->ssy - nSrcY);
+            if (nSrcXSize > 0 && nSrcYSize > 0)
+            {
+                CPL_IGNORE_RET_VAL(poPrefetchSrcDS->Prefetch(
+                    nSrcX, nSrcY, nSrcXSize, nSrcYSize,
+                    psOptions->nBandCount, psOptions->panSrcBands, nullptr));
+            }
+        }
+    };
+    // Chunk 0 is read immediately by its own thread: start with chunk 1.
+    PrefetchChunkSourceWindow(1);
+
     CPLErr eErr = CE_None;
     for (int iChunk = 0; iChunk < nChunkListCount + 1; iChunk++)
     {
@@ -1329,6 +1447,9 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
                     CPLCondWait(hCond, hCondMutex);
                 CPLReleaseMutex(hCondMutex);
             }
+
+            if (iChunk >= 1)
+                PrefetchChunkSourceWindow(iChunk + 1);
         }
 
         /* --------------------------------------------------------------------
@@ -1366,6 +1487,9 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     CPLDestroyCond(hCond);
     CPLDestroyMutex(hCondMutex);
 
+    if (poPrefetchSrcDS)
+        poPrefetchSrcDS->CancelPrefetch();
+
     WipeChunkList();
 
     oErrorAccumulator.ReplayErrors();
@@ -2074,6 +2198,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     if (eErr == CE_None && nSrcXSize > 0 && nSrcYSize > 0)
     {
         GDALDataset *poSrcDS = GDALDataset::FromHandle(psOptions->hSrcDS);
+        const auto nReadStartTime = std::chrono::steady_clock::now();
         if (psOptions->nBandCount == 1)
         {
             // Particular case to simplify the stack a bit.
@@ -2094,6 +2219,12 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
                              WARP_EXTRA_ELTS),
                 nullptr);
         }
+        dfSrcReadWallTimeSec +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                          nReadStartTime)
+                .count();
+        nSrcReadBytes += static_cast<GUIntBig>(nWordSize) * nSrcXSize *
+                         nSrcYSize * psOptions->nBandCount;
     }
 
     ReportTiming("Input buffer read");
@@ -10,10 +10,16 @@
  ****************************************************************************/
 
 #include <functional>
+#include <algorithm>
+#include <utility>
+#include <vector>
 #include <cmath>
 
 #include "cpl_port.h"
 #include "gdal_alg.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 // There's a plethora of bresenham implementations, all questionable production
 // quality. Bresenham optimizes for integer math, which makes sense for raster
@@ -366,3 +372,157 @@ bool GDALIsLineOfSightVisible(const GDALRasterBandH hBand, const int xA,
 
     return Bresenham2D(xA, yA, xB, yB, OnBresenhamPoint);
 }
+
+/************************************************************************/
+/*                  GDALIsLineOfSightVisibleBatch()                     */
+/************************************************************************/
+
+/**
+ * Check Line of Sight between many point pairs at once.
+ *
+ * Rays are reordered so that those traversing the same DEM blocks are
+ * evaluated together (maximizing block cache reuse), and are spread across
+ * worker threads (honoring GDAL_NUM_THREADS) when the band's dataset can be
+ * wrapped in a thread-safe dataset. Semantics per ray are exactly those of
+ * GDALIsLineOfSightVisible(); terrain intersection positions are not
+ * reported in batch mode.
+ *
+ * @param hBand The band to read the DEM data from. Must NOT be null.
+ * @param nPoints Number of point pairs.
+ * @param panXA Array of nPoints X locations of the first points.
+ * @param panYA Array of nPoints Y locations of the first points.
+ * @param padfZA Array of nPoints heights of the first points.
+ * @param panXB Array of nPoints X locations of the second points.
+ * @param panYB Array of nPoints Y locations of the second points.
+ * @param padfZB Array of nPoints heights of the second points.
+ * @param[out] pabyVisible Array of nPoints bytes, set to 1 when the pair is
+ *                         within line of sight, 0 otherwise.
+ * @param papszOptions Options (currently ignored).
+ * @return true unless an error occurred (invalid arguments).
+ *
+ * @since GDAL 3.14
+ */
+bool GDALIsLineOfSightVisibleBatch(const GDALRasterBandH hBand, int nPoints,
+                                   const int *panXA, const int *panYA,
+                                   const double *padfZA, const int *panXB,
+                                   const int *panYB, const double *padfZB,
+                                   GByte *pabyVisible,
+                                   CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hBand, "GDALIsLineOfSightVisibleBatch", false);
+    VALIDATE_POINTER1(pabyVisible, "GDALIsLineOfSightVisibleBatch", false);
+    VALIDATE_POINTER1(panXA, "GDALIsLineOfSightVisibleBatch", false);
+    VALIDATE_POINTER1(panYA, "GDALIsLineOfSightVisibleBatch", false);
+    VALIDATE_POINTER1(padfZA, "GDALIsLineOfSightVisibleBatch", false);
+    VALIDATE_POINTER1(panXB, "GDALIsLineOfSightVisibleBatch", false);
+    VALIDATE_POINTER1(panYB, "GDALIsLineOfSightVisibleBatch", false);
+    VALIDATE_POINTER1(padfZB, "GDALIsLineOfSightVisibleBatch", false);
+    if (nPoints <= 0)
+        return true;
+
+    /* ---------------------------------------------------------------- */
+    /*      Sort the rays by the DEM block of their top-left segment     */
+    /*      corner (Morton order), so consecutive rays touch the same    */
+    /*      cached blocks.                                               */
+    /* ---------------------------------------------------------------- */
+    int nBlockXSize = 1;
+    int nBlockYSize = 1;
+    GDALGetBlockSize(hBand, &nBlockXSize, &nBlockYSize);
+    if (nBlockXSize <= 0)
+        nBlockXSize = 1;
+    if (nBlockYSize <= 0)
+        nBlockYSize = 1;
+
+    const auto SpreadBits = [](GUIntBig v)
+    {
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        v = (v | (v << 2)) & 0x3333333333333333ULL;
+        v = (v | (v << 1)) & 0x5555555555555555ULL;
+        return v;
+    };
+
+    std::vector<std::pair<GUIntBig, int>> asOrder(nPoints);
+    for (int i = 0; i < nPoints; ++i)
+    {
+        const int nBlockX =
+            std::max(0, std::min(panXA[i], panXB[i])) / nBlockXSize;
+        const int nBlockY =
+            std::max(0, std::min(panYA[i], panYB[i])) / nBlockYSize;
+        asOrder[i] = {
+            SpreadBits(static_cast<GUIntBig>(nBlockX) & 0xFFFFFFFFU) |
+                (SpreadBits(static_cast<GUIntBig>(nBlockY) & 0xFFFFFFFFU)
+                 << 1),
+            i};
+    }
+    std::sort(asOrder.begin(), asOrder.end());
+
+    /* ---------------------------------------------------------------- */
+    /*      Evaluate the groups across worker threads when the dataset   */
+    /*      can be used through a thread-safe wrapper.                   */
+    /* ---------------------------------------------------------------- */
+    const int nThreads =
+        std::min(GDALGetNumThreads(CPLGetNumCPUs(),
+                                   /* bDefaultAllCPUs = */ false),
+                 std::max(1, nPoints / 64));
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+    GDALDataset *poDS = poBand->GetDataset();
+    GDALDataset *poThreadSafeDS = nullptr;
+    if (nThreads > 1 && poDS != nullptr && poBand->GetBand() >= 1)
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        poThreadSafeDS = GDALGetThreadSafeDataset(
+            poDS, GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE);
+    }
+
+    if (poThreadSafeDS != nullptr)
+    {
+        const int nBandNum = poBand->GetBand();
+        CPLWorkerThreadPool oPool(nThreads);
+        const int nChunkSize = DIV_ROUND_UP(nPoints, nThreads);
+        for (int iChunk = 0; iChunk < nThreads; ++iChunk)
+        {
+            const int iBegin = iChunk * nChunkSize;
+            const int iEnd = std::min(nPoints, iBegin + nChunkSize);
+            if (iBegin >= iEnd)
+                break;
+            oPool.SubmitJob(
+                [poThreadSafeDS, nBandNum, iBegin, iEnd, &asOrder, panXA,
+                 panYA, padfZA, panXB, panYB, padfZB, pabyVisible,
+                 papszOptions]()
+                {
+                    GDALRasterBandH hTSBand = GDALRasterBand::ToHandle(
+                        poThreadSafeDS->GetRasterBand(nBandNum));
+                    for (int i = iBegin; i < iEnd; ++i)
+                    {
+                        const int iRay = asOrder[i].second;
+                        pabyVisible[iRay] =
+                            GDALIsLineOfSightVisible(
+                                hTSBand, panXA[iRay], panYA[iRay],
+                                padfZA[iRay], panXB[iRay], panYB[iRay],
+                                padfZB[iRay], nullptr, nullptr, papszOptions)
+                                ? 1
+                                : 0;
+                    }
+                });
+        }
+        oPool.WaitCompletion();
+        poThreadSafeDS->ReleaseRef();
+        return true;
+    }
+
+    for (int i = 0; i < nPoints; ++i)
+    {
+        const int iRay = asOrder[i].second;
+        pabyVisible[iRay] =
+            GDALIsLineOfSightVisible(hBand, panXA[iRay], panYA[iRay],
+                                     padfZA[iRay], panXB[iRay], panYB[iRay],
+                                     padfZB[iRay], nullptr, nullptr,
+                                     papszOptions)
+                ? 1
+                : 0;
+    }
+    return true;
+}
@@ -14,8 +14,13 @@
 #define MARCHING_SQUARES_CONTOUR_GENERATOR_H
 
 #include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include <algorithm>
 
+#include "cpl_conv.h"
+#include "cpl_string.h"
 #include "gdal.h"
 
 #include "utility.h"
@@ -155,6 +160,112 @@ class ContourGeneratorFromRaster
     {
         size_t width = GDALGetRasterBandXSize(band_);
         size_t height = GDALGetRasterBandYSize(band_);
+
+        const auto readLine = [this, width](size_t lineIdx, double *buffer)
+        {
+            const CPLErr error =
+                GDALRasterIO(band_, GF_Read, 0, int(lineIdx), int(width), 1,
+                             buffer, int(width), 1, GDT_Float64, 0, 0);
+            if (error != CE_None)
+            {
+                CPLDebug("CONTOUR", "failed fetch %d %d", int(lineIdx),
+                         int(width));
+            }
+            return error;
+        };
+
+        if (height > 1 &&
+            CPLTestBool(
+                CPLGetConfigOption("GDAL_CONTOUR_LINE_PREFETCH", "YES")))
+        {
+            // Double-buffered reading: a helper thread fetches line N+1
+            // while line N is fed to the contour generator, so raster
+            // decoding overlaps with the marching-squares computation.
+            // The band is only ever accessed by one thread at a time.
+            std::vector<double> curLine(width);
+            std::vector<double> nextLine(width);
+
+            std::mutex oMutex;
+            std::condition_variable oCV;
+            size_t requestedLine = 0;
+            bool bHasRequest = false;
+            bool bLineReady = false;
+            bool bExitThread = false;
+            CPLErr eReadErr = CE_None;
+
+            std::thread oReaderThread(
+                [&]()
+                {
+                    std::unique_lock<std::mutex> oLock(oMutex);
+                    while (true)
+                    {
+                        oCV.wait(oLock, [&]()
+                                 { return bHasRequest || bExitThread; });
+                        if (bExitThread)
+                            break;
+                        const size_t lineToRead = requestedLine;
+                        bHasRequest = false;
+                        oLock.unlock();
+                        const CPLErr eErr =
+                            readLine(lineToRead, nextLine.data());
+                        oLock.lock();
+                        eReadErr = eErr;
+                        bLineReady = true;
+                        oCV.notify_all();
+                    }
+                });
+
+            bool ok = readLine(0, curLine.data()) == CE_None;
+            for (size_t lineIdx = 0; ok && lineIdx < height; lineIdx++)
+            {
+                if (progressFunc &&
+                    progressFunc(double(lineIdx) / height, "Processing line",
+                                 progressData) == FALSE)
+                {
+                    ok = false;
+                    break;
+                }
+
+                const bool bMoreLines = lineIdx + 1 < height;
+                if (bMoreLines)
+                {
+                    std::lock_guard<std::mutex> oLock(oMutex);
+                    requestedLine = lineIdx + 1;
+                    bHasRequest = true;
+                    bLineReady = false;
+                    oCV.notify_all();
+                }
+
+                this->feedLine(curLine.data());
+
+                if (bMoreLines)
+                {
+                    std::unique_lock<std::mutex> oLock(oMutex);
+                    oCV.wait(oLock, [&]() { return bLineReady; });
+                    if (eReadErr != CE_None)
+                    {
+                        ok = false;
+                        break;
+                    }
+                    std::swap(curLine, nextLine);
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> oLock(oMutex);
+                bExitThread = true;
+                oCV.notify_all();
+            }
+            oReaderThread.join();
+
+            if (!ok)
+                return false;
+
+            if (progressFunc)
+                progressFunc(1.0, "", progressData);
+            return true;
+        }
+
         std::vector<double> line;
         line.resize(width);
 
@@ -165,13 +276,8 @@ class ContourGeneratorFromRaster
                              progressData) == FALSE)
                 return false;
 
-            CPLErr error =
-                GDALRasterIO(band_, GF_Read, 0, int(lineIdx), int(width), 1,
-                             &line[0], int(width), 1, GDT_Float64, 0, 0);
-            if (error != CE_None)
+            if (readLine(lineIdx, &line[0]) != CE_None)
             {
-                CPLDebug("CONTOUR", "failed fetch %d %d", int(lineIdx),
-                         int(width));
                 return false;
             }
             this->feedLine(&line[0]);
@@ -329,6 +329,10 @@ Polygonizer<PolyIdType, DataType>::~Polygonizer()
     {
         delete pair.second;
     }
+    for (RPolygon *poPolygon : apoRecycledPolygons_)
+    {
+        delete poPolygon;
+    }
 }
 
 template <typename PolyIdType, typename DataType>
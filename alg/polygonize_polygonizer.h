@@ -22,6 +22,7 @@
 #include <vector>
 #include <limits>
 #include <map>
+#include <unordered_map>
 
 #include "cpl_error.h"
 #include "ogr_api.h"
@@ -92,6 +93,16 @@ struct RPolygon
      * update the bottom-right most cell index of the current polygon
      */
     void updateBottomRightPos(IndexType iRow, IndexType iCol);
+
+    /**
+     * reinitialize the polygon for reuse by the polygon recycling pool
+     */
+    void reset()
+    {
+        iBottomRightRow = 0;
+        iBottomRightCol = 0;
+        oArcs.clear();
+    }
 };
 
 /**
@@ -140,12 +151,18 @@ template <typename PolyIdType, typename DataType> class Polygonizer
         std::numeric_limits<PolyIdType>::max();
 
   private:
-    using PolygonMap = std::map<PolyIdType, RPolygon *>;
+    // Hashed: looked up per traced cell, and polygon ids have no useful
+    // ordering.
+    using PolygonMap = std::unordered_map<PolyIdType, RPolygon *>;
     using PolygonMapEntry = typename PolygonMap::value_type;
 
     PolyIdType nInvalidPolyId_;
     RPolygon *poTheOuterPolygon_{nullptr};
     PolygonMap oPolygonMap_{};
+    // Completed polygons are recycled rather than deleted: one polygon
+    // object is created and destroyed per emitted feature, which on
+    // billion-pixel rasters makes allocator churn measurable.
+    std::vector<RPolygon *> apoRecycledPolygons_{};
 
     PolygonReceiver<DataType> *poPolygonReceiver_;
 
@@ -19,6 +19,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <vector>
 #include <string>
 #include <utility>
 
@@ -391,6 +392,261 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
  * @return CE_None on success or CE_Failure if something goes wrong.
  */
 
+/************************************************************************/
+/*                   GDALFillNodataCoarseToFine()                       */
+/************************************************************************/
+
+/* Pyramidal variant of GDALFillNodata(): the band and its validity mask
+ * are downsampled by factors of two (averaging valid pixels only) until
+ * every remaining hole closes or the level degenerates, and the holes of
+ * each level are then filled from the coarser one, followed by a few
+ * 3x3 smoothing iterations restricted to filled pixels. This is
+ * algorithmically much cheaper than a large search distance on big holes.
+ * The pyramid is held in memory, so this mode is reserved for rasters
+ * whose float32 representation fits comfortably in RAM. */
+static CPLErr GDALFillNodataCoarseToFine(GDALRasterBandH hTargetBand,
+                                         GDALRasterBandH hMaskBand,
+                                         int nSmoothingIterations,
+                                         GDALProgressFunc pfnProgress,
+                                         void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+
+    struct Level
+    {
+        int nX = 0;
+        int nY = 0;
+        std::vector<float> afVal{};
+        std::vector<GByte> abyValid{};
+    };
+
+    std::vector<Level> aoLevels(1);
+    aoLevels[0].nX = nXSize;
+    aoLevels[0].nY = nYSize;
+    try
+    {
+        aoLevels[0].afVal.resize(static_cast<size_t>(nXSize) * nYSize);
+        aoLevels[0].abyValid.resize(static_cast<size_t>(nXSize) * nYSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory", __func__);
+        return CE_Failure;
+    }
+
+    if (GDALRasterIO(hTargetBand, GF_Read, 0, 0, nXSize, nYSize,
+                     aoLevels[0].afVal.data(), nXSize, nYSize, GDT_Float32, 0,
+                     0) != CE_None ||
+        GDALRasterIO(hMaskBand, GF_Read, 0, 0, nXSize, nYSize,
+                     aoLevels[0].abyValid.data(), nXSize, nYSize, GDT_Byte, 0,
+                     0) != CE_None)
+    {
+        return CE_Failure;
+    }
+
+    /* ---------------- Build the pyramid ---------------- */
+    while (true)
+    {
+        const Level &oPrev = aoLevels.back();
+        bool bHasHole = false;
+        for (size_t i = 0; !bHasHole && i < oPrev.abyValid.size(); ++i)
+            bHasHole = oPrev.abyValid[i] == 0;
+        if (!bHasHole || (oPrev.nX <= 2 && oPrev.nY <= 2))
+            break;
+
+        Level oNext;
+        oNext.nX = std::max(1, oPrev.nX / 2);
+        oNext.nY = std::max(1, oPrev.nY / 2);
+        try
+        {
+            oNext.afVal.resize(static_cast<size_t>(oNext.nX) * oNext.nY);
+            oNext.abyValid.resize(static_cast<size_t>(oNext.nX) * oNext.nY);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                     __func__);
+            return CE_Failure;
+        }
+        for (int iY = 0; iY < oNext.nY; ++iY)
+        {
+            for (int iX = 0; iX < oNext.nX; ++iX)
+            {
+                double dfSum = 0;
+                int nCount = 0;
+                for (int iSubY = 2 * iY;
+                     iSubY < std::min(2 * iY + 2, oPrev.nY); ++iSubY)
+                {
+                    for (int iSubX = 2 * iX;
+                         iSubX < std::min(2 * iX + 2, oPrev.nX); ++iSubX)
+                    {
+                        const size_t iOff =
+                            static_cast<size_t>(iSubY) * oPrev.nX + iSubX;
+                        if (oPrev.abyValid[iOff])
+                        {
+                            dfSum += oPrev.afVal[iOff];
+                            ++nCount;
+                        }
+                    }
+                }
+                const size_t iOff = static_cast<size_t>(iY) * oNext.nX + iX;
+                if (nCount)
+                {
+                    oNext.afVal[iOff] = static_cast<float>(dfSum / nCount);
+                    oNext.abyValid[iOff] = 1;
+                }
+                else
+                {
+                    oNext.afVal[iOff] = 0.0f;
+                    oNext.abyValid[iOff] = 0;
+                }
+            }
+        }
+        aoLevels.emplace_back(std::move(oNext));
+    }
+
+    /* ---------------- Fill downward ---------------- */
+    // At the coarsest level, fill any remaining hole with the mean of the
+    // valid pixels.
+    {
+        Level &oCoarsest = aoLevels.back();
+        double dfSum = 0;
+        GIntBig nCount = 0;
+        for (size_t i = 0; i < oCoarsest.abyValid.size(); ++i)
+        {
+            if (oCoarsest.abyValid[i])
+            {
+                dfSum += oCoarsest.afVal[i];
+                ++nCount;
+            }
+        }
+        const float fMean =
+            nCount ? static_cast<float>(dfSum / nCount) : 0.0f;
+        for (size_t i = 0; i < oCoarsest.abyValid.size(); ++i)
+        {
+            if (!oCoarsest.abyValid[i])
+                oCoarsest.afVal[i] = fMean;
+        }
+    }
+
+    for (size_t iLevel = aoLevels.size() - 1; iLevel > 0; --iLevel)
+    {
+        const Level &oCoarse = aoLevels[iLevel];
+        Level &oFine = aoLevels[iLevel - 1];
+
+        // Transfer the coarse values into the holes
+        for (int iY = 0; iY < oFine.nY; ++iY)
+        {
+            const int iCY = std::min(iY / 2, oCoarse.nY - 1);
+            for (int iX = 0; iX < oFine.nX; ++iX)
+            {
+                const size_t iOff = static_cast<size_t>(iY) * oFine.nX + iX;
+                if (!oFine.abyValid[iOff])
+                {
+                    const int iCX = std::min(iX / 2, oCoarse.nX - 1);
+                    oFine.afVal[iOff] =
+                        oCoarse
+                            .afVal[static_cast<size_t>(iCY) * oCoarse.nX + iCX];
+                }
+            }
+        }
+
+        // A few 3x3 smoothing iterations restricted to the filled pixels
+        const int nIters = std::max(1, nSmoothingIterations);
+        std::vector<float> afTmp(oFine.afVal);
+        for (int iIter = 0; iIter < nIters; ++iIter)
+        {
+            for (int iY = 0; iY < oFine.nY; ++iY)
+            {
+                for (int iX = 0; iX < oFine.nX; ++iX)
+                {
+                    const size_t iOff =
+                        static_cast<size_t>(iY) * oFine.nX + iX;
+                    if (oFine.abyValid[iOff])
+                        continue;
+                    double dfSum = 0;
+                    int nCount = 0;
+                    for (int iDY = -1; iDY <= 1; ++iDY)
+                    {
+                        for (int iDX = -1; iDX <= 1; ++iDX)
+                        {
+                            const int iNY = iY + iDY;
+                            const int iNX = iX + iDX;
+                            if (iNY >= 0 && iNY < oFine.nY && iNX >= 0 &&
+                                iNX < oFine.nX)
+                            {
+                                dfSum += oFine.afVal[static_cast<size_t>(iNY) *
+                                                         oFine.nX +
+                                                     iNX];
+                                ++nCount;
+                            }
+                        }
+                    }
+                    afTmp[iOff] = static_cast<float>(dfSum / nCount);
+                }
+            }
+            for (int iY = 0; iY < oFine.nY; ++iY)
+            {
+                for (int iX = 0; iX < oFine.nX; ++iX)
+                {
+                    const size_t iOff =
+                        static_cast<size_t>(iY) * oFine.nX + iX;
+                    if (!oFine.abyValid[iOff])
+                        oFine.afVal[iOff] = afTmp[iOff];
+                }
+            }
+        }
+
+        if (pfnProgress &&
+            !pfnProgress(static_cast<double>(aoLevels.size() - iLevel) /
+                             static_cast<double>(aoLevels.size()),
+                         "Filling nodata", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    // Write back only the filled pixels, so that valid pixels of data
+    // types wider than Float32 are not degraded by a buffer round-trip.
+    {
+        std::vector<double> adfLine(nXSize);
+        const Level &oFinest = aoLevels[0];
+        for (int iY = 0; iY < nYSize; ++iY)
+        {
+            const size_t iRowOff = static_cast<size_t>(iY) * nXSize;
+            bool bRowHasHole = false;
+            for (int iX = 0; !bRowHasHole && iX < nXSize; ++iX)
+                bRowHasHole = oFinest.abyValid[iRowOff + iX] == 0;
+            if (!bRowHasHole)
+                continue;
+            if (GDALRasterIO(hTargetBand, GF_Read, 0, iY, nXSize, 1,
+                             adfLine.data(), nXSize, 1, GDT_Float64, 0,
+                             0) != CE_None)
+            {
+                return CE_Failure;
+            }
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                if (!oFinest.abyValid[iRowOff + iX])
+                    adfLine[iX] = oFinest.afVal[iRowOff + iX];
+            }
+            if (GDALRasterIO(hTargetBand, GF_Write, 0, iY, nXSize, 1,
+                             adfLine.data(), nXSize, 1, GDT_Float64, 0,
+                             0) != CE_None)
+            {
+                return CE_Failure;
+            }
+        }
+    }
+
+    if (pfnProgress)
+        pfnProgress(1.0, "Filling nodata", pProgressArg);
+
+    return CE_None;
+}
+
 CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
                                   GDALRasterBandH hMaskBand,
                                   double dfMaxSearchDist,
@@ -405,6 +661,29 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
     const int nXSize = GDALGetRasterBandXSize(hTargetBand);
     const int nYSize = GDALGetRasterBandYSize(hTargetBand);
 
+    if (hMaskBand != nullptr &&
+        EQUAL(CSLFetchNameValueDef(papszOptions, "STRATEGY", "SCANLINE"),
+              "COARSE_TO_FINE"))
+    {
+        // The in-memory pyramid needs ~5 bytes per pixel: refuse if that
+        // does not comfortably fit in usable RAM.
+        const GIntBig nRAM = CPLGetUsablePhysicalRAM();
+        const GIntBig nNeeded =
+            static_cast<GIntBig>(nXSize) * nYSize * 5 * 3 / 2;
+        if (nRAM > 0 && nNeeded > nRAM / 2)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "STRATEGY=COARSE_TO_FINE requires " CPL_FRMT_GIB
+                     " MB of RAM on this raster: falling back is not "
+                     "automatic, use the default strategy",
+                     nNeeded / (1024 * 1024));
+            return CE_Failure;
+        }
+        return GDALFillNodataCoarseToFine(hTargetBand, hMaskBand,
+                                          nSmoothingIterations, pfnProgress,
+                                          pProgressArg);
+    }
+
     if (dfMaxSearchDist == 0.0)
         dfMaxSearchDist = std::max(nXSize, nYSize) + 1;
 
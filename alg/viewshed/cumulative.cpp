@@ -61,6 +61,48 @@ bool Cumulative::run(const std::string &srcFilename,
     m_extent.xStop = GDALGetRasterBandXSize(pSrcBand);
     m_extent.yStop = GDALGetRasterBandYSize(pSrcBand);
 
+    /* -------------------------------------------------------------------- */
+    /*      Decode the DEM once into a shared immutable buffer when it      */
+    /*      reasonably fits in RAM: each executor then reads through a      */
+    /*      thin per-thread MEM wrapper instead of re-reading and           */
+    /*      re-decoding the source through its own handle and cache.        */
+    /* -------------------------------------------------------------------- */
+    if (CPLTestBool(CPLGetConfigOption("GDAL_VIEWSHED_SHARED_DEM", "YES")))
+    {
+        const GDALDataType eDT = pSrcBand->GetRasterDataType();
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+        const GIntBig nBytes = static_cast<GIntBig>(m_extent.xStop) *
+                               m_extent.yStop * nDTSize;
+        const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+        if (nBytes > 0 && (nUsableRAM == 0 || nBytes < nUsableRAM / 4))
+        {
+            try
+            {
+                m_sharedDem.resize(static_cast<size_t>(nBytes));
+            }
+            catch (const std::exception &)
+            {
+                m_sharedDem.clear();
+            }
+            if (!m_sharedDem.empty() &&
+                pSrcBand->RasterIO(GF_Read, 0, 0, m_extent.xStop,
+                                   m_extent.yStop, m_sharedDem.data(),
+                                   m_extent.xStop, m_extent.yStop, eDT, 0, 0,
+                                   nullptr) == CE_None)
+            {
+                m_sharedDemType = eDT;
+                srcDS->GetGeoTransform(m_sharedDemGT);
+                int bHasNoData = FALSE;
+                m_sharedDemNoData = pSrcBand->GetNoDataValue(&bHasNoData);
+                m_sharedDemHasNoData = CPL_TO_BOOL(bHasNoData);
+            }
+            else
+            {
+                m_sharedDem.clear();
+            }
+        }
+    }
+
     // Make a bunch of observer locations based on the spacing and stick them on a queue
     // to be handled by viewshed executors.
     for (int x = 0; x < m_extent.xStop; x += m_opts.observerSpacing)
@@ -136,7 +178,28 @@ void Cumulative::runExecutor(const std::string &srcFilename, Progress &progress,
                              std::atomic<bool> &err, std::atomic<int> &running,
                              std::atomic<bool> &hasFoundNoData)
 {
-    DatasetPtr srcDs(GDALDataset::Open(srcFilename.c_str(), GA_ReadOnly));
+    DatasetPtr srcDs;
+    if (m_sharedDemType != GDT_Unknown)
+    {
+        // Per-thread MEM wrapper around the shared immutable DEM buffer.
+        auto poMemDS = std::unique_ptr<MEMDataset>(MEMDataset::Create(
+            "", m_extent.xSize(), m_extent.ySize(), 0, m_sharedDemType,
+            nullptr));
+        if (poMemDS)
+        {
+            GDALRasterBandH hBand = MEMCreateRasterBandEx(
+                poMemDS.get(), 1,
+                const_cast<GByte *>(m_sharedDem.data()), m_sharedDemType, 0,
+                0, false);
+            poMemDS->AddMEMBand(hBand);
+            poMemDS->SetGeoTransform(m_sharedDemGT);
+            if (m_sharedDemHasNoData)
+                poMemDS->GetRasterBand(1)->SetNoDataValue(m_sharedDemNoData);
+            srcDs.reset(poMemDS.release());
+        }
+    }
+    if (!srcDs)
+        srcDs.reset(GDALDataset::Open(srcFilename.c_str(), GA_ReadOnly));
     if (!srcDs)
     {
         err = true;
@@ -10,6 +10,8 @@
 #include <atomic>
 #include <vector>
 
+#include "gdal_priv.h"
+
 #include "notifyqueue.h"
 #include "progress.h"
 #include "viewshed_types.h"
@@ -50,6 +52,14 @@ class Cumulative
 
     Window m_extent{};
     Options m_opts;
+    // Shared immutable copy of the DEM, decoded once and wrapped in a
+    // per-executor MEM dataset, so executors don't each re-read and
+    // re-decode the source through their own handle/cache.
+    std::vector<GByte> m_sharedDem{};
+    GDALDataType m_sharedDemType = GDT_Unknown;
+    GDALGeoTransform m_sharedDemGT{};
+    double m_sharedDemNoData = 0;
+    bool m_sharedDemHasNoData = false;
     ObserverQueue m_observerQueue{};
     DatasetQueue m_datasetQueue{};
     DatasetQueue m_rollupQueue{};
@@ -145,13 +145,32 @@ double doMax(int nXOffset, int nYOffset, double dfThisPrev, double dfLast,
 /// @param progress  Reference to the progress tracker.
 /// @param emitWarningIfNoData  Whether a warning must be emitted if an input
 ///                             pixel is at the nodata value.
+/// Worker pool shared by all executors: evaluating many candidate
+/// observers in sequence no longer pays thread creation/teardown per
+/// viewshed, and concurrent executors (each working on its own band, e.g.
+/// thread-safe dataset wrappers over a shared DEM) share a bounded set of
+/// workers. Sized by GDAL_VIEWSHED_NUM_THREADS (default 4, the previous
+/// per-executor pool size).
+static CPLWorkerThreadPool &executorPool()
+{
+    // At least the 4 threads a single executor used to own, and enough
+    // for the concurrent executors of cumulative mode on many-core hosts.
+    const int nDefaultThreads = std::max(4, CPLGetNumCPUs());
+    const char *pszThreads =
+        CPLGetConfigOption("GDAL_VIEWSHED_NUM_THREADS", nullptr);
+    static CPLWorkerThreadPool pool(
+        std::max(1, pszThreads ? atoi(pszThreads) : nDefaultThreads));
+    return pool;
+}
+
 ViewshedExecutor::ViewshedExecutor(GDALRasterBand &srcBand,
                                    GDALRasterBand &sdBand,
                                    GDALRasterBand &dstBand, int nX, int nY,
                                    const Window &outExtent,
                                    const Window &curExtent, const Options &opts,
                                    Progress &progress, bool emitWarningIfNoData)
-    : m_pool(4), m_dummyBand(), m_srcBand(srcBand), m_sdBand(sdBand),
+    : m_pool(executorPool()), m_dummyBand(), m_srcBand(srcBand),
+      m_sdBand(sdBand),
       m_dstBand(dstBand),
       // If the standard deviation band isn't a dummy band, we're in SD mode.
       m_hasSdBand(dynamic_cast<DummyBand *>(&m_sdBand) == nullptr),
@@ -87,7 +87,7 @@ class ViewshedExecutor
     }
 
   private:
-    CPLWorkerThreadPool m_pool;
+    CPLWorkerThreadPool &m_pool;
     DummyBand m_dummyBand;
     GDALRasterBand &m_srcBand;
     GDALRasterBand &m_sdBand;
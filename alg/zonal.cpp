@@ -1268,16 +1268,29 @@ class GDALZonalStatsImpl
                 }
 
                 size_t ipx = 0;
+                // Zone rasters have long runs of constant values: cache the
+                // stats vector of the previous pixel's zone to skip the map
+                // lookup on runs.
+                double dfLastZone = 0;
+                std::vector<gdal::RasterStats<double>> *paoLastStats = nullptr;
+                const auto IsSameZone = [](double a, double b)
+                { return a == b || (std::isnan(a) && std::isnan(b)); };
                 for (int k = 0; k < oWindow.nYSize; k++)
                 {
                     for (int j = 0; j < oWindow.nXSize; j++)
                     {
-                        // TODO use inner loop to search for a block of constant pixel values.
                         double zone =
                             reinterpret_cast<double *>(pabyZonesBuf.get())[ipx];
 
-                        auto &aoStats = stats[zone];
-                        aoStats.resize(m_options.bands.size(), CreateStats());
+                        if (paoLastStats == nullptr ||
+                            !IsSameZone(zone, dfLastZone))
+                        {
+                            paoLastStats = &stats[zone];
+                            paoLastStats->resize(m_options.bands.size(),
+                                                 CreateStats());
+                            dfLastZone = zone;
+                        }
+                        auto &aoStats = *paoLastStats;
 
                         aoStats[i].process(
                             reinterpret_cast<double *>(m_pabyValuesBuf.get()) +
@@ -918,6 +918,13 @@ MAIN_START(nArgc, papszArgv)
         if (nBandCount > 0)
             CPLSetConfigOption("USE_RRD", "YES");
 
+        // Overview computation and the GeoTIFF .ovr writer both scale with
+        // GDAL_NUM_THREADS; building overviews is a dedicated batch
+        // operation, so default to using the machine unless the user chose
+        // otherwise.
+        if (CPLGetConfigOption("GDAL_NUM_THREADS", nullptr) == nullptr)
+            CPLSetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+
         if (!anLevels.empty() &&
             GDALBuildOverviews(hDataset, osResampling.c_str(),
                                static_cast<int>(anLevels.size()),
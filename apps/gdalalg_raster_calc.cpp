@@ -16,12 +16,17 @@
 #include "../frmts/vrt/vrtdataset.h"
 
 #include "cpl_float.h"
+#include "cpl_multiproc.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "vrtdataset.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <optional>
 
 //! @cond Doxygen_Suppress
@@ -969,6 +974,232 @@ bool GDALRasterCalcAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
     return RunPreStepPipelineValidations() && RunStep(stepCtxt);
 }
 
+/************************************************************************/
+/*                   GDALCalcTryParallelMaterialize()                   */
+/*                                                                      */
+/*      Opt-in (GDAL_CALC_PARALLEL=YES) multi-worker evaluation of      */
+/*      the derived VRT: each worker opens its own copy of the VRT      */
+/*      from its serialized XML (hence its own expression state and     */
+/*      input dataset handles, with no cross-thread sharing), claims    */
+/*      chunks of output rows, and only the writes into the            */
+/*      destination are serialized. Within a worker's chunk, input      */
+/*      blocks are shared across the output bands through the source    */
+/*      dataset block cache, so an A+B / A-B band pair fetches A and    */
+/*      B once. Returns nullptr with *pbFatalError = false whenever     */
+/*      the setup does not qualify, in which case the caller uses the   */
+/*      regular GDALTranslate() path.                                   */
+/************************************************************************/
+
+static std::unique_ptr<GDALDataset> GDALCalcTryParallelMaterialize(
+    GDALDataset *poVRT, const std::string &osDstName,
+    const std::string &osFormat,
+    const std::vector<std::string> &creationOptions,
+    GDALProgressFunc pfnProgress, void *pProgressData, bool *pbFatalError)
+{
+    *pbFatalError = false;
+
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_CALC_PARALLEL", "NO")))
+        return nullptr;
+
+    const int nThreads = GDALGetNumThreads();
+    if (nThreads < 2)
+        return nullptr;
+
+    GDALDriver *poDriver = nullptr;
+    if (!osFormat.empty())
+    {
+        poDriver = GetGDALDriverManager()->GetDriverByName(osFormat.c_str());
+    }
+    else
+    {
+        const CPLStringList aosDrivers(GDALGetOutputDriversForDatasetName(
+            osDstName.c_str(), GDAL_OF_RASTER, /* bSingleMatch = */ true,
+            /* bEmitWarning = */ false));
+        if (!aosDrivers.empty())
+            poDriver =
+                GetGDALDriverManager()->GetDriverByName(aosDrivers[0]);
+    }
+    if (poDriver == nullptr ||
+        poDriver->GetMetadataItem(GDAL_DCAP_CREATE) == nullptr)
+        return nullptr;
+
+    const int nXSize = poVRT->GetRasterXSize();
+    const int nYSize = poVRT->GetRasterYSize();
+    const int nBands = poVRT->GetRasterCount();
+    if (nBands == 0)
+        return nullptr;
+    const GDALDataType eDT = poVRT->GetRasterBand(1)->GetRasterDataType();
+    for (int i = 2; i <= nBands; ++i)
+    {
+        if (poVRT->GetRasterBand(i)->GetRasterDataType() != eDT)
+            return nullptr;
+    }
+
+    CSLConstList papszXML = poVRT->GetMetadata("xml:VRT");
+    if (papszXML == nullptr || papszXML[0] == nullptr)
+        return nullptr;
+
+    // One fully independent copy of the VRT per worker.
+    std::vector<std::unique_ptr<GDALDataset>> apoWorkerVRTs;
+    for (int i = 0; i < nThreads; ++i)
+    {
+        auto poWorkerVRT = std::unique_ptr<GDALDataset>(GDALDataset::Open(
+            papszXML[0], GDAL_OF_RASTER | GDAL_OF_INTERNAL, nullptr, nullptr,
+            nullptr));
+        if (poWorkerVRT == nullptr)
+            return nullptr;
+        apoWorkerVRTs.push_back(std::move(poWorkerVRT));
+    }
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (poPool == nullptr)
+        return nullptr;
+
+    CPLStringList aosCreationOptions;
+    for (const std::string &co : creationOptions)
+        aosCreationOptions.AddString(co.c_str());
+    auto poOut = std::unique_ptr<GDALDataset>(
+        poDriver->Create(osDstName.c_str(), nXSize, nYSize, nBands, eDT,
+                         aosCreationOptions.List()));
+    if (poOut == nullptr)
+        return nullptr;
+
+    poOut->SetSpatialRef(poVRT->GetSpatialRef());
+    GDALGeoTransform gt;
+    if (poVRT->GetGeoTransform(gt) == CE_None)
+        poOut->SetGeoTransform(gt);
+    poOut->SetMetadata(poVRT->GetMetadata());
+    for (int i = 1; i <= nBands; ++i)
+    {
+        GDALRasterBand *poSrcBand = poVRT->GetRasterBand(i);
+        GDALRasterBand *poDstBand = poOut->GetRasterBand(i);
+        int bHasNoData = FALSE;
+        const double dfNoData = poSrcBand->GetNoDataValue(&bHasNoData);
+        if (bHasNoData)
+            poDstBand->SetNoDataValue(dfNoData);
+        poDstBand->SetDescription(poSrcBand->GetDescription());
+    }
+
+    // Chunk of rows aligned on the output block height, sized so that each
+    // worker buffer stays modest and there are enough chunks to balance.
+    int nBlockXSize = 0;
+    int nBlockYSize = 1;
+    poOut->GetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    nBlockYSize = std::max(1, nBlockYSize);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const GIntBig nBytesPerRow =
+        static_cast<GIntBig>(nXSize) * nBands * nDTSize;
+    int nChunkRows = nBlockYSize;
+    while (nChunkRows < nYSize / (nThreads * 8) &&
+           nBytesPerRow * (nChunkRows + nBlockYSize) <= 64 * 1024 * 1024)
+    {
+        nChunkRows += nBlockYSize;
+    }
+    const int nChunks = DIV_ROUND_UP(nYSize, nChunkRows);
+
+    // Not worth it (single chunk), or per-worker buffers would be huge
+    // (e.g. drivers whose natural block is the whole raster): remove the
+    // just-created file and let the regular path handle the request.
+    if (nChunks < 2 || nBytesPerRow * nChunkRows > 256 * 1024 * 1024)
+    {
+        poOut.reset();
+        CPL_IGNORE_RET_VAL(poDriver->Delete(osDstName.c_str()));
+        return nullptr;
+    }
+
+    std::atomic<int> nNextChunk{0};
+    std::atomic<int> nCompletedChunks{0};
+    std::atomic<bool> bError{false};
+    std::mutex oWriteMutex;
+
+    const auto oWorker =
+        [nXSize, nYSize, nBands, eDT, nDTSize, nChunkRows, nChunks,
+         &nNextChunk, &nCompletedChunks, &bError, &oWriteMutex,
+         &poOut](GDALDataset *poWorkerVRT)
+    {
+        std::vector<GByte> abyBuffer;
+        try
+        {
+            abyBuffer.resize(static_cast<size_t>(nChunkRows) * nXSize *
+                             nBands * nDTSize);
+        }
+        catch (const std::exception &)
+        {
+            bError = true;
+            return;
+        }
+        while (!bError)
+        {
+            const int iChunk = nNextChunk.fetch_add(1);
+            if (iChunk >= nChunks)
+                break;
+            const int nYOff = iChunk * nChunkRows;
+            const int nRows = std::min(nChunkRows, nYSize - nYOff);
+            if (poWorkerVRT->RasterIO(GF_Read, 0, nYOff, nXSize, nRows,
+                                      abyBuffer.data(), nXSize, nRows, eDT,
+                                      nBands, nullptr, 0, 0, 0,
+                                      nullptr) != CE_None)
+            {
+                bError = true;
+                break;
+            }
+            {
+                std::lock_guard<std::mutex> oLock(oWriteMutex);
+                if (poOut->RasterIO(GF_Write, 0, nYOff, nXSize, nRows,
+                                    abyBuffer.data(), nXSize, nRows, eDT,
+                                    nBands, nullptr, 0, 0, 0,
+                                    nullptr) != CE_None)
+                {
+                    bError = true;
+                    break;
+                }
+            }
+            ++nCompletedChunks;
+        }
+    };
+
+    auto poQueue = poPool->CreateJobQueue();
+    for (int i = 0; i < nThreads; ++i)
+    {
+        GDALDataset *poWorkerVRT = apoWorkerVRTs[i].get();
+        poQueue->SubmitJob([&oWorker, poWorkerVRT]()
+                           { oWorker(poWorkerVRT); });
+    }
+
+    // Report progress from this thread while the workers run.
+    while (nCompletedChunks < nChunks && !bError)
+    {
+        CPLSleep(0.05);
+        if (pfnProgress != nullptr &&
+            !pfnProgress(static_cast<double>(nCompletedChunks) / nChunks, "",
+                         pProgressData))
+        {
+            bError = true;
+        }
+    }
+    poQueue->WaitCompletion();
+
+    if (bError)
+    {
+        // A failure at this stage (worker I/O error or user interruption)
+        // is final: do not fall back to re-running the whole computation.
+        poOut.reset();
+        CPL_IGNORE_RET_VAL(poDriver->Delete(osDstName.c_str()));
+        *pbFatalError = true;
+        return nullptr;
+    }
+
+    if (pfnProgress != nullptr)
+        pfnProgress(1.0, "", pProgressData);
+
+    if (poOut->FlushCache(false) != CE_None)
+    {
+        *pbFatalError = true;
+        return nullptr;
+    }
+    return poOut;
+}
+
 /************************************************************************/
 /*                  GDALRasterCalcAlgorithm::RunStep()                  */
 /************************************************************************/
@@ -1154,6 +1385,21 @@ bool GDALRasterCalcAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         return true;
     }
 
+    if (!bIsVRT)
+    {
+        bool bFatalError = false;
+        auto poParallelOut = GDALCalcTryParallelMaterialize(
+            vrt.get(), m_outputDataset.GetName(), m_format, m_creationOptions,
+            ctxt.m_pfnProgress, ctxt.m_pProgressData, &bFatalError);
+        if (poParallelOut)
+        {
+            m_outputDataset.Set(std::move(poParallelOut));
+            return true;
+        }
+        if (bFatalError)
+            return false;
+    }
+
     CPLStringList translateArgs;
     if (!m_format.empty())
     {
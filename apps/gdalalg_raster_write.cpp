@@ -12,6 +12,7 @@
 
 #include "gdalalg_raster_write.h"
 
+#include "cpl_conv.h"
 #include "cpl_string.h"
 #include "gdal_utils.h"
 #include "gdal_priv.h"
@@ -84,6 +85,13 @@ bool GDALRasterWriteAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     const auto nLastErrorCounter = CPLGetErrorCounter();
 
     GDALDatasetH hSrcDS = GDALDataset::ToHandle(poSrcDS);
+    // In a pipeline, the source is a chain of lazily evaluated datasets
+    // (warp, calc, ...): overlapping their evaluation with the output
+    // writing turns the final copy into a two-stage dataflow.
+    CPLConfigOptionSetter oSetter(
+        "GDAL_SWATH_PIPELINE",
+        CPLGetConfigOption("GDAL_SWATH_PIPELINE", "YES"),
+        /* bSetOnlyIfUndefined = */ false);
     auto poRetDS = GDALDataset::FromHandle(GDALTranslate(
         m_outputDataset.GetName().c_str(), hSrcDS, psOptions, nullptr));
     GDALTranslateOptionsFree(psOptions);
@@ -15,6 +15,8 @@
 #include "ogr_srs_api.h"
 
 #include "cpl_port.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "gdal_utils_priv.h"
 #include "gdalargumentparser.h"
@@ -26,7 +28,9 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -1829,6 +1833,79 @@ std::unique_ptr<GDALDataset> VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Probing the inputs is latency bound (metadata requests on       */
+    /*      remote files), while AnalyseRaster() must run serially in       */
+    /*      input order: open the datasets ahead on a bounded worker        */
+    /*      window and consume them in order.                               */
+    /* -------------------------------------------------------------------- */
+    std::vector<GDALDatasetH> ahPreopenedDS;
+    std::vector<bool> abPreopenedDone;
+    std::mutex oPreopenMutex;
+    std::condition_variable oPreopenCV;
+    std::unique_ptr<CPLJobQueue> poPreopenQueue;
+    int nNextToSubmit = 0;
+
+    const auto SubmitPreopen = [&](int idx)
+    {
+        const char *pszName = ppszInputFilenames[idx];
+        poPreopenQueue->SubmitJob(
+            [&, idx, pszName]()
+            {
+                GDALDatasetH hDS = GDALOpenEx(pszName, GDAL_OF_RASTER, nullptr,
+                                              papszOpenOptions, nullptr);
+                {
+                    std::lock_guard<std::mutex> oLock(oPreopenMutex);
+                    ahPreopenedDS[idx] = hDS;
+                    abPreopenedDone[idx] = true;
+                }
+                oPreopenCV.notify_all();
+            });
+    };
+
+    // Ensure that on every exit path the in-flight jobs are completed and
+    // unconsumed pre-opened datasets are closed.
+    struct PreopenCleaner
+    {
+        std::unique_ptr<CPLJobQueue> &m_poQueue;
+        std::vector<GDALDatasetH> &m_ahDS;
+
+        ~PreopenCleaner()
+        {
+            if (m_poQueue)
+            {
+                m_poQueue->WaitCompletion();
+                for (auto &hDS : m_ahDS)
+                {
+                    if (hDS)
+                        GDALClose(hDS);
+                }
+            }
+        }
+    };
+
+    PreopenCleaner oPreopenCleaner{poPreopenQueue, ahPreopenedDS};
+
+    if (pahSrcDS == nullptr && ppszInputFilenames != nullptr &&
+        nInputFiles >= 4 &&
+        CPLTestBool(CPLGetConfigOption("GDALBUILDVRT_PARALLEL_PROBE", "YES")))
+    {
+        const int nProbeThreads = GDALGetNumThreads(16, true);
+        if (nProbeThreads > 1)
+        {
+            if (auto *poPool = GDALGetGlobalThreadPool(nProbeThreads))
+            {
+                poPreopenQueue = poPool->CreateJobQueue();
+                ahPreopenedDS.resize(nInputFiles);
+                abPreopenedDone.resize(nInputFiles);
+                const int nWindowSize =
+                    std::min(nInputFiles, 2 * nProbeThreads);
+                for (; nNextToSubmit < nWindowSize; ++nNextToSubmit)
+                    SubmitPreopen(nNextToSubmit);
+            }
+        }
+    }
+
     bool bFoundValid = false;
     for (int i = 0; ppszInputFilenames != nullptr && i < nInputFiles; i++)
     {
@@ -1839,10 +1916,28 @@ std::unique_ptr<GDALDataset> VRTBuilder::Build(GDALProgressFunc pfnProgress,
             return nullptr;
         }
 
-        GDALDatasetH hDS = (pahSrcDS)
-                               ? pahSrcDS[i]
-                               : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
-                                            papszOpenOptions, nullptr);
+        GDALDatasetH hDS;
+        if (pahSrcDS)
+        {
+            hDS = pahSrcDS[i];
+        }
+        else if (poPreopenQueue)
+        {
+            {
+                std::unique_lock<std::mutex> oLock(oPreopenMutex);
+                oPreopenCV.wait(oLock, [&]() -> bool
+                                { return abPreopenedDone[i]; });
+                hDS = ahPreopenedDS[i];
+                ahPreopenedDS[i] = nullptr;
+            }
+            if (nNextToSubmit < nInputFiles)
+                SubmitPreopen(nNextToSubmit++);
+        }
+        else
+        {
+            hDS = GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
+                             papszOpenOptions, nullptr);
+        }
         asDatasetProperties[i].isFileOK = FALSE;
 
         if (hDS)
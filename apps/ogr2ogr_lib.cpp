@@ -25,6 +25,8 @@
 
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <future>
 #include <limits>
 #include <map>
@@ -33,6 +35,7 @@
 #include <set>
 #include <unordered_set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -3671,11 +3674,223 @@ GDALDatasetH GDALVectorTranslate(const char *pszDest, GDALDatasetH hDstDS,
             }
         }
 
+        /* -------------------------------------------------------------------- */
+        /*      Optional layer-parallel translation (OGR2OGR_LAYER_PARALLELISM)  */
+        /*      for multi-layer sources: the destination layers are created      */
+        /*      serially on the shared handles, then each worker re-opens its    */
+        /*      own source and destination connections and appends into its      */
+        /*      layer. Only usable when both datasets can be re-opened and the   */
+        /*      drivers support concurrent connections (e.g. client/server       */
+        /*      databases); layers that cannot be handled that way fall back to  */
+        /*      the sequential loop below.                                       */
+        /* -------------------------------------------------------------------- */
+        std::vector<bool> abLayerDone(nLayerCount, false);
+        const int nLayerParallelism = std::min(
+            128, atoi(CPLGetConfigOption("OGR2OGR_LAYER_PARALLELISM", "1")));
+        if (nLayerParallelism > 1 && nLayerCount > 1 && nRetCode == 0 &&
+            !psOptions->bSplitListFields &&
+            psOptions->nFIDToFetch == OGRNullFID &&
+            psOptions->osNewLayerName.empty() &&
+            psOptions->poClipSrc == nullptr &&
+            psOptions->poClipDst == nullptr && poGCPCoordTrans == nullptr &&
+            !(psOptions->nGroupTransactions > 0 &&
+              !psOptions->nLayerTransaction) &&
+            poDS->GetDescription()[0] != 0 && poODS->GetDescription()[0] != 0)
+        {
+            // Serial pass creating/preparing all destination layers.
+            bool bSetupOK = true;
+            for (int iLayer = 0; iLayer < nLayerCount && bSetupOK; iLayer++)
+            {
+                OGRLayer *poLayer = apoLayers[iLayer];
+                if (poLayer == nullptr)
+                    continue;
+                auto psInfo = oSetup.Setup(poLayer, nullptr, psOptions.get(),
+                                           nTotalEventsDone);
+                if (psInfo == nullptr && !psOptions->bSkipFailures)
+                    bSetupOK = false;
+            }
+
+            if (bSetupOK)
+            {
+                // The destination layers now exist: any layer handled by
+                // the sequential fallback loop must append into them
+                // rather than re-create them.
+                oSetup.m_bAppend = true;
+                oSetup.m_bOverwrite = false;
+            }
+
+            if (bSetupOK && poODS->FlushCache() == CE_None)
+            {
+                const std::string osSrcDSName = poDS->GetDescription();
+                const std::string osDstDSName = poODS->GetDescription();
+                const CPLStringList aosSrcOpenOptions(
+                    CSLDuplicate(poDS->GetOpenOptions()));
+                std::mutex oSetupMutex;
+                std::atomic<int> nNextLayer(0);
+                std::atomic<bool> bFailure(false);
+                std::vector<bool> abLayerFailed(nLayerCount, false);
+
+                const auto WorkerFunc = [&]()
+                {
+                    // OGRSpatialReference is not thread-safe (lazily
+                    // mutated PROJ state), so each worker uses its own
+                    // clones of the shared SRS objects. Cloning itself is
+                    // serialized since it reads the shared objects.
+                    std::unique_ptr<OGRSpatialReference> poOutputSRSWrk;
+                    std::unique_ptr<OGRSpatialReference> poUserSourceSRSWrk;
+                    {
+                        std::lock_guard<std::mutex> oLock(oSetupMutex);
+                        if (oTranslator.m_poOutputSRS)
+                            poOutputSRSWrk.reset(
+                                oTranslator.m_poOutputSRS->Clone());
+                        if (oTranslator.m_poUserSourceSRS)
+                            poUserSourceSRSWrk.reset(
+                                oTranslator.m_poUserSourceSRS->Clone());
+                    }
+
+                    while (!bFailure || psOptions->bSkipFailures)
+                    {
+                        const int iLayer = nNextLayer.fetch_add(1);
+                        if (iLayer >= nLayerCount)
+                            break;
+                        OGRLayer *poLayer = apoLayers[iLayer];
+                        if (poLayer == nullptr)
+                            continue;
+
+                        auto poWrkSrcDS =
+                            std::unique_ptr<GDALDataset>(GDALDataset::Open(
+                                osSrcDSName.c_str(),
+                                GDAL_OF_VECTOR | GDAL_OF_READONLY, nullptr,
+                                aosSrcOpenOptions.List(), nullptr));
+                        auto poWrkDstDS = std::unique_ptr<GDALDataset>(
+                            poWrkSrcDS == nullptr
+                                ? nullptr
+                                : GDALDataset::Open(osDstDSName.c_str(),
+                                                    GDAL_OF_VECTOR |
+                                                        GDAL_OF_UPDATE,
+                                                    nullptr, nullptr,
+                                                    nullptr));
+                        OGRLayer *poWrkSrcLayer =
+                            poWrkDstDS == nullptr
+                                ? nullptr
+                                : poWrkSrcDS->GetLayerByName(
+                                      poLayer->GetName());
+                        if (poWrkSrcLayer == nullptr)
+                        {
+                            // Cannot re-open: leave this layer to the
+                            // sequential loop.
+                            continue;
+                        }
+
+                        SetupTargetLayer oSetupWrk(oSetup);
+                        oSetupWrk.m_poSrcDS = poWrkSrcDS.get();
+                        oSetupWrk.m_poDstDS = poWrkDstDS.get();
+                        oSetupWrk.m_bAppend = true;
+                        oSetupWrk.m_bOverwrite = false;
+                        oSetupWrk.m_bNewDataSource = false;
+                        oSetupWrk.m_poOutputSRS = poOutputSRSWrk.get();
+                        oSetupWrk.m_poUserSourceSRS = poUserSourceSRSWrk.get();
+
+                        LayerTranslator oTranslatorWrk;
+                        oTranslatorWrk.m_poSrcDS = poWrkSrcDS.get();
+                        oTranslatorWrk.m_poODS = poWrkDstDS.get();
+                        oTranslatorWrk.m_bTransform = oTranslator.m_bTransform;
+                        oTranslatorWrk.m_bWrapDateline =
+                            oTranslator.m_bWrapDateline;
+                        oTranslatorWrk.m_osDateLineOffset =
+                            oTranslator.m_osDateLineOffset;
+                        oTranslatorWrk.m_poOutputSRS = poOutputSRSWrk.get();
+                        oTranslatorWrk.m_bNullifyOutputSRS =
+                            oTranslator.m_bNullifyOutputSRS;
+                        oTranslatorWrk.m_poUserSourceSRS =
+                            poUserSourceSRSWrk.get();
+                        oTranslatorWrk.m_eGType = oTranslator.m_eGType;
+                        oTranslatorWrk.m_eGeomTypeConversion =
+                            oTranslator.m_eGeomTypeConversion;
+                        oTranslatorWrk.m_bMakeValid = oTranslator.m_bMakeValid;
+                        oTranslatorWrk.m_bSkipInvalidGeom =
+                            oTranslator.m_bSkipInvalidGeom;
+                        oTranslatorWrk.m_nCoordDim = oTranslator.m_nCoordDim;
+                        oTranslatorWrk.m_eGeomOp = oTranslator.m_eGeomOp;
+                        oTranslatorWrk.m_dfGeomOpParam =
+                            oTranslator.m_dfGeomOpParam;
+                        oTranslatorWrk.m_bExplodeCollections =
+                            oTranslator.m_bExplodeCollections;
+                        oTranslatorWrk.m_bNativeData =
+                            oTranslator.m_bNativeData;
+                        oTranslatorWrk.m_nLimit = oTranslator.m_nLimit;
+
+                        GIntBig nEventsWrk = 0;
+                        std::unique_ptr<TargetLayerInfo> psInfoWrk;
+                        {
+                            // Setup() only reads psOptions, but serialize it
+                            // for safety as it was not written for concurrent
+                            // use.
+                            std::lock_guard<std::mutex> oLock(oSetupMutex);
+                            psInfoWrk =
+                                oSetupWrk.Setup(poWrkSrcLayer, nullptr,
+                                                psOptions.get(), nEventsWrk);
+                        }
+                        poWrkSrcLayer->ResetReading();
+                        const bool bOK =
+                            psInfoWrk != nullptr &&
+                            oTranslatorWrk.Translate(
+                                nullptr, psInfoWrk.get(),
+                                anLayerCountFeatures[iLayer], nullptr,
+                                nEventsWrk, nullptr, nullptr, psOptions.get());
+                        {
+                            std::lock_guard<std::mutex> oLock(oSetupMutex);
+                            abLayerDone[iLayer] = true;
+                            if (!bOK)
+                            {
+                                abLayerFailed[iLayer] = true;
+                                bFailure = true;
+                            }
+                        }
+                    }
+                };
+
+                std::vector<std::thread> aoThreads;
+                const int nThreads = std::min(nLayerParallelism, nLayerCount);
+                for (int i = 0; i < nThreads; ++i)
+                    aoThreads.emplace_back(WorkerFunc);
+                for (auto &oThread : aoThreads)
+                    oThread.join();
+
+                if (bFailure && !psOptions->bSkipFailures)
+                {
+                    for (int iLayer = 0; iLayer < nLayerCount; iLayer++)
+                    {
+                        if (abLayerFailed[iLayer])
+                        {
+                            CPLError(CE_Failure, CPLE_AppDefined,
+                                     "Terminating translation prematurely "
+                                     "after failed\n"
+                                     "translation of layer %s (use "
+                                     "-skipfailures to skip errors)",
+                                     apoLayers[iLayer]->GetName());
+                            break;
+                        }
+                    }
+                    nRetCode = 1;
+                }
+
+                // Per-feature progress cannot be reported from the workers;
+                // any layer left to the sequential loop would report
+                // inconsistent ranges, so disable it.
+                psOptions->bDisplayProgress = false;
+            }
+            else if (!bSetupOK)
+            {
+                nRetCode = 1;
+            }
+        }
+
         /* Second pass to do the real job */
         for (int iLayer = 0; iLayer < nLayerCount && nRetCode == 0; iLayer++)
         {
             OGRLayer *poLayer = apoLayers[iLayer];
-            if (poLayer == nullptr)
+            if (poLayer == nullptr || abLayerDone[iLayer])
                 continue;
 
             std::unique_ptr<OGRLayer> poLayerToFree;
@@ -6580,6 +6795,102 @@ bool LayerTranslator::Translate(
                              poOutputSRS, m_poGCPCoordTrans, false);
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Optional reader thread, decoupling source feature reads from    */
+    /*      the transform+write work of this thread, so that neither end    */
+    /*      sits idle (OGR2OGR_READER_THREAD=YES). Not used when the        */
+    /*      coordinate transformation must be re-evaluated per feature,     */
+    /*      since that path queries the source layer from this thread.      */
+    /* -------------------------------------------------------------------- */
+    struct AsyncFeatureReader
+    {
+        OGRLayer *m_poLayer;
+        std::mutex m_oMutex{};
+        std::condition_variable m_oCV{};
+        std::deque<std::unique_ptr<OGRFeature>> m_oQueue{};
+        bool m_bDone = false;
+        bool m_bStop = false;
+        bool m_bError = false;
+        std::thread m_oThread{};
+
+        explicit AsyncFeatureReader(OGRLayer *poLayer) : m_poLayer(poLayer)
+        {
+            m_oThread = std::thread([this]() { Run(); });
+        }
+
+        void Run()
+        {
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> oLock(m_oMutex);
+                    constexpr size_t MAX_QUEUED_FEATURES = 1024;
+                    m_oCV.wait(oLock,
+                               [this]() {
+                                   return m_bStop || m_oQueue.size() <
+                                                         MAX_QUEUED_FEATURES;
+                               });
+                    if (m_bStop)
+                        break;
+                }
+                auto poFeat =
+                    std::unique_ptr<OGRFeature>(m_poLayer->GetNextFeature());
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                if (poFeat == nullptr)
+                {
+                    // The CPL error state is per-thread: forward it.
+                    m_bError = CPLGetLastErrorType() == CE_Failure;
+                    break;
+                }
+                m_oQueue.push_back(std::move(poFeat));
+                m_oCV.notify_all();
+            }
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            m_bDone = true;
+            m_oCV.notify_all();
+        }
+
+        /** Returns the next feature, or nullptr at end of iteration, in
+         * which case bErrorOut tells whether the reader hit an error. */
+        std::unique_ptr<OGRFeature> Pop(bool &bErrorOut)
+        {
+            std::unique_lock<std::mutex> oLock(m_oMutex);
+            m_oCV.wait(oLock,
+                       [this]() { return m_bDone || !m_oQueue.empty(); });
+            if (!m_oQueue.empty())
+            {
+                auto poFeat = std::move(m_oQueue.front());
+                m_oQueue.pop_front();
+                m_oCV.notify_all();
+                return poFeat;
+            }
+            bErrorOut = m_bError;
+            return nullptr;
+        }
+
+        ~AsyncFeatureReader()
+        {
+            {
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                m_bStop = true;
+            }
+            m_oCV.notify_all();
+            if (m_oThread.joinable())
+                m_oThread.join();
+        }
+    };
+
+    std::unique_ptr<AsyncFeatureReader> poAsyncReader;
+    if (poFeatureIn == nullptr && psOptions->nFIDToFetch == OGRNullFID &&
+        !psInfo->m_bPerFeatureCT &&
+        CPLTestBool(CPLGetConfigOption("OGR2OGR_READER_THREAD", "NO")))
+    {
+        // Warm the lazily computed layer SRS from this thread, as SetupCT()
+        // may query it while the reader thread is inside GetNextFeature().
+        poSrcLayer->GetSpatialRef();
+        poAsyncReader = std::make_unique<AsyncFeatureReader>(poSrcLayer);
+    }
+
     const bool bSingleIteration = poFeatureIn != nullptr;
     while (true)
     {
@@ -6588,16 +6899,19 @@ bool LayerTranslator::Translate(
             break;
         }
 
+        bool bReaderError = false;
         if (poFeatureIn != nullptr)
             poFeature = std::move(poFeatureIn);
         else if (psOptions->nFIDToFetch != OGRNullFID)
             poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
+        else if (poAsyncReader)
+            poFeature = poAsyncReader->Pop(bReaderError);
         else
             poFeature.reset(poSrcLayer->GetNextFeature());
 
         if (poFeature == nullptr)
         {
-            if (CPLGetLastErrorType() == CE_Failure)
+            if (bReaderError || CPLGetLastErrorType() == CE_Failure)
             {
                 bRet = false;
             }
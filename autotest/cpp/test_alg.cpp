@@ -21,6 +21,7 @@
 
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
+#include "gdal_interpolateatpoint.h"
 #include "gdalwarper.h"
 #include "gdal_priv.h"
 
@@ -562,4 +563,131 @@ TEST_F(test_alg, GDALDoubleAlmostEquals)
         std::nextafter(0, -std::numeric_limits<double>::max())));
 }
 
+
+// Test GDALIsLineOfSightVisibleBatch()
+TEST_F(test_alg, GDALIsLineOfSightVisibleBatch)
+{
+    auto const sizeX = 10;
+    auto const sizeY = 10;
+    GDALDatasetUniquePtr poDS(
+        GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+            ->Create("", sizeX, sizeY, 1, GDT_Int8, nullptr));
+    ASSERT_TRUE(poDS != nullptr);
+    auto pBand = poDS->GetRasterBand(1);
+    ASSERT_TRUE(pBand != nullptr);
+
+    // Flat terrain at 0, with a wall at column 5
+    std::vector<int8_t> abyData(sizeX * sizeY, 0);
+    for (int iY = 0; iY < sizeY; ++iY)
+        abyData[iY * sizeX + 5] = 100;
+    ASSERT_EQ(poDS->RasterIO(GF_Write, 0, 0, sizeX, sizeY, abyData.data(),
+                             sizeX, sizeY, GDT_Int8, 1, nullptr, 0, 0, 0,
+                             nullptr),
+              CE_None);
+
+    constexpr int NPOINTS = 4;
+    // 1) clear path left of the wall
+    // 2) path crossing the wall below its top
+    // 3) path crossing the wall above its top
+    // 4) degenerate path (same point, above terrain)
+    const int anXA[NPOINTS] = {0, 0, 0, 2};
+    const int anYA[NPOINTS] = {0, 2, 2, 2};
+    const double adfZA[NPOINTS] = {10.0, 10.0, 200.0, 5.0};
+    const int anXB[NPOINTS] = {4, 9, 9, 2};
+    const int anYB[NPOINTS] = {0, 2, 2, 2};
+    const double adfZB[NPOINTS] = {10.0, 10.0, 200.0, 5.0};
+
+    GByte abyVisible[NPOINTS] = {255, 255, 255, 255};
+    EXPECT_TRUE(GDALIsLineOfSightVisibleBatch(pBand, NPOINTS, anXA, anYA,
+                                              adfZA, anXB, anYB, adfZB,
+                                              abyVisible, nullptr));
+
+    // The batch must agree with the single-ray API for each ray.
+    for (int i = 0; i < NPOINTS; ++i)
+    {
+        const bool bRef = GDALIsLineOfSightVisible(
+            pBand, anXA[i], anYA[i], adfZA[i], anXB[i], anYB[i], adfZB[i],
+            nullptr, nullptr, nullptr);
+        EXPECT_EQ(abyVisible[i] != 0, bRef) << "ray " << i;
+    }
+    EXPECT_NE(abyVisible[0], 0);
+    EXPECT_EQ(abyVisible[1], 0);
+    EXPECT_NE(abyVisible[2], 0);
+
+    // Empty batch succeeds
+    EXPECT_TRUE(GDALIsLineOfSightVisibleBatch(pBand, 0, anXA, anYA, adfZA,
+                                              anXB, anYB, adfZB, abyVisible,
+                                              nullptr));
+    // Null band fails
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    EXPECT_FALSE(GDALIsLineOfSightVisibleBatch(nullptr, NPOINTS, anXA, anYA,
+                                               adfZA, anXB, anYB, adfZB,
+                                               abyVisible, nullptr));
+    CPLPopErrorHandler();
+}
+
+
+// Test GDALInterpolateAtPoints()
+TEST_F(test_alg, GDALInterpolateAtPoints)
+{
+    auto const sizeX = 8;
+    auto const sizeY = 8;
+    GDALDatasetUniquePtr poDS(
+        GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+            ->Create("", sizeX, sizeY, 1, GDT_Float64, nullptr));
+    ASSERT_TRUE(poDS != nullptr);
+    auto pBand = poDS->GetRasterBand(1);
+    ASSERT_TRUE(pBand != nullptr);
+
+    // Linear ramp: value = 2 * x + 3 * y
+    std::vector<double> adfData(sizeX * sizeY);
+    for (int iY = 0; iY < sizeY; ++iY)
+    {
+        for (int iX = 0; iX < sizeX; ++iX)
+            adfData[iY * sizeX + iX] = 2.0 * iX + 3.0 * iY;
+    }
+    ASSERT_EQ(poDS->RasterIO(GF_Write, 0, 0, sizeX, sizeY, adfData.data(),
+                             sizeX, sizeY, GDT_Float64, 1, nullptr, 0, 0, 0,
+                             nullptr),
+              CE_None);
+
+    constexpr size_t NPOINTS = 5;
+    // In pixel-center convention; last point is outside the raster.
+    const double adfX[NPOINTS] = {0.5, 3.5, 2.75, 6.5, -10.0};
+    const double adfY[NPOINTS] = {0.5, 2.5, 4.25, 1.5, 0.5};
+    double adfRealBatch[NPOINTS] = {0, 0, 0, 0, 0};
+    GByte abySuccess[NPOINTS] = {255, 255, 255, 255, 255};
+
+    std::unique_ptr<DoublePointsCache> poCacheBatch;
+    const bool bAllOK = GDALInterpolateAtPoints(
+        pBand, GRIORA_Bilinear, poCacheBatch, NPOINTS, adfX, adfY,
+        adfRealBatch, nullptr, abySuccess);
+    // The out-of-raster point must not succeed, hence not all points OK.
+    EXPECT_FALSE(bAllOK);
+    EXPECT_EQ(abySuccess[NPOINTS - 1], 0);
+
+    // Per-point semantics must match GDALInterpolateAtPoint() exactly.
+    for (size_t i = 0; i < NPOINTS; ++i)
+    {
+        std::unique_ptr<DoublePointsCache> poCacheSingle;
+        double dfRealRef = 0;
+        const bool bRefOK =
+            GDALInterpolateAtPoint(pBand, GRIORA_Bilinear, poCacheSingle,
+                                   adfX[i], adfY[i], &dfRealRef, nullptr);
+        EXPECT_EQ(abySuccess[i] != 0, bRefOK) << "point " << i;
+        if (bRefOK)
+        {
+            EXPECT_EQ(adfRealBatch[i], dfRealRef) << "point " << i;
+        }
+    }
+    // On the linear ramp, bilinear interpolation is exact.
+    EXPECT_NEAR(adfRealBatch[1], 2.0 * 3.0 + 3.0 * 2.0, 1e-10);
+    EXPECT_NEAR(adfRealBatch[2], 2.0 * 2.25 + 3.0 * 3.75, 1e-10);
+
+    // Empty batch succeeds
+    EXPECT_TRUE(GDALInterpolateAtPoints(pBand, GRIORA_Bilinear, poCacheBatch,
+                                        0, adfX, adfY, adfRealBatch, nullptr,
+                                        abySuccess));
+}
+
 }  // namespace
@@ -50,6 +50,7 @@
 #include <charconv>
 #include <cmath>
 #include <limits>
+#include <set>
 #include <fstream>
 #include <string>
 
@@ -6194,4 +6195,206 @@ TEST_F(test_cpl, strict_parse)
     EXPECT_EQ(cpl::strict_parse<float>("-1e-39"), std::nullopt);
 }
 
+
+// Test CPLCompressBatch() / CPLDecompressBatch()
+TEST_F(test_cpl, CPLCompressDecompressBatch)
+{
+    const CPLCompressor *psCompressor = CPLGetCompressor("zlib");
+    const CPLCompressor *psDecompressor = CPLGetDecompressor("zlib");
+    ASSERT_TRUE(psCompressor != nullptr);
+    ASSERT_TRUE(psDecompressor != nullptr);
+
+    constexpr size_t NCHUNKS = 5;
+    std::vector<std::string> asInputs;
+    for (size_t i = 0; i < NCHUNKS; ++i)
+    {
+        asInputs.push_back(
+            std::string(100 + i * 37, static_cast<char>('a' + i)));
+    }
+
+    const void *apInputData[NCHUNKS];
+    size_t anInputSize[NCHUNKS];
+    void *apCompressedData[NCHUNKS] = {};
+    size_t anCompressedSize[NCHUNKS] = {};
+    for (size_t i = 0; i < NCHUNKS; ++i)
+    {
+        apInputData[i] = asInputs[i].data();
+        anInputSize[i] = asInputs[i].size();
+    }
+
+    EXPECT_TRUE(CPLCompressBatch(psCompressor, NCHUNKS, apInputData,
+                                 anInputSize, apCompressedData,
+                                 anCompressedSize, nullptr, 2));
+
+    const void *apCompressedDataConst[NCHUNKS];
+    void *apDecompressedData[NCHUNKS] = {};
+    size_t anDecompressedSize[NCHUNKS] = {};
+    for (size_t i = 0; i < NCHUNKS; ++i)
+    {
+        EXPECT_TRUE(apCompressedData[i] != nullptr);
+        EXPECT_TRUE(anCompressedSize[i] > 0);
+        apCompressedDataConst[i] = apCompressedData[i];
+    }
+    EXPECT_TRUE(CPLDecompressBatch(psDecompressor, NCHUNKS,
+                                   apCompressedDataConst, anCompressedSize,
+                                   apDecompressedData, anDecompressedSize,
+                                   nullptr, 2));
+    for (size_t i = 0; i < NCHUNKS; ++i)
+    {
+        ASSERT_EQ(anDecompressedSize[i], asInputs[i].size());
+        EXPECT_TRUE(memcmp(apDecompressedData[i], asInputs[i].data(),
+                           asInputs[i].size()) == 0);
+        VSIFree(apCompressedData[i]);
+        VSIFree(apDecompressedData[i]);
+    }
+
+    // Empty batch is a no-op success
+    EXPECT_TRUE(CPLCompressBatch(psCompressor, 0, nullptr, nullptr, nullptr,
+                                 nullptr, nullptr, 2));
+    // Null compressor fails
+    EXPECT_FALSE(CPLCompressBatch(nullptr, NCHUNKS, apInputData, anInputSize,
+                                  apCompressedData, anCompressedSize, nullptr,
+                                  2));
+}
+
+// Test CPLAddFilesInZip()
+TEST_F(test_cpl, CPLAddFilesInZip)
+{
+    const std::string osContent1(10000, 'x');
+    const std::string osContent2("small content");
+    const char *pszFile1 = "/vsimem/test_add_files_in_zip_1.bin";
+    const char *pszFile2 = "/vsimem/test_add_files_in_zip_2.bin";
+    const char *pszZip = "/vsimem/test_add_files_in_zip.zip";
+
+    VSILFILE *fp = VSIFOpenL(pszFile1, "wb");
+    ASSERT_TRUE(fp != nullptr);
+    VSIFWriteL(osContent1.data(), 1, osContent1.size(), fp);
+    VSIFCloseL(fp);
+    fp = VSIFOpenL(pszFile2, "wb");
+    ASSERT_TRUE(fp != nullptr);
+    VSIFWriteL(osContent2.data(), 1, osContent2.size(), fp);
+    VSIFCloseL(fp);
+
+    void *hZip = CPLCreateZip(pszZip, nullptr);
+    ASSERT_TRUE(hZip != nullptr);
+    const char *apszArchiveFilenames[] = {"dir/one.bin", "two.bin"};
+    const char *apszInputFilenames[] = {pszFile1, pszFile2};
+    EXPECT_EQ(CPLAddFilesInZip(hZip, 2, apszArchiveFilenames,
+                               apszInputFilenames, nullptr, nullptr, nullptr),
+              CE_None);
+    // Zero files is a no-op success
+    EXPECT_EQ(CPLAddFilesInZip(hZip, 0, apszArchiveFilenames,
+                               apszInputFilenames, nullptr, nullptr, nullptr),
+              CE_None);
+    EXPECT_EQ(CPLCloseZip(hZip), CE_None);
+
+    // Read the entries back through /vsizip
+    const std::string osVSIZip1 = std::string("/vsizip/") + pszZip + "/dir/one.bin";
+    const std::string osVSIZip2 = std::string("/vsizip/") + pszZip + "/two.bin";
+    for (const auto &oPair :
+         {std::make_pair(osVSIZip1, osContent1),
+          std::make_pair(osVSIZip2, osContent2)})
+    {
+        fp = VSIFOpenL(oPair.first.c_str(), "rb");
+        ASSERT_TRUE(fp != nullptr) << oPair.first;
+        std::string osGot(oPair.second.size(), 0);
+        EXPECT_EQ(VSIFReadL(&osGot[0], 1, osGot.size(), fp), osGot.size());
+        // At end of content
+        char chDummy = 0;
+        EXPECT_EQ(VSIFReadL(&chDummy, 1, 1, fp), 0U);
+        VSIFCloseL(fp);
+        EXPECT_TRUE(osGot == oPair.second) << oPair.first;
+    }
+
+    // A missing input file makes the call fail
+    hZip = CPLCreateZip("/vsimem/test_add_files_in_zip2.zip", nullptr);
+    ASSERT_TRUE(hZip != nullptr);
+    const char *apszArchiveFilenames2[] = {"missing.bin"};
+    const char *apszInputFilenames2[] = {"/vsimem/i_do_not_exist.bin"};
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    EXPECT_EQ(CPLAddFilesInZip(hZip, 1, apszArchiveFilenames2,
+                               apszInputFilenames2, nullptr, nullptr, nullptr),
+              CE_Failure);
+    CPLPopErrorHandler();
+    CPLCloseZip(hZip);
+
+    VSIUnlink(pszFile1);
+    VSIUnlink(pszFile2);
+    VSIUnlink(pszZip);
+    VSIUnlink("/vsimem/test_add_files_in_zip2.zip");
+}
+
+// Test CPLQuadTreeInsertBulk()
+TEST_F(test_cpl, CPLQuadTreeInsertBulk)
+{
+    struct Feature
+    {
+        CPLRectObj sRect;
+    };
+
+    const auto GetBounds = [](const void *hFeature, CPLRectObj *pRect)
+    { *pRect = static_cast<const Feature *>(hFeature)->sRect; };
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = 0;
+    sGlobalBounds.miny = 0;
+    sGlobalBounds.maxx = 100;
+    sGlobalBounds.maxy = 100;
+
+    constexpr int NFEATURES = 1000;
+    std::vector<Feature> asFeatures(NFEATURES);
+    std::vector<void *> apFeatures(NFEATURES);
+    unsigned nSeed = 123;
+    const auto NextRand = [&nSeed]()
+    {
+        nSeed = nSeed * 1103515245U + 12345U;
+        return (nSeed >> 16) % 100;
+    };
+    for (int i = 0; i < NFEATURES; ++i)
+    {
+        const double x = static_cast<double>(NextRand());
+        const double y = static_cast<double>(NextRand());
+        asFeatures[i].sRect.minx = x;
+        asFeatures[i].sRect.maxx = std::min(100.0, x + 0.5);
+        asFeatures[i].sRect.miny = y;
+        asFeatures[i].sRect.maxy = std::min(100.0, y + 0.5);
+        apFeatures[i] = &asFeatures[i];
+    }
+
+    CPLQuadTree *hTreeBulk = CPLQuadTreeCreate(&sGlobalBounds, GetBounds);
+    CPLQuadTreeInsertBulk(hTreeBulk, apFeatures.data(), NFEATURES);
+
+    CPLQuadTree *hTreeRef = CPLQuadTreeCreate(&sGlobalBounds, GetBounds);
+    for (int i = 0; i < NFEATURES; ++i)
+        CPLQuadTreeInsert(hTreeRef, apFeatures[i]);
+
+    // The bulk-built tree must return the same features as the
+    // incrementally built one for any search rectangle.
+    for (int iCase = 0; iCase < 10; ++iCase)
+    {
+        CPLRectObj sQuery;
+        sQuery.minx = iCase * 7.0;
+        sQuery.miny = iCase * 3.0;
+        sQuery.maxx = sQuery.minx + 15.0;
+        sQuery.maxy = sQuery.miny + 20.0;
+
+        int nCountBulk = 0;
+        void **pahBulk = CPLQuadTreeSearch(hTreeBulk, &sQuery, &nCountBulk);
+        int nCountRef = 0;
+        void **pahRef = CPLQuadTreeSearch(hTreeRef, &sQuery, &nCountRef);
+        EXPECT_EQ(nCountBulk, nCountRef);
+        std::set<void *> oSetBulk(pahBulk, pahBulk + nCountBulk);
+        std::set<void *> oSetRef(pahRef, pahRef + nCountRef);
+        EXPECT_TRUE(oSetBulk == oSetRef);
+        CPLFree(pahBulk);
+        CPLFree(pahRef);
+    }
+
+    // Empty insertion is a no-op
+    CPLQuadTreeInsertBulk(hTreeBulk, apFeatures.data(), 0);
+
+    CPLQuadTreeDestroy(hTreeBulk);
+    CPLQuadTreeDestroy(hTreeRef);
+}
+
 }  // namespace
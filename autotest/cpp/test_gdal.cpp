@@ -6595,4 +6595,108 @@ TEST_F(test_gdal, GDALLoadEsriCLRAsRAT)
     ASSERT_EQ(poRAT->GetValueAsInt(24, 3), 47);
 }
 
+
+// Test GDALInterleave() / GDALDeinterleave() round-trip
+TEST_F(test_gdal, GDALInterleave)
+{
+    // 3 components of Byte
+    {
+        constexpr size_t N = 19;  // not a multiple of the SIMD width
+        GByte abySrc[3 * N];
+        for (size_t i = 0; i < 3 * N; ++i)
+            abySrc[i] = static_cast<GByte>(i * 7);
+        GByte abyComp0[N], abyComp1[N], abyComp2[N];
+        void *apDst[] = {abyComp0, abyComp1, abyComp2};
+        GDALDeinterleave(abySrc, GDT_UInt8, 3, apDst, GDT_UInt8, N);
+        GByte abyRoundTrip[3 * N] = {};
+        const void *const apSrc[] = {abyComp0, abyComp1, abyComp2};
+        GDALInterleave(apSrc, GDT_UInt8, 3, abyRoundTrip, GDT_UInt8, N);
+        EXPECT_TRUE(memcmp(abySrc, abyRoundTrip, sizeof(abySrc)) == 0);
+    }
+
+    // 4 components of UInt16, with type conversion on output
+    {
+        constexpr size_t N = 13;
+        GUInt16 anSrc[4 * N];
+        for (size_t i = 0; i < 4 * N; ++i)
+            anSrc[i] = static_cast<GUInt16>(i * 1000);
+        GUInt16 anComp[4][N];
+        void *apDst[] = {anComp[0], anComp[1], anComp[2], anComp[3]};
+        GDALDeinterleave(anSrc, GDT_UInt16, 4, apDst, GDT_UInt16, N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+                EXPECT_EQ(anComp[c][i], anSrc[i * 4 + c]);
+        }
+        GUInt16 anRoundTrip[4 * N] = {};
+        const void *const apSrc[] = {anComp[0], anComp[1], anComp[2],
+                                     anComp[3]};
+        GDALInterleave(apSrc, GDT_UInt16, 4, anRoundTrip, GDT_UInt16, N);
+        EXPECT_TRUE(memcmp(anSrc, anRoundTrip, sizeof(anSrc)) == 0);
+
+        // UInt16 -> Int32 conversion while interleaving
+        GInt32 anAsInt32[4 * N] = {};
+        GDALInterleave(apSrc, GDT_UInt16, 4, anAsInt32, GDT_Int32, N);
+        for (size_t i = 0; i < 4 * N; ++i)
+            EXPECT_EQ(anAsInt32[i], static_cast<GInt32>(anSrc[i]));
+    }
+
+    // Degenerate case: zero iterations
+    {
+        GByte byDummy = 0;
+        const void *const apSrc[] = {&byDummy, &byDummy, &byDummy};
+        GDALInterleave(apSrc, GDT_UInt8, 3, &byDummy, GDT_UInt8, 0);
+    }
+}
+
+
+// Test GDALDataset::Prefetch()
+TEST_F(test_gdal, DatasetPrefetch)
+{
+    GDALDatasetUniquePtr poDS(
+        GDALDriver::FromHandle(GDALGetDriverByName("GTiff"))
+            ->Create("/vsimem/test_prefetch.tif", 64, 64, 2, GDT_UInt8,
+                     nullptr));
+    ASSERT_TRUE(poDS != nullptr);
+    std::vector<GByte> abyData(64 * 64);
+    for (size_t i = 0; i < abyData.size(); ++i)
+        abyData[i] = static_cast<GByte>(i);
+    for (int iBand = 1; iBand <= 2; ++iBand)
+    {
+        ASSERT_EQ(poDS->GetRasterBand(iBand)->RasterIO(
+                      GF_Write, 0, 0, 64, 64, abyData.data(), 64, 64,
+                      GDT_UInt8, 0, 0, nullptr),
+                  CE_None);
+    }
+    poDS.reset(GDALDataset::Open("/vsimem/test_prefetch.tif"));
+    ASSERT_TRUE(poDS != nullptr);
+
+    // Happy path: prefetch all bands of a window, then read it back:
+    // results must be unchanged.
+    EXPECT_EQ(poDS->Prefetch(0, 0, 64, 64, 0, nullptr), CE_None);
+    const int anBandList[] = {2};
+    EXPECT_EQ(poDS->Prefetch(16, 16, 32, 32, 1, anBandList), CE_None);
+    std::vector<GByte> abyGot(64 * 64);
+    EXPECT_EQ(poDS->GetRasterBand(1)->RasterIO(GF_Read, 0, 0, 64, 64,
+                                               abyGot.data(), 64, 64,
+                                               GDT_UInt8, 0, 0, nullptr),
+              CE_None);
+    EXPECT_TRUE(abyGot == abyData);
+
+    // Prefetching again while a previous request may still be pending,
+    // and cancelling, must be safe.
+    EXPECT_EQ(poDS->Prefetch(0, 0, 32, 32, 0, nullptr), CE_None);
+    poDS->CancelPrefetch();
+
+    // Out-of-extent windows are rejected.
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    EXPECT_EQ(poDS->Prefetch(-1, 0, 64, 64, 0, nullptr), CE_Failure);
+    EXPECT_EQ(poDS->Prefetch(0, 0, 65, 64, 0, nullptr), CE_Failure);
+    EXPECT_EQ(poDS->Prefetch(0, 0, 0, 64, 0, nullptr), CE_Failure);
+    CPLPopErrorHandler();
+
+    poDS.reset();
+    VSIUnlink("/vsimem/test_prefetch.tif");
+}
+
 }  // namespace
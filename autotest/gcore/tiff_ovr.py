@@ -3283,3 +3283,39 @@ def test_tiff_ovr_bugfix_gh_14728_cubic_low_alpha_values(tmp_vsimem):
             "B", ds.GetRasterBand(2).GetOverview(0).ReadRaster(271, 380, 1, 1)
         )[0],
     ] == [156, 25]
+
+###############################################################################
+# Test the WINDOWS option of GDALRegenerateOverviewsMultiBand()
+
+
+@gdaltest.enable_exceptions()
+def test_tiff_ovr_windows_option(tmp_vsimem):
+
+    filename = tmp_vsimem / "test_ovr_windows.tif"
+    ref_filename = tmp_vsimem / "test_ovr_windows_ref.tif"
+
+    def create(fname):
+        ds = gdal.GetDriverByName("GTiff").Create(fname, 64, 64)
+        ds.GetRasterBand(1).Fill(1)
+        ds.BuildOverviews("AVERAGE", [2])
+        # Modify two distinct windows of the full resolution data
+        ds.GetRasterBand(1).WriteRaster(0, 0, 8, 8, b"\xFF" * (8 * 8))
+        ds.GetRasterBand(1).WriteRaster(32, 32, 16, 16, b"\x80" * (16 * 16))
+        return ds
+
+    # Refresh only the dirty windows on one dataset...
+    ds = create(filename)
+    ds.BuildOverviews("AVERAGE", [2], options=["WINDOWS=0,0,8,8;32,32,16,16"])
+
+    # ... and fully regenerate the other: overviews must be identical
+    ds_ref = create(ref_filename)
+    ds_ref.BuildOverviews("AVERAGE", [2])
+
+    assert (
+        ds.GetRasterBand(1).GetOverview(0).ReadRaster()
+        == ds_ref.GetRasterBand(1).GetOverview(0).ReadRaster()
+    )
+
+    # An invalid window specification must fail
+    with pytest.raises(Exception):
+        ds.BuildOverviews("AVERAGE", [2], options=["WINDOWS=0,0,8"])
@@ -919,6 +919,49 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test the .gzidx seek index sidecar written with CPL_VSIL_GZIP_WRITE_SEEK_INDEX
+
+
+def test_vsigzip_seek_index_sidecar():
+
+    filename = "/vsimem/vsigzip_seek_index.gz"
+    content = b"".join(b"%08d" % i for i in range(100000))
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_WRITE_SEEK_INDEX": "YES",
+            "CPL_VSIL_DEFLATE_CHUNK_SIZE": "32K",
+        }
+    ):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "wb")
+        assert f is not None
+        gdal.VSIFWriteL(content, 1, len(content), f)
+        gdal.VSIFCloseL(f)
+
+    # The sidecar must have been written
+    assert gdal.VSIStatL(filename + ".gzidx") is not None
+
+    # Random access reads served through the index must be correct
+    f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+    assert f is not None
+    gdal.VSIFSeekL(f, len(content) - 16, 0)
+    assert gdal.VSIFReadL(1, 16, f) == content[-16:]
+    gdal.VSIFSeekL(f, 123456, 0)
+    assert gdal.VSIFReadL(1, 32, f) == content[123456 : 123456 + 32]
+    gdal.VSIFCloseL(f)
+
+    # An invalid sidecar must be ignored, with reads still correct
+    gdal.FileFromMemBuffer(filename + ".gzidx", "not a valid index")
+    f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+    assert f is not None
+    gdal.VSIFSeekL(f, 123456, 0)
+    assert gdal.VSIFReadL(1, 32, f) == content[123456 : 123456 + 32]
+    gdal.VSIFCloseL(f)
+
+    gdal.Unlink(filename)
+    gdal.Unlink(filename + ".gzidx")
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -621,3 +621,48 @@ def test_png_close(tmp_path):
     )
     ds.Close()
     os.remove(tmp_path / "out.png")
+
+
+###############################################################################
+# Test the PARALLEL_WRITE creation option
+
+
+@gdaltest.enable_exceptions()
+def test_png_parallel_write(tmp_vsimem):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 256, 200, 3)
+    for b in range(3):
+        src_ds.GetRasterBand(b + 1).WriteRaster(
+            0,
+            0,
+            256,
+            200,
+            bytes((x * (b + 1) + y) % 255 for y in range(200) for x in range(256)),
+        )
+
+    ds = gdal.GetDriverByName("PNG").CreateCopy(
+        tmp_vsimem / "parallel.png", src_ds, options=["PARALLEL_WRITE=YES"]
+    )
+    assert ds is not None
+    ds = None
+    ds_ref = gdal.GetDriverByName("PNG").CreateCopy(tmp_vsimem / "serial.png", src_ds)
+    assert ds_ref is not None
+    ds_ref = None
+
+    # Decoded pixels must be identical to the source and to the serial writer
+    ds = gdal.Open(tmp_vsimem / "parallel.png")
+    ds_ref = gdal.Open(tmp_vsimem / "serial.png")
+    assert ds.ReadRaster() == src_ds.ReadRaster()
+    assert ds.ReadRaster() == ds_ref.ReadRaster()
+
+    # Non 8-bit input: the option silently falls back to the regular writer
+    src16_ds = gdal.GetDriverByName("MEM").Create("", 130, 130, 1, gdal.GDT_UInt16)
+    src16_ds.GetRasterBand(1).Fill(40000)
+    with gdal.quiet_errors():
+        ds16 = gdal.GetDriverByName("PNG").CreateCopy(
+            tmp_vsimem / "parallel16.png", src16_ds, options=["PARALLEL_WRITE=YES"]
+        )
+    assert ds16 is not None
+    ds16 = None
+    ds16 = gdal.Open(tmp_vsimem / "parallel16.png")
+    assert ds16.ReadRaster() == src16_ds.ReadRaster()
@@ -11551,3 +11551,66 @@ def test_ogr_gpkg_spatialite_after_create(tmp_vsimem):
     with ds.ExecuteSQL("SELECT ST_Buffer(geom, 1) FROM test") as sql_lyr:
         f = sql_lyr.GetNextFeature()
         assert f.GetGeometryRef() is not None
+
+
+###############################################################################
+# Test the CLUSTER BY HILBERT special SQL command
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_gpkg_cluster_by_hilbert(tmp_vsimem):
+
+    filename = tmp_vsimem / "test_cluster_by_hilbert.gpkg"
+    ds = gdaltest.gpkg_dr.CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("name", ogr.OFTString))
+    # Insert points in an order that is intentionally not spatially
+    # clustered
+    contents = {}
+    for i in range(100):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        x = (i * 37) % 100
+        y = (i * 73) % 100
+        f.SetField("name", "feat_%d_%d" % (x, y))
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (x, y)))
+        lyr.CreateFeature(f)
+        contents["feat_%d_%d" % (x, y)] = (x, y)
+    assert lyr.GetFeatureCount() == 100
+
+    ds.ExecuteSQL("CLUSTER BY HILBERT test")
+
+    # Same content, feature ids renumbered starting at 1, spatial index
+    # still present and consistent
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 100
+    fids = set()
+    got = {}
+    for f in lyr:
+        fids.add(f.GetFID())
+        g = f.GetGeometryRef()
+        got[f.GetField("name")] = (g.GetX(), g.GetY())
+    assert fids == set(range(1, 101))
+    assert got == contents
+
+    with ds.ExecuteSQL("SELECT HasSpatialIndex('test', 'geom')") as sql_lyr:
+        assert sql_lyr.GetNextFeature().GetField(0) == 1
+    lyr.SetSpatialFilterRect(10.5, 10.5, 30.5, 30.5)
+    expected = {
+        name for name, (x, y) in contents.items() if 10.5 <= x <= 30.5 and 10.5 <= y <= 30.5
+    }
+    assert {f.GetField("name") for f in lyr} == expected
+    lyr.SetSpatialFilter(None)
+
+    # Unknown layer must error out
+    with gdal.quiet_errors(), gdaltest.disable_exceptions():
+        gdal.ErrorReset()
+        ds.ExecuteSQL("CLUSTER BY HILBERT i_do_not_exist")
+        assert gdal.GetLastErrorMsg() != ""
+
+    ds = None
+
+    # Reopen and check persisted state
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 100
+    assert {f.GetField("name") for f in lyr} == set(contents.keys())
@@ -28,6 +28,7 @@
 import contextlib
 import os
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -42,7 +43,7 @@ pytestmark = pytest.mark.require_driver("MapInfo File")
 def startup_and_cleanup():
     yield
 
-    for filename in ["join_t.idm", "join_t.ind"]:
+    for filename in ["join_t.idm", "join_t.ind", "join_t.gidx"]:
         assert not os.path.exists(filename)
 
 
@@ -111,8 +112,11 @@ def test_ogr_index_can_join_without_index():
 
 def test_ogr_index_creating_index_causes_index_files_to_be_created():
     with create_join_t_test_file(create_index=True):
+        # A fresh index is created with the generic ".gidx" sidecar; the
+        # legacy MapInfo sidecars are only used when they pre-exist.
+        assert os.path.exists("join_t.gidx")
         for filename in ["join_t.idm", "join_t.ind"]:
-            assert os.path.exists(filename)
+            assert not os.path.exists(filename)
 
 
 ###############################################################################
@@ -191,7 +195,7 @@ def test_ogr_index_drop_index_removes_files():
 
         # After dataset closing, check that the index files do not exist after
         # dropping the index
-        for filename in ["join_t.idm", "join_t.ind"]:
+        for filename in ["join_t.idm", "join_t.ind", "join_t.gidx"]:
             assert not os.path.exists(filename)
 
 
@@ -230,11 +234,10 @@ def test_ogr_index_recreating_index_causes_index_files_to_be_created():
         with ogr.OpenShared("join_t.dbf", update=1) as s_ds:
             s_ds.ExecuteSQL("CREATE INDEX ON join_t USING value")
 
-        for filename in ["join_t.idm", "join_t.ind"]:
-            try:
-                os.stat(filename)
-            except (OSError, FileNotFoundError):
-                pytest.fail("%s should exist" % filename)
+        try:
+            os.stat("join_t.gidx")
+        except (OSError, FileNotFoundError):
+            pytest.fail("join_t.gidx should exist")
 
 
 ###############################################################################
@@ -253,9 +256,12 @@ def test_ogr_index_recreating_index_causes_index_to_be_populated():
         with ogr.OpenShared("join_t.dbf", update=1) as s_ds:
             s_ds.ExecuteSQL("CREATE INDEX ON join_t USING value")
 
-        with open("join_t.idm", "rt") as f:
-            xml = f.read()
-        assert xml.find("VALUE") != -1, "VALUE column is not indexed (1)"
+        # The ".gidx" sidecar is binary: check the re-created index through
+        # an indexed lookup instead of inspecting the file.
+        with ogr.OpenShared("join_t.dbf", update=0) as s_ds:
+            s_lyr = s_ds.GetLayerByName("join_t")
+            s_lyr.SetAttributeFilter("VALUE='Value 5'")
+            ogrtest.check_features_against_list(s_lyr, "SKEY", [5])
 
 
 ###############################################################################
@@ -280,10 +286,51 @@ def test_ogr_index_creating_index_in_separate_steps_works():
             # will be re-opened in read-write mode
             s_ds.ExecuteSQL("CREATE INDEX ON join_t USING skey")
 
-        with open("join_t.idm", "rt") as f:
-            xml = f.read()
-        assert xml.find("VALUE") != -1, "VALUE column is not indexed (2)"
-        assert xml.find("SKEY") != -1, "SKEY column is not indexed (2)"
+        # Check both indexed columns through indexed lookups
+        with ogr.OpenShared("join_t.dbf", update=0) as s_ds:
+            s_lyr = s_ds.GetLayerByName("join_t")
+            s_lyr.SetAttributeFilter("VALUE='Value 5'")
+            ogrtest.check_features_against_list(s_lyr, "SKEY", [5])
+            s_lyr.SetAttributeFilter("SKEY = 7")
+            ogrtest.check_features_against_list(s_lyr, "VALUE", ["Value 7"])
+
+
+###############################################################################
+# Test that a corrupt .gidx sidecar is ignored, with queries still correct
+
+
+def test_ogr_index_generic_corrupt_gidx_is_ignored():
+
+    with create_join_t_test_file(create_index=True):
+        assert os.path.exists("join_t.gidx")
+        with open("join_t.gidx", "wb") as f:
+            f.write(b"this is not a valid index")
+
+        with gdaltest.error_handler():
+            s_ds = ogr.OpenShared("join_t.dbf", update=0)
+            s_lyr = s_ds.GetLayerByName("join_t")
+            s_lyr.SetAttributeFilter("SKEY = 5")
+            ogrtest.check_features_against_list(s_lyr, "VALUE", ["Value 5"])
+        s_ds = None
+
+
+###############################################################################
+# Test that the generic index answers equality lookups on all indexed rows
+
+
+def test_ogr_index_generic_gidx_full_lookup():
+
+    with create_join_t_test_file(create_index=True):
+        with ogr.OpenShared("join_t.dbf", update=0) as s_ds:
+            s_lyr = s_ds.GetLayerByName("join_t")
+            for i in range(20):
+                s_lyr.SetAttributeFilter("SKEY = %d" % i)
+                ogrtest.check_features_against_list(
+                    s_lyr, "VALUE", ["Value %d" % i]
+                )
+            # No match
+            s_lyr.SetAttributeFilter("SKEY = 12345")
+            ogrtest.check_features_against_list(s_lyr, "VALUE", [])
 
 
 ###############################################################################
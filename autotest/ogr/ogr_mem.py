@@ -3275,3 +3275,69 @@ def test_ogr_mem_relationships():
     assert ds.GetRelationship("my_relationship").GetRightTableName() == "dest_table2"
     assert ds.DeleteRelationship("my_relationship")
     assert ds.GetRelationship("my_relationship") is None
+
+
+###############################################################################
+# Test the native Arrow encoding path of the MEM layer
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_mem_native_arrow_stream():
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    ds = gdal.GetDriverByName("MEM").CreateVector("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["int32"] = 123
+    f["int64"] = 1234567890123
+    f["real"] = 1.25
+    f["str"] = "hello"
+    f["bool"] = True
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+    lyr.CreateFeature(f)
+
+    # Second feature with all fields unset, and no geometry
+    f = ogr.Feature(lyr.GetLayerDefn())
+    lyr.CreateFeature(f)
+
+    # Third feature with empty string
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["str"] = ""
+    lyr.CreateFeature(f)
+
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+
+    stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+    batches = [batch for batch in stream]
+    assert len(batches) == 1
+    batch = batches[0]
+    assert list(batch["OGC_FID"]) == [0, 1, 2]
+    assert batch["int32"][0] == 123
+    assert batch["int64"][0] == 1234567890123
+    assert batch["real"][0] == 1.25
+    assert batch["str"][0] == b"hello"
+    assert bool(batch["bool"][0]) is True
+    assert batch["str"][2] == b""
+    g = ogr.CreateGeometryFromWkb(bytes(batch["wkb_geometry"][0]))
+    assert g.ExportToWkt() == "POINT (1 2)"
+    del stream
+
+    # With an attribute filter, the capability is off and the generic
+    # implementation is used: results must honor the filter.
+    lyr.SetAttributeFilter("int32 = 123")
+    assert not lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+    batches = [batch for batch in stream]
+    assert len(batches) == 1
+    assert list(batches[0]["int32"]) == [123]
+    del stream
+    lyr.SetAttributeFilter(None)
@@ -6429,3 +6429,70 @@ def test_ogr_pg_geometry_intersection_spatial_filter(
         assert f.GetGeometryRef().ExportToWkt() == "POINT (0.5 0.5)"
         f = sql_lyr.GetNextFeature()
         assert f is None
+
+
+###############################################################################
+# Test the native Arrow encoding fast path (OGR_PG_ARROW_NATIVE)
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_pg_native_arrow_stream(pg_ds):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    lyr = pg_ds.CreateLayer("test_native_arrow")
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["int32"] = 123
+    f["int64"] = 1234567890123
+    f["real"] = 1.25
+    f["str"] = "hello"
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+    lyr.CreateFeature(f)
+
+    # All fields unset
+    f = ogr.Feature(lyr.GetLayerDefn())
+    lyr.CreateFeature(f)
+
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["int32"] = -7
+    f["str"] = ""
+    lyr.CreateFeature(f)
+
+    def read_batches(native):
+        with gdal.config_option("OGR_PG_ARROW_NATIVE", "YES" if native else "NO"):
+            read_lyr = pg_ds.GetLayerByName("test_native_arrow")
+            read_lyr.ResetReading()
+            stream = read_lyr.GetArrowStreamAsNumPy(
+                options=["USE_MASKED_ARRAYS=NO"]
+            )
+            result = {}
+            for batch in stream:
+                for key, arr in batch.items():
+                    result.setdefault(key, []).extend(list(arr))
+            del stream
+            return result
+
+    native = read_batches(True)
+    generic = read_batches(False)
+
+    # The native path must return exactly what the generic path returns
+    assert set(native.keys()) == set(generic.keys())
+    for key in native:
+        assert len(native[key]) == 3, key
+        for v_native, v_generic in zip(native[key], generic[key]):
+            if isinstance(v_native, bytes) or v_native is None:
+                assert v_native == v_generic, key
+            else:
+                assert v_native == pytest.approx(v_generic), key
+
+    assert native["int32"][0] == 123
+    assert native["int64"][0] == 1234567890123
+    assert native["real"][0] == 1.25
+    assert native["str"][0] == b"hello"
+    assert native["int32"][2] == -7
+    assert native["str"][2] == b""
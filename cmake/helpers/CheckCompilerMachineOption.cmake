@@ -38,7 +38,8 @@ function(check_compiler_machine_option outvar feature)
     elseif(MSVC)
       # Only Visual Studio 2017 version 15.3 / Visual C++ 19.11 & up have support for AVX-512.
       # https://blogs.msdn.microsoft.com/vcblog/2017/07/11/microsoft-visual-studio-2017-supports-intel-avx-512/
-      set(MSVC_FLAG_MAP AVX512 "-arch:AVX512" AVX2 "-arch:AVX2" AVX "-arch:AVX")
+      set(MSVC_FLAG_MAP AVX512 "-arch:AVX512" AVX512F "-arch:AVX512" AVX512BW "-arch:AVX512"
+                        AVX512VL "-arch:AVX512" AVX2 "-arch:AVX2" AVX "-arch:AVX")
       list(FIND MSVC_FLAG_MAP ${feature} _found)
       if(_found GREATER -1)
         math(EXPR index "${_found}+1")
@@ -78,6 +79,9 @@ function(check_compiler_machine_option outvar feature)
             "sse4a" "ammintrin.h"
             "avx" "immintrin.h"
             "avx2" "immintrin.h"
+            "avx512f" "immintrin.h"
+            "avx512bw" "immintrin.h"
+            "avx512vl" "immintrin.h"
             "fma" "immintrin.h"
             "fma4" "x86intrin.h"
             "xop" "x86intrin.h")
@@ -102,6 +102,10 @@ gdal_check_package(XercesC "Read and write XML formats (needed for GMLAS and ILI
 include(CheckDependentLibrariesZLIB)
 
 gdal_check_package(Deflate "Enable libdeflate compression library (complement to ZLib)" CAN_DISABLE)
+gdal_check_package(SIMDJSON "Enable simdjson-accelerated JSON parsing in CPLJSONDocument" CAN_DISABLE)
+if (UNIX AND "${CMAKE_SYSTEM}" MATCHES "Linux")
+  gdal_check_package(LIBURING "Enable io_uring accelerated multi-range reads on local files" CAN_DISABLE)
+endif ()
 
 gdal_check_package(OpenSSL "Use OpenSSL library" COMPONENTS SSL Crypto CAN_DISABLE)
 
@@ -251,6 +251,14 @@ else ()
       HAVE_PREAD_BSD)
   endif()
 
+  check_c_source_compiles(
+    "
+       #include <sys/types.h>
+       #include <sys/uio.h>
+       int main() { preadv(0, NULL, 0, 0); return 0; }
+      "
+    HAVE_PREADV)
+
   set(UNIX_STDIO_64 TRUE)
 
   set(INCLUDE_XLOCALE_H)
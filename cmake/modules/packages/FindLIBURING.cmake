@@ -0,0 +1,52 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+#[=======================================================================[.rst:
+FindLIBURING
+------------
+
+Find the liburing includes and library.
+
+IMPORTED Targets
+^^^^^^^^^^^^^^^^
+
+This module defines :prop_tgt:`IMPORTED` target ``LIBURING::LIBURING``, if
+liburing has been found.
+
+Result Variables
+^^^^^^^^^^^^^^^^
+
+This module defines the following variables:
+
+::
+
+  LIBURING_INCLUDE_DIRS  - where to find liburing.h, etc.
+  LIBURING_LIBRARIES     - List of libraries when using liburing.
+  LIBURING_FOUND         - True if liburing found.
+#]=======================================================================]
+
+find_path(LIBURING_INCLUDE_DIR
+          NAMES liburing.h
+          PATH_SUFFIXES include)
+
+find_library(LIBURING_LIBRARY
+             NAMES uring
+             PATH_SUFFIXES lib)
+
+mark_as_advanced(LIBURING_INCLUDE_DIR LIBURING_LIBRARY)
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(LIBURING
+        REQUIRED_VARS LIBURING_LIBRARY LIBURING_INCLUDE_DIR)
+
+if(LIBURING_FOUND)
+    set(LIBURING_INCLUDE_DIRS ${LIBURING_INCLUDE_DIR})
+    set(LIBURING_LIBRARIES ${LIBURING_LIBRARY})
+
+    if(NOT TARGET LIBURING::LIBURING)
+        add_library(LIBURING::LIBURING UNKNOWN IMPORTED)
+        set_target_properties(LIBURING::LIBURING PROPERTIES
+                INTERFACE_INCLUDE_DIRECTORIES "${LIBURING_INCLUDE_DIRS}"
+                IMPORTED_LOCATION "${LIBURING_LIBRARY}")
+    endif()
+endif()
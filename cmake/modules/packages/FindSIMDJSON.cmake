@@ -0,0 +1,52 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+#[=======================================================================[.rst:
+FindSIMDJSON
+------------
+
+Find the simdjson includes and library.
+
+IMPORTED Targets
+^^^^^^^^^^^^^^^^
+
+This module defines :prop_tgt:`IMPORTED` target ``SIMDJSON::SIMDJSON``, if
+simdjson has been found.
+
+Result Variables
+^^^^^^^^^^^^^^^^
+
+This module defines the following variables:
+
+::
+
+  SIMDJSON_INCLUDE_DIRS  - where to find simdjson.h, etc.
+  SIMDJSON_LIBRARIES     - List of libraries when using simdjson.
+  SIMDJSON_FOUND         - True if simdjson found.
+#]=======================================================================]
+
+find_path(SIMDJSON_INCLUDE_DIR
+          NAMES simdjson.h
+          PATH_SUFFIXES include)
+
+find_library(SIMDJSON_LIBRARY
+             NAMES simdjson
+             PATH_SUFFIXES lib)
+
+mark_as_advanced(SIMDJSON_INCLUDE_DIR SIMDJSON_LIBRARY)
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(SIMDJSON
+        REQUIRED_VARS SIMDJSON_LIBRARY SIMDJSON_INCLUDE_DIR)
+
+if(SIMDJSON_FOUND)
+    set(SIMDJSON_INCLUDE_DIRS ${SIMDJSON_INCLUDE_DIR})
+    set(SIMDJSON_LIBRARIES ${SIMDJSON_LIBRARY})
+
+    if(NOT TARGET SIMDJSON::SIMDJSON)
+        add_library(SIMDJSON::SIMDJSON UNKNOWN IMPORTED)
+        set_target_properties(SIMDJSON::SIMDJSON PROPERTIES
+                INTERFACE_INCLUDE_DIRECTORIES "${SIMDJSON_INCLUDE_DIRS}"
+                IMPORTED_LOCATION "${SIMDJSON_LIBRARY}")
+    endif()
+endif()
@@ -17,10 +17,16 @@
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "ogr_spatialref.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "mdreader/reader_pleiades.h"
 #include "vrtdataset.h"
-#include <map>
 #include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 
 /************************************************************************/
 /* ==================================================================== */
@@ -54,6 +60,34 @@ class DIMAPDataset final : public GDALPamDataset
 
     char **papszXMLDimapMetadata{};
 
+    // Component file region contributing to a band, recorded when the VRT
+    // sources are built. All DIMAP sources are full resolution with a 1:1
+    // pixel mapping, so a destination offset fully describes the placement.
+    struct BandComponent
+    {
+        CPLString osFilename{};
+        int nSrcBand = 0;
+        int nDstXOff = 0;
+        int nDstYOff = 0;
+        int nWidth = 0;
+        int nHeight = 0;
+    };
+
+    // Per band (0-based) list of components, used by the band-parallel
+    // read path.
+    std::vector<std::vector<BandComponent>> m_aoBandComponents{};
+
+    // One handle per (band, component file), so that each band worker of
+    // the parallel path reads through its own independent handles.
+    std::map<std::pair<int, CPLString>, std::unique_ptr<GDALDataset>>
+        m_oMapParallelHandles{};
+
+    bool TryParallelMultiBandRead(int nXOff, int nYOff, int nXSize, int nYSize,
+                                  void *pData, GDALDataType eBufType,
+                                  int nBandCount, BANDMAP_TYPE panBandMap,
+                                  GSpacing nPixelSpace, GSpacing nLineSpace,
+                                  GSpacing nBandSpace);
+
     CPL_DISALLOW_COPY_ASSIGN(DIMAPDataset)
 
   protected:
@@ -149,6 +183,12 @@ int DIMAPDataset::CloseDependentDatasets()
         bHasDroppedRef = TRUE;
     }
 
+    if (!m_oMapParallelHandles.empty())
+    {
+        m_oMapParallelHandles.clear();
+        bHasDroppedRef = TRUE;
+    }
+
     return bHasDroppedRef;
 }
 
@@ -343,12 +383,210 @@ CPLErr DIMAPDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                          nLineSpace, nBandSpace, psExtraArg);
     }
 
+    // Multi-band full resolution reads: the component files are
+    // independent, so read the bands concurrently, each through its own
+    // handles, with interleaved assembly into the destination buffer.
+    if (eRWFlag == GF_Read && nBandCount > 1 && nBufXSize == nXSize &&
+        nBufYSize == nYSize && !psExtraArg->bFloatingPointWindowValidity &&
+        static_cast<GIntBig>(nBufXSize) * nBufYSize >= 1024 * 1024 &&
+        !m_aoBandComponents.empty())
+    {
+        if (TryParallelMultiBandRead(nXOff, nYOff, nXSize, nYSize, pData,
+                                     eBufType, nBandCount, panBandMap,
+                                     nPixelSpace, nLineSpace, nBandSpace))
+        {
+            if (psExtraArg->pfnProgress != nullptr)
+                psExtraArg->pfnProgress(1.0, "", psExtraArg->pProgressData);
+            return CE_None;
+        }
+    }
+
     return poVRTDS->IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData,
                               nBufXSize, nBufYSize, eBufType, nBandCount,
                               panBandMap, nPixelSpace, nLineSpace, nBandSpace,
                               psExtraArg);
 }
 
+/************************************************************************/
+/*                      TryParallelMultiBandRead()                      */
+/*                                                                      */
+/*      Band-parallel read path for multi-file products. Each worker    */
+/*      handles one requested band through handles on the component     */
+/*      files that only it uses, so no dataset object is shared         */
+/*      between threads. Returns false (with the buffer in an           */
+/*      unspecified state) if the request cannot be handled this way,   */
+/*      in which case the caller re-issues it through the VRT.          */
+/************************************************************************/
+
+bool DIMAPDataset::TryParallelMultiBandRead(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+    GDALDataType eBufType, int nBandCount, BANDMAP_TYPE panBandMap,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace)
+{
+    const int nMaxThreads = GDALGetNumThreads(
+        CPLGetConfigOption("DIMAP_NUM_THREADS", nullptr));
+    if (nMaxThreads <= 1)
+        return false;
+
+    for (int i = 0; i < nBandCount; i++)
+    {
+        if (panBandMap[i] < 1 ||
+            panBandMap[i] > static_cast<int>(m_aoBandComponents.size()))
+            return false;
+        // A duplicated band would make two workers share a handle.
+        for (int j = 0; j < i; j++)
+        {
+            if (panBandMap[j] == panBandMap[i])
+                return false;
+        }
+    }
+
+    // Open (or reuse) the handles serially: they persist on the dataset
+    // across calls, and each is only ever used by the worker of its band.
+    for (int i = 0; i < nBandCount; i++)
+    {
+        const int iBand = panBandMap[i];
+        for (const auto &oComp : m_aoBandComponents[iBand - 1])
+        {
+            if (oComp.nDstXOff >= nXOff + nXSize ||
+                oComp.nDstYOff >= nYOff + nYSize ||
+                oComp.nDstXOff + oComp.nWidth <= nXOff ||
+                oComp.nDstYOff + oComp.nHeight <= nYOff)
+                continue;
+            const auto oKey = std::make_pair(iBand, oComp.osFilename);
+            if (m_oMapParallelHandles.find(oKey) ==
+                m_oMapParallelHandles.end())
+            {
+                auto poCompDS =
+                    std::unique_ptr<GDALDataset>(GDALDataset::Open(
+                        oComp.osFilename,
+                        GDAL_OF_RASTER | GDAL_OF_INTERNAL |
+                            GDAL_OF_VERBOSE_ERROR));
+                if (poCompDS == nullptr ||
+                    oComp.nSrcBand > poCompDS->GetRasterCount())
+                    return false;
+                m_oMapParallelHandles[oKey] = std::move(poCompDS);
+            }
+        }
+    }
+
+    CPLWorkerThreadPool *poPool =
+        GDALGetGlobalThreadPool(std::min(nMaxThreads, nBandCount));
+    if (poPool == nullptr)
+        return false;
+
+    struct BandJob
+    {
+        DIMAPDataset *poDS = nullptr;
+        int nBand = 0;
+        GByte *pabyDest = nullptr;
+        int nXOff = 0;
+        int nYOff = 0;
+        int nXSize = 0;
+        int nYSize = 0;
+        GDALDataType eBufType = GDT_Unknown;
+        GSpacing nPixelSpace = 0;
+        GSpacing nLineSpace = 0;
+        std::atomic<bool> *pbError = nullptr;
+    };
+
+    std::atomic<bool> bError = false;
+    std::vector<BandJob> aoJobs(nBandCount);
+    for (int i = 0; i < nBandCount; i++)
+    {
+        BandJob &oJob = aoJobs[i];
+        oJob.poDS = this;
+        oJob.nBand = panBandMap[i];
+        oJob.pabyDest = static_cast<GByte *>(pData) + i * nBandSpace;
+        oJob.nXOff = nXOff;
+        oJob.nYOff = nYOff;
+        oJob.nXSize = nXSize;
+        oJob.nYSize = nYSize;
+        oJob.eBufType = eBufType;
+        oJob.nPixelSpace = nPixelSpace;
+        oJob.nLineSpace = nLineSpace;
+        oJob.pbError = &bError;
+    }
+
+    const auto BandReadFunc = [](void *pUserData)
+    {
+        BandJob *poJob = static_cast<BandJob *>(pUserData);
+        DIMAPDataset *poThisDS = poJob->poDS;
+
+        // Zero-initialize the band slice: tiles do not necessarily cover
+        // the whole raster (same behavior as the VRT with its default 0
+        // background).
+        const int nBufTypeSize = GDALGetDataTypeSizeBytes(poJob->eBufType);
+        const double dfZero = 0.0;
+        for (int iLine = 0; iLine < poJob->nYSize; iLine++)
+        {
+            GByte *pabyLine = poJob->pabyDest + iLine * poJob->nLineSpace;
+            if (poJob->nPixelSpace == nBufTypeSize)
+                memset(pabyLine, 0,
+                       static_cast<size_t>(poJob->nXSize) * nBufTypeSize);
+            else
+                GDALCopyWords64(&dfZero, GDT_Float64, 0, pabyLine,
+                                poJob->eBufType,
+                                static_cast<int>(poJob->nPixelSpace),
+                                poJob->nXSize);
+        }
+
+        for (const auto &oComp :
+             poThisDS->m_aoBandComponents[poJob->nBand - 1])
+        {
+            const int nIntXOff = std::max(poJob->nXOff, oComp.nDstXOff);
+            const int nIntYOff = std::max(poJob->nYOff, oComp.nDstYOff);
+            const int nIntXEnd = std::min(poJob->nXOff + poJob->nXSize,
+                                          oComp.nDstXOff + oComp.nWidth);
+            const int nIntYEnd = std::min(poJob->nYOff + poJob->nYSize,
+                                          oComp.nDstYOff + oComp.nHeight);
+            if (nIntXOff >= nIntXEnd || nIntYOff >= nIntYEnd)
+                continue;
+
+            const auto oIter = poThisDS->m_oMapParallelHandles.find(
+                std::make_pair(poJob->nBand, oComp.osFilename));
+            if (oIter == poThisDS->m_oMapParallelHandles.end())
+            {
+                poJob->pbError->store(true);
+                return;
+            }
+
+            GByte *pabyDest =
+                poJob->pabyDest +
+                static_cast<GSpacing>(nIntYOff - poJob->nYOff) *
+                    poJob->nLineSpace +
+                static_cast<GSpacing>(nIntXOff - poJob->nXOff) *
+                    poJob->nPixelSpace;
+            if (oIter->second->GetRasterBand(oComp.nSrcBand)
+                    ->RasterIO(GF_Read, nIntXOff - oComp.nDstXOff,
+                               nIntYOff - oComp.nDstYOff, nIntXEnd - nIntXOff,
+                               nIntYEnd - nIntYOff, pabyDest,
+                               nIntXEnd - nIntXOff, nIntYEnd - nIntYOff,
+                               poJob->eBufType, poJob->nPixelSpace,
+                               poJob->nLineSpace, nullptr) != CE_None)
+            {
+                poJob->pbError->store(true);
+                return;
+            }
+        }
+    };
+
+    std::vector<void *> apJobData;
+    apJobData.reserve(aoJobs.size());
+    for (auto &oJob : aoJobs)
+        apJobData.push_back(&oJob);
+    poPool->SubmitJobs(BandReadFunc, apJobData);
+    poPool->WaitCompletion();
+
+    if (bError)
+    {
+        CPLDebug("DIMAP", "Parallel multi-band read failed, falling back to "
+                          "serial reading");
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                          GetOverviewCount()                          */
 /************************************************************************/
@@ -869,6 +1107,10 @@ int DIMAPDataset::ReadImageInformation()
         poVRTBand->AddSimpleSource(osImageFilename, iBand + 1, 0, 0,
                                    nRasterXSize, nRasterYSize, 0, 0,
                                    nRasterXSize, nRasterYSize);
+
+        m_aoBandComponents.emplace_back();
+        m_aoBandComponents.back().push_back(BandComponent{
+            osImageFilename, iBand + 1, 0, 0, nRasterXSize, nRasterYSize});
     }
 
     /* -------------------------------------------------------------------- */
@@ -1371,6 +1613,13 @@ int DIMAPDataset::ReadImageInformation2()
                     oTileIdxNameTuple.second, nSrcBand, 0, 0, nWidth, nHeight,
                     (nCol - 1) * nTileWidth, (nRow - 1) * nTileHeight, nWidth,
                     nHeight);
+
+                if (static_cast<int>(m_aoBandComponents.size()) <= iBand)
+                    m_aoBandComponents.resize(iBand + 1);
+                m_aoBandComponents[iBand].push_back(BandComponent{
+                    CPLString(oTileIdxNameTuple.second), nSrcBand,
+                    (nCol - 1) * nTileWidth, (nRow - 1) * nTileHeight, nWidth,
+                    nHeight});
             }
         }
     }
@@ -13,6 +13,27 @@
 
 #include "gdal_priv.h"
 #include "gdal_frmts.h"
+#include "gdalplugindriverproxy.h"
+
+/* The XXXXDriverSetCommonMetadata() functions of the drivers that can be
+ * registered in a deferred way. Their "drivercore" headers cannot be
+ * included together, as each of them defines a DRIVER_NAME constant. */
+#ifdef FRMT_gif
+void GIFDriverSetCommonMetadata(GDALDriver *);
+void BIGGIFDriverSetCommonMetadata(GDALDriver *);
+#endif
+#ifdef FRMT_grib
+void GRIBDriverSetCommonMetadata(GDALDriver *);
+#endif
+#ifdef FRMT_jpeg
+void JPEGDriverSetCommonMetadata(GDALDriver *);
+#endif
+#ifdef FRMT_png
+void PNGDriverSetCommonMetadata(GDALDriver *);
+#endif
+#ifdef FRMT_webp
+void WEBPDriverSetCommonMetadata(GDALDriver *);
+#endif
 #include "ogrsf_frmts.h"
 
 #ifdef GNM_ENABLED
@@ -108,11 +129,35 @@ void CPL_DLL GDALRegisterPlugins(void)
  * application.
  */
 
+/************************************************************************/
+/*                   GDALDeclareDeferredBuiltin()                       */
+/************************************************************************/
+
+#if defined(FRMT_gif) || defined(FRMT_grib) || defined(FRMT_jpeg) ||           \
+    defined(FRMT_png) || defined(FRMT_webp)
+/* Register a lightweight proxy carrying only the identification metadata of
+ * a built-in driver, deferring the actual registration to first use. */
+static void GDALDeclareDeferredBuiltin(void (*pfnSetCommonMetadata)(GDALDriver *),
+                                       void (*pfnRegister)())
+{
+    auto poProxyDriver = new GDALPluginDriverProxy(pfnRegister);
+    pfnSetCommonMetadata(poProxyDriver);
+    GetGDALDriverManager()->DeclareDeferredBuiltinDriver(poProxyDriver);
+}
+#endif
+
 void CPL_STDCALL GDALAllRegister()
 
 {
     auto poDriverManager = GetGDALDriverManager();
 
+    // When enabled, some built-in drivers are only registered when actually
+    // used, through the same proxy mechanism as deferred plugins, to lower
+    // the startup cost of GDALAllRegister().
+    const bool bDeferBuiltins =
+        CPLTestBool(CPLGetConfigOption("GDAL_DEFER_BUILTIN_DRIVERS", "NO"));
+    CPL_IGNORE_RET_VAL(bDeferBuiltins);
+
 #if defined(HAVE_EXTERNAL_DEFERRED_PLUGINS)
     DeclareExternalDeferredPlugins();
 #endif
@@ -397,7 +442,14 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_png
-    GDALRegister_PNG();
+    if (bDeferBuiltins)
+    {
+        GDALDeclareDeferredBuiltin(PNGDriverSetCommonMetadata, GDALRegister_PNG);
+    }
+    else
+    {
+        GDALRegister_PNG();
+    }
 #endif
 
 #ifdef FRMT_dds
@@ -409,7 +461,14 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_jpeg
-    GDALRegister_JPEG();
+    if (bDeferBuiltins)
+    {
+        GDALDeclareDeferredBuiltin(JPEGDriverSetCommonMetadata, GDALRegister_JPEG);
+    }
+    else
+    {
+        GDALRegister_JPEG();
+    }
 #endif
 
 #ifdef FRMT_mem
@@ -421,8 +480,16 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_gif
-    GDALRegister_GIF();
-    GDALRegister_BIGGIF();
+    if (bDeferBuiltins)
+    {
+        GDALDeclareDeferredBuiltin(GIFDriverSetCommonMetadata, GDALRegister_GIF);
+        GDALDeclareDeferredBuiltin(BIGGIFDriverSetCommonMetadata, GDALRegister_BIGGIF);
+    }
+    else
+    {
+        GDALRegister_GIF();
+        GDALRegister_BIGGIF();
+    }
 #endif
 
 #ifdef FRMT_envisat
@@ -535,7 +602,14 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_grib
-    GDALRegister_GRIB();
+    if (bDeferBuiltins)
+    {
+        GDALDeclareDeferredBuiltin(GRIBDriverSetCommonMetadata, GDALRegister_GRIB);
+    }
+    else
+    {
+        GDALRegister_GRIB();
+    }
 #endif
 
 #ifdef FRMT_mrsid
@@ -593,7 +667,14 @@ void CPL_STDCALL GDALAllRegister()
 #endif
 
 #ifdef FRMT_webp
-    GDALRegister_WEBP();
+    if (bDeferBuiltins)
+    {
+        GDALDeclareDeferredBuiltin(WEBPDriverSetCommonMetadata, GDALRegister_WEBP);
+    }
+    else
+    {
+        GDALRegister_WEBP();
+    }
 #endif
 
 #ifdef FRMT_pdf
@@ -1408,6 +1408,14 @@ GRIBDataset::Inventory(GDALOpenInfo *poOpenInfo)
         }
     }
     osSideCarFilename += ".idx";
+    // The sidecar may live elsewhere or under another name (e.g. archives
+    // serving x.grib2 with x.grb2.idx): allow an explicit override.
+    if (const char *pszIdxFilename = CSLFetchNameValueDef(
+            poOpenInfo->papszOpenOptions, "IDX_FILENAME",
+            CPLGetConfigOption("GRIB_IDX_FILENAME", nullptr)))
+    {
+        osSideCarFilename = pszIdxFilename;
+    }
     VSILFILE *fpSideCar = nullptr;
     if (CPLTestBool(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                                          "USE_IDX", "YES")) &&
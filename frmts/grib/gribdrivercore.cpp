@@ -57,6 +57,9 @@ void GRIBDriverSetCommonMetadata(GDALDriver *poDriver)
                               "    <Option name='USE_IDX' type='boolean' "
                               "description='Load metadata from "
                               "wgrib2 index file if available' default='YES'/>"
+                              "    <Option name='IDX_FILENAME' type='string' "
+                              "description='Path of the wgrib2 index file, "
+                              "when it is not <grib_filename>.idx'/>"
                               "</OpenOptionList>");
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC, "drivers/raster/grib.html");
     poDriver->SetMetadataItem(GDAL_DMD_EXTENSIONS, "grb grb2 grib2");
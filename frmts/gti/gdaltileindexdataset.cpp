@@ -4352,9 +4352,14 @@ bool GDALTileIndexDataset::CollectSources(double dfXOff, double dfYOff,
     if (poSQLLayer)
         ReleaseResultSet(poSQLLayer);
 
-    constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_IO = 1000 * 1000;
+    // Latency-bound topologies (remote COGs) benefit from parallel source
+    // reads even for small viewport requests: allow tuning the engagement
+    // threshold.
+    const int nMinimumPixelCountForThreadedIO =
+        atoi(CPLGetConfigOption("GTI_THREADED_IO_MIN_PIXEL_COUNT",
+                                CPLSPrintf("%d", 1000 * 1000)));
     if (bMultiThreadAllowed && m_aoSourceDesc.size() > 1 &&
-        dfXSize * dfYSize > MINIMUM_PIXEL_COUNT_FOR_THREADED_IO)
+        dfXSize * dfYSize > nMinimumPixelCountForThreadedIO)
     {
         if (m_nNumThreads < 0)
             m_nNumThreads = GetNumThreads();
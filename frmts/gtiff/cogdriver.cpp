@@ -58,6 +58,25 @@ static bool HasZSTDCompression()
 
 /************************************************************************/
 /*                           GetTmpFilename()                           */
+/************************************************************************/
+/*                          COGGetNumThreads()                          */
+/************************************************************************/
+
+/** Effective NUM_THREADS value for COG generation: the creation option,
+ * else the GDAL_NUM_THREADS configuration option, else ALL_CPUS, since
+ * both overview computation and tile compression scale with cores and
+ * COG generation is typically a dedicated batch operation.
+ */
+static const char *COGGetNumThreads(CSLConstList papszOptions)
+{
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads == nullptr)
+        pszNumThreads = "ALL_CPUS";
+    return pszNumThreads;
+}
+
 /************************************************************************/
 
 static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt)
@@ -1122,7 +1141,7 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
         CPLGetConfigOption("COG_TMP_COMPRESSION",  // only for debug purposes
                            HasZSTDCompression() ? "ZSTD" : "LZW"));
     aosOverviewOptions.SetNameValue(
-        "NUM_THREADS", CSLFetchNameValue(papszOptions, "NUM_THREADS"));
+        "NUM_THREADS", COGGetNumThreads(papszOptions));
     aosOverviewOptions.SetNameValue("BIGTIFF", "YES");
     aosOverviewOptions.SetNameValue("SPARSE_OK", "YES");
 
@@ -1272,8 +1291,7 @@ GDALCOGCreator::Create(const char *pszFilename, GDALDataset *const poSrcDS,
 
     aosOptions.SetNameValue("BIGTIFF",
                             CSLFetchNameValue(papszOptions, "BIGTIFF"));
-    aosOptions.SetNameValue("NUM_THREADS",
-                            CSLFetchNameValue(papszOptions, "NUM_THREADS"));
+    aosOptions.SetNameValue("NUM_THREADS", COGGetNumThreads(papszOptions));
     aosOptions.SetNameValue("GEOTIFF_VERSION",
                             CSLFetchNameValue(papszOptions, "GEOTIFF_VERSION"));
     aosOptions.SetNameValue("SPARSE_OK",
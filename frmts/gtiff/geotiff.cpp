@@ -1623,6 +1623,14 @@ void GDALRegister_GTiff()
         "       <Value>256</Value>"
         "       <Value>257</Value>"
         "   </Option>"
+        "   <Option name='VIRTUAL_MEM_IO' type='string-select' "
+        "description='Whether to serve reads of uncompressed local files "
+        "directly from a memory mapping of the whole file' "
+        "default='NO'>"
+        "       <Value>NO</Value>"
+        "       <Value>YES</Value>"
+        "       <Value>IF_ENOUGH_RAM</Value>"
+        "   </Option>"
         "</OpenOptionList>");
     poDriver->SetMetadataItem(GDAL_DMD_SUBDATASETS, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_CREATE_SUBDATASETS, "YES");
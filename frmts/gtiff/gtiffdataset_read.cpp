@@ -1444,6 +1444,72 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
 
     if (sContext.bSuccess)
     {
+        /* --------------------------------------------------------------- */
+        /*      Optionally extend the asynchronous fetch beyond the        */
+        /*      current window: sequential readers (gdal_translate, tile   */
+        /*      renderers) typically request the next strip of blocks      */
+        /*      right after this one, so issuing its ranges now keeps the  */
+        /*      network side several tiles ahead of the decompression      */
+        /*      workers (GDAL_TIFF_PREFETCH_NEXT_STRIP=YES).               */
+        /* --------------------------------------------------------------- */
+        if (nAdviseReadRanges > 0 &&
+            CPLTestBool(
+                CPLGetConfigOption("GDAL_TIFF_PREFETCH_NEXT_STRIP", "NO")))
+        {
+            const int nNextBlockYStart = nBlockYStart + nYBlocks;
+            const int nBlocksPerCol = DIV_ROUND_UP(nRasterYSize,
+                                                   m_nBlockYSize);
+            if (nNextBlockYStart < nBlocksPerCol)
+            {
+                const int nBandsForSpeculation =
+                    m_nPlanarConfig == PLANARCONFIG_SEPARATE ? nBandCount : 1;
+                for (int i = 0; i < nBandsForSpeculation; ++i)
+                {
+                    for (int x = 0; x < nXBlocks; ++x)
+                    {
+                        int nBlockId = (nBlockXStart + x) +
+                                       nNextBlockYStart *
+                                           sContext.nBlocksPerRow;
+                        if (m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+                            nBlockId +=
+                                (panBandMap[i] - 1) * m_nBlocksPerBand;
+                        vsi_l_offset nSpecOffset = 0;
+                        vsi_l_offset nSpecSize = 0;
+                        bool bError = false;
+                        CPL_IGNORE_RET_VAL(IsBlockAvailable(
+                            nBlockId, &nSpecOffset, &nSpecSize, &bError));
+                        if (bError || nSpecSize == 0)
+                            continue;
+                        const size_t nSpecSizeSzT =
+                            static_cast<size_t>(std::min<vsi_l_offset>(
+                                std::numeric_limits<size_t>::max(),
+                                nSpecSize));
+                        if (nAdviseReadTotalBytesLimit > 0 &&
+                            nSpecSizeSzT >
+                                nAdviseReadTotalBytesLimit -
+                                    std::min(nAdviseReadTotalBytesLimit,
+                                             nAdviseReadAccBytes))
+                        {
+                            // Do not overflow the AdviseRead() capacity
+                            // with speculative ranges.
+                            i = nBandsForSpeculation;
+                            break;
+                        }
+                        nAdviseReadAccBytes += nSpecSizeSzT;
+                        if (static_cast<size_t>(nAdviseReadRanges) >=
+                            anOffsets.size())
+                        {
+                            anOffsets.resize(nAdviseReadRanges + 1);
+                            anSizes.resize(nAdviseReadRanges + 1);
+                        }
+                        anOffsets[nAdviseReadRanges] = nSpecOffset;
+                        anSizes[nAdviseReadRanges] = nSpecSizeSzT;
+                        ++nAdviseReadRanges;
+                    }
+                }
+            }
+        }
+
         // Potentially start asynchronous fetching of ranges depending on file
         // implementation
         if (nAdviseReadRanges > 0)
@@ -3954,6 +4020,20 @@ GDALDataset *GTiffDataset::Open(GDALOpenInfo *poOpenInfo)
                     atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                                               "COLOR_TABLE_MULTIPLIER", "0"))));
 
+    // Zero-copy reads of uncompressed local files from a memory mapping of
+    // the whole file, on a per-dataset basis (same values as the
+    // GTIFF_VIRTUAL_MEM_IO configuration option).
+    if (const char *pszVirtualMemIO = CSLFetchNameValue(
+            poOpenInfo->papszOpenOptions, "VIRTUAL_MEM_IO"))
+    {
+        if (EQUAL(pszVirtualMemIO, "IF_ENOUGH_RAM"))
+            poDS->m_eVirtualMemIOUsage = VirtualMemIOEnum::IF_ENOUGH_RAM;
+        else if (CPLTestBool(pszVirtualMemIO))
+            poDS->m_eVirtualMemIOUsage = VirtualMemIOEnum::YES;
+        else
+            poDS->m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
+    }
+
     if (poDS->OpenOffset(l_hTIFF, TIFFCurrentDirOffset(l_hTIFF),
                          poOpenInfo->eAccess, bAllowRGBAInterface,
                          true) != CE_None)
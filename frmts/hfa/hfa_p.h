@@ -193,6 +193,13 @@ class HFABand final
     CPLErr GetRasterBlock(int nXBlock, int nYBlock, void *pData, int nDataSize);
     CPLErr SetRasterBlock(int nXBlock, int nYBlock, void *pData);
 
+    bool IsBlockCompressed(int nXBlock, int nYBlock);
+    CPLErr ReadCompressedBlockData(int nXBlock, int nYBlock, GByte **ppabyData,
+                                   int *pnDataSize);
+    static CPLErr UncompressBlock(GByte *pabyCData, int nSrcBytes,
+                                  GByte *pabyDest, int nMaxPixels,
+                                  EPTType eDataType);
+
     const char *GetBandName();
     void SetBandName(const char *pszName);
 
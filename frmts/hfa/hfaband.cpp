@@ -568,8 +568,9 @@ CPLErr HFABand::LoadExternalBlockInfo()
         return CE_Failure;                                                     \
     }
 
-static CPLErr UncompressBlock(GByte *pabyCData, int nSrcBytes, GByte *pabyDest,
-                              int nMaxPixels, EPTType eDataType)
+CPLErr HFABand::UncompressBlock(GByte *pabyCData, int nSrcBytes,
+                                GByte *pabyDest, int nMaxPixels,
+                                EPTType eDataType)
 
 {
     CHECK_ENOUGH_BYTES(13);
@@ -1330,6 +1331,85 @@ CPLErr HFABand::GetRasterBlock(int nXBlock, int nYBlock, void *pData,
     return CE_None;
 }
 
+/************************************************************************/
+/*                         IsBlockCompressed()                          */
+/************************************************************************/
+
+bool HFABand::IsBlockCompressed(int nXBlock, int nYBlock)
+
+{
+    if (LoadBlockInfo() != CE_None)
+        return false;
+
+    const int iBlock = nXBlock + nYBlock * nBlocksPerRow;
+    return (panBlockFlag[iBlock] & BFLG_VALID) != 0 &&
+           (panBlockFlag[iBlock] & BFLG_COMPRESSED) != 0;
+}
+
+/************************************************************************/
+/*                      ReadCompressedBlockData()                       */
+/*                                                                      */
+/*      Fetch the raw compressed data of a block, for the caller to     */
+/*      run through UncompressBlock() itself, possibly on another       */
+/*      thread.  Unlike GetRasterBlock() this makes no attempt to       */
+/*      paper over I/O errors on files in update state: any failure     */
+/*      just returns CE_Failure and the caller is expected to fall      */
+/*      back to the regular block reading path.                         */
+/************************************************************************/
+
+CPLErr HFABand::ReadCompressedBlockData(int nXBlock, int nYBlock,
+                                        GByte **ppabyData, int *pnDataSize)
+
+{
+    *ppabyData = nullptr;
+    *pnDataSize = 0;
+
+    if (!IsBlockCompressed(nXBlock, nYBlock))
+        return CE_Failure;
+
+    const int iBlock = nXBlock + nYBlock * nBlocksPerRow;
+
+    vsi_l_offset nBlockOffset = 0;
+    vsi_l_offset nThisBlockSize = 0;
+    VSILFILE *fpData = nullptr;
+
+    if (fpExternal)
+    {
+        fpData = fpExternal;
+        nBlockOffset = nBlockStart + nBlockSize * iBlock * nLayerStackCount +
+                       nLayerStackIndex * nBlockSize;
+        nThisBlockSize = nBlockSize;
+    }
+    else
+    {
+        fpData = psInfo->fp;
+        nBlockOffset = panBlockStart[iBlock];
+        nThisBlockSize = panBlockSize[iBlock];
+    }
+
+    if (nThisBlockSize == 0 || nThisBlockSize > INT_MAX)
+        return CE_Failure;
+
+    if (VSIFSeekL(fpData, nBlockOffset, SEEK_SET) != 0)
+        return CE_Failure;
+
+    GByte *pabyCData = static_cast<GByte *>(
+        VSI_MALLOC_VERBOSE(static_cast<size_t>(nThisBlockSize)));
+    if (pabyCData == nullptr)
+        return CE_Failure;
+
+    if (VSIFReadL(pabyCData, static_cast<size_t>(nThisBlockSize), 1, fpData) !=
+        1)
+    {
+        CPLFree(pabyCData);
+        return CE_Failure;
+    }
+
+    *ppabyData = pabyCData;
+    *pnDataSize = static_cast<int>(nThisBlockSize);
+    return CE_None;
+}
+
 /************************************************************************/
 /*                            ReAllocBlock()                            */
 /************************************************************************/
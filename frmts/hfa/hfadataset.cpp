@@ -35,11 +35,13 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "gdal_rat.h"
+#include "gdal_thread_pool.h"
 #include "hfa.h"
 #include "ogr_core.h"
 #include "ogr_spatialref.h"
@@ -2500,6 +2502,176 @@ GDALRasterBand *HFARasterBand::GetOverview(int i)
         return papoOverviewBands[i];
 }
 
+/************************************************************************/
+/*                     PreDecodeCompressedBlocks()                      */
+/*                                                                      */
+/*      Opportunistically decompress the compressed blocks              */
+/*      intersecting the given window on the global worker thread       */
+/*      pool, directly into GDAL block cache buffers, so that the       */
+/*      generic RasterIO() machinery finds them already decoded.        */
+/*      Purely advisory: any block that cannot be handled here is       */
+/*      left to the regular serial IReadBlock() path.                   */
+/************************************************************************/
+
+void HFARasterBand::PreDecodeCompressedBlocks(int nXOff, int nYOff, int nXSize,
+                                              int nYSize)
+{
+    // Decoding directly into cached block buffers only works when
+    // IReadBlock() would not post-process the data (1/2/4 bit expansion).
+    if (eHFADataType == EPT_u1 || eHFADataType == EPT_u2 ||
+        eHFADataType == EPT_u4)
+        return;
+
+    const int nThreads =
+        GDALGetNumThreads(CPLGetConfigOption("HFA_NUM_THREADS", nullptr));
+    if (nThreads <= 1)
+        return;
+
+    HFABand *poHFABand = hHFA->papoBand[nBand - 1];
+    if (nThisOverview >= 0)
+    {
+        if (nThisOverview >= poHFABand->nOverviews)
+            return;
+        poHFABand = poHFABand->papoOverviews[nThisOverview];
+    }
+    if (poHFABand->nBlockXSize != nBlockXSize ||
+        poHFABand->nBlockYSize != nBlockYSize)
+        return;
+
+    const int nXBlockStart = nXOff / nBlockXSize;
+    const int nXBlockEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nYBlockStart = nYOff / nBlockYSize;
+    const int nYBlockEnd = (nYOff + nYSize - 1) / nBlockYSize;
+
+    if (static_cast<GIntBig>(nXBlockEnd - nXBlockStart + 1) *
+            (nYBlockEnd - nYBlockStart + 1) <
+        4)
+        return;
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (poPool == nullptr)
+        return;
+
+    struct DecodeJob
+    {
+        HFABand *poBand = nullptr;
+        GByte *pabyCData = nullptr;
+        int nCDataSize = 0;
+        GDALRasterBlock *poBlock = nullptr;
+        int nXBlock = 0;
+        int nYBlock = 0;
+        bool bSuccess = false;
+    };
+
+    std::vector<DecodeJob> aoJobs;
+
+    // Parallel decompression pass.
+    const auto DecodeFunc = [](void *pData)
+    {
+        DecodeJob *poJob = static_cast<DecodeJob *>(pData);
+        // Errors are not reported from worker threads: failed blocks are
+        // evicted from the cache below and decoded again, serially, by the
+        // regular path, which emits the error on the request thread.
+        CPLErrorHandlerPusher oQuietErrors(CPLQuietErrorHandler);
+        poJob->bSuccess =
+            HFABand::UncompressBlock(
+                poJob->pabyCData, poJob->nCDataSize,
+                static_cast<GByte *>(poJob->poBlock->GetDataRef()),
+                poJob->poBand->nBlockXSize * poJob->poBand->nBlockYSize,
+                poJob->poBand->eDataType) == CE_None;
+    };
+
+    const auto RunBatch = [this, poPool, &aoJobs, &DecodeFunc]()
+    {
+        std::vector<void *> apJobData;
+        apJobData.reserve(aoJobs.size());
+        for (auto &oJob : aoJobs)
+            apJobData.push_back(&oJob);
+        poPool->SubmitJobs(DecodeFunc, apJobData);
+        poPool->WaitCompletion();
+
+        for (auto &oJob : aoJobs)
+        {
+            CPLFree(oJob.pabyCData);
+            oJob.poBlock->DropLock();
+            if (!oJob.bSuccess)
+                FlushBlock(oJob.nXBlock, oJob.nYBlock, FALSE);
+        }
+        aoJobs.clear();
+    };
+
+    // Bound the number of blocks locked at any time, so that a request
+    // covering a huge window does not hold the whole window in the block
+    // cache at once.
+    const size_t nBatchSize = std::max<size_t>(64, 8 * nThreads);
+
+    // Sequential I/O pass: fetch the raw compressed data of every
+    // intersecting block not already in the block cache.
+    for (int iYBlock = nYBlockStart; iYBlock <= nYBlockEnd; iYBlock++)
+    {
+        for (int iXBlock = nXBlockStart; iXBlock <= nXBlockEnd; iXBlock++)
+        {
+            if (!poHFABand->IsBlockCompressed(iXBlock, iYBlock))
+                continue;
+
+            GDALRasterBlock *poBlock = TryGetLockedBlockRef(iXBlock, iYBlock);
+            if (poBlock != nullptr)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+
+            GByte *pabyCData = nullptr;
+            int nCDataSize = 0;
+            if (poHFABand->ReadCompressedBlockData(
+                    iXBlock, iYBlock, &pabyCData, &nCDataSize) != CE_None)
+                continue;
+
+            poBlock = GetLockedBlockRef(iXBlock, iYBlock, TRUE);
+            if (poBlock == nullptr)
+            {
+                CPLFree(pabyCData);
+                continue;
+            }
+
+            DecodeJob oJob;
+            oJob.poBand = poHFABand;
+            oJob.pabyCData = pabyCData;
+            oJob.nCDataSize = nCDataSize;
+            oJob.poBlock = poBlock;
+            oJob.nXBlock = iXBlock;
+            oJob.nYBlock = iYBlock;
+            aoJobs.push_back(oJob);
+
+            if (aoJobs.size() >= nBatchSize)
+                RunBatch();
+        }
+    }
+
+    if (!aoJobs.empty())
+        RunBatch();
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr HFARasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                int nXSize, int nYSize, void *pData,
+                                int nBufXSize, int nBufYSize,
+                                GDALDataType eBufType, GSpacing nPixelSpace,
+                                GSpacing nLineSpace,
+                                GDALRasterIOExtraArg *psExtraArg)
+
+{
+    if (eRWFlag == GF_Read)
+        PreDecodeCompressedBlocks(nXOff, nYOff, nXSize, nYSize);
+
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                             IReadBlock()                             */
 /************************************************************************/
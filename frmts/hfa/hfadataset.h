@@ -136,6 +136,8 @@ class HFARasterBand final : public GDALPamRasterBand
     void ReadAuxMetadata();
     void ReadHistogramMetadata();
     void EstablishOverviews();
+    void PreDecodeCompressedBlocks(int nXOff, int nYOff, int nXSize,
+                                   int nYSize);
     CPLErr WriteNamedRAT(const char *pszName,
                          const GDALRasterAttributeTable *poRAT);
 
@@ -145,6 +147,9 @@ class HFARasterBand final : public GDALPamRasterBand
 
     CPLErr IReadBlock(int, int, void *) override;
     CPLErr IWriteBlock(int, int, void *) override;
+    CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                     GDALDataType, GSpacing nPixelSpace, GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
 
     const char *GetDescription() const override;
     void SetDescription(const char *) override;
@@ -25,6 +25,10 @@
 #include <mutex>
 #include <type_traits>
 
+#if defined(__x86_64) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_mdreader.h"
@@ -968,6 +972,138 @@ CPLErr LIBERTIFFDataset::IRasterIO(
 /*                        HorizPredictorDecode()                        */
 /************************************************************************/
 
+#if defined(__x86_64) || defined(_M_X64)
+
+// SSE2 in-register prefix sums for the hot horizontal differencing
+// cases (the LZW + predictor=2 combination of legacy archives). A
+// stride-N prefix sum over a 16 byte register is obtained by adding the
+// register shifted left by N, 2N, ... bytes, then adding the carried
+// per-component totals of the previous iteration.
+
+static void HorizPredictorDecode1ComponentByteSSE2(uint8_t *buffer,
+                                                   size_t nPixelCount)
+{
+    size_t i = 0;
+    __m128i carry = _mm_setzero_si128();
+    for (; i + 16 <= nPixelCount; i += 16)
+    {
+        __m128i x =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 1));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 2));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi8(x, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(buffer + i), x);
+        carry = _mm_set1_epi8(static_cast<char>(buffer[i + 15]));
+    }
+    uint8_t acc = i > 0 ? buffer[i - 1] : 0;
+    for (; i < nPixelCount; ++i)
+    {
+        acc = static_cast<uint8_t>(acc + buffer[i]);
+        buffer[i] = acc;
+    }
+}
+
+static void HorizPredictorDecode3ComponentsByteSSE2(uint8_t *buffer,
+                                                    size_t nPixelCount)
+{
+    const size_t nBytes = nPixelCount * 3;
+    size_t i = 0;
+    __m128i carry = _mm_setzero_si128();
+    // Process 4 pixels (12 bytes) per iteration: the stride-3 prefix sum
+    // through shifts by 3 and 6 bytes accumulates offsets -3, -6 and -9,
+    // which is complete for the first 12 bytes of the register only.
+    for (; i + 16 <= nBytes; i += 12)
+    {
+        __m128i x =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 3));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 6));
+        x = _mm_add_epi8(x, carry);
+        alignas(16) uint8_t tmp[16];
+        _mm_store_si128(reinterpret_cast<__m128i *>(tmp), x);
+        memcpy(buffer + i, tmp, 12);
+        const char c0 = static_cast<char>(tmp[9]);
+        const char c1 = static_cast<char>(tmp[10]);
+        const char c2 = static_cast<char>(tmp[11]);
+        carry = _mm_setr_epi8(c0, c1, c2, c0, c1, c2, c0, c1, c2, c0, c1, c2,
+                              c0, c1, c2, c0);
+    }
+    uint8_t acc0 = i > 0 ? buffer[i - 3] : 0;
+    uint8_t acc1 = i > 0 ? buffer[i - 2] : 0;
+    uint8_t acc2 = i > 0 ? buffer[i - 1] : 0;
+    for (; i + 2 < nBytes; i += 3)
+    {
+        acc0 = static_cast<uint8_t>(acc0 + buffer[i + 0]);
+        acc1 = static_cast<uint8_t>(acc1 + buffer[i + 1]);
+        acc2 = static_cast<uint8_t>(acc2 + buffer[i + 2]);
+        buffer[i + 0] = acc0;
+        buffer[i + 1] = acc1;
+        buffer[i + 2] = acc2;
+    }
+}
+
+static void HorizPredictorDecode4ComponentsByteSSE2(uint8_t *buffer,
+                                                    size_t nPixelCount)
+{
+    const size_t nBytes = nPixelCount * 4;
+    size_t i = 0;
+    __m128i carry = _mm_setzero_si128();
+    for (; i + 16 <= nBytes; i += 16)
+    {
+        __m128i x =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi8(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi8(x, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(buffer + i), x);
+        // Broadcast the last pixel (4 bytes) to all lanes.
+        carry = _mm_shuffle_epi32(x, 0xFF);
+    }
+    uint8_t acc0 = i > 0 ? buffer[i - 4] : 0;
+    uint8_t acc1 = i > 0 ? buffer[i - 3] : 0;
+    uint8_t acc2 = i > 0 ? buffer[i - 2] : 0;
+    uint8_t acc3 = i > 0 ? buffer[i - 1] : 0;
+    for (; i + 3 < nBytes; i += 4)
+    {
+        acc0 = static_cast<uint8_t>(acc0 + buffer[i + 0]);
+        acc1 = static_cast<uint8_t>(acc1 + buffer[i + 1]);
+        acc2 = static_cast<uint8_t>(acc2 + buffer[i + 2]);
+        acc3 = static_cast<uint8_t>(acc3 + buffer[i + 3]);
+        buffer[i + 0] = acc0;
+        buffer[i + 1] = acc1;
+        buffer[i + 2] = acc2;
+        buffer[i + 3] = acc3;
+    }
+}
+
+static void HorizPredictorDecode1ComponentUInt16SSE2(uint16_t *buffer,
+                                                     size_t nPixelCount)
+{
+    size_t i = 0;
+    __m128i carry = _mm_setzero_si128();
+    for (; i + 8 <= nPixelCount; i += 8)
+    {
+        __m128i x =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + i));
+        x = _mm_add_epi16(x, _mm_slli_si128(x, 2));
+        x = _mm_add_epi16(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi16(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi16(x, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(buffer + i), x);
+        carry = _mm_set1_epi16(static_cast<short>(buffer[i + 7]));
+    }
+    uint16_t acc = i > 0 ? buffer[i - 1] : 0;
+    for (; i < nPixelCount; ++i)
+    {
+        acc = static_cast<uint16_t>(acc + buffer[i]);
+        buffer[i] = acc;
+    }
+}
+
+#endif  // defined(__x86_64) || defined(_M_X64)
+
 template <class T, class U>
 CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW static void
 HorizPredictorDecode1Component(void *bufferIn, size_t nPixelCount)
@@ -1062,6 +1198,39 @@ HorizPredictorDecode(void *bufferIn, size_t nPixelCount,
     static_assert(std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> ||
                   std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t>);
 
+#if defined(__x86_64) || defined(_M_X64)
+    if constexpr (std::is_same_v<T, uint8_t>)
+    {
+        if (nComponentsPerPixel == 1)
+        {
+            HorizPredictorDecode1ComponentByteSSE2(
+                static_cast<uint8_t *>(bufferIn), nPixelCount);
+            return;
+        }
+        else if (nComponentsPerPixel == 3)
+        {
+            HorizPredictorDecode3ComponentsByteSSE2(
+                static_cast<uint8_t *>(bufferIn), nPixelCount);
+            return;
+        }
+        else if (nComponentsPerPixel == 4)
+        {
+            HorizPredictorDecode4ComponentsByteSSE2(
+                static_cast<uint8_t *>(bufferIn), nPixelCount);
+            return;
+        }
+    }
+    else if constexpr (std::is_same_v<T, uint16_t>)
+    {
+        if (nComponentsPerPixel == 1)
+        {
+            HorizPredictorDecode1ComponentUInt16SSE2(
+                static_cast<uint16_t *>(bufferIn), nPixelCount);
+            return;
+        }
+    }
+#endif
+
     if (nComponentsPerPixel == 1)
     {
         // cppcheck-suppress duplicateBranch
@@ -892,6 +892,7 @@ MBTilesDataset::~MBTilesDataset()
             CPLFree(m_papoOverviewDS);
         }
 
+        FinalizeCachedReadTileStmt();
         if (hDS != nullptr)
         {
             GDALClose(hDS);
@@ -31,6 +31,8 @@
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
 #include "ogrsf_frmts.h"
+#include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 
 /************************************************************************/
 /*                     IOGRMemLayerFeatureIterator                      */
@@ -156,6 +158,241 @@ OGRFeature *OGRMemLayer::GetNextFeature()
     return nullptr;
 }
 
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+int OGRMemLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                   struct ArrowArray *out_array)
+{
+    memset(out_array, 0, sizeof(*out_array));
+
+    /* -------------------------------------------------------------------- */
+    /*      The fast path fills the Arrow arrays directly from the stored   */
+    /*      features, without cloning each of them through                  */
+    /*      GetNextFeature(). It requires client-side filters to be unset   */
+    /*      and field types with a direct Arrow equivalent.                 */
+    /* -------------------------------------------------------------------- */
+    bool bFastPath =
+        m_poFilterGeom == nullptr && m_poAttrQuery == nullptr &&
+        !m_aosArrowArrayStreamOptions.FetchBool(GAS_OPT_DATETIME_AS_STRING,
+                                                false);
+    for (int i = 0; bFastPath && i < m_poFeatureDefn->GetFieldCount(); ++i)
+    {
+        switch (m_poFeatureDefn->GetFieldDefn(i)->GetType())
+        {
+            case OFTInteger:
+            case OFTInteger64:
+            case OFTReal:
+            case OFTString:
+            case OFTBinary:
+            case OFTDate:
+            case OFTTime:
+            case OFTDateTime:
+                break;
+            default:
+                bFastPath = false;
+                break;
+        }
+    }
+    if (!bFastPath)
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+
+    if (m_iNextReadFID < 0)
+        return 0;  // end of iteration
+
+    auto psHelper = std::make_unique<OGRArrowArrayHelper>(
+        m_poDS, m_poFeatureDefn.get(), m_aosArrowArrayStreamOptions,
+        out_array);
+    if (out_array->release == nullptr)
+        return ENOMEM;
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int iFeat = 0;
+    bool bErrorOccurred = false;
+    while (iFeat < psHelper->m_nMaxBatchSize && !bErrorOccurred)
+    {
+        const OGRFeature *poFeature = nullptr;
+        if (m_papoFeatures)
+        {
+            if (m_iNextReadFID >= m_nMaxFeatureCount)
+                break;
+            poFeature = m_papoFeatures[m_iNextReadFID++];
+            if (poFeature == nullptr)
+                continue;
+        }
+        else if (m_oMapFeaturesIter != m_oMapFeatures.end())
+        {
+            poFeature = m_oMapFeaturesIter->second.get();
+            ++m_oMapFeaturesIter;
+        }
+        else
+        {
+            break;
+        }
+        m_nFeaturesRead++;
+
+        if (psHelper->m_panFIDValues)
+            psHelper->m_panFIDValues[iFeat] = poFeature->GetFID();
+
+        for (int i = 0;
+             i < psHelper->m_nGeomFieldCount && !bErrorOccurred; ++i)
+        {
+            const int iArrowField = psHelper->m_mapOGRGeomFieldToArrowField[i];
+            if (iArrowField < 0)
+                continue;
+            const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
+            if (poGeom == nullptr)
+            {
+                if (!psHelper->SetNull(iArrowField, iFeat))
+                    bErrorOccurred = true;
+                continue;
+            }
+            const size_t nWkbSize = poGeom->WkbSize();
+            GByte *outPtr = psHelper->GetPtrForStringOrBinary(iArrowField,
+                                                              iFeat, nWkbSize);
+            if (outPtr == nullptr)
+            {
+                bErrorOccurred = true;
+                continue;
+            }
+            poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+        }
+
+        for (int i = 0; i < psHelper->m_nFieldCount && !bErrorOccurred; ++i)
+        {
+            const int iArrowField = psHelper->m_mapOGRFieldToArrowField[i];
+            if (iArrowField < 0)
+                continue;
+            auto psArray = out_array->children[iArrowField];
+            const OGRField *psRawField = poFeature->GetRawFieldRef(i);
+            if (OGR_RawField_IsUnset(psRawField) ||
+                OGR_RawField_IsNull(psRawField))
+            {
+                if (!psHelper->SetNull(iArrowField, iFeat))
+                    bErrorOccurred = true;
+                continue;
+            }
+            const auto *poFieldDefn = m_poFeatureDefn->GetFieldDefn(i);
+            switch (poFieldDefn->GetType())
+            {
+                case OFTInteger:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTBoolean)
+                    {
+                        if (psRawField->Integer)
+                            OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                    }
+                    else if (poFieldDefn->GetSubType() == OFSTInt16)
+                    {
+                        OGRArrowArrayHelper::SetInt16(
+                            psArray, iFeat,
+                            static_cast<int16_t>(psRawField->Integer));
+                    }
+                    else
+                    {
+                        OGRArrowArrayHelper::SetInt32(psArray, iFeat,
+                                                      psRawField->Integer);
+                    }
+                    break;
+                }
+                case OFTInteger64:
+                {
+                    OGRArrowArrayHelper::SetInt64(psArray, iFeat,
+                                                  psRawField->Integer64);
+                    break;
+                }
+                case OFTReal:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                    {
+                        OGRArrowArrayHelper::SetFloat(
+                            psArray, iFeat,
+                            static_cast<float>(psRawField->Real));
+                    }
+                    else
+                    {
+                        OGRArrowArrayHelper::SetDouble(psArray, iFeat,
+                                                       psRawField->Real);
+                    }
+                    break;
+                }
+                case OFTString:
+                {
+                    const size_t nLen = strlen(psRawField->String);
+                    GByte *outPtr = psHelper->GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                    {
+                        bErrorOccurred = true;
+                        break;
+                    }
+                    memcpy(outPtr, psRawField->String, nLen);
+                    break;
+                }
+                case OFTBinary:
+                {
+                    const size_t nLen = psRawField->Binary.nCount;
+                    GByte *outPtr = psHelper->GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                    {
+                        bErrorOccurred = true;
+                        break;
+                    }
+                    memcpy(outPtr, psRawField->Binary.paData, nLen);
+                    break;
+                }
+                case OFTDate:
+                {
+                    OGRArrowArrayHelper::SetDate(psArray, iFeat, brokenDown,
+                                                 *psRawField);
+                    break;
+                }
+                case OFTTime:
+                {
+                    OGRArrowArrayHelper::SetInt32(
+                        psArray, iFeat,
+                        psRawField->Date.Hour * 3600000 +
+                            psRawField->Date.Minute * 60000 +
+                            static_cast<int>(psRawField->Date.Second * 1000 +
+                                             0.5f));
+                    break;
+                }
+                case OFTDateTime:
+                {
+                    OGRArrowArrayHelper::SetDateTime(
+                        psArray, iFeat, brokenDown, psHelper->m_anTZFlags[i],
+                        *psRawField);
+                    break;
+                }
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+        }
+
+        if (!bErrorOccurred)
+            ++iFeat;
+    }
+
+    if (bErrorOccurred)
+    {
+        if (out_array->release)
+            out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+        return ENOMEM;
+    }
+
+    psHelper->Shrink(iFeat);
+    if (iFeat == 0)
+        psHelper->ClearArray();
+
+    return 0;
+}
+
 /************************************************************************/
 /*                           SetNextByIndex()                           */
 /************************************************************************/
@@ -657,6 +894,9 @@ int OGRMemLayer::TestCapability(const char *pszCap) const
     else if (EQUAL(pszCap, OLCZGeometries))
         return TRUE;
 
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr;
+
     return FALSE;
 }
 
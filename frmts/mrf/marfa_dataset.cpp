@@ -206,6 +206,23 @@ CPLErr MRFDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return CE_Failure;
     }
 
+    //
+    // In caching mode, let the source dataset know the whole window this
+    // request is about to pull page by page through FetchBlock(): remote
+    // backed sources (e.g. /vsicurl/) can then fetch the corresponding
+    // ranges concurrently instead of serving one page per round trip.
+    //
+    if (eRWFlag == GF_Read && !source.empty() && !clonedSource &&
+        CPLTestBool(CPLGetConfigOption("MRF_ADVISE_SOURCE_READ", "YES")))
+    {
+        if (GDALDataset *poSrc = GetSrcDS())
+        {
+            CPL_IGNORE_RET_VAL(poSrc->AdviseRead(
+                nXOff, nYOff, nXSize, nYSize, nBufXSize, nBufYSize, eBufType,
+                nBandCount, const_cast<int *>(panBandMap), nullptr));
+        }
+    }
+
     //
     // Call the parent implementation, which splits it into bands and calls
     // their IRasterIO
@@ -227,7 +227,8 @@ class netCDFRasterBand final : public GDALPamRasterBand
                       size_t nTmpBlockYSize, bool bCheckIsNan = false);
     void SetBlockSize();
 
-    bool FetchNetcdfChunk(size_t xstart, size_t ystart, void *pImage);
+    bool FetchNetcdfChunk(int cdfidIn, size_t xstart, size_t ystart,
+                          void *pImage);
 
     void SetNoDataValueNoUpdate(double dfNoData);
     void SetNoDataValueNoUpdate(int64_t nNoData);
@@ -2275,8 +2276,8 @@ void netCDFRasterBand::CheckDataCpx(void *pImage, void *pImageNC,
 /*                          FetchNetcdfChunk()                          */
 /************************************************************************/
 
-bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
-                                        void *pImage)
+bool netCDFRasterBand::FetchNetcdfChunk(int cdfidIn, size_t xstart,
+                                        size_t ystart, void *pImage)
 {
     size_t start[MAX_NC_DIMS] = {};
     size_t edge[MAX_NC_DIMS] = {};
@@ -2301,7 +2302,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
 #endif
 
     int nd = 0;
-    nc_inq_varndims(cdfid, nZId, &nd);
+    nc_inq_varndims(cdfidIn, nZId, &nd);
     if (nd == 3)
     {
         start[panBandZPos[0]] = nLevel;  // z
@@ -2363,7 +2364,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     {
         if (bSignedData)
         {
-            status = nc_get_vara_schar(cdfid, nZId, start, edge,
+            status = nc_get_vara_schar(cdfidIn, nZId, start, edge,
                                        static_cast<signed char *>(pImageNC));
             if (status == NC_NOERR)
                 CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
@@ -2371,7 +2372,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
         }
         else
         {
-            status = nc_get_vara_uchar(cdfid, nZId, start, edge,
+            status = nc_get_vara_uchar(cdfidIn, nZId, start, edge,
                                        static_cast<unsigned char *>(pImageNC));
             if (status == NC_NOERR)
                 CheckData<unsigned char>(pImage, pImageNC, edge[nBandXPos],
@@ -2380,7 +2381,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (eDataType == GDT_Int8)
     {
-        status = nc_get_vara_schar(cdfid, nZId, start, edge,
+        status = nc_get_vara_schar(cdfidIn, nZId, start, edge,
                                    static_cast<signed char *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<signed char>(pImage, pImageNC, edge[nBandXPos],
@@ -2388,7 +2389,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (nc_datatype == NC_SHORT)
     {
-        status = nc_get_vara_short(cdfid, nZId, start, edge,
+        status = nc_get_vara_short(cdfidIn, nZId, start, edge,
                                    static_cast<short *>(pImageNC));
         if (status == NC_NOERR)
         {
@@ -2407,13 +2408,13 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     else if (eDataType == GDT_Int32)
     {
 #if SIZEOF_UNSIGNED_LONG == 4
-        status = nc_get_vara_long(cdfid, nZId, start, edge,
+        status = nc_get_vara_long(cdfidIn, nZId, start, edge,
                                   static_cast<long *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<long>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                             false);
 #else
-        status = nc_get_vara_int(cdfid, nZId, start, edge,
+        status = nc_get_vara_int(cdfidIn, nZId, start, edge,
                                  static_cast<int *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
@@ -2422,7 +2423,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (eDataType == GDT_Float32)
     {
-        status = nc_get_vara_float(cdfid, nZId, start, edge,
+        status = nc_get_vara_float(cdfidIn, nZId, start, edge,
                                    static_cast<float *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
@@ -2430,7 +2431,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (eDataType == GDT_Float64)
     {
-        status = nc_get_vara_double(cdfid, nZId, start, edge,
+        status = nc_get_vara_double(cdfidIn, nZId, start, edge,
                                     static_cast<double *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
@@ -2438,7 +2439,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (eDataType == GDT_UInt16)
     {
-        status = nc_get_vara_ushort(cdfid, nZId, start, edge,
+        status = nc_get_vara_ushort(cdfidIn, nZId, start, edge,
                                     static_cast<unsigned short *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<unsigned short>(pImage, pImageNC, edge[nBandXPos],
@@ -2446,7 +2447,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (eDataType == GDT_UInt32)
     {
-        status = nc_get_vara_uint(cdfid, nZId, start, edge,
+        status = nc_get_vara_uint(cdfidIn, nZId, start, edge,
                                   static_cast<unsigned int *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<unsigned int>(pImage, pImageNC, edge[nBandXPos],
@@ -2454,7 +2455,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (eDataType == GDT_Int64)
     {
-        status = nc_get_vara_longlong(cdfid, nZId, start, edge,
+        status = nc_get_vara_longlong(cdfidIn, nZId, start, edge,
                                       static_cast<long long *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<std::int64_t>(pImage, pImageNC, edge[nBandXPos],
@@ -2463,7 +2464,7 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     else if (eDataType == GDT_UInt64)
     {
         status =
-            nc_get_vara_ulonglong(cdfid, nZId, start, edge,
+            nc_get_vara_ulonglong(cdfidIn, nZId, start, edge,
                                   static_cast<unsigned long long *>(pImageNC));
         if (status == NC_NOERR)
             CheckData<std::uint64_t>(pImage, pImageNC, edge[nBandXPos],
@@ -2471,28 +2472,28 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     }
     else if (eDataType == GDT_CInt16)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
+        status = nc_get_vara(cdfidIn, nZId, start, edge, pImageNC);
         if (status == NC_NOERR)
             CheckDataCpx<short>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                                 false);
     }
     else if (eDataType == GDT_CInt32)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
+        status = nc_get_vara(cdfidIn, nZId, start, edge, pImageNC);
         if (status == NC_NOERR)
             CheckDataCpx<int>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                               false);
     }
     else if (eDataType == GDT_CFloat32)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
+        status = nc_get_vara(cdfidIn, nZId, start, edge, pImageNC);
         if (status == NC_NOERR)
             CheckDataCpx<float>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                                 false);
     }
     else if (eDataType == GDT_CFloat64)
     {
-        status = nc_get_vara(cdfid, nZId, start, edge, pImageNC);
+        status = nc_get_vara(cdfidIn, nZId, start, edge, pImageNC);
         if (status == NC_NOERR)
             CheckDataCpx<double>(pImage, pImageNC, edge[nBandXPos], nYChunkSize,
                                  false);
@@ -2519,7 +2520,30 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                                     void *pImage)
 
 {
-    CPLMutexHolderD(&hNCMutex);
+    netCDFDataset *poGDSMain = cpl::down_cast<netCDFDataset *>(poDS);
+
+    // With GDAL_NETCDF_PER_THREAD_HANDLES=YES (and a thread-safe
+    // libnetcdf/HDF5 stack), read through a pooled handle of our own
+    // instead of serializing on the global netCDF mutex.
+    const int nPooledCdfid = poGDSMain->AcquirePooledHandle();
+
+    struct PooledHandleReleaser
+    {
+        netCDFDataset *m_poDS;
+        int m_nId;
+
+        ~PooledHandleReleaser()
+        {
+            if (m_nId >= 0)
+                m_poDS->ReleasePooledHandle(m_nId);
+        }
+    };
+
+    PooledHandleReleaser oReleaser{poGDSMain, nPooledCdfid};
+    std::unique_ptr<CPLMutexHolder> poMutexHolder;
+    if (nPooledCdfid < 0)
+        poMutexHolder = std::make_unique<CPLMutexHolder>(&hNCMutex);
+    const int nEffectiveCdfid = nPooledCdfid >= 0 ? nPooledCdfid : cdfid;
 
     // Locate X, Y and Z position in the array.
 
@@ -2570,7 +2594,7 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 if (!firstChunk)
                 {
                     firstChunk.reset(new std::vector<GByte>(nChunkSize));
-                    if (!FetchNetcdfChunk(xstart,
+                    if (!FetchNetcdfChunk(nEffectiveCdfid, xstart,
                                           nFirstChunkBlock * nBlockYSize,
                                           firstChunk.get()->data()))
                         return CE_Failure;
@@ -2580,7 +2604,7 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 if (!secondChunk && firstKey != secondKey)
                 {
                     secondChunk.reset(new std::vector<GByte>(nChunkSize));
-                    if (!FetchNetcdfChunk(xstart, nLastChunkBlock * nBlockYSize,
+                    if (!FetchNetcdfChunk(nEffectiveCdfid, xstart, nLastChunkBlock * nBlockYSize,
                                           secondChunk.get()->data()))
                         return CE_Failure;
                     if (poGDS->poChunkCache)
@@ -2625,7 +2649,7 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
         }
     }
 
-    return FetchNetcdfChunk(xstart, ystart, pImage) ? CE_None : CE_Failure;
+    return FetchNetcdfChunk(nEffectiveCdfid, xstart, ystart, pImage) ? CE_None : CE_Failure;
 }
 
 /************************************************************************/
@@ -2858,10 +2882,82 @@ netCDFDataset::~netCDFDataset()
 
 /************************************************************************/
 /*                               Close()                                */
+/************************************************************************/
+/*                        AcquirePooledHandle()                         */
+/************************************************************************/
+
+int netCDFDataset::AcquirePooledHandle()
+{
+    if (m_nPooledHandleState == 0)
+        return -1;
+
+    std::lock_guard<std::mutex> oLock(m_oPooledHandleMutex);
+    if (m_nPooledHandleState < 0)
+    {
+        m_nPooledHandleState =
+            eAccess == GA_ReadOnly && !m_osFilenameForPooledHandles.empty() &&
+                    CPLTestBool(CPLGetConfigOption(
+                        "GDAL_NETCDF_PER_THREAD_HANDLES", "NO"))
+                ? 1
+                : 0;
+        if (m_nPooledHandleState == 0)
+            return -1;
+    }
+
+    if (!m_anPooledHandles.empty())
+    {
+        const int nPooledCdfid = m_anPooledHandles.back();
+        m_anPooledHandles.pop_back();
+        return nPooledCdfid;
+    }
+
+    int nNewCdfid = -1;
+    {
+        // Opening mutates global libnetcdf state: keep the global mutex
+        // for that part.
+        CPLMutexHolderD(&hNCMutex);
+        if (GDAL_nc_open(m_osFilenameForPooledHandles.c_str(), NC_NOWRITE,
+                         &nNewCdfid) != NC_NOERR)
+        {
+            m_nPooledHandleState = 0;
+            return -1;
+        }
+    }
+    return nNewCdfid;
+}
+
+/************************************************************************/
+/*                        ReleasePooledHandle()                         */
+/************************************************************************/
+
+void netCDFDataset::ReleasePooledHandle(int nPooledCdfid)
+{
+    std::lock_guard<std::mutex> oLock(m_oPooledHandleMutex);
+    m_anPooledHandles.push_back(nPooledCdfid);
+}
+
+/************************************************************************/
+/*                        ClosePooledHandles()                          */
+/************************************************************************/
+
+void netCDFDataset::ClosePooledHandles()
+{
+    std::lock_guard<std::mutex> oLock(m_oPooledHandleMutex);
+    if (!m_anPooledHandles.empty())
+    {
+        CPLMutexHolderD(&hNCMutex);
+        for (const int nPooledCdfid : m_anPooledHandles)
+            GDAL_nc_close(nPooledCdfid);
+        m_anPooledHandles.clear();
+    }
+    m_nPooledHandleState = 0;
+}
+
 /************************************************************************/
 
 CPLErr netCDFDataset::Close(GDALProgressFunc, void *)
 {
+    ClosePooledHandles();
     CPLErr eErr = CE_None;
     if (nOpenFlags != OPEN_FLAGS_CLOSED)
     {
@@ -8331,6 +8427,12 @@ GDALDataset *netCDFDataset::Open(GDALOpenInfo *poOpenInfo)
     CPLDebug("GDAL_netCDF", "got cdfid=%d", cdfid);
 #endif
 
+    // Remember how to re-open the file for the optional pooled read
+    // handles (plain files only: /vsi files go through in-memory or
+    // userfaultfd mappings that cannot simply be re-opened by name).
+    if (!STARTS_WITH(osFilenameForNCOpen.c_str(), "/vsi"))
+        poDS->m_osFilenameForPooledHandles = osFilenameForNCOpen;
+
 #if defined(ENABLE_NCDUMP) && !defined(_WIN32)
     // Try to destroy the temporary file right now on Unix
     if (poDS->bFileToDestroyAtClosing)
@@ -21,6 +21,7 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <mutex>
 #include <vector>
 
 #include "cpl_mem_cache.h"
@@ -352,6 +353,9 @@ class netCDFDataset final : public GDALPamDataset
     bool bFileToDestroyAtClosing;
 #endif
     int cdfid;
+    std::mutex m_oPooledHandleMutex{};
+    std::vector<int> m_anPooledHandles{};
+    int m_nPooledHandleState = -1;  // -1: uninit, 0: disabled, 1: enabled
 #ifdef ENABLE_UFFD
     cpl_uffd_context *pCtx = nullptr;
 #endif
@@ -552,6 +556,17 @@ class netCDFDataset final : public GDALPamDataset
 
     CPLErr Close(GDALProgressFunc = nullptr, void * = nullptr) override;
 
+    //! @cond Doxygen_Suppress
+    // Optional pool of additional read-only netCDF handles on the same
+    // file, for GDAL_NETCDF_PER_THREAD_HANDLES=YES (requires a thread-safe
+    // libnetcdf/HDF5 stack). Returns -1 when pooling is not available.
+    int AcquirePooledHandle();
+    void ReleasePooledHandle(int nPooledCdfid);
+    void ClosePooledHandles();
+
+    std::string m_osFilenameForPooledHandles{};
+    //! @endcond
+
   public:
     netCDFDataset();
     ~netCDFDataset() override;
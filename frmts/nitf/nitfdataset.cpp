@@ -34,6 +34,7 @@
 #include "cpl_csv.h"
 #include "cpl_error.h"
 #include "cpl_minixml.h"
+#include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
@@ -592,6 +593,31 @@ NITFDataset *NITFDataset::OpenInternal(GDALOpenInfo *poOpenInfo,
             // to be opened by a random driver.
             static const char *const apszDrivers[] = {
                 "JP2KAK", "JP2ECW", "JP2MRSID", "JP2OPENJPEG", nullptr};
+
+            // Forward the requested decode thread count to the JPEG2000
+            // driver: JP2OPENJPEG sizes its internal thread pool from
+            // GDAL_NUM_THREADS and JP2KAK from JP2KAK_THREADS, both
+            // evaluated when the codestream is opened.
+            const char *pszNumThreads = CSLFetchNameValueDef(
+                poOpenInfo->papszOpenOptions, "NUM_THREADS",
+                CPLGetConfigOption("NITF_J2K_NUM_THREADS", nullptr));
+            std::unique_ptr<CPLConfigOptionSetter> poGDALNumThreadsSetter;
+            std::unique_ptr<CPLConfigOptionSetter> poKakaduNumThreadsSetter;
+            if (pszNumThreads != nullptr)
+            {
+                std::string osNumThreads(pszNumThreads);
+                if (EQUAL(pszNumThreads, "ALL_CPUS"))
+                    osNumThreads = CPLSPrintf("%d", CPLGetNumCPUs());
+                poGDALNumThreadsSetter =
+                    std::make_unique<CPLConfigOptionSetter>(
+                        "GDAL_NUM_THREADS", osNumThreads.c_str(),
+                        /* bSetOnlyIfUndefined = */ false);
+                poKakaduNumThreadsSetter =
+                    std::make_unique<CPLConfigOptionSetter>(
+                        "JP2KAK_THREADS", osNumThreads.c_str(),
+                        /* bSetOnlyIfUndefined = */ false);
+            }
+
             poDS->poJ2KDataset.reset(GDALDataset::Open(
                 osDSName, GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR, apszDrivers,
                 nullptr, nullptr));
@@ -100,6 +100,9 @@ void NITFDriverSetCommonMetadata(GDALDriver *poDriver)
         "  <Option name='FAIL_IF_VALIDATION_ERROR' type='boolean' "
         "description='Whether a validation error should cause dataset opening "
         "to fail' default='NO' />"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "threads the JPEG2000 driver should use to decode a C8 compressed "
+        "image segment, or ALL_CPUS' />"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
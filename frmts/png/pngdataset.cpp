@@ -27,6 +27,9 @@
 #include "pngdrivercore.h"
 
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <zlib.h>
 #include "cpl_vsi_virtual.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
@@ -2284,6 +2287,340 @@ static bool safe_png_write_end(jmp_buf sSetJmpContext, png_structp png_ptr,
 /*                             CreateCopy()                             */
 /************************************************************************/
 
+/************************************************************************/
+/*                      PNGCreateCopyParallel()                         */
+/************************************************************************/
+
+/** pigz-style parallel PNG encoder: rows are filtered and
+ * deflate-compressed in independent bands of rows on a worker thread
+ * pool; each band ends on a byte boundary (Z_SYNC_FLUSH) so the
+ * concatenation of the parts forms one valid zlib stream (adler32
+ * checksums combined), emitted as one IDAT chunk per band.
+ *
+ * Only handles the plain case (8-bit, no color table, no interlacing,
+ * no ancillary chunks) and returns false when it does not apply or
+ * fails, in which case the caller runs the regular libpng path.
+ */
+static bool PNGCreateCopyParallel(GDALDataset *poSrcDS,
+                                  const char *pszFilename, int nZLevel,
+                                  GDALProgressFunc pfnProgress,
+                                  void *pProgressData)
+{
+    const int nBands = poSrcDS->GetRasterCount();
+    const int nXSize = poSrcDS->GetRasterXSize();
+    const int nYSize = poSrcDS->GetRasterYSize();
+
+    if (poSrcDS->GetRasterBand(1)->GetRasterDataType() != GDT_UInt8 ||
+        poSrcDS->GetRasterBand(1)->GetColorTable() != nullptr)
+        return false;
+    const int nCPUs = CPLGetNumCPUs();
+    if (nCPUs < 2 || nYSize < 128)
+        return false;
+    const GIntBig nRawSize =
+        static_cast<GIntBig>(nXSize) * nYSize * nBands;
+    if (nRawSize > 512 * 1024 * 1024)
+        return false;
+
+    /* ---------------- read the whole image, pixel interleaved -------- */
+    std::vector<GByte> abyRaw;
+    try
+    {
+        abyRaw.resize(static_cast<size_t>(nRawSize));
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    if (poSrcDS->RasterIO(GF_Read, 0, 0, nXSize, nYSize, abyRaw.data(),
+                          nXSize, nYSize, GDT_UInt8, nBands, nullptr, nBands,
+                          static_cast<GSpacing>(nXSize) * nBands, 1,
+                          nullptr) != CE_None)
+        return false;
+
+    const int nThreads = std::min(nCPUs, 1 + nYSize / 64);
+    CPLWorkerThreadPool oPool;
+    if (!oPool.Setup(nThreads, nullptr, nullptr))
+        return false;
+
+    const int nRowsPerJob = std::max(64, DIV_ROUND_UP(nYSize, 4 * nThreads));
+    const int nJobs = DIV_ROUND_UP(nYSize, nRowsPerJob);
+    const size_t nRowBytes = static_cast<size_t>(nXSize) * nBands;
+
+    struct CompressJob
+    {
+        const GByte *pabyRaw = nullptr;
+        int nXSize = 0;
+        int nBands = 0;
+        int nFirstRow = 0;
+        int nRowCount = 0;
+        int nZLevel = 0;
+        bool bLast = false;
+        bool bOK = false;
+        uLong nAdler = 0;
+        size_t nFilteredSize = 0;
+        std::vector<GByte> abyOut{};
+    };
+
+    const auto CompressFunc = [](void *pData)
+    {
+        CompressJob *psJob = static_cast<CompressJob *>(pData);
+        const size_t nRowBytesJob =
+            static_cast<size_t>(psJob->nXSize) * psJob->nBands;
+        const int nPixOff = psJob->nBands;
+
+        // Filter the rows with the classical minimum-sum-of-absolute
+        // differences heuristic over the 5 PNG filters.
+        std::vector<GByte> abyFiltered;
+        std::vector<GByte> abyCandidate;
+        try
+        {
+            abyFiltered.resize((nRowBytesJob + 1) * psJob->nRowCount);
+            abyCandidate.resize(nRowBytesJob);
+        }
+        catch (const std::exception &)
+        {
+            return;
+        }
+        for (int iRow = 0; iRow < psJob->nRowCount; ++iRow)
+        {
+            const GByte *pabyCur =
+                psJob->pabyRaw +
+                static_cast<size_t>(psJob->nFirstRow + iRow) * nRowBytesJob;
+            // Note: the previous row of the first row of the job belongs
+            // to the previous job, but is read-only shared data.
+            const GByte *pabyPrev =
+                psJob->nFirstRow + iRow == 0
+                    ? nullptr
+                    : pabyCur - nRowBytesJob;
+            GByte *pabyDstRow =
+                abyFiltered.data() + static_cast<size_t>(iRow) *
+                                         (nRowBytesJob + 1);
+
+            GByte nBestFilter = 0;
+            uint64_t nBestSum = 0;
+            for (size_t i = 0; i < nRowBytesJob; ++i)
+            {
+                const GByte v = pabyCur[i];
+                nBestSum += v < 128 ? v : 256 - v;
+            }
+            const auto EvalFilter = [&](GByte nFilter)
+            {
+                uint64_t nSum = 0;
+                for (size_t i = 0; i < nRowBytesJob && nSum < nBestSum; ++i)
+                {
+                    const int a =
+                        i >= static_cast<size_t>(nPixOff)
+                            ? pabyCur[i - nPixOff]
+                            : 0;
+                    const int b = pabyPrev ? pabyPrev[i] : 0;
+                    int nPred;
+                    if (nFilter == 1)
+                        nPred = a;
+                    else if (nFilter == 2)
+                        nPred = b;
+                    else if (nFilter == 3)
+                        nPred = (a + b) / 2;
+                    else
+                    {
+                        const int c =
+                            (pabyPrev &&
+                             i >= static_cast<size_t>(nPixOff))
+                                ? pabyPrev[i - nPixOff]
+                                : 0;
+                        const int p = a + b - c;
+                        const int pa = std::abs(p - a);
+                        const int pb = std::abs(p - b);
+                        const int pc = std::abs(p - c);
+                        nPred = (pa <= pb && pa <= pc) ? a
+                                : (pb <= pc)           ? b
+                                                       : c;
+                    }
+                    const GByte v =
+                        static_cast<GByte>(pabyCur[i] - nPred);
+                    abyCandidate[i] = v;
+                    nSum += v < 128 ? v : 256 - v;
+                }
+                if (nSum < nBestSum)
+                {
+                    nBestSum = nSum;
+                    nBestFilter = nFilter;
+                    memcpy(pabyDstRow + 1, abyCandidate.data(), nRowBytesJob);
+                }
+            };
+            EvalFilter(1);
+            EvalFilter(2);
+            EvalFilter(3);
+            EvalFilter(4);
+            pabyDstRow[0] = nBestFilter;
+            if (nBestFilter == 0)
+                memcpy(pabyDstRow + 1, pabyCur, nRowBytesJob);
+        }
+
+        psJob->nFilteredSize = abyFiltered.size();
+        psJob->nAdler =
+            adler32(adler32(0L, Z_NULL, 0), abyFiltered.data(),
+                    static_cast<uInt>(abyFiltered.size()));
+
+        // Raw deflate of the filtered band, sync-flushed (or finished for
+        // the last band) so that parts concatenate into one valid stream.
+        z_stream sStream;
+        memset(&sStream, 0, sizeof(sStream));
+        if (deflateInit2(&sStream, psJob->nZLevel, Z_DEFLATED,
+                         -15 /* raw */, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            return;
+        const uLong nBound =
+            deflateBound(&sStream, static_cast<uLong>(abyFiltered.size())) +
+            16;
+        try
+        {
+            psJob->abyOut.resize(nBound);
+        }
+        catch (const std::exception &)
+        {
+            deflateEnd(&sStream);
+            return;
+        }
+        sStream.next_in = abyFiltered.data();
+        sStream.avail_in = static_cast<uInt>(abyFiltered.size());
+        sStream.next_out = psJob->abyOut.data();
+        sStream.avail_out = static_cast<uInt>(psJob->abyOut.size());
+        const int nRet =
+            deflate(&sStream, psJob->bLast ? Z_FINISH : Z_SYNC_FLUSH);
+        const bool bOK = psJob->bLast ? nRet == Z_STREAM_END
+                                      : (nRet == Z_OK && sStream.avail_in == 0);
+        psJob->abyOut.resize(psJob->abyOut.size() - sStream.avail_out);
+        deflateEnd(&sStream);
+        psJob->bOK = bOK;
+    };
+
+    std::vector<CompressJob> asJobs(nJobs);
+    std::vector<void *> apJobs;
+    for (int i = 0; i < nJobs; ++i)
+    {
+        asJobs[i].pabyRaw = abyRaw.data();
+        asJobs[i].nXSize = nXSize;
+        asJobs[i].nBands = nBands;
+        asJobs[i].nFirstRow = i * nRowsPerJob;
+        asJobs[i].nRowCount =
+            std::min(nRowsPerJob, nYSize - i * nRowsPerJob);
+        asJobs[i].nZLevel = nZLevel;
+        asJobs[i].bLast = (i == nJobs - 1);
+        apJobs.push_back(&asJobs[i]);
+    }
+    oPool.SubmitJobs(CompressFunc, apJobs);
+    oPool.WaitCompletion();
+
+    uLong nAdlerAll = adler32(0L, Z_NULL, 0);
+    for (const auto &sJob : asJobs)
+    {
+        if (!sJob.bOK)
+            return false;
+        nAdlerAll = adler32_combine(nAdlerAll, sJob.nAdler,
+                                    static_cast<z_off_t>(sJob.nFilteredSize));
+    }
+
+    /* ---------------- emit the PNG file ------------------------------ */
+    VSILFILE *fp = VSIFOpenL(pszFilename, "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_OpenFailed, "Unable to create png file %s.",
+                 pszFilename);
+        return false;
+    }
+
+    bool bOK = true;
+    const auto WriteChunk =
+        [fp, &bOK](const char *pszType, const GByte *pabyData, size_t nLen)
+    {
+        GUInt32 nLenBE = static_cast<GUInt32>(nLen);
+        CPL_MSBPTR32(&nLenBE);
+        bOK = bOK && VSIFWriteL(&nLenBE, 4, 1, fp) == 1;
+        uLong nCRC = crc32(0L, reinterpret_cast<const Bytef *>(pszType), 4);
+        bOK = bOK && VSIFWriteL(pszType, 4, 1, fp) == 1;
+        if (nLen)
+        {
+            nCRC = crc32(nCRC, pabyData, static_cast<uInt>(nLen));
+            bOK = bOK && VSIFWriteL(pabyData, nLen, 1, fp) == 1;
+        }
+        GUInt32 nCRCBE = static_cast<GUInt32>(nCRC);
+        CPL_MSBPTR32(&nCRCBE);
+        bOK = bOK && VSIFWriteL(&nCRCBE, 4, 1, fp) == 1;
+    };
+
+    const GByte abySignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A,
+                                   '\n'};
+    bOK = VSIFWriteL(abySignature, 8, 1, fp) == 1;
+
+    GByte abyIHDR[13];
+    GUInt32 nVal = nXSize;
+    CPL_MSBPTR32(&nVal);
+    memcpy(abyIHDR, &nVal, 4);
+    nVal = nYSize;
+    CPL_MSBPTR32(&nVal);
+    memcpy(abyIHDR + 4, &nVal, 4);
+    abyIHDR[8] = 8;  // bit depth
+    abyIHDR[9] = nBands == 1   ? 0
+                 : nBands == 2 ? 4
+                 : nBands == 3 ? 2
+                               : 6;  // color type
+    abyIHDR[10] = 0;                 // compression
+    abyIHDR[11] = 0;                 // filter
+    abyIHDR[12] = 0;                 // no interlacing
+    WriteChunk("IHDR", abyIHDR, 13);
+
+    for (int i = 0; i < nJobs && bOK; ++i)
+    {
+        if (i == 0)
+        {
+            // zlib header (32K window, default compression) ahead of the
+            // first raw deflate part
+            std::vector<GByte> abyFirst;
+            abyFirst.reserve(2 + asJobs[0].abyOut.size());
+            abyFirst.push_back(0x78);
+            abyFirst.push_back(0x9C);
+            abyFirst.insert(abyFirst.end(), asJobs[0].abyOut.begin(),
+                            asJobs[0].abyOut.end());
+            if (nJobs == 1)
+            {
+                GUInt32 nAdlerBE = static_cast<GUInt32>(nAdlerAll);
+                CPL_MSBPTR32(&nAdlerBE);
+                const GByte *pabyAdler =
+                    reinterpret_cast<const GByte *>(&nAdlerBE);
+                abyFirst.insert(abyFirst.end(), pabyAdler, pabyAdler + 4);
+            }
+            WriteChunk("IDAT", abyFirst.data(), abyFirst.size());
+        }
+        else if (i == nJobs - 1)
+        {
+            std::vector<GByte> abyLast(asJobs[i].abyOut);
+            GUInt32 nAdlerBE = static_cast<GUInt32>(nAdlerAll);
+            CPL_MSBPTR32(&nAdlerBE);
+            const GByte *pabyAdler =
+                reinterpret_cast<const GByte *>(&nAdlerBE);
+            abyLast.insert(abyLast.end(), pabyAdler, pabyAdler + 4);
+            WriteChunk("IDAT", abyLast.data(), abyLast.size());
+        }
+        else
+        {
+            WriteChunk("IDAT", asJobs[i].abyOut.data(),
+                       asJobs[i].abyOut.size());
+        }
+        if (pfnProgress &&
+            !pfnProgress((i + 1) / static_cast<double>(nJobs), nullptr,
+                         pProgressData))
+        {
+            bOK = false;
+        }
+    }
+
+    WriteChunk("IEND", nullptr, 0);
+    if (VSIFCloseL(fp) != 0)
+        bOK = false;
+    if (!bOK)
+        VSIUnlink(pszFilename);
+    return bOK;
+}
+
 GDALDataset *PNGDataset::CreateCopy(const char *pszFilename,
                                     GDALDataset *poSrcDS, int bStrict,
                                     CSLConstList papszOptions,
@@ -2318,6 +2655,71 @@ GDALDataset *PNGDataset::CreateCopy(const char *pszFilename,
             return nullptr;
     }
 
+    // Optional pigz-style parallel encoder for the plain 8-bit case.
+    if (CPLTestBool(CSLFetchNameValueDef(
+            papszOptions, "PARALLEL_WRITE",
+            CPLGetConfigOption("PNG_PARALLEL_WRITE", "NO"))) &&
+        poSrcDS->GetRasterBand(1)->GetRasterDataType() == GDT_UInt8 &&
+        CSLFetchNameValue(papszOptions, GDALMD_NBITS) == nullptr &&
+        CSLFetchNameValue(papszOptions, "SOURCE_ICC_PROFILE") == nullptr &&
+        CSLFetchNameValue(papszOptions, "SOURCE_ICC_PROFILE_NAME") ==
+            nullptr &&
+        !CPLFetchBool(papszOptions, "WRITE_METADATA_AS_TEXT", false) &&
+        !CPLTestBool(CSLFetchNameValueDef(
+            papszOptions, "@CREATE_ONLY_VISIBLE_AT_CLOSE_TIME", "NO")))
+    {
+        int bGotNoData = FALSE;
+        poSrcDS->GetRasterBand(1)->GetNoDataValue(&bGotNoData);
+        const char *pszZLevel = CSLFetchNameValue(papszOptions, "ZLEVEL");
+        const int nParallelZLevel =
+            pszZLevel ? atoi(pszZLevel) : Z_DEFAULT_COMPRESSION;
+        if (!bGotNoData &&
+            PNGCreateCopyParallel(poSrcDS, pszFilename, nParallelZLevel,
+                                  pfnProgress, pProgressData))
+        {
+            // Do we need a world file?
+            if (CPLFetchBool(papszOptions, "WORLDFILE", false))
+            {
+                GDALGeoTransform gt;
+                if (poSrcDS->GetGeoTransform(gt) == CE_None)
+                    GDALWriteWorldFile(pszFilename, "wld", gt.data());
+            }
+            // Re-open dataset and copy any auxiliary PAM information, with
+            // the same behavior as the regular writer below, including the
+            // fake dataset returned when re-opening is not possible.
+            if (CPLTestBool(CPLGetConfigOption("GDAL_OPEN_AFTER_COPY", "YES")))
+            {
+                CPLPushErrorHandler(CPLQuietErrorHandler);
+                GDALOpenInfo oOpenInfo(pszFilename, GA_ReadOnly);
+                PNGDataset *poDS =
+                    cpl::down_cast<PNGDataset *>(PNGDataset::Open(&oOpenInfo));
+                CPLPopErrorHandler();
+                if (poDS)
+                {
+                    poDS->CloneInfo(poSrcDS, GCIF_PAM_DEFAULT & ~GCIF_METADATA);
+
+                    char **papszExcludedDomains =
+                        CSLAddString(nullptr, "COLOR_PROFILE");
+                    GDALDriver::DefaultCopyMetadata(
+                        poSrcDS, poDS, papszOptions, papszExcludedDomains);
+                    CSLDestroy(papszExcludedDomains);
+
+                    return poDS;
+                }
+                CPLErrorReset();
+            }
+
+            PNGDataset *poFakeDS = new PNGDataset();
+            poFakeDS->nRasterXSize = poSrcDS->GetRasterXSize();
+            poFakeDS->nRasterYSize = poSrcDS->GetRasterYSize();
+            poFakeDS->nBitDepth = 8;
+            for (int i = 0; i < poSrcDS->GetRasterCount(); i++)
+                poFakeDS->SetBand(i + 1, new PNGRasterBand(poFakeDS, i + 1));
+            return poFakeDS;
+        }
+        // On failure, fall through to the regular libpng writer.
+    }
+
     // Create the dataset.
     auto fpImage(
         CPLTestBool(CSLFetchNameValueDef(
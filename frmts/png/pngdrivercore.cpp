@@ -79,6 +79,9 @@ void PNGDriverSetCommonMetadata(GDALDriver *poDriver)
         "default='FALSE'/>\n"
         "   <Option name='NBITS' type='int' description='Force output bit "
         "depth: 1, 2 or 4'/>\n"
+        "   <Option name='PARALLEL_WRITE' type='boolean' description='Whether "
+        "to compress rows in parallel on multiple threads, for 8-bit images "
+        "without special options' default='FALSE'/>\n"
         "</CreationOptionList>\n");
 
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
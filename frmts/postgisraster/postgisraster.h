@@ -341,6 +341,11 @@ class PostGISRasterRasterBand final : public VRTSourcedRasterBand
     void NullBuffer(void *pData, int nBufXSize, int nBufYSize,
                     GDALDataType eBufType, int nPixelSpace, int nLineSpace);
 
+    bool TryServerSideMosaic(int nXOff, int nYOff, int nXSize, int nYSize,
+                             void *pData, int nBufXSize, int nBufYSize,
+                             GDALDataType eBufType, GSpacing nPixelSpace,
+                             GSpacing nLineSpace);
+
   public:
     PostGISRasterRasterBand(PostGISRasterDataset *poDSIn, int nBandIn,
                             GDALDataType eDataTypeIn, GBool bNoDataValueSetIn,
@@ -110,6 +110,206 @@ static int SortTilesByPKID(const void *a, const void *b)
     return strcmp(pa->GetPKID(), pb->GetPKID());
 }
 
+/********************************************************
+ * \brief TryServerSideMosaic
+ *
+ * Satisfy a downsampled read with a single server-side query, letting
+ * PostGIS mosaic, clip and resample the intersecting tiles with
+ * ST_Union/ST_Clip/ST_Resize, instead of fetching every native
+ * resolution tile. The result is only used when it exactly matches the
+ * requested buffer size and window georeference; on any mismatch or
+ * error false is returned and the caller falls back to the tile-based
+ * code path.
+ ********************************************************/
+bool PostGISRasterRasterBand::TryServerSideMosaic(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData, int nBufXSize,
+    int nBufYSize, GDALDataType eBufType, GSpacing nPixelSpace,
+    GSpacing nLineSpace)
+{
+    PostGISRasterDataset *poRDS = cpl::down_cast<PostGISRasterDataset *>(poDS);
+
+    // Only handle data types with a direct PostGIS pixel type equivalent.
+    int nExpectedPixelTypeCode = -1;
+    switch (eDataType)
+    {
+        case GDT_UInt8:
+            nExpectedPixelTypeCode = 4; /* 8BUI */
+            break;
+        case GDT_Int8:
+            nExpectedPixelTypeCode = 3; /* 8BSI */
+            break;
+        case GDT_UInt16:
+            nExpectedPixelTypeCode = 6; /* 16BUI */
+            break;
+        case GDT_Int16:
+            nExpectedPixelTypeCode = 5; /* 16BSI */
+            break;
+        case GDT_UInt32:
+            nExpectedPixelTypeCode = 8; /* 32BUI */
+            break;
+        case GDT_Int32:
+            nExpectedPixelTypeCode = 7; /* 32BSI */
+            break;
+        case GDT_Float32:
+            nExpectedPixelTypeCode = 10; /* 32BF */
+            break;
+        case GDT_Float64:
+            nExpectedPixelTypeCode = 11; /* 64BF */
+            break;
+        default:
+            break;
+    }
+    if (nExpectedPixelTypeCode < 0)
+        return false;
+
+    double adfProjWin[8];
+    poRDS->PolygonFromCoords(nXOff, nYOff, nXOff + nXSize, nYOff + nYSize,
+                             adfProjWin);
+
+    CPLString osPolygon;
+    osPolygon.Printf("ST_GeomFromText('POLYGON((%.18f %.18f,%.18f %.18f,"
+                     "%.18f %.18f,%.18f %.18f,%.18f %.18f))',%d)",
+                     adfProjWin[0], adfProjWin[1], adfProjWin[2], adfProjWin[3],
+                     adfProjWin[4], adfProjWin[5], adfProjWin[6], adfProjWin[7],
+                     adfProjWin[0], adfProjWin[1], poRDS->nSrid);
+
+    CPLString osSchemaI(CPLQuotedSQLIdentifier(pszSchema));
+    CPLString osTableI(CPLQuotedSQLIdentifier(pszTable));
+    CPLString osColumnI(CPLQuotedSQLIdentifier(pszColumn));
+
+    CPLString osCommand;
+    osCommand.Printf("SELECT encode(ST_AsBinary(ST_Resize(ST_Clip("
+                     "ST_Union(ST_Band(%s,%d)),%s),%d,%d),TRUE),'hex') "
+                     "FROM %s.%s WHERE %s && %s",
+                     osColumnI.c_str(), nBand, osPolygon.c_str(), nBufXSize,
+                     nBufYSize, osSchemaI.c_str(), osTableI.c_str(),
+                     osColumnI.c_str(), osPolygon.c_str());
+    if (poRDS->pszWhere != nullptr)
+        osCommand += CPLSPrintf(" AND (%s)", poRDS->pszWhere);
+
+    PGresult *poResult = PQexec(poRDS->poConn, osCommand.c_str());
+
+#ifdef DEBUG_QUERY
+    CPLDebug("PostGIS_Raster",
+             "PostGISRasterRasterBand::TryServerSideMosaic(): "
+             "Query = \"%s\" --> number of rows = %d",
+             osCommand.c_str(), poResult ? PQntuples(poResult) : 0);
+#endif
+
+    if (poResult == nullptr || PQresultStatus(poResult) != PGRES_TUPLES_OK ||
+        PQntuples(poResult) != 1)
+    {
+        if (poResult)
+            PQclear(poResult);
+        CPLDebug("PostGIS_Raster", "Server-side mosaic query failed: %s. "
+                                   "Falling back to tile based reading",
+                 PQerrorMessage(poRDS->poConn));
+        return false;
+    }
+
+    if (PQgetisnull(poResult, 0, 0))
+    {
+        // No tile intersects the window.
+        PQclear(poResult);
+        NullBuffer(pData, nBufXSize, nBufYSize, eBufType,
+                   static_cast<int>(nPixelSpace),
+                   static_cast<int>(nLineSpace));
+        return true;
+    }
+
+    int nWKBLength = 0;
+    GByte *pbyData = CPLHexToBinary(PQgetvalue(poResult, 0, 0), &nWKBLength);
+    PQclear(poResult);
+    if (pbyData == nullptr)
+        return false;
+
+    bool bOK = false;
+    const int nPixelSize = GDALGetDataTypeSizeBytes(eDataType);
+    const int nExpectedWKBLength =
+        RASTER_HEADER_SIZE +
+        BAND_SIZE(nPixelSize, nPixelSize * nBufXSize * nBufYSize);
+    if (nWKBLength == nExpectedWKBLength)
+    {
+        const bool bIsLittleEndian = (pbyData[0] == 1);
+#ifdef CPL_LSB
+        const bool bSwap = !bIsLittleEndian;
+#else
+        const bool bSwap = bIsLittleEndian;
+#endif
+        const auto ReadUInt16 = [pbyData, bSwap](int nOffset)
+        {
+            GUInt16 nVal = 0;
+            memcpy(&nVal, pbyData + nOffset, sizeof(nVal));
+            if (bSwap)
+                CPL_SWAP16PTR(&nVal);
+            return static_cast<int>(nVal);
+        };
+        const auto ReadDouble = [pbyData, bSwap](int nOffset)
+        {
+            double dfVal = 0;
+            memcpy(&dfVal, pbyData + nOffset, sizeof(dfVal));
+            if (bSwap)
+                CPL_SWAP64PTR(&dfVal);
+            return dfVal;
+        };
+
+        const int nBandsWKB = ReadUInt16(3);
+        const double dfScaleX = ReadDouble(5);
+        const double dfScaleY = ReadDouble(13);
+        const double dfIpX = ReadDouble(21);
+        const double dfIpY = ReadDouble(29);
+        const int nWidth = ReadUInt16(57);
+        const int nHeight = ReadUInt16(59);
+        const GByte nBandFlags = pbyData[RASTER_HEADER_SIZE];
+
+        // The server result is only usable if it exactly covers the
+        // requested window: ST_Clip() shrinks the extent when the union
+        // of tiles does not fully cover it, in which case resampling it
+        // to the buffer size would stretch the wrong region.
+        const double dfExpectedScaleX =
+            poRDS->m_gt.xscale * nXSize / nBufXSize;
+        const double dfExpectedScaleY =
+            poRDS->m_gt.yscale * nYSize / nBufYSize;
+        const double dfPixelEps = fabs(poRDS->m_gt.xscale) * 1e-3;
+        if (nBandsWKB == 1 && nWidth == nBufXSize && nHeight == nBufYSize &&
+            (nBandFlags & 0x80) == 0 &&
+            (nBandFlags & 0x0F) == nExpectedPixelTypeCode &&
+            fabs(dfIpX - adfProjWin[0]) <= dfPixelEps &&
+            fabs(dfIpY - adfProjWin[1]) <= dfPixelEps &&
+            fabs(dfScaleX - dfExpectedScaleX) <=
+                1e-6 * fabs(dfExpectedScaleX) &&
+            fabs(dfScaleY - dfExpectedScaleY) <= 1e-6 * fabs(dfExpectedScaleY))
+        {
+            GByte *pbyPixels =
+                pbyData + RASTER_HEADER_SIZE + 1 + nPixelSize /* nodata */;
+            if (bSwap && nPixelSize > 1)
+            {
+                GDALSwapWords(pbyPixels, nPixelSize,
+                              nBufXSize * nBufYSize, nPixelSize);
+            }
+            for (int iY = 0; iY < nBufYSize; iY++)
+            {
+                GDALCopyWords64(pbyPixels + static_cast<size_t>(iY) *
+                                                nBufXSize * nPixelSize,
+                                eDataType, nPixelSize,
+                                static_cast<GByte *>(pData) + iY * nLineSpace,
+                                eBufType, static_cast<int>(nPixelSpace),
+                                nBufXSize);
+            }
+            bOK = true;
+        }
+    }
+
+    if (!bOK)
+    {
+        CPLDebug("PostGIS_Raster",
+                 "Server-side mosaic result does not match the requested "
+                 "window. Falling back to tile based reading");
+    }
+    CPLFree(pbyData);
+    return bOK;
+}
+
 /**
  * Read/write a region of image data for this band.
  *
@@ -197,6 +397,20 @@ CPLErr PostGISRasterRasterBand::IRasterIO(
 
     PostGISRasterDataset *poRDS = cpl::down_cast<PostGISRasterDataset *>(poDS);
 
+    /*******************************************************************
+     * Optional server-side mosaic: for downsampled requests, let
+     * PostGIS assemble and resample the intersecting tiles with
+     * ST_Union/ST_Clip/ST_Resize in a single query, instead of
+     * transferring every native resolution tile.
+     ******************************************************************/
+    if (nBufXSize < nXSize && nBufYSize < nYSize &&
+        CPLTestBool(CPLGetConfigOption("PR_SERVER_SIDE_MOSAIC", "FALSE")))
+    {
+        if (TryServerSideMosaic(nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                                nBufYSize, eBufType, nPixelSpace, nLineSpace))
+            return CE_None;
+    }
+
     int bSameWindowAsOtherBand =
         (nXOff == poRDS->nXOffPrev && nYOff == poRDS->nYOffPrev &&
          nXSize == poRDS->nXSizePrev && nYSize == poRDS->nYSizePrev);
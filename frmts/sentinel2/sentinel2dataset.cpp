@@ -137,6 +137,36 @@ static const char *SENTINEL2GetOption(GDALOpenInfo *poOpenInfo,
 static bool SENTINEL2GetTileInfo(const char *pszFilename, int *pnWidth,
                                  int *pnHeight, int *pnBits);
 
+/************************************************************************/
+/*                        SENTINEL2TileExists()                         */
+/************************************************************************/
+
+// Cache of directory listings, to batch tile existence checks into one
+// VSIReadDir() per directory instead of one VSIStatExL() per tile, which
+// is costly on /vsizip//vsis3/ and similar file systems.
+typedef std::map<std::string, CPLStringList> SENTINEL2DirCache;
+
+static bool SENTINEL2TileExists(const CPLString &osTile,
+                                SENTINEL2DirCache &oDirCache)
+{
+    const std::string osDir = CPLGetPathSafe(osTile.c_str());
+    auto oIter = oDirCache.find(osDir);
+    if (oIter == oDirCache.end())
+    {
+        oIter = oDirCache
+                    .insert(std::pair<std::string, CPLStringList>(
+                        osDir, CPLStringList(VSIReadDir(osDir.c_str()))))
+                    .first;
+    }
+    const CPLStringList &aosList = oIter->second;
+    if (!aosList.empty())
+        return aosList.FindString(CPLGetFilename(osTile.c_str())) >= 0;
+
+    // Directory listing unavailable: fall back to a direct probe.
+    VSIStatBufL sStat;
+    return VSIStatExL(osTile.c_str(), &sStat, VSI_STAT_EXISTS_FLAG) == 0;
+}
+
 /************************************************************************/
 /*                            IsS2Prefixed()                            */
 /************************************************************************/
@@ -1871,6 +1901,7 @@ static void SENTINEL2GetResolutionSetAndMainMDFromGranule(
     {
         // If no main MTD file found, then probe all bands for resolution (of
         // interest if there's one, or all resolutions otherwise)
+        SENTINEL2DirCache oDirCache;
         for (const auto &sBandDesc : asBandDesc)
         {
             if (nResolutionOfInterest != 0 &&
@@ -1886,8 +1917,7 @@ static void SENTINEL2GetResolutionSetAndMainMDFromGranule(
             CPLString osTile(SENTINEL2GetTilename(
                 CPLGetPathSafe(pszFilename).c_str(),
                 CPLGetBasenameSafe(pszFilename).c_str(), osBandName));
-            VSIStatBufL sStat;
-            if (VSIStatExL(osTile, &sStat, VSI_STAT_EXISTS_FLAG) == 0)
+            if (SENTINEL2TileExists(osTile, oDirCache))
             {
                 oMapResolutionsToBands[sBandDesc.nResolution].insert(
                     std::move(osBandName));
@@ -2199,6 +2229,7 @@ GDALDataset *SENTINEL2Dataset::OpenL1BSubdataset(GDALOpenInfo *poOpenInfo)
     const int nAlphaBand = (!bAlpha) ? 0 : nBands;
     const GDALDataType eDT = GDT_UInt16;
 
+    SENTINEL2DirCache oDirCache;
     for (int nBand = 1; nBand <= nBands; nBand++)
     {
         VRTSourcedRasterBand *poBand = nullptr;
@@ -2250,8 +2281,7 @@ GDALDataset *SENTINEL2Dataset::OpenL1BSubdataset(GDALOpenInfo *poOpenInfo)
         }
         else
         {
-            VSIStatBufL sStat;
-            if (VSIStatExL(osTile, &sStat, VSI_STAT_EXISTS_FLAG) == 0)
+            if (SENTINEL2TileExists(osTile, oDirCache))
                 bTileFound = true;
         }
         if (!bTileFound)
@@ -2615,6 +2645,7 @@ SENTINEL2Dataset::OpenL1BSubdatasetWithGeoloc(GDALOpenInfo *poOpenInfo)
             .append("GRANULE");
     int nValMax = 0;
     int nBits = 0;
+    SENTINEL2DirCache oDirCache;
     for (int i = nIdxFirstExpectedGranule; i <= nIdxLastExpectedGranule; ++i)
     {
         const auto &sGranule = asGranules[i];
@@ -2655,8 +2686,7 @@ SENTINEL2Dataset::OpenL1BSubdatasetWithGeoloc(GDALOpenInfo *poOpenInfo)
         }
         else
         {
-            VSIStatBufL sStat;
-            if (VSIStatExL(osTile.c_str(), &sStat, VSI_STAT_EXISTS_FLAG) == 0)
+            if (SENTINEL2TileExists(osTile, oDirCache))
                 bTileFound = true;
         }
         if (!bTileFound)
@@ -4108,6 +4138,7 @@ SENTINEL2Dataset *SENTINEL2Dataset::CreateL1CL2ADataset(
     const int nAlphaBand = (bIsPreview || bIsTCI || !bAlpha) ? 0 : nBands;
     const GDALDataType eDT = (bIsPreview || bIsTCI) ? GDT_UInt8 : GDT_UInt16;
 
+    SENTINEL2DirCache oDirCache;
     for (int nBand = 1; nBand <= nBands; nBand++)
     {
         VRTSourcedRasterBand *poBand = nullptr;
@@ -4197,8 +4228,7 @@ SENTINEL2Dataset *SENTINEL2Dataset::CreateL1CL2ADataset(
             }
             else
             {
-                VSIStatBufL sStat;
-                if (VSIStatExL(osTile, &sStat, VSI_STAT_EXISTS_FLAG) == 0)
+                if (SENTINEL2TileExists(osTile, oDirCache))
                     bTileFound = true;
             }
             if (!bTileFound)
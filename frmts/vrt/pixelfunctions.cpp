@@ -1874,6 +1874,31 @@ static const char pszSqrtPixelFuncMetadata[] =
     "   <Argument type='builtin' value='NoData' optional='true'/>"
     "</PixelFunctionArgumentsList>";
 
+/************************************************************************/
+/*                        ApplyUnaryPacked()                            */
+/************************************************************************/
+
+/** Applies a unary function over a packed same-typed source/destination,
+ * with a straight per-line loop the compiler can vectorize, instead of
+ * the per-pixel type dispatch and GDALCopyWords() call of the generic
+ * paths. */
+template <class T, class Func>
+static void ApplyUnaryPacked(const void *pSrc, void *pDst, int nXSize,
+                             int nYSize, int nLineSpace, Func f)
+{
+    const T *CPL_RESTRICT pSrcT = static_cast<const T *>(pSrc);
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        T *CPL_RESTRICT pDstT = reinterpret_cast<T *>(
+            static_cast<GByte *>(pDst) +
+            static_cast<GSpacing>(nLineSpace) * iLine);
+        const T *CPL_RESTRICT pSrcLine =
+            pSrcT + static_cast<size_t>(iLine) * nXSize;
+        for (int i = 0; i < nXSize; ++i)
+            pDstT[i] = f(pSrcLine[i]);
+    }
+}
+
 static CPLErr SqrtPixelFunc(void **papoSources, int nSources, void *pData,
                             int nXSize, int nYSize, GDALDataType eSrcType,
                             GDALDataType eBufType, int nPixelSpace,
@@ -1890,6 +1915,26 @@ static CPLErr SqrtPixelFunc(void **papoSources, int nSources, void *pData,
     if (bHasNoData && FetchDoubleArg(papszArgs, "NoData", &dfNoData) != CE_None)
         return CE_Failure;
 
+    /* ---- Fast packed same-type paths (vectorized sqrtps/sqrtpd) ---- */
+    if (!bHasNoData && eSrcType == eBufType &&
+        nPixelSpace == GDALGetDataTypeSizeBytes(eBufType))
+    {
+        if (eSrcType == GDT_Float32)
+        {
+            ApplyUnaryPacked<float>(papoSources[0], pData, nXSize, nYSize,
+                                    nLineSpace,
+                                    [](float v) { return std::sqrt(v); });
+            return CE_None;
+        }
+        if (eSrcType == GDT_Float64)
+        {
+            ApplyUnaryPacked<double>(papoSources[0], pData, nXSize, nYSize,
+                                     nLineSpace,
+                                     [](double v) { return std::sqrt(v); });
+            return CE_None;
+        }
+    }
+
     /* ---- Set pixels ---- */
     size_t ii = 0;
     for (int iLine = 0; iLine < nYSize; ++iLine)
@@ -1970,6 +2015,27 @@ static CPLErr Log10PixelFuncHelper(void **papoSources, int nSources,
             }
         }
     }
+    else if (!bHasNoData && eSrcType == eBufType &&
+             nPixelSpace == GDALGetDataTypeSizeBytes(eBufType) &&
+             eSrcType == GDT_Float32)
+    {
+        // Compute in double like the generic path, for identical rounding.
+        ApplyUnaryPacked<float>(
+            papoSources[0], pData, nXSize, nYSize, nLineSpace,
+            [fact](float v)
+            {
+                return static_cast<float>(
+                    fact * std::log10(std::abs(static_cast<double>(v))));
+            });
+    }
+    else if (!bHasNoData && eSrcType == eBufType &&
+             nPixelSpace == GDALGetDataTypeSizeBytes(eBufType) &&
+             eSrcType == GDT_Float64)
+    {
+        ApplyUnaryPacked<double>(
+            papoSources[0], pData, nXSize, nYSize, nLineSpace,
+            [fact](double v) { return fact * std::log10(std::abs(v)); });
+    }
     else
     {
         /* ---- Set pixels ---- */
@@ -2988,7 +3054,22 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         pszDialect = "muparser";
     }
 
-    auto poExpression = gdal::MathExpression::Create(pszExpression, pszDialect);
+    // For the muparser dialect, first try the fast built-in bytecode
+    // engine, which covers the common arithmetic/comparison/conditional
+    // subset with identical semantics and falls back below when the
+    // expression does not compile with it.
+    std::unique_ptr<gdal::MathExpression> poExpression;
+    bool bTriedBuiltin = false;
+    if (EQUAL(pszDialect, "muparser") &&
+        CPLTestBool(CPLGetConfigOption("GDAL_VRT_EXPR_BUILTIN", "YES")))
+    {
+        poExpression = std::make_unique<gdal::BuiltinExpression>(pszExpression);
+        bTriedBuiltin = true;
+    }
+    if (!poExpression)
+    {
+        poExpression = gdal::MathExpression::Create(pszExpression, pszDialect);
+    }
 
     // cppcheck-suppress knownConditionTrueFalse
     if (!poExpression)
@@ -3056,6 +3137,36 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         poExpression->RegisterVector("BANDS", &adfValuesForPixel);
     }
 
+    if (bTriedBuiltin && poExpression->Compile() != CE_None)
+    {
+        // The built-in engine cannot handle this expression: switch to the
+        // requested interpreter and redo the registrations.
+        poExpression = gdal::MathExpression::Create(pszExpression, pszDialect);
+        if (!poExpression)
+            return CE_Failure;
+        {
+            int iSource = 0;
+            for (const auto &osName : aosSourceNames)
+            {
+                poExpression->RegisterVariable(osName,
+                                               &adfValuesForPixel[iSource++]);
+            }
+        }
+        if (includeCenterCoords)
+        {
+            poExpression->RegisterVariable("_CENTER_X_", &dfCenterX);
+            poExpression->RegisterVariable("_CENTER_Y_", &dfCenterY);
+        }
+        if (bHasNoData)
+        {
+            poExpression->RegisterVariable("NODATA", &dfNoData);
+        }
+        if (strstr(pszExpression, "BANDS"))
+        {
+            poExpression->RegisterVector("BANDS", &adfValuesForPixel);
+        }
+    }
+
     std::unique_ptr<double, VSIFreeReleaser> padfResults(
         static_cast<double *>(VSI_MALLOC2_VERBOSE(nXSize, sizeof(double))));
     if (!padfResults)
@@ -17,6 +17,7 @@
 #ifndef DOXYGEN_SKIP
 
 #include "cpl_hash_set.h"
+#include "cpl_quad_tree.h"
 #include "cpl_minixml.h"
 #include "gdal_driver.h"
 #include "gdal_multidim.h"
@@ -949,6 +950,18 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
     CPLStringList m_aosSourceList{};
     int m_nSkipBufferInitialization = -1;
 
+    // Persistent spatial index over the destination windows of simple
+    // sources, built lazily for bands with many sources so that RasterIO
+    // only visits the intersecting ones. Invalidated whenever the source
+    // list changes.
+    CPLQuadTree *m_hSourcesSpatialIndex = nullptr;
+    bool m_bSourcesSpatialIndexUnusable = false;
+
+    void InvalidateSourcesSpatialIndex();
+    bool GetSourceIndicesIntersecting(double dfXOff, double dfYOff,
+                                      double dfXSize, double dfYSize,
+                                      std::vector<int> &anIndices);
+
     bool CanUseSourcesMinMaxImplementations();
 
     bool IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(
@@ -14,6 +14,9 @@
 
 #include "cpl_error.h"
 
+#include <map>
+#include <memory>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -101,6 +104,76 @@ class MathExpression /* non final */
 
 /*! @cond Doxygen_Suppress */
 
+/**
+ * Fast built-in expression engine covering the common arithmetic /
+ * comparison / conditional subset of the muparser dialect, compiled to a
+ * compact stack bytecode evaluated without per-element virtual dispatch.
+ * Used opportunistically by the expression pixel function, with the
+ * regular interpreters as fallback.
+ */
+class BuiltinExpression final : public MathExpression
+{
+  public:
+    explicit BuiltinExpression(const char *pszExpression);
+    ~BuiltinExpression() override;
+
+    void RegisterVariable(std::string_view osVariable,
+                          double *pdfLocation) override;
+    void RegisterVector(std::string_view osVariable,
+                        std::vector<double> *padfLocation) override;
+    CPLErr Compile() override;
+    CPLErr Evaluate() override;
+    const std::vector<double> &Results() const override;
+
+  private:
+    struct Op
+    {
+        enum class Code
+        {
+            PUSH_CONST,
+            PUSH_VAR,
+            ADD,
+            SUB,
+            MUL,
+            DIV,
+            POW,
+            NEG,
+            LT,
+            GT,
+            LE,
+            GE,
+            EQ,
+            NE,
+            AND,
+            OR,
+            SELECT,  // cond ? a : b
+            SQRT,
+            ABS,
+            EXP,
+            FLOOR,
+            CEIL,
+            MIN,
+            MAX
+        };
+
+        Code eCode = Code::PUSH_CONST;
+        double dfConst = 0;
+        const double *pdfVar = nullptr;
+        // Only used during parsing, before variable resolution
+        std::string osVarName{};
+    };
+
+    std::string m_osExpression;
+    std::map<std::string, double *, std::less<>> m_oVariables{};
+    std::vector<Op> m_aoOps{};
+    std::vector<double> m_adfStack{};
+    std::vector<double> m_adfResults{};
+    bool m_bHasUnsupportedFeature = false;
+    int m_nCompiled = 0;  // 0: not tried, 1: ok, -1: failed
+
+    bool Parse();
+};
+
 #if GDAL_VRT_ENABLE_EXPRTK
 
 /**
@@ -0,0 +1,487 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Built-in bytecode engine for pixel math expressions
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vrtexpression.h"
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+namespace gdal
+{
+
+/************************************************************************/
+/*                         BuiltinExpression()                          */
+/************************************************************************/
+
+BuiltinExpression::BuiltinExpression(const char *pszExpression)
+    : m_osExpression(pszExpression)
+{
+    m_adfResults.resize(1);
+}
+
+BuiltinExpression::~BuiltinExpression() = default;
+
+/************************************************************************/
+/*                         RegisterVariable()                           */
+/************************************************************************/
+
+void BuiltinExpression::RegisterVariable(std::string_view osVariable,
+                                         double *pdfLocation)
+{
+    m_oVariables[std::string(osVariable)] = pdfLocation;
+}
+
+/************************************************************************/
+/*                          RegisterVector()                            */
+/************************************************************************/
+
+void BuiltinExpression::RegisterVector(std::string_view /*osVariable*/,
+                                       std::vector<double> * /*padfLocation*/)
+{
+    // Vector semantics (and vector-valued results) are left to the full
+    // interpreters.
+    m_bHasUnsupportedFeature = true;
+}
+
+/************************************************************************/
+/*                              Parse()                                 */
+/************************************************************************/
+
+/** Recursive descent parser emitting stack bytecode, for the grammar:
+ *
+ *   ternary := or ('?' ternary ':' ternary)?
+ *   or      := and ('||' and)*
+ *   and     := eq ('&&' eq)*
+ *   eq      := rel (('=='|'!=') rel)*
+ *   rel     := add (('<'|'>'|'<='|'>=') add)*
+ *   add     := mul (('+'|'-') mul)*
+ *   mul     := unary (('*'|'/') unary)*
+ *   unary   := '-' unary | power
+ *   power   := primary ('^' unary)?
+ *   primary := number | ident ('(' ternary (',' ternary)? ')')? |
+ *              '(' ternary ')'
+ *
+ * which matches muparser semantics (comparisons yield 1/0, '^' is the
+ * power operator binding tighter than unary minus).
+ */
+bool BuiltinExpression::Parse()
+{
+    const char *psz = m_osExpression.c_str();
+
+    const auto SkipSpace = [&psz]()
+    {
+        while (*psz == ' ' || *psz == '\t' || *psz == '\n' || *psz == '\r')
+            ++psz;
+    };
+
+    const auto Accept = [&psz, &SkipSpace](const char *pszTok)
+    {
+        SkipSpace();
+        const size_t nLen = strlen(pszTok);
+        if (strncmp(psz, pszTok, nLen) == 0)
+        {
+            // Do not let '<' match '<=' etc.
+            if ((pszTok[nLen - 1] == '<' || pszTok[nLen - 1] == '>' ||
+                 pszTok[nLen - 1] == '=' || pszTok[nLen - 1] == '!') &&
+                psz[nLen] == '=')
+                return false;
+            psz += nLen;
+            return true;
+        }
+        return false;
+    };
+
+    std::function<bool()> Ternary;
+
+    const auto Primary = [&]() -> bool
+    {
+        SkipSpace();
+        if (Accept("("))
+        {
+            if (!Ternary())
+                return false;
+            return Accept(")");
+        }
+        if ((*psz >= '0' && *psz <= '9') || *psz == '.')
+        {
+            char *pszEnd = nullptr;
+            Op sOp;
+            sOp.eCode = Op::Code::PUSH_CONST;
+            sOp.dfConst = CPLStrtod(psz, &pszEnd);
+            if (pszEnd == psz)
+                return false;
+            psz = pszEnd;
+            m_aoOps.push_back(std::move(sOp));
+            return true;
+        }
+        if (isalpha(static_cast<unsigned char>(*psz)) || *psz == '_')
+        {
+            const char *pszStart = psz;
+            while (isalnum(static_cast<unsigned char>(*psz)) || *psz == '_')
+                ++psz;
+            std::string osName(pszStart, psz - pszStart);
+            SkipSpace();
+            if (*psz == '(')
+            {
+                ++psz;
+                if (!Ternary())
+                    return false;
+                int nArgs = 1;
+                SkipSpace();
+                if (*psz == ',')
+                {
+                    ++psz;
+                    if (!Ternary())
+                        return false;
+                    nArgs = 2;
+                }
+                if (!Accept(")"))
+                    return false;
+                Op sOp;
+                if (nArgs == 1 && osName == "sqrt")
+                    sOp.eCode = Op::Code::SQRT;
+                else if (nArgs == 1 && osName == "abs")
+                    sOp.eCode = Op::Code::ABS;
+                else if (nArgs == 1 && osName == "exp")
+                    sOp.eCode = Op::Code::EXP;
+                else if (nArgs == 1 && osName == "floor")
+                    sOp.eCode = Op::Code::FLOOR;
+                else if (nArgs == 1 && osName == "ceil")
+                    sOp.eCode = Op::Code::CEIL;
+                else if (nArgs == 2 && osName == "min")
+                    sOp.eCode = Op::Code::MIN;
+                else if (nArgs == 2 && osName == "max")
+                    sOp.eCode = Op::Code::MAX;
+                else if (nArgs == 2 && osName == "pow")
+                    sOp.eCode = Op::Code::POW;
+                else
+                    return false;
+                m_aoOps.push_back(std::move(sOp));
+                return true;
+            }
+            Op sOp;
+            sOp.eCode = Op::Code::PUSH_VAR;
+            sOp.osVarName = std::move(osName);
+            m_aoOps.push_back(std::move(sOp));
+            return true;
+        }
+        return false;
+    };
+
+    std::function<bool()> Unary;
+
+    const auto Power = [&]() -> bool
+    {
+        if (!Primary())
+            return false;
+        if (Accept("^"))
+        {
+            if (!Unary())
+                return false;
+            Op sOp;
+            sOp.eCode = Op::Code::POW;
+            m_aoOps.push_back(std::move(sOp));
+        }
+        return true;
+    };
+
+    Unary = [&]() -> bool
+    {
+        if (Accept("-"))
+        {
+            if (!Unary())
+                return false;
+            Op sOp;
+            sOp.eCode = Op::Code::NEG;
+            m_aoOps.push_back(std::move(sOp));
+            return true;
+        }
+        if (Accept("+"))
+            return Unary();
+        return Power();
+    };
+
+    const auto BinaryChain =
+        [this](const std::function<bool()> &Sub,
+               const std::vector<std::pair<const char *, Op::Code>> &aOps,
+               const std::function<bool(const char *)> &AcceptFn) -> bool
+    {
+        if (!Sub())
+            return false;
+        while (true)
+        {
+            bool bMatched = false;
+            for (const auto &[pszTok, eCode] : aOps)
+            {
+                if (AcceptFn(pszTok))
+                {
+                    if (!Sub())
+                        return false;
+                    Op sOp;
+                    sOp.eCode = eCode;
+                    m_aoOps.push_back(std::move(sOp));
+                    bMatched = true;
+                    break;
+                }
+            }
+            if (!bMatched)
+                return true;
+        }
+    };
+
+    const auto Mul = [&]() -> bool
+    {
+        return BinaryChain(
+            Unary, {{"*", Op::Code::MUL}, {"/", Op::Code::DIV}}, Accept);
+    };
+    const auto Add = [&]() -> bool
+    {
+        return BinaryChain(Mul, {{"+", Op::Code::ADD}, {"-", Op::Code::SUB}},
+                           Accept);
+    };
+    const auto Rel = [&]() -> bool
+    {
+        return BinaryChain(Add,
+                           {{"<=", Op::Code::LE},
+                            {">=", Op::Code::GE},
+                            {"<", Op::Code::LT},
+                            {">", Op::Code::GT}},
+                           Accept);
+    };
+    const auto Eq = [&]() -> bool
+    {
+        return BinaryChain(Rel, {{"==", Op::Code::EQ}, {"!=", Op::Code::NE}},
+                           Accept);
+    };
+    const auto And = [&]() -> bool
+    { return BinaryChain(Eq, {{"&&", Op::Code::AND}}, Accept); };
+    const auto Or = [&]() -> bool
+    { return BinaryChain(And, {{"||", Op::Code::OR}}, Accept); };
+
+    Ternary = [&]() -> bool
+    {
+        if (!Or())
+            return false;
+        if (Accept("?"))
+        {
+            if (!Ternary())
+                return false;
+            if (!Accept(":"))
+                return false;
+            if (!Ternary())
+                return false;
+            Op sOp;
+            sOp.eCode = Op::Code::SELECT;
+            m_aoOps.push_back(std::move(sOp));
+        }
+        return true;
+    };
+
+    if (!Ternary())
+        return false;
+    SkipSpace();
+    return *psz == '\0';
+}
+
+/************************************************************************/
+/*                             Compile()                                */
+/************************************************************************/
+
+CPLErr BuiltinExpression::Compile()
+{
+    if (m_nCompiled != 0)
+        return m_nCompiled > 0 ? CE_None : CE_Failure;
+    m_nCompiled = -1;
+    if (m_bHasUnsupportedFeature)
+        return CE_Failure;
+    m_aoOps.clear();
+    if (!Parse())
+    {
+        m_aoOps.clear();
+        return CE_Failure;
+    }
+
+    // Resolve variables, and compute the stack depth.
+    size_t nDepth = 0;
+    size_t nMaxDepth = 0;
+    for (auto &sOp : m_aoOps)
+    {
+        switch (sOp.eCode)
+        {
+            case Op::Code::PUSH_CONST:
+                ++nDepth;
+                break;
+            case Op::Code::PUSH_VAR:
+            {
+                const auto oIter = m_oVariables.find(sOp.osVarName);
+                if (oIter == m_oVariables.end())
+                {
+                    m_aoOps.clear();
+                    return CE_Failure;
+                }
+                sOp.pdfVar = oIter->second;
+                ++nDepth;
+                break;
+            }
+            case Op::Code::NEG:
+            case Op::Code::SQRT:
+            case Op::Code::ABS:
+            case Op::Code::EXP:
+            case Op::Code::FLOOR:
+            case Op::Code::CEIL:
+                break;
+            case Op::Code::SELECT:
+                nDepth -= 2;
+                break;
+            default:
+                --nDepth;
+                break;
+        }
+        nMaxDepth = std::max(nMaxDepth, nDepth);
+    }
+    if (nDepth != 1)
+    {
+        m_aoOps.clear();
+        return CE_Failure;
+    }
+    m_adfStack.resize(nMaxDepth);
+    m_nCompiled = 1;
+    return CE_None;
+}
+
+/************************************************************************/
+/*                             Evaluate()                               */
+/************************************************************************/
+
+CPLErr BuiltinExpression::Evaluate()
+{
+    if (m_nCompiled == 0 && Compile() != CE_None)
+        return CE_Failure;
+    if (m_nCompiled < 0)
+        return CE_Failure;
+
+    double *pdfTop = m_adfStack.data();
+    for (const auto &sOp : m_aoOps)
+    {
+        switch (sOp.eCode)
+        {
+            case Op::Code::PUSH_CONST:
+                *pdfTop++ = sOp.dfConst;
+                break;
+            case Op::Code::PUSH_VAR:
+                *pdfTop++ = *sOp.pdfVar;
+                break;
+            case Op::Code::ADD:
+                pdfTop[-2] += pdfTop[-1];
+                --pdfTop;
+                break;
+            case Op::Code::SUB:
+                pdfTop[-2] -= pdfTop[-1];
+                --pdfTop;
+                break;
+            case Op::Code::MUL:
+                pdfTop[-2] *= pdfTop[-1];
+                --pdfTop;
+                break;
+            case Op::Code::DIV:
+                pdfTop[-2] /= pdfTop[-1];
+                --pdfTop;
+                break;
+            case Op::Code::POW:
+                pdfTop[-2] = std::pow(pdfTop[-2], pdfTop[-1]);
+                --pdfTop;
+                break;
+            case Op::Code::NEG:
+                pdfTop[-1] = -pdfTop[-1];
+                break;
+            case Op::Code::LT:
+                pdfTop[-2] = pdfTop[-2] < pdfTop[-1] ? 1.0 : 0.0;
+                --pdfTop;
+                break;
+            case Op::Code::GT:
+                pdfTop[-2] = pdfTop[-2] > pdfTop[-1] ? 1.0 : 0.0;
+                --pdfTop;
+                break;
+            case Op::Code::LE:
+                pdfTop[-2] = pdfTop[-2] <= pdfTop[-1] ? 1.0 : 0.0;
+                --pdfTop;
+                break;
+            case Op::Code::GE:
+                pdfTop[-2] = pdfTop[-2] >= pdfTop[-1] ? 1.0 : 0.0;
+                --pdfTop;
+                break;
+            case Op::Code::EQ:
+                pdfTop[-2] = pdfTop[-2] == pdfTop[-1] ? 1.0 : 0.0;
+                --pdfTop;
+                break;
+            case Op::Code::NE:
+                pdfTop[-2] = pdfTop[-2] != pdfTop[-1] ? 1.0 : 0.0;
+                --pdfTop;
+                break;
+            case Op::Code::AND:
+                pdfTop[-2] =
+                    (pdfTop[-2] != 0 && pdfTop[-1] != 0) ? 1.0 : 0.0;
+                --pdfTop;
+                break;
+            case Op::Code::OR:
+                pdfTop[-2] = (pdfTop[-2] != 0 || pdfTop[-1] != 0) ? 1.0 : 0.0;
+                --pdfTop;
+                break;
+            case Op::Code::SELECT:
+                pdfTop[-3] = pdfTop[-3] != 0 ? pdfTop[-2] : pdfTop[-1];
+                pdfTop -= 2;
+                break;
+            case Op::Code::SQRT:
+                pdfTop[-1] = std::sqrt(pdfTop[-1]);
+                break;
+            case Op::Code::ABS:
+                pdfTop[-1] = std::fabs(pdfTop[-1]);
+                break;
+            case Op::Code::EXP:
+                pdfTop[-1] = std::exp(pdfTop[-1]);
+                break;
+            case Op::Code::FLOOR:
+                pdfTop[-1] = std::floor(pdfTop[-1]);
+                break;
+            case Op::Code::CEIL:
+                pdfTop[-1] = std::ceil(pdfTop[-1]);
+                break;
+            case Op::Code::MIN:
+                pdfTop[-2] = std::min(pdfTop[-2], pdfTop[-1]);
+                --pdfTop;
+                break;
+            case Op::Code::MAX:
+                pdfTop[-2] = std::max(pdfTop[-2], pdfTop[-1]);
+                --pdfTop;
+                break;
+        }
+    }
+    m_adfResults[0] = m_adfStack[0];
+    return CE_None;
+}
+
+/************************************************************************/
+/*                             Results()                                */
+/************************************************************************/
+
+const std::vector<double> &BuiltinExpression::Results() const
+{
+    return m_adfResults;
+}
+
+}  // namespace gdal
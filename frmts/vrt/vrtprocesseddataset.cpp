@@ -13,10 +13,13 @@
 #include "cpl_minixml.h"
 #include "cpl_string.h"
 #include "gdal_priv.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "vrtdataset.h"
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <set>
@@ -1376,15 +1379,92 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
         }
 
         const auto &oFunc = oIterFunc->second;
-        if (oFunc.pfnProcess(
-                oStep.osAlgorithm.c_str(), oFunc.pUserData, oStep.pWorkingData,
-                oStep.aosArguments.List(), nBufXSize, nBufYSize,
-                abyInput.data(), abyInput.size(), oStep.eInDT, oStep.nInBands,
-                oStep.adfInNoData.data(), abyOutput.data(), abyOutput.size(),
-                oStep.eOutDT, oStep.nOutBands, oStep.adfOutNoData.data(),
-                dfSrcXOff, dfSrcYOff, dfSrcXSize, dfSrcYSize, srcGT.data(),
-                m_osVRTPath.c_str(),
-                /*papszExtra=*/nullptr) != CE_None)
+
+        /* ------------------------------------------------------------ */
+        /*      The purely per-pixel built-in steps, whose working data  */
+        /*      is read-only during processing, can be applied on row    */
+        /*      strips in parallel over the worker pool.                 */
+        /* ------------------------------------------------------------ */
+        const bool bParallelizableStep =
+            oStep.osAlgorithm == "LUT" ||
+            oStep.osAlgorithm == "BandAffineCombination";
+        const int nNumThreads =
+            bParallelizableStep && nBufYSize >= 64
+                ? GDALGetNumThreads(std::min(nBufYSize / 16, 16), true)
+                : 1;
+        bool bStepOK = true;
+        bool bRanParallel = false;
+        if (nNumThreads > 1)
+        {
+            auto *poPool = GDALGetGlobalThreadPool(nNumThreads);
+            if (poPool)
+            {
+                bRanParallel = true;
+                const int nChunks = nNumThreads;
+                const int nRowsPerChunk = DIV_ROUND_UP(nBufYSize, nChunks);
+                const size_t nInRowBytes =
+                    static_cast<size_t>(nBufXSize) * oStep.nInBands *
+                    GDALGetDataTypeSizeBytes(oStep.eInDT);
+                const size_t nOutRowBytes =
+                    static_cast<size_t>(nBufXSize) * oStep.nOutBands *
+                    GDALGetDataTypeSizeBytes(oStep.eOutDT);
+                std::atomic<bool> bFailed(false);
+                auto poQueue = poPool->CreateJobQueue();
+                for (int iChunk = 0; iChunk < nChunks; ++iChunk)
+                {
+                    const int nYStart = iChunk * nRowsPerChunk;
+                    const int nYCount =
+                        std::min(nRowsPerChunk, nBufYSize - nYStart);
+                    if (nYCount <= 0)
+                        break;
+                    poQueue->SubmitJob(
+                        [&, nYStart, nYCount]()
+                        {
+                            if (bFailed)
+                                return;
+                            const double dfChunkSrcYOff =
+                                dfSrcYOff + dfSrcYSize * nYStart / nBufYSize;
+                            const double dfChunkSrcYSize =
+                                dfSrcYSize * nYCount / nBufYSize;
+                            if (oFunc.pfnProcess(
+                                    oStep.osAlgorithm.c_str(), oFunc.pUserData,
+                                    oStep.pWorkingData,
+                                    oStep.aosArguments.List(), nBufXSize,
+                                    nYCount,
+                                    abyInput.data() + nYStart * nInRowBytes,
+                                    nYCount * nInRowBytes, oStep.eInDT,
+                                    oStep.nInBands, oStep.adfInNoData.data(),
+                                    abyOutput.data() + nYStart * nOutRowBytes,
+                                    nYCount * nOutRowBytes, oStep.eOutDT,
+                                    oStep.nOutBands, oStep.adfOutNoData.data(),
+                                    dfSrcXOff, dfChunkSrcYOff, dfSrcXSize,
+                                    dfChunkSrcYSize, srcGT.data(),
+                                    m_osVRTPath.c_str(),
+                                    /*papszExtra=*/nullptr) != CE_None)
+                            {
+                                bFailed = true;
+                            }
+                        });
+                }
+                poQueue->WaitCompletion();
+                bStepOK = !bFailed;
+            }
+        }
+        if (!bRanParallel)
+        {
+            bStepOK = oFunc.pfnProcess(
+                          oStep.osAlgorithm.c_str(), oFunc.pUserData,
+                          oStep.pWorkingData, oStep.aosArguments.List(),
+                          nBufXSize, nBufYSize, abyInput.data(),
+                          abyInput.size(), oStep.eInDT, oStep.nInBands,
+                          oStep.adfInNoData.data(), abyOutput.data(),
+                          abyOutput.size(), oStep.eOutDT, oStep.nOutBands,
+                          oStep.adfOutNoData.data(), dfSrcXOff, dfSrcYOff,
+                          dfSrcXSize, dfSrcYSize, srcGT.data(),
+                          m_osVRTPath.c_str(),
+                          /*papszExtra=*/nullptr) == CE_None;
+        }
+        if (!bStepOK)
         {
             return false;
         }
@@ -115,6 +115,7 @@ VRTSourcedRasterBand::VRTSourcedRasterBand(GDALDataset *poDSIn, int nBandIn,
 VRTSourcedRasterBand::~VRTSourcedRasterBand()
 
 {
+    InvalidateSourcesSpatialIndex();
     VRTSourcedRasterBand::CloseDependentDatasets();
 }
 
@@ -300,6 +301,138 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
     return true;
 }
 
+/************************************************************************/
+/*                   InvalidateSourcesSpatialIndex()                    */
+/************************************************************************/
+
+void VRTSourcedRasterBand::InvalidateSourcesSpatialIndex()
+{
+    if (m_hSourcesSpatialIndex)
+    {
+        CPLQuadTreeDestroy(m_hSourcesSpatialIndex);
+        m_hSourcesSpatialIndex = nullptr;
+    }
+    m_bSourcesSpatialIndexUnusable = false;
+}
+
+/************************************************************************/
+/*                   GetSourceIndicesIntersecting()                     */
+/************************************************************************/
+
+/** Fills anIndices with the indices, in source order, of the sources
+ * whose destination window intersects the given window, using a lazily
+ * built quadtree over the source destination rectangles. Returns false
+ * when the index cannot be used (few sources, non-simple sources, or
+ * sources with unset destination windows), in which case the caller
+ * must do its linear scan.
+ */
+bool VRTSourcedRasterBand::GetSourceIndicesIntersecting(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    std::vector<int> &anIndices)
+{
+    constexpr size_t MIN_SOURCES_FOR_INDEX = 64;
+    if (m_bSourcesSpatialIndexUnusable ||
+        m_papoSources.size() < MIN_SOURCES_FOR_INDEX)
+        return false;
+
+    if (m_hSourcesSpatialIndex == nullptr)
+    {
+        CPLRectObj sGlobalBounds;
+        bool bGlobalBoundsSet = false;
+        for (const auto &poSource : m_papoSources)
+        {
+            if (!poSource->IsSimpleSource())
+            {
+                m_bSourcesSpatialIndexUnusable = true;
+                return false;
+            }
+            const auto poSS =
+                cpl::down_cast<VRTSimpleSource *>(poSource.get());
+            double dfSrcXOff = 0;
+            double dfSrcYOff = 0;
+            double dfSrcXSize = 0;
+            double dfSrcYSize = 0;
+            poSS->GetDstWindow(dfSrcXOff, dfSrcYOff, dfSrcXSize, dfSrcYSize);
+            if (!poSS->IsDstWinSet() || dfSrcXSize < 0 || dfSrcYSize < 0)
+            {
+                // A source without a (fully) set destination window would
+                // need per-request evaluation: do not index this band.
+                m_bSourcesSpatialIndexUnusable = true;
+                return false;
+            }
+            if (!bGlobalBoundsSet)
+            {
+                sGlobalBounds.minx = dfSrcXOff;
+                sGlobalBounds.miny = dfSrcYOff;
+                sGlobalBounds.maxx = dfSrcXOff + dfSrcXSize;
+                sGlobalBounds.maxy = dfSrcYOff + dfSrcYSize;
+                bGlobalBoundsSet = true;
+            }
+            else
+            {
+                sGlobalBounds.minx = std::min(sGlobalBounds.minx, dfSrcXOff);
+                sGlobalBounds.miny = std::min(sGlobalBounds.miny, dfSrcYOff);
+                sGlobalBounds.maxx =
+                    std::max(sGlobalBounds.maxx, dfSrcXOff + dfSrcXSize);
+                sGlobalBounds.maxy =
+                    std::max(sGlobalBounds.maxy, dfSrcYOff + dfSrcYSize);
+            }
+        }
+
+        m_hSourcesSpatialIndex = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+        if (m_hSourcesSpatialIndex == nullptr)
+        {
+            m_bSourcesSpatialIndexUnusable = true;
+            return false;
+        }
+        for (size_t i = 0; i < m_papoSources.size(); ++i)
+        {
+            const auto poSS =
+                cpl::down_cast<VRTSimpleSource *>(m_papoSources[i].get());
+            double dfSrcXOff = 0;
+            double dfSrcYOff = 0;
+            double dfSrcXSize = 0;
+            double dfSrcYSize = 0;
+            poSS->GetDstWindow(dfSrcXOff, dfSrcYOff, dfSrcXSize, dfSrcYSize);
+            CPLRectObj sRect;
+            sRect.minx = dfSrcXOff;
+            sRect.miny = dfSrcYOff;
+            sRect.maxx = dfSrcXOff + dfSrcXSize;
+            sRect.maxy = dfSrcYOff + dfSrcYSize;
+            CPLQuadTreeInsertWithBounds(
+                m_hSourcesSpatialIndex,
+                reinterpret_cast<void *>(static_cast<uintptr_t>(i)), &sRect);
+        }
+    }
+
+    CPLRectObj sAOI;
+    sAOI.minx = dfXOff;
+    sAOI.miny = dfYOff;
+    sAOI.maxx = dfXOff + dfXSize;
+    sAOI.maxy = dfYOff + dfYSize;
+    int nCandidates = 0;
+    void **pahCandidates =
+        CPLQuadTreeSearch(m_hSourcesSpatialIndex, &sAOI, &nCandidates);
+    anIndices.clear();
+    anIndices.reserve(nCandidates);
+    for (int i = 0; i < nCandidates; ++i)
+    {
+        const int iSource = static_cast<int>(
+            reinterpret_cast<uintptr_t>(pahCandidates[i]));
+        // Re-check with the exact (strict) intersection test so that the
+        // result matches what the linear scan would have selected.
+        if (cpl::down_cast<VRTSimpleSource *>(m_papoSources[iSource].get())
+                ->DstWindowIntersects(dfXOff, dfYOff, dfXSize, dfYSize))
+        {
+            anIndices.push_back(iSource);
+        }
+    }
+    CPLFree(pahCandidates);
+    // Preserve compositing order.
+    std::sort(anIndices.begin(), anIndices.end());
+    return true;
+}
+
 /************************************************************************/
 /*                       CanMultiThreadRasterIO()                       */
 /************************************************************************/
@@ -810,12 +943,19 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
         void *const pProgressDataGlobal = psExtraArg->pProgressData;
 
         VRTSource::WorkingState oWorkingState;
-        const int nSources = static_cast<int>(m_papoSources.size());
-        for (int iSource = 0; eErr == CE_None && iSource < nSources; iSource++)
-        {
+        std::vector<int> anIntersectingSources;
+        const bool bUseSpatialIndex = GetSourceIndicesIntersecting(
+            nXOff, nYOff, nXSize, nYSize, anIntersectingSources);
+        const int nSources =
+            bUseSpatialIndex ? static_cast<int>(anIntersectingSources.size())
+                             : static_cast<int>(m_papoSources.size());
+        for (int iIter = 0; eErr == CE_None && iIter < nSources; iIter++)
+        {
+            const int iSource =
+                bUseSpatialIndex ? anIntersectingSources[iIter] : iIter;
             psExtraArg->pfnProgress = GDALScaledProgress;
             psExtraArg->pProgressData = GDALCreateScaledProgress(
-                1.0 * iSource / nSources, 1.0 * (iSource + 1) / nSources,
+                1.0 * iIter / nSources, 1.0 * (iIter + 1) / nSources,
                 pfnProgressGlobal, pProgressDataGlobal);
             if (psExtraArg->pProgressData == nullptr)
                 psExtraArg->pfnProgress = nullptr;
@@ -2319,6 +2459,7 @@ CPLErr VRTSourcedRasterBand::AddSource(std::unique_ptr<VRTSource> poNewSource)
         }
     }
 
+    InvalidateSourcesSpatialIndex();
     m_papoSources.push_back(std::move(poNewSource));
 
     return CE_None;
@@ -3143,6 +3284,7 @@ CPLErr VRTSourcedRasterBand::SetMetadata(CSLConstList papszNewMD,
 
         if (EQUAL(pszDomain, "vrt_sources"))
         {
+            InvalidateSourcesSpatialIndex();
             m_papoSources.clear();
         }
 
@@ -3202,6 +3344,7 @@ int VRTSourcedRasterBand::CloseDependentDatasets()
     if (m_papoSources.empty())
         return ret;
 
+    InvalidateSourcesSpatialIndex();
     m_papoSources.clear();
 
     return TRUE;
@@ -3389,6 +3532,7 @@ void VRTSourcedRasterBand::RemoveCoveredSources(CSLConstList papszOptions)
     }
 
     // Compact the papoSources array
+    InvalidateSourcesSpatialIndex();
     m_papoSources.erase(std::remove_if(m_papoSources.begin(),
                                        m_papoSources.end(),
                                        [](const std::unique_ptr<VRTSource> &src)
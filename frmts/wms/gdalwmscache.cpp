@@ -16,6 +16,106 @@
 #include "cpl_md5.h"
 #include "wmsdriver.h"
 
+#include <list>
+#include <mutex>
+
+/************************************************************************/
+/*                      Shared tile payload cache                       */
+/*                                                                      */
+/*      Process-wide, in-memory LRU of downloaded tile payloads,        */
+/*      keyed by request URL (which encodes layer, tile matrix, row     */
+/*      and column), and shared across all dataset handles, so that     */
+/*      applications opening the same upstream layers through many      */
+/*      handles do not re-download identical tiles. Disabled unless     */
+/*      the GDAL_WMS_SHARED_TILE_CACHE_SIZE configuration option is     */
+/*      set to a byte budget (a percentage of usable RAM is also        */
+/*      accepted).                                                      */
+/************************************************************************/
+
+namespace
+{
+struct GDALWMSSharedTileCache
+{
+    typedef std::pair<std::string, std::shared_ptr<std::vector<GByte>>> Entry;
+    std::mutex oMutex{};
+    std::list<Entry> oLRU{};
+    std::map<std::string, std::list<Entry>::iterator> oMap{};
+    GIntBig nUsed = 0;
+};
+}  // namespace
+
+static GDALWMSSharedTileCache &GDALWMSGetSharedTileCache()
+{
+    static GDALWMSSharedTileCache oCache;
+    return oCache;
+}
+
+static GIntBig GDALWMSGetSharedTileCacheBudget()
+{
+    const char *pszValue =
+        CPLGetConfigOption("GDAL_WMS_SHARED_TILE_CACHE_SIZE", nullptr);
+    if (pszValue == nullptr)
+        return 0;
+    GIntBig nValue = 0;
+    if (CPLParseMemorySize(pszValue, &nValue, nullptr) != CE_None)
+        return 0;
+    return nValue;
+}
+
+std::shared_ptr<std::vector<GByte>>
+GDALWMSGetTileFromSharedCache(const char *pszURL)
+{
+    if (GDALWMSGetSharedTileCacheBudget() <= 0)
+        return nullptr;
+    auto &oCache = GDALWMSGetSharedTileCache();
+    std::lock_guard<std::mutex> oLock(oCache.oMutex);
+    const auto oIter = oCache.oMap.find(pszURL);
+    if (oIter == oCache.oMap.end())
+        return nullptr;
+    // Move to the front of the LRU list.
+    oCache.oLRU.splice(oCache.oLRU.begin(), oCache.oLRU, oIter->second);
+    return oIter->second->second;
+}
+
+void GDALWMSInsertTileIntoSharedCache(const char *pszURL,
+                                      const GByte *pabyData, size_t nSize)
+{
+    const GIntBig nBudget = GDALWMSGetSharedTileCacheBudget();
+    if (nBudget <= 0 || nSize == 0 ||
+        static_cast<GIntBig>(nSize) > nBudget)
+        return;
+    auto &oCache = GDALWMSGetSharedTileCache();
+    std::lock_guard<std::mutex> oLock(oCache.oMutex);
+    const auto oIter = oCache.oMap.find(pszURL);
+    if (oIter != oCache.oMap.end())
+    {
+        // Refresh the existing entry. A new buffer is allocated rather
+        // than overwriting the current one, which may still be read by
+        // other threads through a previously returned shared pointer.
+        oCache.nUsed -=
+            static_cast<GIntBig>(oIter->second->second->size());
+        oIter->second->second = std::make_shared<std::vector<GByte>>(
+            pabyData, pabyData + nSize);
+        oCache.nUsed += static_cast<GIntBig>(nSize);
+        oCache.oLRU.splice(oCache.oLRU.begin(), oCache.oLRU, oIter->second);
+    }
+    else
+    {
+        oCache.oLRU.emplace_front(
+            pszURL, std::make_shared<std::vector<GByte>>(
+                        pabyData, pabyData + nSize));
+        oCache.oMap[pszURL] = oCache.oLRU.begin();
+        oCache.nUsed += static_cast<GIntBig>(nSize);
+    }
+    while (oCache.nUsed > nBudget && oCache.oLRU.size() > 1)
+    {
+        const auto &oBack = oCache.oLRU.back();
+        oCache.nUsed -= static_cast<GIntBig>(oBack.second->size());
+        oCache.oMap.erase(oBack.first);
+        oCache.oLRU.pop_back();
+    }
+}
+
 static void CleanCacheThread(void *pData)
 {
     GDALWMSCache *pCache = static_cast<GDALWMSCache *>(pData);
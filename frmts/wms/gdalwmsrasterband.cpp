@@ -157,6 +157,35 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                         }
                     }
                 }
+
+                // Process-wide shared tile cache, across dataset handles.
+                if (need_this_block && ret == CE_None && !request.URL.empty())
+                {
+                    const auto poPayload =
+                        GDALWMSGetTileFromSharedCache(request.URL);
+                    if (poPayload != nullptr)
+                    {
+                        if (advise_read)
+                        {
+                            need_this_block = false;
+                        }
+                        else
+                        {
+                            CPLString file_name(BufferToVSIFile(
+                                const_cast<GByte *>(poPayload->data()),
+                                poPayload->size()));
+                            if (!file_name.empty())
+                            {
+                                if (ReadBlockFromFile(file_name, ix, iy, nBand,
+                                                      p, 0) == CE_None)
+                                {
+                                    need_this_block = false;
+                                }
+                                VSIUnlink(file_name);
+                            }
+                        }
+                    }
+                }
             }
 
             if (need_this_block)
@@ -232,6 +261,9 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                         {
                             if (cache != nullptr)
                                 cache->Insert(request.URL, file_name);
+                            GDALWMSInsertTileIntoSharedCache(
+                                request.URL, request.pabyData,
+                                request.nDataLen);
                         }
                         else
                         {
@@ -242,6 +274,9 @@ CPLErr GDALWMSRasterBand::ReadBlocks(int x, int y, void *buffer, int bx0,
                             {
                                 if (cache != nullptr)
                                     cache->Insert(request.URL, file_name);
+                                GDALWMSInsertTileIntoSharedCache(
+                                    request.URL, request.pabyData,
+                                    request.nDataLen);
                             }
                             else
                             {
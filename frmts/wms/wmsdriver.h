@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 #include <utility>
@@ -54,6 +55,14 @@ void URLPrepare(CPLString &url);
 // 3); void URLAppend(CPLString *url, const CPLString &s);
 CPLString BufferToVSIFile(GByte *buffer, size_t size);
 
+// Process-wide shared cache of downloaded tile payloads, keyed by request
+// URL and shared across all dataset handles. Enabled by setting the
+// GDAL_WMS_SHARED_TILE_CACHE_SIZE configuration option to a byte budget.
+std::shared_ptr<std::vector<GByte>>
+GDALWMSGetTileFromSharedCache(const char *pszURL);
+void GDALWMSInsertTileIntoSharedCache(const char *pszURL,
+                                      const GByte *pabyData, size_t nSize);
+
 int StrToBool(const char *p);
 int URLSearchAndReplace(CPLString *base, const char *search, const char *fmt,
                         ...) CPL_PRINT_FUNC_FORMAT(3, 4);
@@ -1180,7 +1180,9 @@ bool ZarrArray::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
     // arrayStep[i] guaranteed positive after negative-step normalization above.
     // Skip if the current read region is already covered by a previous
     // IAdviseRead (explicit or auto), so we don't blow away a useful cache.
-    if (nDims >= 2)
+    // 1-D arrays are included: a time series extraction along a chunked
+    // time dimension is exactly the embarrassingly parallel case.
+    if (nDims >= 1)
     {
         bool bAlreadyCached = false;
         if (!m_oChunkCache.empty() && m_anCachedAdviseReadStart.size() == nDims)
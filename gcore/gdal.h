@@ -2216,6 +2216,11 @@ void CPL_DLL GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
                               int nComponents, void **ppDestBuffer,
                               GDALDataType eDestDT, size_t nIters);
 
+void CPL_DLL GDALInterleave(const void *const *ppSourceBuffer,
+                            GDALDataType eSourceDT, int nComponents,
+                            void *pDestBuffer, GDALDataType eDestDT,
+                            size_t nIters);
+
 void CPL_DLL GDALTranspose2D(const void *pSrc, GDALDataType eSrcType,
                              void *pDst, GDALDataType eDstType,
                              size_t nSrcWidth, size_t nSrcHeight);
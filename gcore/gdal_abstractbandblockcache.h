@@ -18,6 +18,10 @@
 #include "cpl_port.h"
 #include "cpl_error.h"
 
+#include <map>
+#include <mutex>
+#include <vector>
+
 typedef struct _CPLCond CPLCond;
 typedef struct _CPLLock CPLLock;
 typedef struct _CPLMutex CPLMutex;
@@ -47,6 +51,14 @@ class GDALAbstractBandBlockCache /* non final */
 
     volatile int m_nDirtyBlocks = 0;
 
+    // Optional compressed second-tier cache of evicted clean blocks
+    // (GDAL_COMPRESSED_BLOCK_CACHE_SIZE), for read-only bands.
+    std::mutex m_oCompressedTierMutex{};
+    std::map<GUIntBig, std::vector<GByte>> m_oCompressedTier{};
+
+    void StoreEvictedBlockCompressed(GDALRasterBlock *poBlock);
+    void FreeCompressedTier();
+
     CPL_DISALLOW_COPY_ASSIGN(GDALAbstractBandBlockCache)
 
   protected:
@@ -69,6 +81,8 @@ class GDALAbstractBandBlockCache /* non final */
     virtual ~GDALAbstractBandBlockCache();
 
     GDALRasterBlock *CreateBlock(int nXBlockOff, int nYBlockOff);
+    bool TryRehydrateBlock(int nXBlockOff, int nYBlockOff, void *pDest,
+                           size_t nDestSize);
     void AddBlockToFreeList(GDALRasterBlock *poBlock);
     void IncDirtyBlocks(int nInc);
     void WaitCompletionPendingTasks();
@@ -94,6 +108,16 @@ class GDALAbstractBandBlockCache /* non final */
     virtual CPLErr AdoptBlock(GDALRasterBlock *poBlock) = 0;
     virtual GDALRasterBlock *TryGetLockedBlockRef(int nXBlockOff,
                                                   int nYBlockYOff) = 0;
+
+    /** Bulk variant of TryGetLockedBlockRef() over a rectangle of blocks:
+     * papoBlocks[] (row-major, nXBlockCount * nYBlockCount entries)
+     * receives a locked reference for each cached block, or nullptr for
+     * misses, amortizing the cache lock over the whole request instead of
+     * taking it once per block. The base implementation loops over
+     * TryGetLockedBlockRef(). */
+    virtual void TryGetLockedBlockRefs(int nXBlockStart, int nYBlockStart,
+                                       int nXBlockCount, int nYBlockCount,
+                                       GDALRasterBlock **papoBlocks);
     virtual CPLErr UnreferenceBlock(GDALRasterBlock *poBlock) = 0;
     virtual CPLErr FlushBlock(int nXBlockOff, int nYBlockOff,
                               int bWriteDirtyBlock) = 0;
@@ -392,6 +392,17 @@ class CPL_DLL GDALDataset : public GDALMajorObject
                               int nBandCount, int *panBandList,
                               CSLConstList papszOptions);
 
+    CPLErr Prefetch(int nXOff, int nYOff, int nXSize, int nYSize,
+                    int nBandCount, const int *panBandList,
+                    CSLConstList papszOptions = nullptr);
+    void CancelPrefetch();
+
+    //! @cond Doxygen_Suppress
+    void IncBlockCacheHit();
+    void IncBlockCacheMiss(uint64_t nBytesRead);
+    void IncBlocksWritten();
+    //! @endcond
+
     virtual CPLErr CreateMaskBand(int nFlagsIn);
 
     virtual GDALAsyncReader *
@@ -99,6 +99,7 @@ class CPL_DLL GDALDriverManager final : public GDALMajorObject
     static void AutoLoadPythonDrivers();
 
     void DeclareDeferredPluginDriver(GDALPluginDriverProxy *poProxyDriver);
+    void DeclareDeferredBuiltinDriver(GDALPluginDriverProxy *poProxyDriver);
 
     //! @cond Doxygen_Suppress
     int GetDriverCount(bool bIncludeHidden) const;
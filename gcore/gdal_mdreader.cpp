@@ -15,6 +15,7 @@
  ****************************************************************************/
 
 #include "cpl_port.h"
+#include "cpl_mem_cache.h"
 #include "gdal_mdreader.h"
 
 #include <cctype>
@@ -22,6 +23,7 @@
 #include <cstdio>
 #include <cstring>
 #include <ctime>
+#include <mutex>
 #include <string>
 
 #include "cpl_conv.h"
@@ -507,6 +509,63 @@ CPLString CPLStripQuotes(const CPLString &sString)
     return CPLStrip(CPLStrip(sString, '"'), '\'');
 }
 
+/************************************************************************/
+/*                     GDALMDSidecarParseCache                          */
+/************************************************************************/
+
+/** Process-wide cache of parsed metadata sidecars (IMD/RPB/RPC), keyed
+ * on (path, mtime, size), so that catalog crawlers re-opening the same
+ * products do not re-fetch and re-parse the same files. Bounded LRU.
+ */
+namespace
+{
+struct GDALMDSidecarParseCache
+{
+    std::mutex oMutex{};
+    lru11::Cache<std::string, std::shared_ptr<CPLStringList>> oCache{64};
+
+    static GDALMDSidecarParseCache &Get()
+    {
+        static GDALMDSidecarParseCache singleton;
+        return singleton;
+    }
+
+    //! Returns true and fills ppapszResult (CSLDuplicate'd) on cache hit.
+    //! osKey is filled whenever the file exists.
+    bool Lookup(const char *pszFilePath, std::string &osKey,
+                char ***ppapszResult)
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(pszFilePath, &sStat) != 0)
+            return false;
+        osKey = pszFilePath;
+        osKey += '|';
+        osKey += std::to_string(static_cast<uint64_t>(sStat.st_mtime));
+        osKey += '|';
+        osKey += std::to_string(static_cast<uint64_t>(sStat.st_size));
+
+        std::lock_guard<std::mutex> oLock(oMutex);
+        std::shared_ptr<CPLStringList> *ppoCached = oCache.getPtr(osKey);
+        if (ppoCached)
+        {
+            *ppapszResult = CSLDuplicate((*ppoCached)->List());
+            return true;
+        }
+        return false;
+    }
+
+    void Insert(const std::string &osKey, CSLConstList papszResult)
+    {
+        if (osKey.empty())
+            return;
+        auto poEntry = std::make_shared<CPLStringList>(
+            CSLDuplicate(const_cast<char **>(papszResult)));
+        std::lock_guard<std::mutex> oLock(oMutex);
+        oCache.insert(osKey, std::move(poEntry));
+    }
+};
+}  // namespace
+
 /************************************************************************/
 /*                          GDALLoadRPBFile()                           */
 /************************************************************************/
@@ -551,6 +610,12 @@ char **GDALLoadRPBFile(const CPLString &soFilePath)
     if (soFilePath.empty())
         return nullptr;
 
+    std::string osCacheKey;
+    char **papszCached = nullptr;
+    if (GDALMDSidecarParseCache::Get().Lookup(soFilePath.c_str(), osCacheKey,
+                                              &papszCached))
+        return papszCached;
+
     /* -------------------------------------------------------------------- */
     /*      Read file and parse.                                            */
     /* -------------------------------------------------------------------- */
@@ -620,6 +685,7 @@ char **GDALLoadRPBFile(const CPLString &soFilePath)
         papszMD = CSLSetNameValue(papszMD, apszRPBMap[i], osAdjVal);
     }
 
+    GDALMDSidecarParseCache::Get().Insert(osCacheKey, papszMD);
     return papszMD;
 }
 
@@ -635,6 +701,12 @@ char **GDALLoadRPCFile(const CPLString &soFilePath)
     if (soFilePath.empty())
         return nullptr;
 
+    std::string osCacheKey;
+    char **papszCached = nullptr;
+    if (GDALMDSidecarParseCache::Get().Lookup(soFilePath.c_str(), osCacheKey,
+                                              &papszCached))
+        return papszCached;
+
     /* -------------------------------------------------------------------- */
     /*      Read file and parse.                                            */
     /* -------------------------------------------------------------------- */
@@ -708,6 +780,7 @@ char **GDALLoadRPCFile(const CPLString &soFilePath)
     }
 
     CSLDestroy(papszLines);
+    GDALMDSidecarParseCache::Get().Insert(osCacheKey, papszMD);
     return papszMD;
 }
 
@@ -1038,6 +1111,12 @@ char **GDALLoadIMDFile(const CPLString &osFilePath)
     if (osFilePath.empty())
         return nullptr;
 
+    std::string osCacheKey;
+    char **papszCached = nullptr;
+    if (GDALMDSidecarParseCache::Get().Lookup(osFilePath.c_str(), osCacheKey,
+                                              &papszCached))
+        return papszCached;
+
     /* -------------------------------------------------------------------- */
     /*      Read file and parse.                                            */
     /* -------------------------------------------------------------------- */
@@ -1071,6 +1150,7 @@ char **GDALLoadIMDFile(const CPLString &osFilePath)
         GDAL_IMD_AA2R(&papszIMD);
     }
 
+    GDALMDSidecarParseCache::Get().Insert(osCacheKey, papszIMD);
     return papszIMD;
 }
 
@@ -273,6 +273,10 @@ struct GDALRasterBandPamInfo
 
     GDALRasterAttributeTable *poDefaultRAT = nullptr;
 
+    //! Serialized raster attribute table, deserialized lazily on the first
+    //! GetDefaultRAT() call (million-row RATs are expensive to materialize)
+    CPLXMLNode *psSavedRATTree = nullptr;
+
     bool bOffsetSet = false;
     bool bScaleSet = false;
 
@@ -37,6 +37,9 @@ class CPL_DLL GDALRasterBlock final
 
     bool bDirty = false;
     volatile int nLockCount = 0;
+    //! Approximate global access clock value of the last LRU touch of this
+    //! block; used to skip redundant LRU re-ordering (see Touch()).
+    GUInt32 nTouchStamp = 0;
 
     int nXOff = 0;
     int nYOff = 0;
@@ -53,6 +56,10 @@ class CPL_DLL GDALRasterBlock final
 
     bool bMustDetach = false;
 
+    // Index of the LRU shard this block belongs to. Assigned at construction
+    // time (and in RecycleFor()) from the band identity and block coordinates.
+    int iShard = 0;
+
     CPL_INTERNAL void Detach_unlocked(void);
     CPL_INTERNAL void Touch_unlocked(void);
 
@@ -18,9 +18,37 @@
 #include <new>
 
 #include "cpl_atomic_ops.h"
+#include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 
+#include <atomic>
+
+/************************************************************************/
+/*                  Compressed second-tier block cache                  */
+/************************************************************************/
+
+/** Total budget in bytes of the process-wide compressed tier, from the
+ * GDAL_COMPRESSED_BLOCK_CACHE_SIZE configuration option (0: disabled). */
+static GIntBig GDALGetCompressedTierBudget()
+{
+    static const GIntBig nBudget = []()
+    {
+        const char *pszVal =
+            CPLGetConfigOption("GDAL_COMPRESSED_BLOCK_CACHE_SIZE", nullptr);
+        return pszVal ? CPLAtoGIntBig(pszVal) : 0;
+    }();
+    return nBudget;
+}
+
+static std::atomic<GIntBig> gnCompressedTierUsage{0};
+
+static GUIntBig GDALCompressedTierKey(int nXBlockOff, int nYBlockOff)
+{
+    return (static_cast<GUIntBig>(static_cast<GUInt32>(nYBlockOff)) << 32) |
+           static_cast<GUInt32>(nXBlockOff);
+}
+
 #include "gdal_abstractbandblockcache.h"
 
 //! @cond Doxygen_Suppress
@@ -47,6 +75,8 @@ GDALAbstractBandBlockCache::GDALAbstractBandBlockCache(GDALRasterBand *poBandIn)
 
 GDALAbstractBandBlockCache::~GDALAbstractBandBlockCache()
 {
+    FreeCompressedTier();
+
     CPLAssert(nKeepAliveCounter == 0);
     FreeDanglingBlocks();
     if (hSpinLock)
@@ -81,8 +111,134 @@ void GDALAbstractBandBlockCache::UnreferenceBlockBase()
 /*      FlushCacheBlock() after they have been finished with a block.   */
 /************************************************************************/
 
+/************************************************************************/
+/*                      TryGetLockedBlockRefs()                         */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::TryGetLockedBlockRefs(
+    int nXBlockStart, int nYBlockStart, int nXBlockCount, int nYBlockCount,
+    GDALRasterBlock **papoBlocks)
+{
+    size_t i = 0;
+    for (int iY = 0; iY < nYBlockCount; ++iY)
+    {
+        for (int iX = 0; iX < nXBlockCount; ++iX, ++i)
+        {
+            papoBlocks[i] =
+                TryGetLockedBlockRef(nXBlockStart + iX, nYBlockStart + iY);
+        }
+    }
+}
+
+/************************************************************************/
+/*                  StoreEvictedBlockCompressed()                       */
+/************************************************************************/
+
+/** Compresses the content of an evicted clean block of a read-only band
+ * into the second-tier cache, so that a future miss rehydrates from
+ * memory instead of re-running the driver decode / network fetch. */
+void GDALAbstractBandBlockCache::StoreEvictedBlockCompressed(
+    GDALRasterBlock *poBlock)
+{
+    const GIntBig nBudget = GDALGetCompressedTierBudget();
+    if (nBudget <= 0 || poBlock->GetDirty() ||
+        poBlock->GetDataRef() == nullptr ||
+        poBand->GetAccess() != GA_ReadOnly)
+        return;
+
+    const size_t nRawSize = static_cast<size_t>(poBlock->GetBlockSize());
+    if (nRawSize == 0)
+        return;
+
+    // Compress with zlib level 1: cheap, and basemap-class data still
+    // compresses well.
+    std::vector<GByte> abyCompressed;
+    try
+    {
+        abyCompressed.resize(nRawSize + nRawSize / 2 + 64);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    size_t nCompressedSize = 0;
+    if (CPLZLibDeflate(poBlock->GetDataRef(), nRawSize, 1,
+                       abyCompressed.data(), abyCompressed.size(),
+                       &nCompressedSize) == nullptr ||
+        nCompressedSize == 0 || nCompressedSize >= nRawSize)
+    {
+        // Not compressible enough to beat the main cache.
+        return;
+    }
+    abyCompressed.resize(nCompressedSize);
+    abyCompressed.shrink_to_fit();
+
+    if (gnCompressedTierUsage.load(std::memory_order_relaxed) +
+            static_cast<GIntBig>(nCompressedSize) >
+        nBudget)
+        return;
+
+    const GUIntBig nKey =
+        GDALCompressedTierKey(poBlock->GetXOff(), poBlock->GetYOff());
+    std::lock_guard<std::mutex> oLock(m_oCompressedTierMutex);
+    auto oIter = m_oCompressedTier.find(nKey);
+    if (oIter != m_oCompressedTier.end())
+    {
+        gnCompressedTierUsage -= static_cast<GIntBig>(oIter->second.size());
+        oIter->second = std::move(abyCompressed);
+    }
+    else
+    {
+        m_oCompressedTier[nKey] = std::move(abyCompressed);
+    }
+    gnCompressedTierUsage += static_cast<GIntBig>(nCompressedSize);
+}
+
+/************************************************************************/
+/*                       TryRehydrateBlock()                            */
+/************************************************************************/
+
+/** Attempts to fill pDest with the decompressed content of a block
+ * previously stored by StoreEvictedBlockCompressed(). */
+bool GDALAbstractBandBlockCache::TryRehydrateBlock(int nXBlockOff,
+                                                   int nYBlockOff, void *pDest,
+                                                   size_t nDestSize)
+{
+    if (GDALGetCompressedTierBudget() <= 0)
+        return false;
+    const GUIntBig nKey = GDALCompressedTierKey(nXBlockOff, nYBlockOff);
+    std::lock_guard<std::mutex> oLock(m_oCompressedTierMutex);
+    const auto oIter = m_oCompressedTier.find(nKey);
+    if (oIter == m_oCompressedTier.end())
+        return false;
+    size_t nOutSize = 0;
+    if (CPLZLibInflate(oIter->second.data(), oIter->second.size(), pDest,
+                       nDestSize, &nOutSize) == nullptr ||
+        nOutSize != nDestSize)
+    {
+        gnCompressedTierUsage -= static_cast<GIntBig>(oIter->second.size());
+        m_oCompressedTier.erase(oIter);
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       FreeCompressedTier()                           */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::FreeCompressedTier()
+{
+    std::lock_guard<std::mutex> oLock(m_oCompressedTierMutex);
+    for (const auto &oEntry : m_oCompressedTier)
+        gnCompressedTierUsage -= static_cast<GIntBig>(oEntry.second.size());
+    m_oCompressedTier.clear();
+}
+
 void GDALAbstractBandBlockCache::AddBlockToFreeList(GDALRasterBlock *poBlock)
 {
+    StoreEvictedBlockCompressed(poBlock);
+
     CPLAssert(poBlock->poPrevious == nullptr);
     CPLAssert(poBlock->poNext == nullptr);
     {
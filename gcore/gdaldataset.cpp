@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <cmath>
@@ -41,6 +42,7 @@
 #include "cpl_vsi.h"
 #include "cpl_vsi_error.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "gdal.h"
 #include "gdal_alg.h"
@@ -130,6 +132,27 @@ class GDALDataset::Private
     std::vector<int>
         m_anBandMap{};  // used by RasterIO(). Values are 1, 2, etc.
 
+    // Per-dataset I/O and block cache counters (see the IO_STATS metadata
+    // domain in GetMetadata())
+    std::atomic<uint64_t> nBlockCacheHits{0};
+    std::atomic<uint64_t> nBlockCacheMisses{0};
+    std::atomic<uint64_t> nBlocksRead{0};
+    std::atomic<uint64_t> nBlocksWritten{0};
+    std::atomic<uint64_t> nBlockBytesRead{0};
+    CPLStringList aosIOStatsMD{};
+
+    // Prefetch() state. The generation counter is shared with the pending
+    // worker jobs, that abort as soon as it no longer matches the value
+    // captured at submission time.
+    std::mutex m_oPrefetchMutex{};
+    // Once a prefetch has been requested, reads on this dataset (from the
+    // prefetch worker and from the calling thread) are serialized through
+    // the read-write mutex, even in read-only mode. Sticky by design.
+    std::atomic<bool> m_bPrefetchRWMutexEnabled{false};
+    CPLJobQueuePtr m_poPrefetchQueue{};
+    std::shared_ptr<std::atomic<GUIntBig>> m_poPrefetchGeneration =
+        std::make_shared<std::atomic<GUIntBig>>(0);
+
     Private() = default;
 };
 
@@ -341,6 +364,10 @@ GDALDataset::~GDALDataset()
         }
     }
 
+    // Normally done by Close(), but drivers not going through it may get
+    // here with a prefetch worker still referencing the bands.
+    CancelPrefetch();
+
     /* -------------------------------------------------------------------- */
     /*      Destroy the raster bands if they exist.                         */
     /* -------------------------------------------------------------------- */
@@ -477,6 +504,10 @@ CPLErr GDALDataset::Close(GDALProgressFunc pfnProgress, void *pProgressData)
 
     if (nOpenFlags != OPEN_FLAGS_CLOSED)
     {
+        // Bands are still alive at this point: make sure no prefetch worker
+        // references them anymore.
+        CancelPrefetch();
+
         // Call UnregisterFromSharedDataset() before altering nOpenFlags
         UnregisterFromSharedDataset();
 
@@ -3546,6 +3577,184 @@ CPLErr CPL_STDCALL GDALDatasetAdviseRead(GDALDatasetH hDS, int nXOff, int nYOff,
         panBandMap, const_cast<char **>(papszOptions));
 }
 
+/************************************************************************/
+/*                              Prefetch()                              */
+/************************************************************************/
+
+/**
+ * \brief Asynchronously load the blocks of a window into the block cache.
+ *
+ * Contrary to AdviseRead(), which is a hint only honoured by a few drivers,
+ * this method concretely enqueues the blocks intersecting the window of
+ * interest for reading by a worker thread of the global thread pool.
+ * Subsequent RasterIO() requests on the window are then served from the
+ * block cache, which hides most of the per-request latency of remote
+ * (e.g. /vsicurl/, /vsis3/) datasets.
+ *
+ * Each call supersedes the blocks still pending from a previous Prefetch()
+ * call on this dataset, so sliding-window consumers (e.g. tile viewers) can
+ * simply call it again whenever their viewport changes.
+ *
+ * Prefetching is best effort: read errors are ignored, and blocks may be
+ * evicted from the cache before being consumed if GDAL_CACHEMAX is too
+ * small for the window of interest.
+ *
+ * The worker thread serializes its block reads with the calling thread's
+ * RasterIO() requests through the dataset read-write mutex (enabled on the
+ * first Prefetch() call, including for read-only datasets), so the
+ * underlying driver is never driven concurrently; a prefetch must still
+ * not be pending at the time the dataset is closed: call CancelPrefetch()
+ * first when in doubt.
+ *
+ * @param nXOff pixel offset of the window of interest from the left side.
+ * @param nYOff line offset of the window of interest from the top.
+ * @param nXSize width in pixels of the window of interest.
+ * @param nYSize height in lines of the window of interest.
+ * @param nBandCount number of entries of panBandList, or 0 to prefetch all
+ * bands.
+ * @param panBandList list of band numbers (1 based), or nullptr to use the
+ * nBandCount first bands.
+ * @param papszOptions NULL terminated list of options, or nullptr. None
+ * supported currently.
+ *
+ * @return CE_None on success (meaning the request has been queued), or
+ * CE_Failure.
+ *
+ * @since GDAL 3.14
+ */
+
+CPLErr GDALDataset::Prefetch(int nXOff, int nYOff, int nXSize, int nYSize,
+                             int nBandCount, const int *panBandList,
+                             CSLConstList papszOptions)
+
+{
+    if (m_poPrivate == nullptr)
+        return CE_Failure;
+
+    if (nXOff < 0 || nYOff < 0 || nXSize <= 0 || nYSize <= 0 ||
+        nXSize > GetRasterXSize() - nXOff || nYSize > GetRasterYSize() - nYOff)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "Prefetch(): window out of dataset extent");
+        return CE_Failure;
+    }
+
+    std::vector<GDALRasterBand *> apoBands;
+    if (nBandCount == 0)
+    {
+        for (int i = 1; i <= GetRasterCount(); ++i)
+            apoBands.push_back(GetRasterBand(i));
+    }
+    else
+    {
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            GDALRasterBand *poBand =
+                GetRasterBand(panBandList ? panBandList[i] : i + 1);
+            if (poBand == nullptr)
+                return CE_Failure;
+            apoBands.push_back(poBand);
+        }
+    }
+
+    std::lock_guard<std::mutex> oGuard(m_poPrivate->m_oPrefetchMutex);
+
+    // From now on, all block reads on this dataset go through the
+    // read-write mutex (see EnterReadWrite()), so that the worker and the
+    // calling thread never drive the underlying driver concurrently.
+    m_poPrivate->m_bPrefetchRWMutexEnabled = true;
+
+    // Supersede the blocks still pending from a previous call.
+    m_poPrivate->m_poPrefetchGeneration->fetch_add(1);
+
+    if (m_poPrivate->m_poPrefetchQueue == nullptr)
+    {
+        CPLWorkerThreadPool *poPool =
+            GDALGetGlobalThreadPool(GDALGetNumThreads(papszOptions));
+        if (poPool == nullptr)
+            return CE_Failure;
+        m_poPrivate->m_poPrefetchQueue = poPool->CreateJobQueue();
+        if (m_poPrivate->m_poPrefetchQueue == nullptr)
+            return CE_Failure;
+    }
+
+    const auto poGeneration = m_poPrivate->m_poPrefetchGeneration;
+    const GUIntBig nGeneration = poGeneration->load();
+    const bool bOK = m_poPrivate->m_poPrefetchQueue->SubmitJob(
+        [this, apoBands = std::move(apoBands), poGeneration, nGeneration,
+         nXOff, nYOff, nXSize, nYSize]()
+        {
+            // Prefetching is best effort: do not emit errors.
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            for (GDALRasterBand *poBand : apoBands)
+            {
+                int nBlockXSize = 0;
+                int nBlockYSize = 0;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                if (nBlockXSize <= 0 || nBlockYSize <= 0)
+                    continue;
+                const int nFirstBlockX = nXOff / nBlockXSize;
+                const int nFirstBlockY = nYOff / nBlockYSize;
+                const int nLastBlockX = (nXOff + nXSize - 1) / nBlockXSize;
+                const int nLastBlockY = (nYOff + nYSize - 1) / nBlockYSize;
+                for (int iBlockY = nFirstBlockY; iBlockY <= nLastBlockY;
+                     ++iBlockY)
+                {
+                    for (int iBlockX = nFirstBlockX; iBlockX <= nLastBlockX;
+                         ++iBlockX)
+                    {
+                        // A newer Prefetch() / CancelPrefetch() call
+                        // supersedes this request.
+                        if (poGeneration->load() != nGeneration)
+                            return;
+                        // Serialize with the calling thread's own reads:
+                        // the underlying driver is not thread-safe.
+                        const bool bCallLeaveReadWrite =
+                            CPL_TO_BOOL(EnterReadWrite(GF_Read));
+                        GDALRasterBlock *poBlock =
+                            poBand->GetLockedBlockRef(iBlockX, iBlockY);
+                        if (poBlock)
+                            poBlock->DropLock();
+                        if (bCallLeaveReadWrite)
+                            LeaveReadWrite();
+                    }
+                }
+            }
+        });
+
+    return bOK ? CE_None : CE_Failure;
+}
+
+/************************************************************************/
+/*                          CancelPrefetch()                            */
+/************************************************************************/
+
+/**
+ * \brief Cancel a pending Prefetch() request and wait for its completion.
+ *
+ * This method returns immediately if no prefetch is pending.
+ *
+ * @since GDAL 3.14
+ */
+
+void GDALDataset::CancelPrefetch()
+
+{
+    if (m_poPrivate == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> oGuard(m_poPrivate->m_oPrefetchMutex);
+    m_poPrivate->m_poPrefetchGeneration->fetch_add(1);
+    if (m_poPrivate->m_poPrefetchQueue)
+        m_poPrivate->m_poPrefetchQueue->WaitCompletion();
+}
+
+// Keep in sync prototype of those 2 functions between gdalopeninfo.cpp and
+// gdaldataset.cpp
+void GDALOpenInfoCacheDeclareOpeningDriver(const char *pszFilename,
+                                           const char *pszDriverName);
+std::string GDALOpenInfoCacheGetOpeningDriver(const char *pszFilename);
+
 /************************************************************************/
 /*                       GDALAntiRecursionStruct                        */
 /************************************************************************/
@@ -4240,6 +4449,20 @@ GDALDataset::Open(GDALOpenInfo *poOpenInfo,
     GDALDriver *poMissingPluginDriver = nullptr;
     std::vector<GDALDriver *> apoSecondPassDrivers;
 
+    // When the header probe cache knows which driver opened this file last
+    // time, probe it first. This is only a hint: if it does not match
+    // anymore, the regular driver iteration below takes over.
+    GDALDriver *poCachedPreferredDriver = nullptr;
+    {
+        const std::string osCachedDriver =
+            GDALOpenInfoCacheGetOpeningDriver(pszFilename);
+        if (!osCachedDriver.empty())
+        {
+            poCachedPreferredDriver =
+                poDM->GetDriverByName(osCachedDriver.c_str());
+        }
+    }
+
     // Lookup of matching driver for dataset can involve up to 2 passes:
     // - in the first pass, all drivers that are compabile of the request mode
     //   (raster/vector/etc.) are probed using their Identify() method if it
@@ -4258,14 +4481,20 @@ GDALDataset::Open(GDALOpenInfo *poOpenInfo,
     //   loaded for real.
     int iPass = 1;
 retry:
-    for (int iDriver = 0;
+    for (int iDriver = (iPass == 1 && poCachedPreferredDriver) ? -1 : 0;
          iDriver < (iPass == 1 ? nDriverCount
                                : static_cast<int>(apoSecondPassDrivers.size()));
          ++iDriver)
     {
         GDALDriver *poDriver =
-            iPass == 1 ? poDM->GetDriver(iDriver, /*bIncludeHidden=*/true)
-                       : apoSecondPassDrivers[iDriver];
+            iDriver < 0 ? poCachedPreferredDriver
+            : iPass == 1 ? poDM->GetDriver(iDriver, /*bIncludeHidden=*/true)
+                         : apoSecondPassDrivers[iDriver];
+        if (iDriver >= 0 && iPass == 1 && poDriver == poCachedPreferredDriver)
+        {
+            // Already probed in the extra first iteration.
+            continue;
+        }
         const char *pszDriverName = GDALGetDriverShortName(poDriver);
         if (pszDriverName && papszAllowedDrivers)
         {
@@ -4518,6 +4747,9 @@ retry:
             {
                 poDS->m_bCanBeReopened = true;
 
+                GDALOpenInfoCacheDeclareOpeningDriver(
+                    pszFilename, poDriver->GetDescription());
+
                 if ((nOpenFlags & GDAL_OF_THREAD_SAFE) != 0)
                 {
                     poDS =
@@ -5215,8 +5447,82 @@ void GDALDataset::ReportErrorV(const char *pszDSName, CPLErr eErrClass,
 /************************************************************************/
 /*                            GetMetadata()                             */
 /************************************************************************/
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                     Per-dataset I/O statistics                       */
+/************************************************************************/
+
+/* Called by GDALRasterBand::GetLockedBlockRef() and
+ * GDALRasterBlock::Write() to maintain the counters exposed in the
+ * IO_STATS metadata domain. */
+
+void GDALDataset::IncBlockCacheHit()
+{
+    if (m_poPrivate)
+        m_poPrivate->nBlockCacheHits.fetch_add(1, std::memory_order_relaxed);
+}
+
+void GDALDataset::IncBlockCacheMiss(uint64_t nBytesRead)
+{
+    if (m_poPrivate)
+    {
+        m_poPrivate->nBlockCacheMisses.fetch_add(1,
+                                                 std::memory_order_relaxed);
+        // nBytesRead is 0 for blocks that are just initialized for
+        // writing, without a driver read.
+        if (nBytesRead)
+        {
+            m_poPrivate->nBlocksRead.fetch_add(1, std::memory_order_relaxed);
+            m_poPrivate->nBlockBytesRead.fetch_add(nBytesRead,
+                                                   std::memory_order_relaxed);
+        }
+    }
+}
+
+void GDALDataset::IncBlocksWritten()
+{
+    if (m_poPrivate)
+        m_poPrivate->nBlocksWritten.fetch_add(1, std::memory_order_relaxed);
+}
+
+//! @endcond
+
 CSLConstList GDALDataset::GetMetadata(const char *pszDomain)
 {
+    if (pszDomain != nullptr && EQUAL(pszDomain, "IO_STATS") && m_poPrivate)
+    {
+        // Number of blocks actually read from the driver, i.e. block cache
+        // misses, and an estimate of the corresponding decoded bytes.
+        m_poPrivate->aosIOStatsMD.Clear();
+        m_poPrivate->aosIOStatsMD.SetNameValue(
+            "BLOCK_CACHE_HITS",
+            CPLSPrintf(CPL_FRMT_GUIB,
+                       static_cast<GUIntBig>(
+                           m_poPrivate->nBlockCacheHits.load())));
+        m_poPrivate->aosIOStatsMD.SetNameValue(
+            "BLOCK_CACHE_MISSES",
+            CPLSPrintf(CPL_FRMT_GUIB,
+                       static_cast<GUIntBig>(
+                           m_poPrivate->nBlockCacheMisses.load())));
+        m_poPrivate->aosIOStatsMD.SetNameValue(
+            "BLOCKS_READ",
+            CPLSPrintf(CPL_FRMT_GUIB,
+                       static_cast<GUIntBig>(
+                           m_poPrivate->nBlocksRead.load())));
+        m_poPrivate->aosIOStatsMD.SetNameValue(
+            "BLOCKS_WRITTEN",
+            CPLSPrintf(CPL_FRMT_GUIB,
+                       static_cast<GUIntBig>(
+                           m_poPrivate->nBlocksWritten.load())));
+        m_poPrivate->aosIOStatsMD.SetNameValue(
+            "BLOCK_BYTES_READ",
+            CPLSPrintf(CPL_FRMT_GUIB,
+                       static_cast<GUIntBig>(
+                           m_poPrivate->nBlockBytesRead.load())));
+        return m_poPrivate->aosIOStatsMD.List();
+    }
+
 #ifndef WITHOUT_DERIVED
     if (pszDomain != nullptr && EQUAL(pszDomain, "DERIVED_SUBDATASETS"))
     {
@@ -8838,7 +9144,9 @@ int GDALDataset::EnterReadWrite(GDALRWFlag eRWFlag)
     if (m_poPrivate->poParentDataset)
         return m_poPrivate->poParentDataset->EnterReadWrite(eRWFlag);
 
-    if (eAccess == GA_Update)
+    // A dataset on which Prefetch() has been used serializes reads with the
+    // prefetch worker through the same mutex, even in read-only mode.
+    if (eAccess == GA_Update || m_poPrivate->m_bPrefetchRWMutexEnabled)
     {
         if (m_poPrivate->eStateReadWriteMutex ==
             GDALAllowReadWriteMutexState::RW_MUTEX_STATE_UNKNOWN)
@@ -14,12 +14,17 @@
 #include "cpl_port.h"
 #include "gdal_priv.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
+#include <mutex>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /* ==================================================================== */
@@ -258,6 +263,181 @@ class GDALDefaultAsyncReader : public GDALAsyncReader
                                              int *pnBufYSize) override;
 };
 
+/************************************************************************/
+/* ==================================================================== */
+/*                      GDALThreadedAsyncReader                         */
+/* ==================================================================== */
+/************************************************************************/
+
+/* Used by GDALGetDefaultAsyncReader() when the THREADED option (or the
+ * GDAL_ASYNC_READER_THREADED configuration option) is set. The RasterIO
+ * request is submitted to the global worker thread pool, so that the caller
+ * can overlap other work with the read and poll for completion with
+ * GetNextUpdatedRegion(). The caller must not otherwise use the dataset
+ * while the request is pending. */
+
+class GDALThreadedAsyncReader : public GDALAsyncReader
+{
+  private:
+    mutable std::mutex oMutex{};
+    std::condition_variable oCV{};
+    bool bDone = false;
+    CPLErr eErr = CE_Failure;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadedAsyncReader)
+
+    void WaitCompletion(double dfTimeout);
+
+  public:
+    GDALThreadedAsyncReader(GDALDataset *poDS, int nXOff, int nYOff,
+                            int nXSize, int nYSize, void *pBuf, int nBufXSize,
+                            int nBufYSize, GDALDataType eBufType,
+                            int nBandCount, int *panBandMap, int nPixelSpace,
+                            int nLineSpace, int nBandSpace,
+                            CSLConstList papszOptions);
+    ~GDALThreadedAsyncReader() override;
+
+    GDALAsyncStatusType GetNextUpdatedRegion(double dfTimeout, int *pnBufXOff,
+                                             int *pnBufYOff, int *pnBufXSize,
+                                             int *pnBufYSize) override;
+    int LockBuffer(double dfTimeout) override;
+};
+
+/************************************************************************/
+/*                      GDALThreadedAsyncReader()                       */
+/************************************************************************/
+
+GDALThreadedAsyncReader::GDALThreadedAsyncReader(
+    GDALDataset *poDSIn, int nXOffIn, int nYOffIn, int nXSizeIn, int nYSizeIn,
+    void *pBufIn, int nBufXSizeIn, int nBufYSizeIn, GDALDataType eBufTypeIn,
+    int nBandCountIn, int *panBandMapIn, int nPixelSpaceIn, int nLineSpaceIn,
+    int nBandSpaceIn, CSLConstList papszOptionsIn)
+
+{
+    poDS = poDSIn;
+    nXOff = nXOffIn;
+    nYOff = nYOffIn;
+    nXSize = nXSizeIn;
+    nYSize = nYSizeIn;
+    pBuf = pBufIn;
+    nBufXSize = nBufXSizeIn;
+    nBufYSize = nBufYSizeIn;
+    eBufType = eBufTypeIn;
+    nBandCount = nBandCountIn;
+    panBandMap = static_cast<int *>(CPLMalloc(sizeof(int) * nBandCountIn));
+
+    if (panBandMapIn != nullptr)
+        memcpy(panBandMap, panBandMapIn, sizeof(int) * nBandCount);
+    else
+    {
+        for (int i = 0; i < nBandCount; i++)
+            panBandMap[i] = i + 1;
+    }
+
+    nPixelSpace = nPixelSpaceIn;
+    nLineSpace = nLineSpaceIn;
+    nBandSpace = nBandSpaceIn;
+
+    CPLWorkerThreadPool *poPool =
+        GDALGetGlobalThreadPool(GDALGetNumThreads(papszOptionsIn));
+    const auto DoRequest = [this]()
+    {
+        const CPLErr eLocalErr = poDS->RasterIO(
+            GF_Read, nXOff, nYOff, nXSize, nYSize, pBuf, nBufXSize, nBufYSize,
+            eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace,
+            nBandSpace, nullptr);
+        {
+            std::lock_guard<std::mutex> oGuard(oMutex);
+            eErr = eLocalErr;
+            bDone = true;
+            // Notify while holding the mutex: the destructor may destroy
+            // this object as soon as it can observe bDone == true.
+            oCV.notify_all();
+        }
+    };
+    if (poPool == nullptr || !poPool->SubmitJob(DoRequest))
+    {
+        // Could not spawn/submit: run the request synchronously.
+        DoRequest();
+    }
+}
+
+/************************************************************************/
+/*                      ~GDALThreadedAsyncReader()                      */
+/************************************************************************/
+
+GDALThreadedAsyncReader::~GDALThreadedAsyncReader()
+
+{
+    // Make sure the worker job no longer references this object.
+    WaitCompletion(-1.0);
+
+    CPLFree(panBandMap);
+}
+
+/************************************************************************/
+/*                           WaitCompletion()                           */
+/************************************************************************/
+
+void GDALThreadedAsyncReader::WaitCompletion(double dfTimeout)
+{
+    std::unique_lock<std::mutex> oLock(oMutex);
+    if (bDone)
+        return;
+    if (dfTimeout < 0)
+    {
+        oCV.wait(oLock, [this]() { return bDone; });
+    }
+    else if (dfTimeout > 0)
+    {
+        oCV.wait_for(oLock, std::chrono::duration<double>(dfTimeout),
+                     [this]() { return bDone; });
+    }
+}
+
+/************************************************************************/
+/*                        GetNextUpdatedRegion()                        */
+/************************************************************************/
+
+GDALAsyncStatusType GDALThreadedAsyncReader::GetNextUpdatedRegion(
+    double dfTimeout, int *pnBufXOff, int *pnBufYOff, int *pnBufXSize,
+    int *pnBufYSize)
+{
+    WaitCompletion(dfTimeout);
+
+    std::lock_guard<std::mutex> oGuard(oMutex);
+    if (!bDone)
+    {
+        *pnBufXOff = 0;
+        *pnBufYOff = 0;
+        *pnBufXSize = 0;
+        *pnBufYSize = 0;
+        return GARIO_PENDING;
+    }
+
+    *pnBufXOff = 0;
+    *pnBufYOff = 0;
+    *pnBufXSize = nBufXSize;
+    *pnBufYSize = nBufYSize;
+
+    return eErr == CE_None ? GARIO_COMPLETE : GARIO_ERROR;
+}
+
+/************************************************************************/
+/*                             LockBuffer()                             */
+/************************************************************************/
+
+int GDALThreadedAsyncReader::LockBuffer(double dfTimeout)
+
+{
+    // The worker thread is the only writer of pBuf: once the request has
+    // completed, the buffer can be used freely.
+    WaitCompletion(dfTimeout);
+
+    std::lock_guard<std::mutex> oGuard(oMutex);
+    return bDone ? TRUE : FALSE;
+}
+
 /************************************************************************/
 /*                     GDALGetDefaultAsyncReader()                      */
 /************************************************************************/
@@ -270,6 +450,16 @@ GDALGetDefaultAsyncReader(GDALDataset *poDS, int nXOff, int nYOff, int nXSize,
                           int nBandSpace, CSLConstList papszOptions)
 
 {
+    if (CPLFetchBool(papszOptions, "THREADED",
+                     CPLTestBool(CPLGetConfigOption(
+                         "GDAL_ASYNC_READER_THREADED", "NO"))))
+    {
+        return new GDALThreadedAsyncReader(
+            poDS, nXOff, nYOff, nXSize, nYSize, pBuf, nBufXSize, nBufYSize,
+            eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace,
+            nBandSpace, papszOptions);
+    }
+
     return new GDALDefaultAsyncReader(poDS, nXOff, nYOff, nXSize, nYSize, pBuf,
                                       nBufXSize, nBufYSize, eBufType,
                                       nBandCount, panBandMap, nPixelSpace,
@@ -855,6 +855,14 @@ GDALDataset *GDALDriver::DefaultCreateCopy(const char *pszFilename,
                                                               nullptr};
         const bool bSkipHoles = CPLTestBool(
             CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "FALSE"));
+        // Overlap the read of the next swath with the write of the current
+        // one (the swath geometry is derived from the block sizes of both
+        // datasets by GDALDatasetCopyWholeRaster()). An explicit user
+        // setting of GDAL_SWATH_PIPELINE takes precedence.
+        CPLConfigOptionSetter oSwathPipelineSetter(
+            "GDAL_SWATH_PIPELINE",
+            CPLGetConfigOption("GDAL_SWATH_PIPELINE", "YES"),
+            /* bSetOnlyIfUndefined = */ false);
         eErr = GDALDatasetCopyWholeRaster(
             poSrcDS, poDstDS,
             bSkipHoles ? apszCopyRasterOptionsSkipHoles : nullptr, pfnProgress,
@@ -22,6 +22,7 @@
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_http.h"
+#include "cpl_json.h"
 #include "cpl_multiproc.h"
 #include "cpl_port.h"
 #include "cpl_string.h"
@@ -1020,6 +1021,28 @@ CPLErr GDALDriverManager::LoadPlugin(const char *name)
 #endif  // GDAL_NO_AUTOLOAD
 }
 
+static const char *const apszProxyMetadataItems[] = {
+    GDAL_DMD_LONGNAME,
+    GDAL_DMD_EXTENSIONS,
+    GDAL_DMD_EXTENSION,
+    GDAL_DCAP_RASTER,
+    GDAL_DCAP_MULTIDIM_RASTER,
+    GDAL_DCAP_VECTOR,
+    GDAL_DCAP_GNM,
+    GDAL_DMD_OPENOPTIONLIST,
+    GDAL_DCAP_OPEN,
+    GDAL_DCAP_CREATE,
+    GDAL_DCAP_CREATE_MULTIDIMENSIONAL,
+    GDAL_DCAP_CREATECOPY,
+    GDAL_DCAP_UPDATE,
+    GDAL_DMD_SUBDATASETS,
+    GDAL_DCAP_MULTIPLE_VECTOR_LAYERS,
+    GDAL_DCAP_NONSPATIAL,
+    GDAL_DMD_CONNECTION_PREFIX,
+    GDAL_DCAP_VECTOR_TRANSLATE_FROM,
+    GDAL_DMD_PLUGIN_INSTALLATION_MESSAGE,
+};
+
 /************************************************************************/
 /*                          AutoLoadDrivers()                           */
 /************************************************************************/
@@ -1049,6 +1072,27 @@ CPLErr GDALDriverManager::LoadPlugin(const char *name)
  * -DINSTALL_PLUGIN_DIR=/another/path to cmake.
  */
 
+#ifndef GDAL_NO_AUTOLOAD
+
+/************************************************************************/
+/*                    GDALGetPluginManifestPath()                       */
+/************************************************************************/
+
+static std::string GDALGetPluginManifestPath()
+{
+    const char *pszPath =
+        CPLGetConfigOption("GDAL_PLUGIN_MANIFEST_CACHE_PATH", nullptr);
+    if (pszPath)
+        return pszPath;
+    const std::string osCacheDir = GDALGetCacheDirectory();
+    if (osCacheDir.empty())
+        return std::string();
+    return CPLFormFilenameSafe(osCacheDir.c_str(), "gdal_plugin_manifest.json",
+                               nullptr);
+}
+
+#endif  // GDAL_NO_AUTOLOAD
+
 void GDALDriverManager::AutoLoadDrivers()
 
 {
@@ -1070,6 +1114,40 @@ void GDALDriverManager::AutoLoadDrivers()
         return;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      When GDAL_PLUGIN_MANIFEST_CACHE is enabled, load the manifest  */
+    /*      recorded by a previous process start, so that plugins whose    */
+    /*      file has not changed can be registered as deferred proxy       */
+    /*      drivers without dlopen()'ing them.                             */
+    /* -------------------------------------------------------------------- */
+    bool bManifestCache =
+        CPLTestBool(CPLGetConfigOption("GDAL_PLUGIN_MANIFEST_CACHE", "NO"));
+    std::string osManifestPath;
+    CPLJSONObject oManifestPlugins;
+    bool bManifestDirty = false;
+    if (bManifestCache)
+    {
+        osManifestPath = GDALGetPluginManifestPath();
+        if (osManifestPath.empty())
+        {
+            bManifestCache = false;
+        }
+        else
+        {
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            CPLJSONDocument oDoc;
+            VSIStatBufL sStat;
+            if (VSIStatL(osManifestPath.c_str(), &sStat) == 0 &&
+                oDoc.Load(osManifestPath) &&
+                oDoc.GetRoot().GetString("gdal_version") == GDAL_RELEASE_NAME)
+            {
+                oManifestPlugins = oDoc.GetRoot().GetObj("plugins");
+            }
+            if (!oManifestPlugins.IsValid())
+                oManifestPlugins = CPLJSONObject();
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Where should we look for stuff?                                 */
     /* -------------------------------------------------------------------- */
@@ -1141,6 +1219,50 @@ void GDALDriverManager::AutoLoadDrivers()
             const std::string osFilename = CPLFormFilenameSafe(
                 osABISpecificDir.c_str(), papszFiles[iFile], nullptr);
 
+            if (bManifestCache)
+            {
+                VSIStatBufL sPluginStat;
+                const CPLJSONObject oEntry =
+                    oManifestPlugins.GetObjNoSplitName(osFilename);
+                const CPLJSONArray oDriversJson = oEntry.GetArray("drivers");
+                if (oEntry.IsValid() &&
+                    VSIStatL(osFilename.c_str(), &sPluginStat) == 0 &&
+                    oEntry.GetLong("mtime") ==
+                        static_cast<GInt64>(sPluginStat.st_mtime) &&
+                    oEntry.GetLong("size") ==
+                        static_cast<GInt64>(sPluginStat.st_size) &&
+                    oDriversJson.IsValid() && oDriversJson.Size() > 0)
+                {
+                    for (int i = 0; i < oDriversJson.Size(); ++i)
+                    {
+                        const CPLJSONObject oDriverJson = oDriversJson[i];
+                        const std::string osDriverName =
+                            oDriverJson.GetString("name");
+                        if (osDriverName.empty() ||
+                            GetDriverByName(osDriverName.c_str()) != nullptr)
+                        {
+                            continue;
+                        }
+                        auto poProxyDriver =
+                            new GDALPluginDriverProxy(papszFiles[iFile]);
+                        poProxyDriver->SetDescription(osDriverName.c_str());
+                        for (const auto &oItem :
+                             oDriverJson.GetObj("metadata").GetChildren())
+                        {
+                            poProxyDriver->SetMetadataItem(
+                                oItem.GetName().c_str(),
+                                oItem.ToString().c_str());
+                        }
+                        DeclareDeferredPluginDriver(poProxyDriver);
+                    }
+                    CPLDebug("GDAL",
+                             "Registering %s from the plugin manifest cache.",
+                             osFilename.c_str());
+                    bFoundOnePlugin = true;
+                    continue;
+                }
+            }
+
             CPLErrorReset();
             CPLPushErrorHandler(CPLQuietErrorHandler);
             void *pRegister = CPLGetSymbol(osFilename.c_str(), osFuncName);
@@ -1163,7 +1285,53 @@ void GDALDriverManager::AutoLoadDrivers()
                 CPLDebug("GDAL", "Auto register %s using %s.",
                          osFilename.c_str(), osFuncName.c_str());
 
+                const int nDriverCountBefore = GetDriverCount();
                 reinterpret_cast<void (*)()>(pRegister)();
+
+                VSIStatBufL sPluginStat;
+                if (bManifestCache &&
+                    VSIStatL(osFilename.c_str(), &sPluginStat) == 0)
+                {
+                    CPLJSONObject oEntry;
+                    oEntry.Add("mtime",
+                               static_cast<GInt64>(sPluginStat.st_mtime));
+                    oEntry.Add("size",
+                               static_cast<GInt64>(sPluginStat.st_size));
+                    CPLJSONArray oDriversJson;
+                    for (int i = nDriverCountBefore; i < GetDriverCount(); ++i)
+                    {
+                        GDALDriver *poDriver = GetDriver(i);
+                        CPLJSONObject oDriverJson;
+                        oDriverJson.Add("name", poDriver->GetDescription());
+                        CPLJSONObject oMetadata;
+                        for (const char *pszItem : apszProxyMetadataItems)
+                        {
+                            const char *pszValue =
+                                poDriver->GetMetadataItem(pszItem);
+                            if (pszValue)
+                                oMetadata.Add(pszItem, pszValue);
+                        }
+                        // The proxies constructed from the manifest need
+                        // these capabilities to expose the corresponding
+                        // callbacks without loading the plugin.
+                        if (poDriver->pfnOpen || poDriver->pfnOpenWithDriverArg)
+                            oMetadata.Set(GDAL_DCAP_OPEN, "YES");
+                        if (poDriver->pfnCreate ||
+                            poDriver->pfnCreateEx)
+                            oMetadata.Set(GDAL_DCAP_CREATE, "YES");
+                        if (poDriver->pfnCreateMultiDimensional)
+                            oMetadata.Set(GDAL_DCAP_CREATE_MULTIDIMENSIONAL,
+                                          "YES");
+                        if (poDriver->pfnCreateCopy)
+                            oMetadata.Set(GDAL_DCAP_CREATECOPY, "YES");
+                        oDriverJson.Add("metadata", oMetadata);
+                        oDriversJson.Add(oDriverJson);
+                    }
+                    oEntry.Add("drivers", oDriversJson);
+                    oManifestPlugins.DeleteNoSplitName(osFilename);
+                    oManifestPlugins.AddNoSplitName(osFilename, oEntry);
+                    bManifestDirty = true;
+                }
             }
         }
 
@@ -1172,6 +1340,19 @@ void GDALDriverManager::AutoLoadDrivers()
 
     CSLDestroy(papszSearchPaths);
 
+    if (bManifestCache && bManifestDirty)
+    {
+        // Best effort: failure to persist the manifest is not an error.
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        VSIMkdirRecursive(CPLGetPathSafe(osManifestPath.c_str()).c_str(),
+                          0755);
+        CPLJSONDocument oDoc;
+        CPLJSONObject oRoot = oDoc.GetRoot();
+        oRoot.Add("gdal_version", GDAL_RELEASE_NAME);
+        oRoot.Add("plugins", oManifestPlugins);
+        oDoc.Save(osManifestPath);
+    }
+
     // No need to reorder drivers if there are no plugins
     if (!bFoundOnePlugin)
         m_osDriversIniPath.clear();
@@ -1318,6 +1499,16 @@ GDALPluginDriverProxy::GDALPluginDriverProxy(
 {
 }
 
+/** Constructor for a built-in driver whose registration is deferred.
+ *
+ * @param pfnRegisterFunction Function registering the real driver, e.g.
+ *                            GDALRegister_GTiff
+ */
+GDALPluginDriverProxy::GDALPluginDriverProxy(void (*pfnRegisterFunction)())
+    : m_osPluginFileName(), m_pfnRegisterFunction(pfnRegisterFunction)
+{
+}
+
 //! @cond Doxygen_Suppress
 #define DEFINE_DRIVER_METHOD_GET_CALLBACK(method_name, output_type)            \
     GDALDriver::output_type GDALPluginDriverProxy::method_name()               \
@@ -1363,28 +1554,6 @@ CPLErr GDALPluginDriverProxy::SetMetadataItem(const char *pszName,
     return GDALDriver::SetMetadataItem(pszName, pszValue, pszDomain);
 }
 
-static const char *const apszProxyMetadataItems[] = {
-    GDAL_DMD_LONGNAME,
-    GDAL_DMD_EXTENSIONS,
-    GDAL_DMD_EXTENSION,
-    GDAL_DCAP_RASTER,
-    GDAL_DCAP_MULTIDIM_RASTER,
-    GDAL_DCAP_VECTOR,
-    GDAL_DCAP_GNM,
-    GDAL_DMD_OPENOPTIONLIST,
-    GDAL_DCAP_OPEN,
-    GDAL_DCAP_CREATE,
-    GDAL_DCAP_CREATE_MULTIDIMENSIONAL,
-    GDAL_DCAP_CREATECOPY,
-    GDAL_DCAP_UPDATE,
-    GDAL_DMD_SUBDATASETS,
-    GDAL_DCAP_MULTIPLE_VECTOR_LAYERS,
-    GDAL_DCAP_NONSPATIAL,
-    GDAL_DMD_CONNECTION_PREFIX,
-    GDAL_DCAP_VECTOR_TRANSLATE_FROM,
-    GDAL_DMD_PLUGIN_INSTALLATION_MESSAGE,
-};
-
 const char *GDALPluginDriverProxy::GetMetadataItem(const char *pszName,
                                                    const char *pszDomain)
 {
@@ -1447,7 +1616,7 @@ GDALDriver *GDALPluginDriverProxy::GetRealDriver()
 {
     // No need to take the mutex has this member variable is not modified
     // under the mutex.
-    if (m_osPluginFullPath.empty())
+    if (m_osPluginFullPath.empty() && m_pfnRegisterFunction == nullptr)
         return nullptr;
 
     CPLMutexHolderD(&hDMMutex);
@@ -1462,6 +1631,39 @@ GDALDriver *GDALPluginDriverProxy::GetRealDriver()
         m_poRealDriver = std::move(oIter->second);
         poDriverManager->m_oMapRealDrivers.erase(oIter);
     }
+    else if (m_pfnRegisterFunction)
+    {
+        // Deferred built-in driver: run its registration function. The
+        // real driver ends up in m_oMapRealDrivers through
+        // RegisterDriver().
+        CPLDebug("GDAL", "On-demand registering built-in driver %s.",
+                 GetDescription());
+        poDriverManager->m_bInDeferredDriverLoading = true;
+        try
+        {
+            m_pfnRegisterFunction();
+        }
+        catch (...)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Registration function of %s threw an exception",
+                     GetDescription());
+        }
+        poDriverManager->m_bInDeferredDriverLoading = false;
+
+        oIter = poDriverManager->m_oMapRealDrivers.find(GetDescription());
+        if (oIter == poDriverManager->m_oMapRealDrivers.end())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Registration function of %s did not register it",
+                     GetDescription());
+        }
+        else
+        {
+            m_poRealDriver = std::move(oIter->second);
+            poDriverManager->m_oMapRealDrivers.erase(oIter);
+        }
+    }
     else
     {
 #ifdef GDAL_NO_AUTOLOAD
@@ -1784,6 +1986,40 @@ void GDALDriverManager::DeclareDeferredPluginDriver(
     }
 }
 
+/************************************************************************/
+/*                   DeclareDeferredBuiltinDriver()                     */
+/************************************************************************/
+
+/** Declare a built-in driver that will be registered when actually needed.
+ *
+ * The proxy driver must have been constructed with the
+ * GDALPluginDriverProxy constructor taking the registration function of
+ * the real driver, and must carry the same identification metadata as the
+ * real driver (typically through its XXXXDriverSetCommonMetadata()
+ * function).
+ *
+ * @param poProxyDriver Driver proxy
+ *
+ * @since 3.14
+ */
+void GDALDriverManager::DeclareDeferredBuiltinDriver(
+    GDALPluginDriverProxy *poProxyDriver)
+{
+    CPLMutexHolderD(&hDMMutex);
+
+    if (GDALGetDriverByName(poProxyDriver->GetDescription()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "DeclareDeferredBuiltinDriver(): trying to register %s "
+                 "several times",
+                 poProxyDriver->GetDescription());
+        delete poProxyDriver;
+        return;
+    }
+
+    RegisterDriver(poProxyDriver);
+}
+
 /************************************************************************/
 /*                      GDALDestroyDriverManager()                      */
 /************************************************************************/
@@ -61,6 +61,9 @@ class GDALHashSetBandBlockCache final : public GDALAbstractBandBlockCache
     bool IsInitOK() override;
     CPLErr FlushCache() override;
     CPLErr AdoptBlock(GDALRasterBlock *) override;
+    void TryGetLockedBlockRefs(int nXBlockStart, int nYBlockStart,
+                               int nXBlockCount, int nYBlockCount,
+                               GDALRasterBlock **papoBlocks) override;
     GDALRasterBlock *TryGetLockedBlockRef(int nXBlockOff,
                                           int nYBlockYOff) override;
     CPLErr UnreferenceBlock(GDALRasterBlock *poBlock) override;
@@ -242,4 +245,39 @@ GDALRasterBlock *GDALHashSetBandBlockCache::TryGetLockedBlockRef(int nXBlockOff,
     return poBlock;
 }
 
+/************************************************************************/
+/*                      TryGetLockedBlockRefs()                         */
+/************************************************************************/
+
+void GDALHashSetBandBlockCache::TryGetLockedBlockRefs(
+    int nXBlockStart, int nYBlockStart, int nXBlockCount, int nYBlockCount,
+    GDALRasterBlock **papoBlocks)
+{
+    const size_t nBlocks =
+        static_cast<size_t>(nXBlockCount) * nYBlockCount;
+    {
+        // One locked pass over the whole rectangle
+        CPLLockHolderOptionalLockD(hLock);
+        size_t i = 0;
+        for (int iY = 0; iY < nYBlockCount; ++iY)
+        {
+            for (int iX = 0; iX < nXBlockCount; ++iX, ++i)
+            {
+                GDALRasterBlock oBlockForLookup(nXBlockStart + iX,
+                                                nYBlockStart + iY);
+                const auto oIter = m_oSet.find(&oBlockForLookup);
+                papoBlocks[i] =
+                    oIter != m_oSet.end() ? *oIter : nullptr;
+            }
+        }
+    }
+    // Take the per-block locks outside of the cache lock, like the scalar
+    // variant: a block evicted in between simply turns into a miss.
+    for (size_t i = 0; i < nBlocks; ++i)
+    {
+        if (papoBlocks[i] && !papoBlocks[i]->TakeLock())
+            papoBlocks[i] = nullptr;
+    }
+}
+
 //! @endcond
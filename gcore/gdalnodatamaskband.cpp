@@ -276,6 +276,33 @@ static void SetZeroOr255(GByte *pabyDest, const T *panSrc, size_t nBufSize,
     }
 }
 
+template <class T>
+#if (defined(__GNUC__) && !defined(__clang__))
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void SetZeroOr255IfNan(GByte *pabyDest, const T *pafSrc,
+                              size_t nBufSize)
+{
+    for (size_t i = 0; i < nBufSize; ++i)
+    {
+        // x != x is the vectorizable form of isnan()
+        pabyDest[i] = (pafSrc[i] != pafSrc[i]) ? 0 : 255;
+    }
+}
+
+template <class T>
+#if (defined(__GNUC__) && !defined(__clang__))
+__attribute__((optimize("tree-vectorize")))
+#endif
+static void SetZeroOr255IfRealEqual(GByte *pabyDest, const T *pafSrc,
+                                    size_t nBufSize, T fNoData)
+{
+    for (size_t i = 0; i < nBufSize; ++i)
+    {
+        pabyDest[i] = ARE_REAL_EQUAL(pafSrc[i], fNoData) ? 0 : 255;
+    }
+}
+
 template <class T>
 static void SetZeroOr255(GByte *pabyDest, const T *panSrc, int nBufXSize,
                          int nBufYSize, GSpacing nPixelSpace,
@@ -484,6 +511,25 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                 const float fNoData = static_cast<float>(m_dfNoDataValue);
                 const float *pafSrc = static_cast<const float *>(pTemp);
 
+                if (nPixelSpace == 1)
+                {
+                    // Branch-free per-line kernels, with the nan test
+                    // (loop-invariant) hoisted out, so the loops vectorize.
+                    for (int iY = 0; iY < nBufYSize; iY++)
+                    {
+                        GByte *pabyLineDest = pabyDest + iY * nLineSpace;
+                        const float *pafSrcLine =
+                            pafSrc + static_cast<size_t>(iY) * nBufXSize;
+                        if (bIsNoDataNan)
+                            SetZeroOr255IfNan(pabyLineDest, pafSrcLine,
+                                              nBufXSize);
+                        else
+                            SetZeroOr255IfRealEqual(pabyLineDest, pafSrcLine,
+                                                    nBufXSize, fNoData);
+                    }
+                    break;
+                }
+
                 size_t i = 0;
                 for (int iY = 0; iY < nBufYSize; iY++)
                 {
@@ -508,6 +554,24 @@ CPLErr GDALNoDataMaskBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             {
                 const double *padfSrc = static_cast<const double *>(pTemp);
 
+                if (nPixelSpace == 1)
+                {
+                    for (int iY = 0; iY < nBufYSize; iY++)
+                    {
+                        GByte *pabyLineDest = pabyDest + iY * nLineSpace;
+                        const double *padfSrcLine =
+                            padfSrc + static_cast<size_t>(iY) * nBufXSize;
+                        if (bIsNoDataNan)
+                            SetZeroOr255IfNan(pabyLineDest, padfSrcLine,
+                                              nBufXSize);
+                        else
+                            SetZeroOr255IfRealEqual(pabyLineDest, padfSrcLine,
+                                                    nBufXSize,
+                                                    m_dfNoDataValue);
+                    }
+                    break;
+                }
+
                 size_t i = 0;
                 for (int iY = 0; iY < nBufYSize; iY++)
                 {
@@ -29,6 +29,7 @@
 #include "cpl_config.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_mem_cache.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
@@ -135,6 +136,118 @@ static GByte *GDALOpenInfoGetFileNotToOpen(const char *pszFilename,
     return pabyHeader;
 }
 
+/************************************************************************/
+/*                         Header probe cache                           */
+/*                                                                      */
+/*      Opt-in LRU cache of the first bytes of recently probed files,   */
+/*      and of the driver that last opened them, keyed on the file      */
+/*      path and validated against its (mtime, size). It spares the     */
+/*      header read, and lets GDALOpenEx() probe the right driver       */
+/*      first, when the same file is reopened shortly afterwards, as    */
+/*      the proxy dataset pool of large VRT mosaics constantly does.    */
+/************************************************************************/
+
+namespace
+{
+struct OpenInfoCacheEntry
+{
+    GIntBig nMTime = 0;
+    GUIntBig nSize = 0;
+    std::vector<GByte> abyHeader{};
+    std::string osDriverName{};
+};
+}  // namespace
+
+static std::mutex sOpenInfoCacheMutex;
+static lru11::Cache<std::string, OpenInfoCacheEntry> *poOpenInfoCache = nullptr;
+
+static bool GDALOpenInfoCacheEnabled()
+{
+    return CPLTestBool(
+        CPLGetConfigOption("GDAL_OPEN_INFO_HEADER_CACHE", "NO"));
+}
+
+static lru11::Cache<std::string, OpenInfoCacheEntry> *GDALGetOpenInfoCache()
+{
+    if (poOpenInfoCache == nullptr)
+    {
+        const int nSize = std::max(
+            8, atoi(CPLGetConfigOption("GDAL_OPEN_INFO_HEADER_CACHE_SIZE",
+                                       "128")));
+        poOpenInfoCache = new lru11::Cache<std::string, OpenInfoCacheEntry>(
+            static_cast<size_t>(nSize));
+    }
+    return poOpenInfoCache;
+}
+
+/** Return the cached header of pszFilename if its (mtime, size) still
+ * matches, or an empty vector. */
+static std::vector<GByte> GDALOpenInfoCacheGetHeader(const char *pszFilename,
+                                                     const VSIStatBufL &sStat)
+{
+    std::lock_guard<std::mutex> oLock(sOpenInfoCacheMutex);
+    OpenInfoCacheEntry oEntry;
+    if (GDALGetOpenInfoCache()->tryGet(pszFilename, oEntry))
+    {
+        if (oEntry.nMTime == static_cast<GIntBig>(sStat.st_mtime) &&
+            oEntry.nSize == static_cast<GUIntBig>(sStat.st_size))
+        {
+            return oEntry.abyHeader;
+        }
+        GDALGetOpenInfoCache()->remove(pszFilename);
+    }
+    return std::vector<GByte>();
+}
+
+static void GDALOpenInfoCacheSetHeader(const char *pszFilename,
+                                       const VSIStatBufL &sStat,
+                                       const GByte *pabyHeader,
+                                       int nHeaderBytes)
+{
+    std::lock_guard<std::mutex> oLock(sOpenInfoCacheMutex);
+    OpenInfoCacheEntry oEntry;
+    oEntry.nMTime = static_cast<GIntBig>(sStat.st_mtime);
+    oEntry.nSize = static_cast<GUIntBig>(sStat.st_size);
+    oEntry.abyHeader.assign(pabyHeader, pabyHeader + nHeaderBytes);
+    GDALGetOpenInfoCache()->insert(pszFilename, oEntry);
+}
+
+// Keep in sync prototype of those 2 functions between gdalopeninfo.cpp and
+// gdaldataset.cpp
+void GDALOpenInfoCacheDeclareOpeningDriver(const char *pszFilename,
+                                           const char *pszDriverName);
+std::string GDALOpenInfoCacheGetOpeningDriver(const char *pszFilename);
+
+/** Record the driver that successfully opened pszFilename. */
+void GDALOpenInfoCacheDeclareOpeningDriver(const char *pszFilename,
+                                           const char *pszDriverName)
+{
+    if (!GDALOpenInfoCacheEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(sOpenInfoCacheMutex);
+    OpenInfoCacheEntry oEntry;
+    if (GDALGetOpenInfoCache()->tryGet(pszFilename, oEntry) &&
+        oEntry.osDriverName != pszDriverName)
+    {
+        oEntry.osDriverName = pszDriverName;
+        GDALGetOpenInfoCache()->insert(pszFilename, oEntry);
+    }
+}
+
+/** Return the name of the driver that last opened pszFilename, or an empty
+ * string. Only a probing-order hint: callers must fall back to the regular
+ * driver iteration if that driver does not match anymore. */
+std::string GDALOpenInfoCacheGetOpeningDriver(const char *pszFilename)
+{
+    if (!GDALOpenInfoCacheEnabled())
+        return std::string();
+    std::lock_guard<std::mutex> oLock(sOpenInfoCacheMutex);
+    OpenInfoCacheEntry oEntry;
+    if (GDALGetOpenInfoCache()->tryGet(pszFilename, oEntry))
+        return oEntry.osDriverName;
+    return std::string();
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                             GDALOpenInfo                             */
@@ -301,11 +414,48 @@ retry:  // TODO(schwehr): Stop using goto.
             nBufSize = 1024;
         else if (nBufSize > 10 * 1024 * 1024)
             nBufSize = 10 * 1024 * 1024;
-        pabyHeader = static_cast<GByte *>(CPLCalloc(nBufSize + 1, 1));
-        nHeaderBytesTried = nBufSize;
-        nHeaderBytes =
-            static_cast<int>(VSIFReadL(pabyHeader, 1, nHeaderBytesTried, fpL));
-        VSIRewindL(fpL);
+
+        const bool bUseHeaderCache = GDALOpenInfoCacheEnabled();
+        VSIStatBufL sHeaderCacheStat;
+        bool bHeaderCacheStatOK = false;
+        if (bUseHeaderCache)
+        {
+            bHeaderCacheStatOK =
+                VSIStatExL(pszFilename, &sHeaderCacheStat,
+                           VSI_STAT_EXISTS_FLAG | VSI_STAT_SIZE_FLAG) == 0;
+            if (bHeaderCacheStatOK)
+            {
+                const std::vector<GByte> abyCachedHeader =
+                    GDALOpenInfoCacheGetHeader(pszFilename, sHeaderCacheStat);
+                if (!abyCachedHeader.empty() &&
+                    static_cast<int>(abyCachedHeader.size()) >=
+                        std::min<GUIntBig>(nBufSize, sHeaderCacheStat.st_size))
+                {
+                    nHeaderBytes = static_cast<int>(abyCachedHeader.size());
+                    nHeaderBytesTried = std::max(nBufSize, nHeaderBytes);
+                    pabyHeader =
+                        static_cast<GByte *>(CPLCalloc(nHeaderBytes + 1, 1));
+                    memcpy(pabyHeader, abyCachedHeader.data(), nHeaderBytes);
+                }
+            }
+        }
+
+        if (pabyHeader == nullptr)
+        {
+            pabyHeader = static_cast<GByte *>(CPLCalloc(nBufSize + 1, 1));
+            nHeaderBytesTried = nBufSize;
+            nHeaderBytes = static_cast<int>(
+                VSIFReadL(pabyHeader, 1, nHeaderBytesTried, fpL));
+            VSIRewindL(fpL);
+
+            // Bound the memory retained by the cache: 1 MB per entry.
+            if (bUseHeaderCache && bHeaderCacheStatOK && nHeaderBytes > 0 &&
+                nHeaderBytes <= 1024 * 1024)
+            {
+                GDALOpenInfoCacheSetHeader(pszFilename, sHeaderCacheStat,
+                                           pabyHeader, nHeaderBytes);
+            }
+        }
 
         /* If we cannot read anything, check if it is not a directory instead */
         VSIStatBufL sStat;
@@ -83,6 +83,12 @@ void GDALRasterBandPamInfo::CopyFrom(const GDALRasterBandPamInfo &sOther)
     delete poDefaultRAT;
     poDefaultRAT = sOther.poDefaultRAT ? sOther.poDefaultRAT->Clone() : nullptr;
 
+    if (psSavedRATTree)
+        CPLDestroyXMLNode(psSavedRATTree);
+    psSavedRATTree = sOther.psSavedRATTree
+                         ? CPLCloneXMLTree(sOther.psSavedRATTree)
+                         : nullptr;
+
     bOffsetSet = sOther.bOffsetSet;
     bScaleSet = sOther.bScaleSet;
 }
@@ -277,7 +283,12 @@ CPLXMLNode *GDALPamRasterBand::SerializeToXML(const char * /* pszUnused */)
     /* -------------------------------------------------------------------- */
     /*      Raster Attribute Table                                          */
     /* -------------------------------------------------------------------- */
-    if (psPam->poDefaultRAT != nullptr)
+    if (psPam->poDefaultRAT == nullptr && psPam->psSavedRATTree != nullptr)
+    {
+        // Never materialized: pass the saved serialization through.
+        CPLAddXMLChild(psTree, CPLCloneXMLTree(psPam->psSavedRATTree));
+    }
+    else if (psPam->poDefaultRAT != nullptr)
     {
         CPLXMLNode *psSerializedRAT = psPam->poDefaultRAT->Serialize();
         if (psSerializedRAT != nullptr)
@@ -398,6 +409,12 @@ void GDALPamRasterBand::PamClear()
         psPam->poDefaultRAT = nullptr;
     }
 
+    if (psPam->psSavedRATTree != nullptr)
+    {
+        CPLDestroyXMLNode(psPam->psSavedRATTree);
+        psPam->psSavedRATTree = nullptr;
+    }
+
     if (psPam->psSavedHistograms != nullptr)
     {
         CPLDestroyXMLNode(psPam->psSavedHistograms);
@@ -585,10 +602,13 @@ CPLErr GDALPamRasterBand::XMLInit(const CPLXMLNode *psTree,
     if (const CPLXMLNode *psRAT =
             CPLGetXMLNode(psTree, "GDALRasterAttributeTable"))
     {
+        // Defer the (potentially very expensive) materialization of the
+        // table until GetDefaultRAT() is actually called.
         delete psPam->poDefaultRAT;
-        auto poNewRAT = new GDALDefaultRasterAttributeTable();
-        poNewRAT->XMLInit(psRAT, "");
-        psPam->poDefaultRAT = poNewRAT;
+        psPam->poDefaultRAT = nullptr;
+        if (psPam->psSavedRATTree)
+            CPLDestroyXMLNode(psPam->psSavedRATTree);
+        psPam->psSavedRATTree = CPLCloneXMLTree(psRAT);
     }
 
     return CE_None;
@@ -1588,6 +1608,15 @@ GDALRasterAttributeTable *GDALPamRasterBand::GetDefaultRAT()
     if (psPam == nullptr)
         return GDALRasterBand::GetDefaultRAT();
 
+    if (psPam->poDefaultRAT == nullptr && psPam->psSavedRATTree != nullptr)
+    {
+        auto poNewRAT = new GDALDefaultRasterAttributeTable();
+        poNewRAT->XMLInit(psPam->psSavedRATTree, "");
+        psPam->poDefaultRAT = poNewRAT;
+        CPLDestroyXMLNode(psPam->psSavedRATTree);
+        psPam->psSavedRATTree = nullptr;
+    }
+
     return psPam->poDefaultRAT;
 }
 
@@ -1610,6 +1639,11 @@ CPLErr GDALPamRasterBand::SetDefaultRAT(const GDALRasterAttributeTable *poRAT)
         delete psPam->poDefaultRAT;
         psPam->poDefaultRAT = nullptr;
     }
+    if (psPam->psSavedRATTree != nullptr)
+    {
+        CPLDestroyXMLNode(psPam->psSavedRATTree);
+        psPam->psSavedRATTree = nullptr;
+    }
 
     if (poRAT == nullptr)
         psPam->poDefaultRAT = nullptr;
@@ -67,6 +67,7 @@ class GDALPluginDriverProxy final : public GDALDriver
 {
     const std::string m_osPluginFileName;
     std::string m_osPluginFullPath{};
+    void (*m_pfnRegisterFunction)() = nullptr;
     std::unique_ptr<GDALDriver> m_poRealDriver{};
     std::set<std::string> m_oSetMetadataItems{};
 
@@ -87,6 +88,7 @@ class GDALPluginDriverProxy final : public GDALDriver
 
   public:
     explicit GDALPluginDriverProxy(const std::string &osPluginFileName);
+    explicit GDALPluginDriverProxy(void (*pfnRegisterFunction)());
 
     /** Return the plugin file name (not a full path) */
     const std::string &GetPluginFileName() const
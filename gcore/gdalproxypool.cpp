@@ -18,6 +18,10 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -95,6 +99,15 @@ class GDALDatasetPool
     GDALProxyPoolCacheEntry *firstEntry = nullptr;
     GDALProxyPoolCacheEntry *lastEntry = nullptr;
 
+    /* Index of the entries by their filename+open options key, to avoid a
+     * linear scan of the LRU list on each RefDataset(). Several entries may
+     * share the same key (shared datasets of different threads). */
+    std::unordered_multimap<std::string, GDALProxyPoolCacheEntry *>
+        oMapEntries{};
+
+    void InsertEntryInMap(GDALProxyPoolCacheEntry *entry);
+    void RemoveEntryFromMap(GDALProxyPoolCacheEntry *entry);
+
     /* Caution : to be sure that we don't run out of entries, size must be at */
     /* least greater or equal than the maximum number of threads */
     explicit GDALDatasetPool(int maxSize, int64_t nMaxRAMUsage);
@@ -211,6 +224,37 @@ void GDALDatasetPool::CheckLinks()
 }
 #endif
 
+/************************************************************************/
+/*                         InsertEntryInMap()                           */
+/************************************************************************/
+
+void GDALDatasetPool::InsertEntryInMap(GDALProxyPoolCacheEntry *entry)
+{
+    oMapEntries.emplace(entry->pszFileNameAndOpenOptions, entry);
+}
+
+/************************************************************************/
+/*                        RemoveEntryFromMap()                          */
+/************************************************************************/
+
+void GDALDatasetPool::RemoveEntryFromMap(GDALProxyPoolCacheEntry *entry)
+{
+    // Entries already cleared by _CloseDatasetIfZeroRefCount() have a null
+    // key but may still be in the LRU list.
+    if (entry->pszFileNameAndOpenOptions == nullptr)
+        return;
+    const auto oRange =
+        oMapEntries.equal_range(entry->pszFileNameAndOpenOptions);
+    for (auto oIter = oRange.first; oIter != oRange.second; ++oIter)
+    {
+        if (oIter->second == entry)
+        {
+            oMapEntries.erase(oIter);
+            break;
+        }
+    }
+}
+
 /************************************************************************/
 /*                     GetFilenameAndOpenOptions()                      */
 /************************************************************************/
@@ -245,22 +289,43 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
 
     const GIntBig responsiblePID = GDALGetResponsiblePIDForCurrentThread();
 
+    /* Datasets detached from evicted entries. They are closed later, with
+     * the mutex released, so that slow closes do not serialize the other
+     * threads using the pool. */
+    std::vector<std::pair<GDALDataset *, GIntBig>> aoDatasetsToClose;
+
+    const auto CloseDeferredDatasets = [responsiblePID, &aoDatasetsToClose]()
+    {
+        for (auto &oPair : aoDatasetsToClose)
+        {
+            /* Close by pretending we are the thread that GDALOpen'ed this */
+            /* dataset */
+            GDALSetResponsiblePIDForCurrentThread(oPair.second);
+
+            refCountOfDisabledRefCount++;
+            GDALClose(oPair.first);
+            refCountOfDisabledRefCount--;
+        }
+        if (!aoDatasetsToClose.empty())
+            GDALSetResponsiblePIDForCurrentThread(responsiblePID);
+        aoDatasetsToClose.clear();
+    };
+
     const auto EvictEntryWithZeroRefCount =
-        [this, responsiblePID](bool evictEntryWithOpenedDataset)
+        [this, &aoDatasetsToClose](bool evictEntryWithOpenedDataset)
     {
-        GDALProxyPoolCacheEntry *cur = firstEntry;
+        /* Walk the LRU list from its tail to find the least recently used
+         * evictable entry. */
         GDALProxyPoolCacheEntry *candidate = nullptr;
-        while (cur)
+        for (GDALProxyPoolCacheEntry *cur2 = lastEntry; cur2;
+             cur2 = cur2->prev)
         {
-            GDALProxyPoolCacheEntry *next = cur->next;
-
-            if (cur->refCount == 0 &&
-                (!evictEntryWithOpenedDataset || cur->nRAMUsage > 0))
+            if (cur2->refCount == 0 &&
+                (!evictEntryWithOpenedDataset || cur2->nRAMUsage > 0))
             {
-                candidate = cur;
+                candidate = cur2;
+                break;
             }
-
-            cur = next;
         }
         if (candidate == nullptr)
             return false;
@@ -268,21 +333,15 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         nRAMUsage -= candidate->nRAMUsage;
         candidate->nRAMUsage = 0;
 
+        RemoveEntryFromMap(candidate);
         CPLFree(candidate->pszFileNameAndOpenOptions);
         candidate->pszFileNameAndOpenOptions = nullptr;
 
         if (candidate->poDS)
         {
-            /* Close by pretending we are the thread that GDALOpen'ed this */
-            /* dataset */
-            GDALSetResponsiblePIDForCurrentThread(candidate->responsiblePID);
-
-            refCountOfDisabledRefCount++;
-            GDALClose(candidate->poDS);
-            refCountOfDisabledRefCount--;
-
+            aoDatasetsToClose.emplace_back(candidate->poDS,
+                                           candidate->responsiblePID);
             candidate->poDS = nullptr;
-            GDALSetResponsiblePIDForCurrentThread(responsiblePID);
         }
         CPLFree(candidate->pszOwner);
         candidate->pszOwner = nullptr;
@@ -315,17 +374,17 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         return true;
     };
 
-    GDALProxyPoolCacheEntry *cur = firstEntry;
+    GDALProxyPoolCacheEntry *cur = nullptr;
 
     const std::string osFilenameAndOO =
         GetFilenameAndOpenOptions(pszFileName, papszOpenOptions);
 
-    while (cur)
+    const auto oRange = oMapEntries.equal_range(osFilenameAndOO);
+    for (auto oIter = oRange.first; oIter != oRange.second; ++oIter)
     {
-        GDALProxyPoolCacheEntry *next = cur->next;
+        cur = oIter->second;
 
-        if (cur->refCount >= 0 && cur->pszFileNameAndOpenOptions &&
-            osFilenameAndOO == cur->pszFileNameAndOpenOptions &&
+        if (cur->refCount >= 0 &&
             ((bShared && cur->responsiblePID == responsiblePID &&
               ((cur->pszOwner == nullptr && pszOwner == nullptr) ||
                (cur->pszOwner != nullptr && pszOwner != nullptr &&
@@ -353,8 +412,6 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
             cur->refCount++;
             return cur;
         }
-
-        cur = next;
     }
 
     if (!bForceOpen)
@@ -400,6 +457,7 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     cur->responsiblePID = responsiblePID;
     cur->refCount = -1;  // to mark loading of dataset in progress
     cur->nRAMUsage = 0;
+    InsertEntryInMap(cur);
 
     refCountOfDisabledRefCount++;
     const int nFlag =
@@ -407,8 +465,10 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR;
     CPLConfigOptionSetter oSetter("CPL_ALLOW_VSISTDIN", "NO", true);
 
-    // Release mutex while opening dataset to avoid lock contention.
+    // Release mutex while closing evicted datasets and opening the new
+    // one, to avoid lock contention.
     CPLReleaseMutex(*pMutex);
+    CloseDeferredDatasets();
     auto poDS = GDALDataset::Open(pszFileName, nFlag, papszAllowedDrivers,
                                   papszOpenOptions, nullptr);
     CPLAcquireMutex(*pMutex, 1000.0);
@@ -434,6 +494,15 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
         }
     }
 
+    if (!aoDatasetsToClose.empty())
+    {
+        // cur->refCount == 1 at that point, so the entry cannot be evicted
+        // while the mutex is released.
+        CPLReleaseMutex(*pMutex);
+        CloseDeferredDatasets();
+        CPLAcquireMutex(*pMutex, 1000.0);
+    }
+
     return cur;
 }
 
@@ -477,6 +546,7 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
             cur->nRAMUsage = 0;
 
             cur->poDS = nullptr;
+            RemoveEntryFromMap(cur);
             CPLFree(cur->pszFileNameAndOpenOptions);
             cur->pszFileNameAndOpenOptions = nullptr;
             CPLFree(cur->pszOwner);
@@ -36,6 +36,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
 #include "cpl_worker_thread_pool.h"
@@ -343,6 +344,9 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                 GDALRasterIOExtraArg *psExtraArg)
 
 {
+    CPLTraceSpan oTraceSpan("GDALRasterBand::RasterIO", "gdal",
+                            static_cast<GUIntBig>(nBufXSize) * nBufYSize *
+                                GDALGetDataTypeSizeBytes(eBufType));
     GDALRasterIOExtraArg sExtraArg;
     if (psExtraArg == nullptr)
     {
@@ -1973,11 +1977,24 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
                                                    int bJustInitialize)
 
 {
+    CPLTraceSpan oTraceSpan("GDALRasterBand::GetLockedBlockRef", "gdal");
     /* -------------------------------------------------------------------- */
     /*      Try and fetch from cache.                                       */
     /* -------------------------------------------------------------------- */
     GDALRasterBlock *poBlock = TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
 
+    if (poDS)
+    {
+        if (poBlock)
+            poDS->IncBlockCacheHit();
+        else
+            poDS->IncBlockCacheMiss(
+                bJustInitialize ? 0
+                                : static_cast<uint64_t>(nBlockXSize) *
+                                      nBlockYSize *
+                                      GDALGetDataTypeSizeBytes(eDataType));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      If we didn't find it in our memory cache, instantiate a         */
     /*      block (potentially load from disk) and "adopt" it into the      */
@@ -2051,7 +2068,14 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
             return nullptr;
         }
 
-        if (!bJustInitialize)
+        if (!bJustInitialize &&
+            poBandBlockCache->TryRehydrateBlock(
+                nXBlockOff, nYBlockOff, poBlock->GetDataRef(),
+                static_cast<size_t>(poBlock->GetBlockSize())))
+        {
+            // Served from the compressed second-tier cache.
+        }
+        else if (!bJustInitialize)
         {
             const GUInt32 nErrorCounter = CPLGetErrorCounter();
             int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
@@ -4221,6 +4245,51 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
  * @return CE_None on success, or CE_Failure if something goes wrong.
  */
 
+namespace
+{
+/* Accumulates one range of rows of a block into its own bucket array, using
+ * a per-value lookup table to compute the bucket without branching. Used by
+ * GDALRasterBand::GetHistogram() for Byte and UInt16 data. */
+struct HistogramLUTTask
+{
+    const GByte *pabyData = nullptr;
+    const GByte *pabyMaskData = nullptr;
+    GUIntBig *panBuckets = nullptr;
+    const int *panValueToBucket = nullptr;
+    int nBlockXSize = 0;
+    int nXCheck = 0;
+    int nYCheck = 0;
+    bool bUInt16 = false;
+
+    template <class T> void Process() const
+    {
+        const T *paData = reinterpret_cast<const T *>(pabyData);
+        for (int iY = 0; iY < nYCheck; iY++)
+        {
+            const GPtrDiff_t nRowOffset =
+                static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+            for (int iX = 0; iX < nXCheck; iX++)
+            {
+                const GPtrDiff_t iOffset = nRowOffset + iX;
+                if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                    continue;
+                const int nBucket = panValueToBucket[paData[iOffset]];
+                if (nBucket >= 0)
+                    panBuckets[nBucket]++;
+            }
+        }
+    }
+
+    void Perform() const
+    {
+        if (bUInt16)
+            Process<GUInt16>();
+        else
+            Process<GByte>();
+    }
+};
+}  // namespace
+
 CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                                     GUIntBig *panHistogram,
                                     int bIncludeOutOfRange, int bApproxOK,
@@ -4555,6 +4624,29 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
             // be padding only (#6378).
             if (nSampleRate == nBlocksPerRow && nBlocksPerRow > 1)
                 nSampleRate += 1;
+
+            // Optionally bound the number of sampled blocks
+            // (GDAL_STATS_APPROX_MAX_BLOCKS): for huge rasters, the default
+            // sqrt(number_of_blocks) sampling still reads an unbounded
+            // amount of data, while display-grade estimates converge with a
+            // fixed sample size.
+            const int nMaxApproxBlocks = atoi(
+                CPLGetConfigOption("GDAL_STATS_APPROX_MAX_BLOCKS", "0"));
+            if (nMaxApproxBlocks > 0)
+            {
+                const GUIntBig nTotalBlocks =
+                    static_cast<GUIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                if (nTotalBlocks / nSampleRate >
+                    static_cast<GUIntBig>(nMaxApproxBlocks))
+                {
+                    nSampleRate = static_cast<int>(std::min<GUIntBig>(
+                        std::numeric_limits<int>::max() - 1,
+                        (nTotalBlocks + nMaxApproxBlocks - 1) /
+                            nMaxApproxBlocks));
+                    if (nSampleRate == nBlocksPerRow && nBlocksPerRow > 1)
+                        nSampleRate += 1;
+                }
+            }
         }
 
         GByte *pabyMaskData = nullptr;
@@ -4568,6 +4660,75 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
             }
         }
 
+        /* --------------------------------------------------------------------
+         */
+        /*      For Byte and UInt16 data, bin with a value->bucket lookup */
+        /*      table, splitting the rows of each block across the worker */
+        /*      threads of the global pool, each one accumulating into its */
+        /*      own bucket array, merged at the end. */
+        /* --------------------------------------------------------------------
+         */
+        const bool bLUTBinning =
+            ((eDataType == GDT_UInt8 && !bSignedByte) ||
+             eDataType == GDT_UInt16) &&
+            nBuckets <= 1024 * 1024;
+        int nHistThreads = 1;
+        if (bLUTBinning && nBlockYSize > 1)
+        {
+            nHistThreads = GDALGetNumThreads(CPLGetNumCPUs(),
+                                             /* bDefaultToAllCPUs = */ false);
+            // Bound the total amount of memory used by the per-thread
+            // bucket arrays to 64 MB.
+            constexpr GUIntBig MAX_PER_THREAD_HISTOGRAMS_RAM = 64 * 1024 * 1024;
+            while (nHistThreads > 1 &&
+                   static_cast<GUIntBig>(nHistThreads) * nBuckets *
+                           sizeof(GUIntBig) >
+                       MAX_PER_THREAD_HISTOGRAMS_RAM)
+            {
+                nHistThreads /= 2;
+            }
+        }
+        CPLWorkerThreadPool *psHistThreadPool =
+            nHistThreads > 1 ? GDALGetGlobalThreadPool(nHistThreads) : nullptr;
+        std::vector<int> anValueToBucket;
+        std::vector<std::vector<GUIntBig>> aanThreadHistograms;
+        if (psHistThreadPool)
+        {
+            const GUInt32 nMaxValue = eDataType == GDT_UInt8 ? 255 : 65535;
+            try
+            {
+                anValueToBucket.resize(nMaxValue + 1);
+                aanThreadHistograms.resize(nHistThreads);
+                for (auto &anThreadHistogram : aanThreadHistograms)
+                    anThreadHistogram.resize(nBuckets);
+            }
+            catch (const std::exception &)
+            {
+                anValueToBucket.clear();
+                aanThreadHistograms.clear();
+                psHistThreadPool = nullptr;
+            }
+            for (GUInt32 nValue = 0;
+                 psHistThreadPool && nValue <= nMaxValue; ++nValue)
+            {
+                // Must match the per-value logic of the generic loop below.
+                int nBucket = -1;
+                if (!(sNoDataValues.bGotNoDataValue &&
+                      static_cast<double>(nValue) ==
+                          sNoDataValues.dfNoDataValue))
+                {
+                    const double dfIndex = floor((nValue - dfMin) * dfScale);
+                    if (dfIndex < 0)
+                        nBucket = bIncludeOutOfRange ? 0 : -1;
+                    else if (dfIndex >= nBuckets)
+                        nBucket = bIncludeOutOfRange ? nBuckets - 1 : -1;
+                    else
+                        nBucket = static_cast<int>(dfIndex);
+                }
+                anValueToBucket[nValue] = nBucket;
+            }
+        }
+
         /* --------------------------------------------------------------------
          */
         /*      Read the blocks, and add to histogram. */
@@ -4612,6 +4773,42 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
 
             void *pData = poBlock->GetDataRef();
 
+            if (psHistThreadPool)
+            {
+                const int nTasks = std::min(nYCheck, nHistThreads);
+                const int nRowsPerTask = cpl::div_round_up(nYCheck, nTasks);
+                const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+                std::vector<HistogramLUTTask> aoTasks;
+                for (int i = 0; i < nTasks; ++i)
+                {
+                    const int nYCheckTask =
+                        std::min(nRowsPerTask, nYCheck - i * nRowsPerTask);
+                    if (nYCheckTask <= 0)
+                        break;
+                    const GPtrDiff_t nOffset =
+                        static_cast<GPtrDiff_t>(i) * nRowsPerTask * nBlockXSize;
+                    HistogramLUTTask oTask;
+                    oTask.pabyData =
+                        static_cast<const GByte *>(pData) + nOffset * nDTSize;
+                    oTask.pabyMaskData =
+                        pabyMaskData ? pabyMaskData + nOffset : nullptr;
+                    oTask.panBuckets = aanThreadHistograms[i].data();
+                    oTask.panValueToBucket = anValueToBucket.data();
+                    oTask.nBlockXSize = nBlockXSize;
+                    oTask.nXCheck = nXCheck;
+                    oTask.nYCheck = nYCheckTask;
+                    oTask.bUInt16 = eDataType == GDT_UInt16;
+                    aoTasks.emplace_back(oTask);
+                }
+                auto poJobQueue = psHistThreadPool->CreateJobQueue();
+                for (auto &oTask : aoTasks)
+                    poJobQueue->SubmitJob([&oTask]() { oTask.Perform(); });
+                poJobQueue->WaitCompletion();
+
+                poBlock->DropLock();
+                continue;  // To next sample block.
+            }
+
             // this is a special case for a common situation.
             if (eDataType == GDT_UInt8 && !bSignedByte && dfScale == 1.0 &&
                 (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
@@ -4805,6 +5002,12 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
             poBlock->DropLock();
         }
 
+        for (const auto &anThreadHistogram : aanThreadHistograms)
+        {
+            for (int i = 0; i < nBuckets; ++i)
+                panHistogram[i] += anThreadHistogram[i];
+        }
+
         CPLFree(pabyMaskData);
     }
 
@@ -7090,8 +7293,112 @@ struct StatisticsTaskFloat32
         }
     }
 };
+
+template <class T> struct StatisticsTaskInteger
+{
+    const T *pSrcData = nullptr;
+    bool bHasNoData = false;
+    GUInt32 nNoDataValue = 0;
+    GUInt32 nMin = 0;
+    GUInt32 nMax = 0;
+    GUIntBig nSum = 0;
+    GUIntBig nSumSquare = 0;
+    GUIntBig nSampleCount = 0;
+    GUIntBig nValidCount = 0;
+    int nChunkXSize = 0;
+    int nXCheck = 0;
+    int nYCheck = 0;
+
+    void Perform()
+    {
+        ComputeStatisticsInternal<T, /* COMPUTE_OTHER_STATS = */ true>::f(
+            nXCheck, nChunkXSize, nYCheck, pSrcData, bHasNoData, nNoDataValue,
+            nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+    }
+};
 }  // namespace
 
+/************************************************************************/
+/*                    ComputeStatsIntegerChunk()                        */
+/************************************************************************/
+
+/* Compute the statistics of one chunk of Byte/UInt16 data, splitting the
+ * rows of the chunk across the threads of psThreadPool (if not null), with
+ * per-task accumulators merged at the end. */
+template <class T>
+static void ComputeStatsIntegerChunk(
+    CPLWorkerThreadPool *psThreadPool, int nThreads, const T *pSrcData,
+    int nChunkXSize, int nXCheck, int nYCheck, bool bHasNoData,
+    GUInt32 nNoDataValue, GUInt32 nMaxValueType, GUInt32 &nMin, GUInt32 &nMax,
+    GUIntBig &nSum, GUIntBig &nSumSquare, GUIntBig &nSampleCount,
+    GUIntBig &nValidCount)
+{
+    const int nTasks = psThreadPool ? std::min(nYCheck, nThreads) : 1;
+
+    // The optimized kernels require pData to be aligned on 32 bytes, so
+    // each task must start on a row whose offset is a multiple of 32 bytes.
+    int nRowGranularity = 1;
+    const GUIntBig nBytesPerRow =
+        static_cast<GUIntBig>(nChunkXSize) * sizeof(T);
+    if ((nBytesPerRow % 32) != 0)
+    {
+        // Smallest number of rows whose total size is a multiple of 32
+        // bytes: 32 / gcd(nBytesPerRow, 32), the gcd being the lowest
+        // power-of-two factor of nBytesPerRow, capped to 32.
+        const int nLowestSetBit = static_cast<int>(std::min<GUIntBig>(
+            nBytesPerRow & (~nBytesPerRow + 1U), 32U));
+        nRowGranularity = 32 / nLowestSetBit;
+    }
+
+    int nRowsPerTask = cpl::div_round_up(nYCheck, nTasks);
+    nRowsPerTask =
+        cpl::div_round_up(nRowsPerTask, nRowGranularity) * nRowGranularity;
+
+    if (nTasks <= 1 || nRowsPerTask >= nYCheck)
+    {
+        ComputeStatisticsInternal<T, /* COMPUTE_OTHER_STATS = */ true>::f(
+            nXCheck, nChunkXSize, nYCheck, pSrcData, bHasNoData, nNoDataValue,
+            nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+        return;
+    }
+
+    std::vector<StatisticsTaskInteger<T>> tasks;
+    for (int i = 0; i < nTasks; ++i)
+    {
+        const int nYCheckTask = std::min(nRowsPerTask, nYCheck - i * nRowsPerTask);
+        if (nYCheckTask <= 0)
+            break;
+        StatisticsTaskInteger<T> task;
+        task.pSrcData =
+            pSrcData + static_cast<size_t>(i) * nRowsPerTask * nChunkXSize;
+        task.bHasNoData = bHasNoData;
+        task.nNoDataValue = nNoDataValue;
+        task.nMin = nMaxValueType;
+        task.nMax = 0;
+        task.nChunkXSize = nChunkXSize;
+        task.nXCheck = nXCheck;
+        task.nYCheck = nYCheckTask;
+        tasks.emplace_back(std::move(task));
+    }
+
+    auto poJobQueue = psThreadPool->CreateJobQueue();
+    for (auto &task : tasks)
+    {
+        poJobQueue->SubmitJob([&task]() { task.Perform(); });
+    }
+    poJobQueue->WaitCompletion();
+
+    for (const auto &task : tasks)
+    {
+        nMin = std::min(nMin, task.nMin);
+        nMax = std::max(nMax, task.nMax);
+        nSum += task.nSum;
+        nSumSquare += task.nSumSquare;
+        nSampleCount += task.nSampleCount;
+        nValidCount += task.nValidCount;
+    }
+}
+
 /************************************************************************/
 /*                         ComputeStatistics()                          */
 /************************************************************************/
@@ -7353,6 +7660,29 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             // be padding only (#6378)
             if (nSampleRate == nBlocksPerRow && nBlocksPerRow > 1)
                 nSampleRate += 1;
+
+            // Optionally bound the number of sampled blocks
+            // (GDAL_STATS_APPROX_MAX_BLOCKS): for huge rasters, the default
+            // sqrt(number_of_blocks) sampling still reads an unbounded
+            // amount of data, while display-grade estimates converge with a
+            // fixed sample size.
+            const int nMaxApproxBlocks = atoi(
+                CPLGetConfigOption("GDAL_STATS_APPROX_MAX_BLOCKS", "0"));
+            if (nMaxApproxBlocks > 0)
+            {
+                const GUIntBig nTotalBlocks =
+                    static_cast<GUIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                if (nTotalBlocks / nSampleRate >
+                    static_cast<GUIntBig>(nMaxApproxBlocks))
+                {
+                    nSampleRate = static_cast<int>(std::min<GUIntBig>(
+                        std::numeric_limits<int>::max() - 1,
+                        (nTotalBlocks + nMaxApproxBlocks - 1) /
+                            nMaxApproxBlocks));
+                    if (nSampleRate == nBlocksPerRow && nBlocksPerRow > 1)
+                        nSampleRate += 1;
+                }
+            }
         }
         if (nSampleRate == 1)
             bApproxOK = false;
@@ -7414,6 +7744,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 nThreads = GDALGetNumThreads(CPLGetNumCPUs(),
                                              /* bDefaultToAllCPUs = */ false);
             }
+            CPLWorkerThreadPool *psThreadPool =
+                nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
 
             int nNewChunkXSize = nChunkXSize;
             const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
@@ -7519,23 +7851,23 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
 
                 if (eDataType == GDT_UInt8)
                 {
-                    ComputeStatisticsInternal<
-                        GByte, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nChunkXSize, nYCheck,
-                          static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nBlockSumRef, nBlockSumSquareRef,
-                          nBlockSampleCountRef, nBlockValidCountRef);
+                    ComputeStatsIntegerChunk<GByte>(
+                        psThreadPool, nThreads,
+                        static_cast<const GByte *>(pData), nChunkXSize,
+                        nXCheck, nYCheck, nNoDataValue <= nMaxValueType,
+                        nNoDataValue, nMaxValueType, nMin, nMax, nBlockSumRef,
+                        nBlockSumSquareRef, nBlockSampleCountRef,
+                        nBlockValidCountRef);
                 }
                 else
                 {
-                    ComputeStatisticsInternal<
-                        GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nChunkXSize, nYCheck,
-                          static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nBlockSumRef, nBlockSumSquareRef,
-                          nBlockSampleCountRef, nBlockValidCountRef);
+                    ComputeStatsIntegerChunk<GUInt16>(
+                        psThreadPool, nThreads,
+                        static_cast<const GUInt16 *>(pData), nChunkXSize,
+                        nXCheck, nYCheck, nNoDataValue <= nMaxValueType,
+                        nNoDataValue, nMaxValueType, nMin, nMax, nBlockSumRef,
+                        nBlockSumSquareRef, nBlockSampleCountRef,
+                        nBlockValidCountRef);
                 }
 
                 if (poBlock)
@@ -7698,6 +8030,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 nThreads = GDALGetNumThreads(CPLGetNumCPUs(),
                                              /* bDefaultToAllCPUs = */ false);
             }
+            if (nThreads > 1)
+                psThreadPool = GDALGetGlobalThreadPool(nThreads);
 
             int nNewChunkXSize = nChunkXSize;
             if (!bApproxOK && nThreads > 1 &&
@@ -7841,7 +8175,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 }
                 else
                 {
-                    tasksFloat32[0].Perform();
+                    for (auto &task : tasksFloat32)
+                        task.Perform();
                 }
 
                 for (const auto &task : tasksFloat32)
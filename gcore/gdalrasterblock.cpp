@@ -17,9 +17,12 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstring>
+#include <map>
 #include <mutex>
+#include <vector>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
@@ -30,21 +33,10 @@
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+static std::atomic<GIntBig> nCacheUsed{0};
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
-
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
@@ -75,13 +67,271 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+/************************************************************************/
+/*                         LRU list sharding                            */
+/*                                                                      */
+/*      The LRU list is split in several independently locked shards,   */
+/*      so that Touch()/Detach() from different threads do not all      */
+/*      serialize on a single global lock once the cache is warm.       */
+/*      Each block is assigned to a shard from its band identity and    */
+/*      block coordinates. Eviction walks the shards round-robin, so    */
+/*      the eviction order is only approximately least-recently-used    */
+/*      across shards (it remains strictly LRU within a shard).         */
+/************************************************************************/
+
+constexpr int MAX_RB_SHARDS = 64;
 
-#endif
+struct GDALRasterBlockShard
+{
+    CPLLock *hLock = nullptr;
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+};
+
+static GDALRasterBlockShard asRBShards[MAX_RB_SHARDS];
+static std::atomic<int> nRBShardCount{0};
+static std::mutex oRBShardInitMutex;
+
+/** Create the shard locks if not already done, and return the shard count. */
+static int GDALRasterBlockInitShards()
+{
+    int nShards = nRBShardCount.load(std::memory_order_acquire);
+    if (nShards == 0)
+    {
+        std::lock_guard<std::mutex> oGuard(oRBShardInitMutex);
+        nShards = nRBShardCount.load(std::memory_order_relaxed);
+        if (nShards == 0)
+        {
+            nShards =
+                atoi(CPLGetConfigOption("GDAL_BLOCK_CACHE_SHARDS", "0"));
+            if (nShards <= 0)
+                nShards = CPLGetNumCPUs();
+            // Round to a power of two so that the modulo in the shard
+            // selection reduces to a mask.
+            int nRounded = 1;
+            while (nRounded < nShards && nRounded < MAX_RB_SHARDS)
+                nRounded *= 2;
+            nShards = nRounded;
+            for (int i = 0; i < nShards; ++i)
+            {
+                asRBShards[i].hLock = CPLCreateLock(GetLockType());
+                CPLLockSetDebugPerf(asRBShards[i].hLock, bDebugContention);
+            }
+            nRBShardCount.store(nShards, std::memory_order_release);
+        }
+    }
+    return nShards;
+}
+
+/** Compute the shard a block belongs to. nShards is a power of two. */
+static int GDALRasterBlockComputeShard(const GDALRasterBand *poBand, int nXOff,
+                                       int nYOff, int nShards)
+{
+    const uintptr_t nHash = (reinterpret_cast<uintptr_t>(poBand) >> 4) +
+                            static_cast<uintptr_t>(nXOff) * 2654435761U +
+                            static_cast<uintptr_t>(nYOff) * 97U;
+    return static_cast<int>(nHash & static_cast<uintptr_t>(nShards - 1));
+}
+
+#define TAKE_SHARD_LOCK(psShard) CPLLockHolderOptionalLockD((psShard)->hLock)
+
+/************************************************************************/
+/*                        Block buffer pooling                          */
+/*                                                                      */
+/*      When GDAL_BLOCK_BUFFER_POOL is enabled, the buffers of          */
+/*      evicted blocks are recycled instead of being returned to the    */
+/*      heap, which avoids allocator contention and heap                */
+/*      fragmentation in long-running multi-threaded workloads.         */
+/*      Buffers are recycled by exact size, since all blocks of a       */
+/*      given band have the same size. A small per-thread cache         */
+/*      avoids taking the central pool mutex on the hot path.           */
+/************************************************************************/
+
+namespace
+{
+struct GDALBlockBufferPool
+{
+    std::mutex oMutex{};
+    std::map<size_t, std::vector<void *>> oFreeLists{};
+    GIntBig nBytes = 0;
+    GIntBig nMaxBytes = 0;
+    std::atomic<int> nInit{0};  // 0 = unknown, -1 = disabled, 1 = enabled
+
+    bool IsEnabled()
+    {
+        if (nInit.load(std::memory_order_acquire) == 0)
+        {
+            std::lock_guard<std::mutex> oGuard(oMutex);
+            if (nInit.load(std::memory_order_relaxed) == 0)
+            {
+                if (CPLTestBool(
+                        CPLGetConfigOption("GDAL_BLOCK_BUFFER_POOL", "NO")))
+                {
+                    GIntBig nMax = 0;
+                    bool bUnitSpecified = false;
+                    const char *pszSize = CPLGetConfigOption(
+                        "GDAL_BLOCK_BUFFER_POOL_SIZE", nullptr);
+                    if (pszSize && CPLParseMemorySize(pszSize, &nMax,
+                                                      &bUnitSpecified) ==
+                                       CE_None)
+                    {
+                        if (!bUnitSpecified && nMax < 100000)
+                        {
+                            // Assume MB
+                            nMax *= 1024 * 1024;
+                        }
+                    }
+                    else
+                    {
+                        // Default to 10% of the block cache size.
+                        nMax = GDALGetCacheMax64() / 10;
+                    }
+                    nMaxBytes = nMax;
+                    nInit.store(1, std::memory_order_release);
+                }
+                else
+                {
+                    nInit.store(-1, std::memory_order_release);
+                }
+            }
+        }
+        return nInit.load(std::memory_order_acquire) > 0;
+    }
+
+    void *Get(size_t nSize)
+    {
+        std::lock_guard<std::mutex> oGuard(oMutex);
+        auto oIter = oFreeLists.find(nSize);
+        if (oIter == oFreeLists.end() || oIter->second.empty())
+            return nullptr;
+        void *pRet = oIter->second.back();
+        oIter->second.pop_back();
+        nBytes -= static_cast<GIntBig>(nSize);
+        return pRet;
+    }
+
+    bool Put(void *pBuffer, size_t nSize)
+    {
+        std::lock_guard<std::mutex> oGuard(oMutex);
+        if (nBytes + static_cast<GIntBig>(nSize) > nMaxBytes)
+            return false;
+        try
+        {
+            oFreeLists[nSize].push_back(pBuffer);
+        }
+        catch (const std::exception &)
+        {
+            return false;
+        }
+        nBytes += static_cast<GIntBig>(nSize);
+        return true;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> oGuard(oMutex);
+        for (auto &oEntry : oFreeLists)
+        {
+            for (void *pBuffer : oEntry.second)
+                VSIFreeAligned(pBuffer);
+        }
+        oFreeLists.clear();
+        nBytes = 0;
+    }
+};
+
+// Per-thread cache of a few recycled buffers, so that the common case of a
+// thread evicting and reallocating blocks of the same size does not need the
+// central pool mutex.
+struct GDALThreadBlockBufferCache
+{
+    static constexpr int CACHE_SIZE = 4;
+
+    struct Entry
+    {
+        size_t nSize = 0;
+        void *pBuffer = nullptr;
+    };
+
+    Entry asEntries[CACHE_SIZE]{};
+
+    void *Get(size_t nSize)
+    {
+        for (auto &sEntry : asEntries)
+        {
+            if (sEntry.pBuffer != nullptr && sEntry.nSize == nSize)
+            {
+                void *pRet = sEntry.pBuffer;
+                sEntry.pBuffer = nullptr;
+                return pRet;
+            }
+        }
+        return nullptr;
+    }
+
+    bool Put(void *pBuffer, size_t nSize)
+    {
+        for (auto &sEntry : asEntries)
+        {
+            if (sEntry.pBuffer == nullptr)
+            {
+                sEntry.nSize = nSize;
+                sEntry.pBuffer = pBuffer;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ~GDALThreadBlockBufferCache();
+};
+}  // namespace
+
+static GDALBlockBufferPool goBlockBufferPool;
+static thread_local GDALThreadBlockBufferCache goThreadBlockBufferCache;
+
+GDALThreadBlockBufferCache::~GDALThreadBlockBufferCache()
+{
+    // Return the buffers of an exiting thread to the central pool.
+    for (auto &sEntry : asEntries)
+    {
+        if (sEntry.pBuffer != nullptr)
+        {
+            if (!goBlockBufferPool.Put(sEntry.pBuffer, sEntry.nSize))
+                VSIFreeAligned(sEntry.pBuffer);
+            sEntry.pBuffer = nullptr;
+        }
+    }
+}
+
+/** Allocate a buffer for a block payload, possibly recycling a pooled one. */
+static void *GDALRasterBlockAllocBuffer(size_t nSize)
+{
+    if (goBlockBufferPool.IsEnabled())
+    {
+        void *pBuffer = goThreadBlockBufferCache.Get(nSize);
+        if (pBuffer == nullptr)
+            pBuffer = goBlockBufferPool.Get(nSize);
+        if (pBuffer != nullptr)
+            return pBuffer;
+    }
+    return VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nSize);
+}
+
+/** Release a block payload buffer, keeping it for reuse if pooling is on. */
+static void GDALRasterBlockFreeBuffer(void *pBuffer, size_t nSize)
+{
+    if (pBuffer == nullptr)
+        return;
+    if (goBlockBufferPool.IsEnabled())
+    {
+        if (goThreadBlockBufferCache.Put(pBuffer, nSize))
+            return;
+        if (goBlockBufferPool.Put(pBuffer, nSize))
+            return;
+    }
+    VSIFreeAligned(pBuffer);
+}
 
 // #define ENABLE_DEBUG
 
@@ -219,9 +469,7 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
-            {
-                INITIALIZE_LOCK;
-            }
+            GDALRasterBlockInitShards();
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
 
@@ -374,11 +622,18 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
-    GDALRasterBlock *poTarget;
+    const int nShards = GDALRasterBlockInitShards();
+    static std::atomic<unsigned> nNextFlushShard{0};
+    const unsigned nFirstShard = nNextFlushShard.fetch_add(1);
 
+    GDALRasterBlock *poTarget = nullptr;
+
+    for (int i = 0; i < nShards && poTarget == nullptr; ++i)
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        GDALRasterBlockShard *psShard =
+            &asRBShards[(nFirstShard + i) & static_cast<unsigned>(nShards - 1)];
+        TAKE_SHARD_LOCK(psShard);
+        poTarget = psShard->poOldest;
 
         while (poTarget != nullptr)
         {
@@ -392,7 +647,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            continue;
 #ifndef __COVERITY__
         // Disabled to avoid complains about sleeping under locks, that
         // are only true for debug/testing code
@@ -409,6 +664,9 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         poTarget->GetBand()->UnreferenceBlock(poTarget);
     }
 
+    if (poTarget == nullptr)
+        return FALSE;
+
 #ifndef __COVERITY__
     // Disabled to avoid complains about sleeping under locks, that
     // are only true for debug/testing code
@@ -431,7 +689,8 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
     }
 
-    VSIFreeAligned(poTarget->pData);
+    GDALRasterBlockFreeBuffer(poTarget->pData,
+                              static_cast<size_t>(poTarget->GetBlockSize()));
     poTarget->pData = nullptr;
     poTarget->GetBand()->AddBlockToFreeList(poTarget);
 
@@ -529,12 +788,10 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
     : eType(poBandIn->GetRasterDataType()), nXOff(nXOffIn), nYOff(nYOffIn),
       poBand(poBandIn), bMustDetach(true)
 {
-    if (!hRBLock)
-    {
-        // Needed for scenarios where GDALAllRegister() is called after
-        // GDALDestroyDriverManager()
-        INITIALIZE_LOCK;
-    }
+    // Needed for scenarios where GDALAllRegister() is called after
+    // GDALDestroyDriverManager()
+    const int nShards = GDALRasterBlockInitShards();
+    iShard = GDALRasterBlockComputeShard(poBandIn, nXOffIn, nYOffIn, nShards);
 
     CPLAssert(poBandIn != nullptr);
     poBand->GetBlockSize(&nXSize, &nYSize);
@@ -586,6 +843,8 @@ void GDALRasterBlock::RecycleFor(int nXOffIn, int nYOffIn)
     nXOff = nXOffIn;
     nYOff = nYOffIn;
     bMustDetach = true;
+    iShard = GDALRasterBlockComputeShard(poBand, nXOffIn, nYOffIn,
+                                         GDALRasterBlockInitShards());
 }
 
 /************************************************************************/
@@ -605,7 +864,7 @@ GDALRasterBlock::~GDALRasterBlock()
 
     if (pData != nullptr)
     {
-        VSIFreeAligned(pData);
+        GDALRasterBlockFreeBuffer(pData, static_cast<size_t>(GetBlockSize()));
     }
 
     CPLAssert(nLockCount <= 0);
@@ -648,19 +907,21 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        GDALRasterBlockShard *psShard = &asRBShards[iShard];
+        TAKE_SHARD_LOCK(psShard);
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    GDALRasterBlockShard *psShard = &asRBShards[iShard];
+    if (psShard->poOldest == this)
+        psShard->poOldest = poPrevious;
 
-    if (poNewest == this)
+    if (psShard->poNewest == this)
     {
-        poNewest = poNext;
+        psShard->poNewest = poNext;
     }
 
     if (poPrevious != nullptr)
@@ -694,26 +955,34 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    const int nShards = nRBShardCount.load(std::memory_order_acquire);
+    for (int i = 0; i < nShards; ++i)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        GDALRasterBlockShard *psShard = &asRBShards[i];
+        TAKE_SHARD_LOCK(psShard);
+
+        CPLAssert((psShard->poNewest == nullptr &&
+                   psShard->poOldest == nullptr) ||
+                  (psShard->poNewest != nullptr &&
+                   psShard->poOldest != nullptr));
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        if (psShard->poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(psShard->poNewest->poPrevious == nullptr);
+            CPLAssert(psShard->poOldest->poNext == nullptr);
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock *poLast = nullptr;
+            for (GDALRasterBlock *poBlock = psShard->poNewest;
+                 poBlock != nullptr; poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->poPrevious == poLast);
+                CPLAssert(poBlock->iShard == i);
+
+                poLast = poBlock;
+            }
 
-        CPLAssert(poOldest == poLast);
+            CPLAssert(psShard->poOldest == poLast);
+        }
     }
 }
 
@@ -726,8 +995,11 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+    for (int i = 0; i < nRBShardCount.load(); ++i)
+    {
+    GDALRasterBlockShard *psShard = &asRBShards[i];
+    TAKE_SHARD_LOCK(psShard);
+    for (GDALRasterBlock *poBlock = psShard->poNewest; poBlock != nullptr;
          poBlock = poBlock->poNext)
     {
         if (poBlock->GetBand() == poBand)
@@ -746,6 +1018,7 @@ void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
                        poBand->GetDataset()->GetDescription());
         }
     }
+    }
 }
 #endif
 
@@ -776,6 +1049,8 @@ CPLErr GDALRasterBlock::Write()
 
     if (poBand->eFlushBlockErr == CE_None)
     {
+        if (GDALDataset *poDS = poBand->GetDataset())
+            poDS->IncBlocksWritten();
         int bCallLeaveReadWrite = poBand->EnterReadWrite(GF_Write);
         CPLErr eErr = poBand->IWriteBlock(nXOff, nYOff, pData);
         if (bCallLeaveReadWrite)
@@ -800,32 +1075,57 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    GDALRasterBlockShard *psShard = &asRBShards[iShard];
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (psShard->poNewest == this)
         return;
 
-    TAKE_LOCK;
+    // Batched-touch approximation: when this block is already in the LRU
+    // list and was touched among the last accesses process-wide, its
+    // position is still fresh enough for eviction purposes, and
+    // re-ordering it again would only contend on the shard lock.
+    // Read-mostly workloads hammering a small working set skip nearly all
+    // locked updates. Blocks not yet in the list (null links) always go
+    // through the locked path, which performs the insertion.
+    const bool bSeemsInList = poPrevious != nullptr || poNext != nullptr ||
+                              psShard->poOldest == this;
+    if (bSeemsInList)
+    {
+        static std::atomic<GUInt32> gnTouchClock{0};
+        const GUInt32 nNow =
+            gnTouchClock.fetch_add(1, std::memory_order_relaxed) + 1;
+        constexpr GUInt32 TOUCH_RECENCY_WINDOW = 64;
+        if (nNow - nTouchStamp < TOUCH_RECENCY_WINDOW)
+            return;
+        // Benign race: concurrent writers just store close values.
+        nTouchStamp = nNow;
+    }
+
+    TAKE_SHARD_LOCK(psShard);
     Touch_unlocked();
 }
 
 void GDALRasterBlock::Touch_unlocked()
 
 {
+    GDALRasterBlockShard *psShard = &asRBShards[iShard];
+
     // Could happen even if tested in Touch() before taking the lock
     // Scenario would be :
     // 0. this is the second block (the one pointed by poNewest->poNext)
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    if (psShard->poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+    if (psShard->poOldest == this)
+        psShard->poOldest = this->poPrevious;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -834,19 +1134,19 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = psShard->poNewest;
 
-    if (poNewest != nullptr)
+    if (psShard->poNewest != nullptr)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        CPLAssert(psShard->poNewest->poPrevious == nullptr);
+        psShard->poNewest->poPrevious = this;
     }
-    poNewest = this;
+    psShard->poNewest = this;
 
-    if (poOldest == nullptr)
+    if (psShard->poOldest == nullptr)
     {
         CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        psShard->poOldest = this;
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -875,7 +1175,7 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard locks. Other call places can
     // only be called if we have go through there.
     const GIntBig nCurCacheMax = GDALGetCacheMax64();
 
@@ -888,29 +1188,42 @@ CPLErr GDALRasterBlock::Internalize()
     bool bFirstIter = true;
     bool bLoopAgain = false;
     GDALDataset *poThisDS = poBand->GetDataset();
+    const int nShards = GDALRasterBlockInitShards();
+    static std::atomic<unsigned> nNextEvictShard{0};
     do
     {
         bLoopAgain = false;
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
+
+        if (bFirstIter)
+            nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
+
+        // Evict blocks, scanning the shards round-robin, until we are back
+        // under the cache limit. In a first round over the shards, only
+        // discard clean blocks and dirty blocks of this dataset. We do this
+        // to decrease significantly the likelihood of the following weakness
+        // of the block cache design:
+        // 1. Thread 1 fills block B with ones
+        // 2. Thread 2 evicts this dirty block, while thread 1 almost
+        //    at the same time (but slightly after) tries to reacquire
+        //    this block. As it has been removed from the block cache
+        //    array/set, thread 1 now tries to read block B from disk,
+        //    so gets the old value.
+        unsigned iShardIter = nNextEvictShard.fetch_add(1);
+        int nShardsWithoutCandidate = 0;
+        bool bAllowDirtyOtherDataset = false;
+        while (nCacheUsed > nCurCacheMax)
         {
-            TAKE_LOCK;
+            GDALRasterBlockShard *psShard =
+                &asRBShards[iShardIter & static_cast<unsigned>(nShards - 1)];
+            ++iShardIter;
 
-            if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while (nCacheUsed > nCurCacheMax)
+            GDALRasterBlock *poTarget = nullptr;
             {
+                TAKE_SHARD_LOCK(psShard);
+                poTarget = psShard->poOldest;
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
-                // In this first pass, only discard dirty blocks of this
-                // dataset. We do this to decrease significantly the likelihood
-                // of the following weakness of the block cache design:
-                // 1. Thread 1 fills block B with ones
-                // 2. Thread 2 evicts this dirty block, while thread 1 almost
-                //    at the same time (but slightly after) tries to reacquire
-                //    this block. As it has been removed from the block cache
-                //    array/set, thread 1 now tries to read block B from disk,
-                //    so gets the old value.
                 while (poTarget != nullptr)
                 {
                     if (!poTarget->GetDirty())
@@ -934,7 +1247,8 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     poTarget = poTarget->poPrevious;
                 }
-                if (poTarget == nullptr && poDirtyBlockOtherDataset)
+                if (poTarget == nullptr && bAllowDirtyOtherDataset &&
+                    poDirtyBlockOtherDataset)
                 {
                     if (CPLAtomicCompareAndExchange(
                             &(poDirtyBlockOtherDataset->nLockCount), 0, -1))
@@ -945,7 +1259,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = psShard->poOldest;
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -975,43 +1289,52 @@ CPLErr GDALRasterBlock::Internalize()
                     }
 #endif
 
-                    GDALRasterBlock *_poPrevious = poTarget->poPrevious;
-
                     poTarget->Detach_unlocked();
                     poTarget->GetBand()->UnreferenceBlock(poTarget);
+                }
+            }
 
-                    apoBlocksToFree[nBlocksToFree++] = poTarget;
-                    if (poTarget->GetDirty())
-                    {
-                        // Only free one dirty block at a time so that
-                        // other dirty blocks of other bands with the same
-                        // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
-                        break;
-                    }
-                    if (nBlocksToFree == 64)
+            if (poTarget == nullptr)
+            {
+                ++nShardsWithoutCandidate;
+                if (nShardsWithoutCandidate >= nShards)
+                {
+                    if (!bAllowDirtyOtherDataset)
                     {
-                        bLoopAgain = (nCacheUsed > nCurCacheMax);
-                        break;
+                        // Nothing else to evict: fall back to evicting dirty
+                        // blocks of other datasets in a second round.
+                        bAllowDirtyOtherDataset = true;
+                        nShardsWithoutCandidate = 0;
+                        continue;
                     }
-
-                    poTarget = _poPrevious;
-                }
-                else
-                {
                     break;
                 }
+                continue;
             }
 
-            /* ------------------------------------------------------------------
-             */
-            /*      Add this block to the list. */
-            /* ------------------------------------------------------------------
-             */
-            if (!bLoopAgain)
-                Touch_unlocked();
+            nShardsWithoutCandidate = 0;
+            apoBlocksToFree[nBlocksToFree++] = poTarget;
+            if (poTarget->GetDirty())
+            {
+                // Only free one dirty block at a time so that
+                // other dirty blocks of other bands with the same
+                // coordinates can be found with TryGetLockedBlock()
+                bLoopAgain = nCacheUsed > nCurCacheMax;
+                break;
+            }
+            if (nBlocksToFree == 64)
+            {
+                bLoopAgain = (nCacheUsed > nCurCacheMax);
+                break;
+            }
         }
 
+        /* ---------------------------------------------------------------- */
+        /*      Add this block to the list.                                 */
+        /* ---------------------------------------------------------------- */
+        if (!bLoopAgain)
+            Touch();
+
         bFirstIter = false;
 
         // Now free blocks we have detached and removed from their band.
@@ -1051,7 +1374,9 @@ CPLErr GDALRasterBlock::Internalize()
             }
             else
             {
-                VSIFreeAligned(poBlock->pData);
+                GDALRasterBlockFreeBuffer(
+                    poBlock->pData,
+                    static_cast<size_t>(poBlock->GetBlockSize()));
             }
             poBlock->pData = nullptr;
 
@@ -1061,7 +1386,7 @@ CPLErr GDALRasterBlock::Internalize()
 
     if (pNewData == nullptr)
     {
-        pNewData = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nSizeInBytes);
+        pNewData = GDALRasterBlockAllocBuffer(static_cast<size_t>(nSizeInBytes));
         if (pNewData == nullptr)
         {
             return (CE_Failure);
@@ -1120,9 +1445,21 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    {
+        std::lock_guard<std::mutex> oGuard(oRBShardInitMutex);
+        const int nShards = nRBShardCount.load(std::memory_order_acquire);
+        for (int i = 0; i < nShards; ++i)
+        {
+            if (asRBShards[i].hLock != nullptr)
+                CPLDestroyLock(asRBShards[i].hLock);
+            asRBShards[i].hLock = nullptr;
+        }
+        nRBShardCount.store(0, std::memory_order_release);
+    }
+    // Done outside the above lock: Clear() takes the pool mutex, and the
+    // pool initialization path takes the pool mutex before
+    // oRBShardInitMutex (through GDALGetCacheMax64()).
+    goBlockBufferPool.Clear();
 }
 
 /*! @endcond */
@@ -1205,7 +1542,8 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    GDALRasterBlockShard *psShard = &asRBShards[iShard];
+    TAKE_SHARD_LOCK(psShard);
 
     return FALSE;
 }
@@ -1214,14 +1552,17 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    for( int i = 0; i < nRBShardCount.load(); ++i )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        for( GDALRasterBlock *poBlock = asRBShards[i].poNewest;
+             poBlock != nullptr;
+             poBlock = poBlock->poNext )
+        {
+            printf("Block %d\n", iBlock);/*ok*/
+            poBlock->DumpBlock();
+            printf("\n");/*ok*/
+            iBlock++;
+        }
     }
 }
 
@@ -14,6 +14,7 @@
 
 #include "cpl_mem_cache.h"
 #include "cpl_multiproc.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_proxy.h"
 #include "gdal_rat.h"
 #include "gdal_priv.h"
@@ -269,6 +270,14 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
      */
     const CPLStringList m_aosThreadLocalConfigOptions{};
 
+    /** Pool of clones created eagerly (and in parallel) at wrap time
+     * (GDAL_THREADSAFE_PRECLONE_COUNT), consumed by the first requests of
+     * the worker threads instead of paying one full re-open each. */
+    mutable std::mutex m_oPrecloneMutex{};
+    mutable std::vector<std::shared_ptr<GDALDataset>> m_aoPreclonedDS{};
+
+    void WarmUpClones();
+
     /** Cached value returned by GetSpatialRef() */
     mutable OGRSpatialReference m_oSRS{};
 
@@ -557,6 +566,47 @@ GDALThreadSafeDataset::GDALThreadSafeDataset(
     // dataset, let's increase its reference counter though.
     if (!m_poPrototypeDSUniquePtr)
         const_cast<GDALDataset *>(m_poPrototypeDS)->Reference();
+
+    WarmUpClones();
+}
+
+/************************************************************************/
+/*                          WarmUpClones()                              */
+/************************************************************************/
+
+/** Eagerly creates GDAL_THREADSAFE_PRECLONE_COUNT clones of the
+ * prototype dataset, in parallel, so that the first request of each
+ * worker thread does not pay a (for some formats, very expensive) serial
+ * re-open. */
+void GDALThreadSafeDataset::WarmUpClones()
+{
+    const int nPreclones = std::min(
+        1024,
+        atoi(CPLGetConfigOption("GDAL_THREADSAFE_PRECLONE_COUNT", "0")));
+    if (nPreclones <= 0)
+        return;
+
+    const int nThreads = std::min(nPreclones, CPLGetNumCPUs());
+    CPLWorkerThreadPool oPool;
+    if (!oPool.Setup(nThreads, nullptr, nullptr))
+        return;
+
+    std::mutex oMutex;
+    for (int i = 0; i < nPreclones; ++i)
+    {
+        oPool.SubmitJob(
+            [this, &oMutex]()
+            {
+                auto poClone = m_poPrototypeDS->Clone(GDAL_OF_RASTER,
+                                                      /*bCanShareState=*/true);
+                if (poClone)
+                {
+                    std::lock_guard<std::mutex> oLock(oMutex);
+                    m_aoPreclonedDS.push_back(std::move(poClone));
+                }
+            });
+    }
+    oPool.WaitCompletion();
 }
 
 /************************************************************************/
@@ -780,7 +830,17 @@ GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
     // doing a GDALDataset::Open() call to re-open it. Do that by temporarily
     // dropping the lock that protects poCache->m_oCache.
     oLock.unlock();
-    poTLSDS = m_poPrototypeDS->Clone(GDAL_OF_RASTER, /* bCanShareState=*/true);
+    {
+        std::lock_guard<std::mutex> oPrecloneLock(m_oPrecloneMutex);
+        if (!m_aoPreclonedDS.empty())
+        {
+            poTLSDS = std::move(m_aoPreclonedDS.back());
+            m_aoPreclonedDS.pop_back();
+        }
+    }
+    if (!poTLSDS)
+        poTLSDS =
+            m_poPrototypeDS->Clone(GDAL_OF_RASTER, /* bCanShareState=*/true);
     if (poTLSDS)
     {
         CPLDebug("GDAL", "GDALOpen(%s, this=%p) for thread " CPL_FRMT_GIB,
@@ -12,7 +12,9 @@
  ****************************************************************************/
 
 #include "cpl_float.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_multidim.h"
+#include "gdal_thread_pool.h"
 #include "gdalmultidim_array_unscaled.h"
 #include "gdal_pam.h"
 #include "memmultidim.h"
@@ -1528,6 +1530,32 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
         std::vector<GByte> abyMaskData{};
         GDALProgressFunc pfnProgress = nullptr;
         void *pProgressData = nullptr;
+        // Pipelining: accumulation of the previous chunk runs on a worker
+        // while the next chunk is being read; the worker only touches the
+        // "processing" buffers and the accumulator fields.
+        std::unique_ptr<CPLJobQueue> poQueue{};
+        std::vector<double> adfDataProcessing{};
+        std::vector<GByte> abyMaskDataProcessing{};
+        size_t nValsProcessing = 0;
+
+        void Accumulate()
+        {
+            const double *CPL_RESTRICT padf = adfDataProcessing.data();
+            const GByte *CPL_RESTRICT pabyMask = abyMaskDataProcessing.data();
+            for (size_t i = 0; i < nValsProcessing; i++)
+            {
+                if (pabyMask[i])
+                {
+                    const double dfValue = padf[i];
+                    dfMin = std::min(dfMin, dfValue);
+                    dfMax = std::max(dfMax, dfValue);
+                    nValidCount++;
+                    const double dfDelta = dfValue - dfMean;
+                    dfMean += dfDelta / nValidCount;
+                    dfM2 += dfDelta * (dfValue - dfMean);
+                }
+            }
+        }
     };
 
     const auto PerChunkFunc = [](GDALAbstractMDArray *,
@@ -1543,6 +1571,11 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
         for (size_t i = 0; i < nDims; i++)
             nVals *= chunkCount[i];
 
+        // Wait for the accumulation of the previous chunk before reusing
+        // any buffer.
+        if (data->poQueue)
+            data->poQueue->WaitCompletion();
+
         // Get mask
         data->abyMaskData.resize(nVals);
         if (!(poMask->Read(chunkArrayStartIdx, chunkCount, nullptr, nullptr,
@@ -1577,18 +1610,17 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
                             static_cast<int>(sizeof(double)),
                             static_cast<GPtrDiff_t>(nVals));
         }
-        for (size_t i = 0; i < nVals; i++)
+        std::swap(data->adfData, data->adfDataProcessing);
+        std::swap(data->abyMaskData, data->abyMaskDataProcessing);
+        data->nValsProcessing = nVals;
+        if (data->poQueue)
         {
-            if (data->abyMaskData[i])
-            {
-                const double dfValue = data->adfData[i];
-                data->dfMin = std::min(data->dfMin, dfValue);
-                data->dfMax = std::max(data->dfMax, dfValue);
-                data->nValidCount++;
-                const double dfDelta = dfValue - data->dfMean;
-                data->dfMean += dfDelta / data->nValidCount;
-                data->dfM2 += dfDelta * (dfValue - data->dfMean);
-            }
+            // Overlap the accumulation with the read of the next chunk.
+            data->poQueue->SubmitJob([data]() { data->Accumulate(); });
+        }
+        else
+        {
+            data->Accumulate();
         }
         if (data->pfnProgress &&
             !data->pfnProgress(static_cast<double>(iCurChunk) / nChunkCount, "",
@@ -1635,9 +1667,19 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
     }
     sData.pfnProgress = pfnProgress;
     sData.pProgressData = pProgressData;
-    if (!ProcessPerChunk(arrayStartIdx.data(), count.data(),
-                         GetProcessingChunkSize(nMaxChunkSize).data(),
-                         PerChunkFunc, &sData))
+    if (CPLTestBool(
+            CPLGetConfigOption("GDAL_MDIM_STATS_OVERLAP_READ_COMPUTE", "YES")))
+    {
+        if (auto *poPool = GDALGetGlobalThreadPool(1))
+            sData.poQueue = poPool->CreateJobQueue();
+    }
+    const bool bProcessOK =
+        ProcessPerChunk(arrayStartIdx.data(), count.data(),
+                        GetProcessingChunkSize(nMaxChunkSize).data(),
+                        PerChunkFunc, &sData);
+    if (sData.poQueue)
+        sData.poQueue->WaitCompletion();
+    if (!bProcessOK)
     {
         return false;
     }
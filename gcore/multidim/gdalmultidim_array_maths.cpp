@@ -654,8 +654,10 @@ bool GDALMathOperationMDArray::IRead(const GUInt64 *arrayStartIdx,
 
     if (bFullArrayRequested)
     {
-        m_leftValues.clear();
-        m_rightValues.clear();
+        // Actually release the memory: clear() would keep the capacity,
+        // retaining up to twice the hyperslab size until destruction.
+        std::vector<double>().swap(m_leftValues);
+        std::vector<double>().swap(m_rightValues);
     }
 
     return ret;
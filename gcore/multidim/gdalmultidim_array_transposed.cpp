@@ -11,7 +11,11 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include "cpl_worker_thread_pool.h"
 #include "gdal_multidim.h"
+#include "gdal_thread_pool.h"
+
+#include <atomic>
 #include "gdal_pam_multidim.h"
 #include "ogr_spatialref.h"
 
@@ -202,12 +206,65 @@ static bool TransposeLast2Dims(void *pDstBuffer,
 {
     const size_t nEltsLast2Dims = count[nDims - 2] * count[nDims - 1];
     const auto nDTSize = eDT.GetSize();
+    GByte *const pabyDstBufferBase = static_cast<GByte *>(pDstBuffer);
+
+    /* -------------------------------------------------------------------- */
+    /*      The 2D transposes of the (independent) slices along the non     */
+    /*      last-2 dimensions can run in parallel, each worker with its     */
+    /*      own temporary slice buffer.                                     */
+    /* -------------------------------------------------------------------- */
+    const int nThreads =
+        nEltsNonLast2Dims >= 4 &&
+                nEltsNonLast2Dims * nEltsLast2Dims * nDTSize > 32 * 1024 * 1024
+            ? GDALGetNumThreads(
+                  static_cast<int>(std::min<size_t>(nEltsNonLast2Dims, 16)),
+                  true)
+            : 1;
+    if (nThreads > 1)
+    {
+        auto *poPool = GDALGetGlobalThreadPool(nThreads);
+        if (poPool)
+        {
+            std::atomic<bool> bFailed(false);
+            std::atomic<size_t> nCounter(0);
+            const auto Worker = [&]()
+            {
+                void *pTempBuffer =
+                    VSI_MALLOC2_VERBOSE(nEltsLast2Dims, nDTSize);
+                if (pTempBuffer == nullptr)
+                {
+                    bFailed = true;
+                    return;
+                }
+                while (!bFailed)
+                {
+                    const size_t i = nCounter.fetch_add(1);
+                    if (i >= nEltsNonLast2Dims)
+                        break;
+                    GByte *pabySlice =
+                        pabyDstBufferBase + i * nDTSize * nEltsLast2Dims;
+                    GDALTranspose2D(pabySlice, eDT.GetNumericDataType(),
+                                    pTempBuffer, eDT.GetNumericDataType(),
+                                    count[nDims - 1], count[nDims - 2]);
+                    memcpy(pabySlice, pTempBuffer,
+                           nDTSize * nEltsLast2Dims);
+                }
+                VSIFree(pTempBuffer);
+            };
+            auto poQueue = poPool->CreateJobQueue();
+            for (int i = 0; i < nThreads; ++i)
+                poQueue->SubmitJob(Worker);
+            poQueue->WaitCompletion();
+            return !bFailed;
+        }
+    }
+
     void *pTempBufferForLast2DimsTranspose =
         VSI_MALLOC2_VERBOSE(nEltsLast2Dims, nDTSize);
     if (pTempBufferForLast2DimsTranspose == nullptr)
         return false;
 
-    GByte *pabyDstBuffer = static_cast<GByte *>(pDstBuffer);
+    GByte *pabyDstBuffer = pabyDstBufferBase;
     for (size_t i = 0; i < nEltsNonLast2Dims; ++i)
     {
         GDALTranspose2D(pabyDstBuffer, eDT.GetNumericDataType(),
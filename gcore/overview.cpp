@@ -33,6 +33,7 @@
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_vsi.h"
+#include "cpl_cpu_features.h"
 #include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_thread_pool.h"
@@ -1144,6 +1145,64 @@ static int AverageFloatSSE2(int nDstXWidth, int nChunkXSize,
     return iDstPixel;
 }
 
+/************************************************************************/
+/*                          AverageFloatAVX2()                          */
+/************************************************************************/
+
+#if defined(__x86_64) && defined(__GNUC__) && !defined(__INTEL_COMPILER) &&    \
+    !defined(USE_NEON_OPTIMIZATIONS) && defined(HAVE_AVX2_AT_COMPILE_TIME)
+
+#define HAVE_AVERAGE_FLOAT_AVX2
+
+#include <immintrin.h>
+
+/** AVX2 variant of AverageFloatSSE2(), processing 8 output pixels per
+ * iteration. Runtime-dispatched with CPLHaveRuntimeAVX2(). */
+__attribute__((target("avx2"))) static int
+AverageFloatAVX2(int nDstXWidth, int nChunkXSize,
+                 const float *&CPL_RESTRICT pSrcScanlineShiftedInOut,
+                 float *CPL_RESTRICT pDstScanline)
+{
+    const float *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
+
+    int iDstPixel = 0;
+    const auto zeroDot25 = _mm256_set1_ps(0.25f);
+    constexpr int DEST_ELTS = 8;
+    // After _mm256_hadd_ps() of the two vertical sums, pairs are
+    // interleaved per 128-bit lane: fix up the order with a permutation.
+    const auto reorder = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+
+    for (; iDstPixel < nDstXWidth - (DEST_ELTS - 1); iDstPixel += DEST_ELTS)
+    {
+        // Load 2 * DEST_ELTS Float32 from each line
+        const auto firstLineLo =
+            _mm256_mul_ps(_mm256_loadu_ps(pSrcScanlineShifted), zeroDot25);
+        const auto firstLineHi = _mm256_mul_ps(
+            _mm256_loadu_ps(pSrcScanlineShifted + DEST_ELTS), zeroDot25);
+        const auto secondLineLo = _mm256_mul_ps(
+            _mm256_loadu_ps(pSrcScanlineShifted + nChunkXSize), zeroDot25);
+        const auto secondLineHi = _mm256_mul_ps(
+            _mm256_loadu_ps(pSrcScanlineShifted + DEST_ELTS + nChunkXSize),
+            zeroDot25);
+
+        // Vertical addition
+        const auto tmpLo = _mm256_add_ps(firstLineLo, secondLineLo);
+        const auto tmpHi = _mm256_add_ps(firstLineHi, secondLineHi);
+
+        // Horizontal addition, then lane order fix-up
+        const auto average = _mm256_permutevar8x32_ps(
+            _mm256_hadd_ps(tmpLo, tmpHi), reorder);
+
+        _mm256_storeu_ps(&pDstScanline[iDstPixel], average);
+        pSrcScanlineShifted += DEST_ELTS * 2;
+    }
+
+    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
+    return iDstPixel;
+}
+
+#endif  // AVX2 runtime support
+
 /************************************************************************/
 /*                         AverageDoubleSSE2()                          */
 /************************************************************************/
@@ -1457,9 +1516,20 @@ GDALResampleChunk_AverageOrRMS_T(const GDALOverviewResampleArgs &args,
                         }
                         else
                         {
-                            iDstPixel = AverageFloatSSE2(
-                                nDstXWidth, nChunkXSize, pSrcScanlineShifted,
-                                pDstScanline);
+#ifdef HAVE_AVERAGE_FLOAT_AVX2
+                            if (CPLHaveRuntimeAVX2())
+                            {
+                                iDstPixel = AverageFloatAVX2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
+                            }
+                            else
+#endif
+                            {
+                                iDstPixel = AverageFloatSSE2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
+                            }
                         }
                     }
                     else
@@ -5727,6 +5797,10 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
  *                     options can be specified to express that overviews should
  *                     be regenerated only in the specified subset of the source
  *                     dataset.
+ *                     Alternatively, the WINDOWS option can be set to a
+ *                     semicolon separated list of "xoff,yoff,xsize,ysize"
+ *                     tuples to regenerate only the overview tiles affected
+ *                     by those source windows in a single call.
  * @return CE_None on success or CE_Failure on failure.
  */
 
@@ -5744,6 +5818,48 @@ CPLErr GDALRegenerateOverviewsMultiBand(
     if (EQUAL(pszResampling, "NONE") || nBands == 0 || nOverviews == 0)
         return CE_None;
 
+    /* -------------------------------------------------------------------- */
+    /*      Incremental regeneration over a list of dirty windows: the      */
+    /*      WINDOWS option is a semicolon separated list of                 */
+    /*      "xoff,yoff,xsize,ysize" tuples (source dataset coordinates),    */
+    /*      each processed as an independent subset regeneration.           */
+    /* -------------------------------------------------------------------- */
+    if (const char *pszWindows = CSLFetchNameValue(papszOptions, "WINDOWS"))
+    {
+        const CPLStringList aosWindows(
+            CSLTokenizeString2(pszWindows, ";", 0));
+        CPLStringList aosSubOptions(CSLDuplicate(papszOptions));
+        aosSubOptions.SetNameValue("WINDOWS", nullptr);
+        CPLErr eErr = CE_None;
+        for (int i = 0; eErr == CE_None && i < aosWindows.size(); ++i)
+        {
+            const CPLStringList aosTokens(
+                CSLTokenizeString2(aosWindows[i], ",", 0));
+            if (aosTokens.size() != 4)
+            {
+                CPLError(CE_Failure, CPLE_IllegalArg,
+                         "GDALRegenerateOverviewsMultiBand: invalid window "
+                         "'%s' in WINDOWS option",
+                         aosWindows[i]);
+                return CE_Failure;
+            }
+            aosSubOptions.SetNameValue("XOFF", aosTokens[0]);
+            aosSubOptions.SetNameValue("YOFF", aosTokens[1]);
+            aosSubOptions.SetNameValue("XSIZE", aosTokens[2]);
+            aosSubOptions.SetNameValue("YSIZE", aosTokens[3]);
+            void *pScaledProgress = GDALCreateScaledProgress(
+                static_cast<double>(i) / aosWindows.size(),
+                static_cast<double>(i + 1) / aosWindows.size(), pfnProgress,
+                pProgressData);
+            eErr = GDALRegenerateOverviewsMultiBand(
+                nBands, papoSrcBands, nOverviews, papapoOverviewBands,
+                pszResampling, GDALScaledProgress, pScaledProgress,
+                aosSubOptions.List());
+            GDALDestroyScaledProgress(pScaledProgress);
+        }
+        return eErr;
+    }
+
     // Sanity checks.
     if (!STARTS_WITH_CI(pszResampling, "NEAR") &&
         !EQUAL(pszResampling, "RMS") && !EQUAL(pszResampling, "AVERAGE") &&
@@ -15,6 +15,8 @@
 #include "cpl_port.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "cpl_worker_thread_pool.h"
 
 #include <cassert>
 #include <climits>
@@ -25,6 +27,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
@@ -59,6 +62,10 @@
 #define HAVE_SSE2
 #endif
 
+#ifdef HAVE_AVX512_AT_COMPILE_TIME
+#include "rasterio_avx512.h"
+#endif
+
 #ifdef HAVE_SSSE3_AT_COMPILE_TIME
 #include "rasterio_ssse3.h"
 #ifdef __SSSE3__
@@ -2392,6 +2399,14 @@ CPL_NOINLINE void GDALCopyWordsT(const GByte *const CPL_RESTRICT pSrcData,
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
+#if defined(HAVE_AVX512_AT_COMPILE_TIME) &&                                    \
+    (defined(__x86_64) || defined(_M_X64))
+        if (CPLHaveRuntimeAVX512())
+        {
+            GDALCopyWordsByteToFloat32_AVX512(pSrcData, pDstData, nWordCount);
+            return;
+        }
+#endif
         decltype(nWordCount) n = 0;
         const __m128i xmm_zero = _mm_setzero_si128();
         GByte *CPL_RESTRICT pabyDstDataPtr =
@@ -2443,6 +2458,14 @@ CPL_NOINLINE void GDALCopyWordsT(const GByte *const CPL_RESTRICT pSrcData,
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
+#if defined(HAVE_AVX512_AT_COMPILE_TIME) &&                                    \
+    (defined(__x86_64) || defined(_M_X64))
+        if (CPLHaveRuntimeAVX512())
+        {
+            GDALCopyWordsByteToFloat64_AVX512(pSrcData, pDstData, nWordCount);
+            return;
+        }
+#endif
         decltype(nWordCount) n = 0;
         const __m128i xmm_zero = _mm_setzero_si128();
         GByte *CPL_RESTRICT pabyDstDataPtr =
@@ -2866,6 +2889,15 @@ CPL_NOINLINE void GDALCopyWordsT(const uint16_t *const CPL_RESTRICT pSrcData,
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
+#if defined(HAVE_AVX512_AT_COMPILE_TIME) &&                                    \
+    (defined(__x86_64) || defined(_M_X64))
+        if (CPLHaveRuntimeAVX512())
+        {
+            GDALCopyWordsUInt16ToFloat32_AVX512(pSrcData, pDstData,
+                                                nWordCount);
+            return;
+        }
+#endif
         decltype(nWordCount) n = 0;
         const __m128i xmm_zero = _mm_setzero_si128();
         GByte *CPL_RESTRICT pabyDstDataPtr =
@@ -2948,6 +2980,15 @@ CPL_NOINLINE void GDALCopyWordsT(const uint16_t *const CPL_RESTRICT pSrcData,
     if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
         nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
     {
+#if defined(HAVE_AVX512_AT_COMPILE_TIME) &&                                    \
+    (defined(__x86_64) || defined(_M_X64))
+        if (CPLHaveRuntimeAVX512())
+        {
+            GDALCopyWordsUInt16ToFloat64_AVX512(pSrcData, pDstData,
+                                                nWordCount);
+            return;
+        }
+#endif
         decltype(nWordCount) n = 0;
         const __m128i xmm_zero = _mm_setzero_si128();
         GByte *CPL_RESTRICT pabyDstDataPtr =
@@ -3363,6 +3404,14 @@ CPL_NOINLINE void GDALCopyWordsT(const GFloat16 *const CPL_RESTRICT pSrcData,
                                  float *const CPL_RESTRICT pDstData,
                                  int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+    if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
+        nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
+    {
+        // Hardware (F16C) accelerated when available
+        CPLHalfToFloatArray(reinterpret_cast<const GUInt16 *>(pSrcData),
+                            pDstData, static_cast<size_t>(nWordCount));
+        return;
+    }
     GDALCopyWordsT_8atatime(pSrcData, nSrcPixelStride, pDstData,
                             nDstPixelStride, nWordCount);
 }
@@ -3433,6 +3482,15 @@ CPL_NOINLINE void GDALCopyWordsT(const float *const CPL_RESTRICT pSrcData,
                                  GFloat16 *const CPL_RESTRICT pDstData,
                                  int nDstPixelStride, GPtrDiff_t nWordCount)
 {
+    if (nSrcPixelStride == static_cast<int>(sizeof(*pSrcData)) &&
+        nDstPixelStride == static_cast<int>(sizeof(*pDstData)))
+    {
+        // Hardware (F16C) accelerated when available
+        CPLFloatToHalfArray(pSrcData,
+                            reinterpret_cast<GUInt16 *>(pDstData),
+                            static_cast<size_t>(nWordCount));
+        return;
+    }
     GDALCopyWordsT_8atatime(pSrcData, nSrcPixelStride, pDstData,
                             nDstPixelStride, nWordCount);
 }
@@ -5711,6 +5769,65 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
         return CE_Failure;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Optional read/write pipelining (GDAL_SWATH_PIPELINE=YES):       */
+    /*      the write of the previous swath runs on a single worker job     */
+    /*      while the next swath is being read, with double-buffered swath  */
+    /*      buffers. Writes remain strictly sequential (one queue).         */
+    /* -------------------------------------------------------------------- */
+    void *pSwathBufNext = nullptr;
+    std::unique_ptr<CPLJobQueue> poWriteQueue;
+    std::atomic<bool> bAsyncWriteError(false);
+    if (CPLTestBool(CPLGetConfigOption("GDAL_SWATH_PIPELINE", "NO")))
+    {
+        if (auto *poPool = GDALGetGlobalThreadPool(1))
+        {
+            pSwathBufNext =
+                VSI_MALLOC3_VERBOSE(nSwathCols, nSwathLines, nPixelSize);
+            if (pSwathBufNext)
+                poWriteQueue = poPool->CreateJobQueue();
+        }
+    }
+
+    const auto WriteSwath =
+        [&](int iX, int iY, int nThisCols, int nThisLines, int nBandCountIn,
+            const int *panBands) -> CPLErr
+    {
+        if (!poWriteQueue)
+        {
+            return poDstDS->RasterIO(GF_Write, iX, iY, nThisCols, nThisLines,
+                                     pSwathBuf, nThisCols, nThisLines, eDT,
+                                     nBandCountIn,
+                                     const_cast<int *>(panBands), 0, 0, 0,
+                                     nullptr);
+        }
+        poWriteQueue->WaitCompletion();
+        if (bAsyncWriteError)
+            return CE_Failure;
+        std::swap(pSwathBuf, pSwathBufNext);
+        void *const pWriteBuf = pSwathBufNext;
+        std::vector<int> anBands;
+        if (panBands)
+            anBands.assign(panBands, panBands + nBandCountIn);
+        poWriteQueue->SubmitJob(
+            [&bAsyncWriteError, poDstDS, iX, iY, nThisCols, nThisLines,
+             pWriteBuf, eDT, nBandCountIn, anBands = std::move(anBands)]()
+            {
+                if (!bAsyncWriteError &&
+                    poDstDS->RasterIO(GF_Write, iX, iY, nThisCols, nThisLines,
+                                      pWriteBuf, nThisCols, nThisLines, eDT,
+                                      nBandCountIn,
+                                      anBands.empty()
+                                          ? nullptr
+                                          : const_cast<int *>(anBands.data()),
+                                      0, 0, 0, nullptr) != CE_None)
+                {
+                    bAsyncWriteError = true;
+                }
+            });
+        return CE_None;
+    };
+
     CPLDebug("GDAL",
              "GDALDatasetCopyWholeRaster(): %d*%d swaths, bInterleave=%d",
              nSwathCols, nSwathLines, static_cast<int>(bInterleave));
@@ -5785,10 +5902,8 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
                         GDALDestroyScaledProgress(sExtraArg.pProgressData);
 
                         if (eErr == CE_None)
-                            eErr = poDstDS->RasterIO(
-                                GF_Write, iX, iY, nThisCols, nThisLines,
-                                pSwathBuf, nThisCols, nThisLines, eDT, 1,
-                                &nBand, 0, 0, 0, nullptr);
+                            eErr = WriteSwath(iX, iY, nThisCols, nThisLines, 1,
+                                              &nBand);
                     }
 
                     nBlocksDone++;
@@ -5866,10 +5981,8 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
                     GDALDestroyScaledProgress(sExtraArg.pProgressData);
 
                     if (eErr == CE_None)
-                        eErr = poDstDS->RasterIO(
-                            GF_Write, iX, iY, nThisCols, nThisLines, pSwathBuf,
-                            nThisCols, nThisLines, eDT, nBandCount, nullptr, 0,
-                            0, 0, nullptr);
+                        eErr = WriteSwath(iX, iY, nThisCols, nThisLines,
+                                          nBandCount, nullptr);
                 }
 
                 nBlocksDone++;
@@ -5889,7 +6002,14 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     /* -------------------------------------------------------------------- */
     /*      Cleanup                                                         */
     /* -------------------------------------------------------------------- */
+    if (poWriteQueue)
+    {
+        poWriteQueue->WaitCompletion();
+        if (bAsyncWriteError && eErr == CE_None)
+            eErr = CE_Failure;
+    }
     CPLFree(pSwathBuf);
+    CPLFree(pSwathBufNext);
 
     return eErr;
 }
@@ -6749,6 +6869,15 @@ void GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
                     static_cast<GByte *>(ppDestBuffer[2]);
                 GByte *CPL_RESTRICT pabyDest3 =
                     static_cast<GByte *>(ppDestBuffer[3]);
+#if defined(HAVE_AVX512_AT_COMPILE_TIME) &&                                    \
+    (defined(__x86_64) || defined(_M_X64))
+                if (CPLHaveRuntimeAVX512())
+                {
+                    GDALDeinterleave4Byte_AVX512(pabySrc, pabyDest0, pabyDest1,
+                                                 pabyDest2, pabyDest3, nIters);
+                    return;
+                }
+#endif
                 GDALDeinterleave4Byte(pabySrc, pabyDest0, pabyDest1, pabyDest2,
                                       pabyDest3, nIters);
                 return;
@@ -6809,6 +6938,63 @@ void GDALDeinterleave(const void *pSourceBuffer, GDALDataType eSourceDT,
     }
 }
 
+/************************************************************************/
+/*                          GDALInterleave()                            */
+/************************************************************************/
+
+/*! Copy values from multiple per-component buffers to a pixel-interleave
+    buffer.
+
+    In pseudo-code
+    \verbatim
+    for(size_t i = 0; i < nIters; ++i)
+        for(int iComp = 0; iComp < nComponents; iComp++ )
+            pDestBuffer[nComponents * i + iComp] = ppSourceBuffer[iComp][i]
+    \endverbatim
+
+    This is the reverse operation of GDALDeinterleave(). When the source
+    buffers are contiguous in memory (as is the case after a
+    GDALDeinterleave() in a single allocation), the implementation goes
+    through GDALTranspose2D(), which has SIMD optimizations for several
+    data types.
+
+    \since GDAL 3.14
+ */
+void GDALInterleave(const void *const *ppSourceBuffer, GDALDataType eSourceDT,
+                    int nComponents, void *pDestBuffer, GDALDataType eDestDT,
+                    size_t nIters)
+{
+    const int nSourceDTSize = GDALGetDataTypeSizeBytes(eSourceDT);
+    const int nDestDTSize = GDALGetDataTypeSizeBytes(eDestDT);
+
+    bool bContiguousSource = true;
+    for (int iComp = 0; iComp + 1 < nComponents; iComp++)
+    {
+        if (static_cast<const GByte *>(ppSourceBuffer[iComp]) +
+                nIters * nSourceDTSize !=
+            static_cast<const GByte *>(ppSourceBuffer[iComp + 1]))
+        {
+            bContiguousSource = false;
+            break;
+        }
+    }
+    if (bContiguousSource && nComponents > 0)
+    {
+        // Interleaving a nComponents x nIters planar matrix is transposing it.
+        GDALTranspose2D(ppSourceBuffer[0], eSourceDT, pDestBuffer, eDestDT,
+                        nIters, nComponents);
+        return;
+    }
+
+    for (int iComp = 0; iComp < nComponents; iComp++)
+    {
+        GDALCopyWords64(
+            ppSourceBuffer[iComp], eSourceDT, nSourceDTSize,
+            static_cast<GByte *>(pDestBuffer) + iComp * nDestDTSize, eDestDT,
+            nComponents * nDestDTSize, nIters);
+    }
+}
+
 /************************************************************************/
 /*                   GDALTranspose2DSingleToSingle()                    */
 /************************************************************************/
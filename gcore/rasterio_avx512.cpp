@@ -0,0 +1,170 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX-512 specializations
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX512_AT_COMPILE_TIME) &&                                    \
+    (defined(__x86_64) || defined(_M_X64))
+
+#include "rasterio_avx512.h"
+
+#include <immintrin.h>
+
+/************************************************************************/
+/*                 GDALCopyWordsByteToFloat32_AVX512()                  */
+/************************************************************************/
+
+void GDALCopyWordsByteToFloat32_AVX512(const GByte *CPL_RESTRICT pSrc,
+                                       float *CPL_RESTRICT pDst,
+                                       GPtrDiff_t nWordCount)
+{
+    decltype(nWordCount) n = 0;
+    for (; n + 16 <= nWordCount; n += 16)
+    {
+        const __m128i xmm =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSrc + n));
+        _mm512_storeu_ps(pDst + n,
+                         _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(xmm)));
+    }
+    if (n < nWordCount)
+    {
+        const __mmask16 mask =
+            static_cast<__mmask16>((1U << (nWordCount - n)) - 1);
+        const __m128i xmm = _mm_maskz_loadu_epi8(mask, pSrc + n);
+        _mm512_mask_storeu_ps(pDst + n, mask,
+                              _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(xmm)));
+    }
+}
+
+/************************************************************************/
+/*                 GDALCopyWordsByteToFloat64_AVX512()                  */
+/************************************************************************/
+
+void GDALCopyWordsByteToFloat64_AVX512(const GByte *CPL_RESTRICT pSrc,
+                                       double *CPL_RESTRICT pDst,
+                                       GPtrDiff_t nWordCount)
+{
+    decltype(nWordCount) n = 0;
+    for (; n + 8 <= nWordCount; n += 8)
+    {
+        const __m128i xmm =
+            _mm_loadu_si64(reinterpret_cast<const void *>(pSrc + n));
+        _mm512_storeu_pd(pDst + n,
+                         _mm512_cvtepi32_pd(_mm256_cvtepu8_epi32(xmm)));
+    }
+    if (n < nWordCount)
+    {
+        const __mmask8 mask =
+            static_cast<__mmask8>((1U << (nWordCount - n)) - 1);
+        const __m128i xmm = _mm_maskz_loadu_epi8(mask, pSrc + n);
+        _mm512_mask_storeu_pd(pDst + n, mask,
+                              _mm512_cvtepi32_pd(_mm256_cvtepu8_epi32(xmm)));
+    }
+}
+
+/************************************************************************/
+/*                GDALCopyWordsUInt16ToFloat32_AVX512()                 */
+/************************************************************************/
+
+void GDALCopyWordsUInt16ToFloat32_AVX512(const GUInt16 *CPL_RESTRICT pSrc,
+                                         float *CPL_RESTRICT pDst,
+                                         GPtrDiff_t nWordCount)
+{
+    decltype(nWordCount) n = 0;
+    for (; n + 16 <= nWordCount; n += 16)
+    {
+        const __m256i ymm =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pSrc + n));
+        _mm512_storeu_ps(pDst + n,
+                         _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(ymm)));
+    }
+    if (n < nWordCount)
+    {
+        const __mmask16 mask =
+            static_cast<__mmask16>((1U << (nWordCount - n)) - 1);
+        const __m256i ymm = _mm256_maskz_loadu_epi16(mask, pSrc + n);
+        _mm512_mask_storeu_ps(pDst + n, mask,
+                              _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(ymm)));
+    }
+}
+
+/************************************************************************/
+/*                GDALCopyWordsUInt16ToFloat64_AVX512()                 */
+/************************************************************************/
+
+void GDALCopyWordsUInt16ToFloat64_AVX512(const GUInt16 *CPL_RESTRICT pSrc,
+                                         double *CPL_RESTRICT pDst,
+                                         GPtrDiff_t nWordCount)
+{
+    decltype(nWordCount) n = 0;
+    for (; n + 8 <= nWordCount; n += 8)
+    {
+        const __m128i xmm =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSrc + n));
+        _mm512_storeu_pd(pDst + n,
+                         _mm512_cvtepi32_pd(_mm256_cvtepu16_epi32(xmm)));
+    }
+    if (n < nWordCount)
+    {
+        const __mmask8 mask =
+            static_cast<__mmask8>((1U << (nWordCount - n)) - 1);
+        const __m128i xmm = _mm_maskz_loadu_epi16(mask, pSrc + n);
+        _mm512_mask_storeu_pd(pDst + n, mask,
+                              _mm512_cvtepi32_pd(_mm256_cvtepu16_epi32(xmm)));
+    }
+}
+
+/************************************************************************/
+/*                  GDALDeinterleave4Byte_AVX512()                      */
+/************************************************************************/
+
+void GDALDeinterleave4Byte_AVX512(const GByte *CPL_RESTRICT pabySrc,
+                                  GByte *CPL_RESTRICT pabyDest0,
+                                  GByte *CPL_RESTRICT pabyDest1,
+                                  GByte *CPL_RESTRICT pabyDest2,
+                                  GByte *CPL_RESTRICT pabyDest3, size_t nIters)
+{
+    // Gather the bytes of each component in each 128-bit lane...
+    const __m512i zmm_shuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+    // ... then gather the per-lane dwords of each component together.
+    const __m512i zmm_permute =
+        _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    size_t i = 0;
+    for (; i + 16 <= nIters; i += 16)
+    {
+        const __m512i zmm = _mm512_loadu_si512(
+            reinterpret_cast<const void *>(pabySrc + 4 * i));
+        const __m512i zmm_deinterleaved = _mm512_permutexvar_epi32(
+            zmm_permute, _mm512_shuffle_epi8(zmm, zmm_shuffle));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyDest0 + i),
+                         _mm512_castsi512_si128(zmm_deinterleaved));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyDest1 + i),
+                         _mm512_extracti32x4_epi32(zmm_deinterleaved, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyDest2 + i),
+                         _mm512_extracti32x4_epi32(zmm_deinterleaved, 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyDest3 + i),
+                         _mm512_extracti32x4_epi32(zmm_deinterleaved, 3));
+    }
+#if defined(__clang__)
+#pragma clang loop vectorize(disable)
+#endif
+    for (; i < nIters; ++i)
+    {
+        pabyDest0[i] = pabySrc[4 * i];
+        pabyDest1[i] = pabySrc[4 * i + 1];
+        pabyDest2[i] = pabySrc[4 * i + 2];
+        pabyDest3[i] = pabySrc[4 * i + 3];
+    }
+}
+
+#endif  // HAVE_AVX512_AT_COMPILE_TIME
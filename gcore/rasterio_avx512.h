@@ -0,0 +1,49 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX-512 specializations
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef RASTERIO_AVX512_H_INCLUDED
+#define RASTERIO_AVX512_H_INCLUDED
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX512_AT_COMPILE_TIME) &&                                    \
+    (defined(__x86_64) || defined(_M_X64))
+
+/* Conversion of contiguous (pixel stride == element size) buffers between
+ * the hottest GDALCopyWords64() type pairs. The remainder of the buffer is
+ * handled with masked loads/stores, so there is no scalar tail loop. */
+
+void GDALCopyWordsByteToFloat32_AVX512(const GByte *CPL_RESTRICT pSrc,
+                                       float *CPL_RESTRICT pDst,
+                                       GPtrDiff_t nWordCount);
+
+void GDALCopyWordsByteToFloat64_AVX512(const GByte *CPL_RESTRICT pSrc,
+                                       double *CPL_RESTRICT pDst,
+                                       GPtrDiff_t nWordCount);
+
+void GDALCopyWordsUInt16ToFloat32_AVX512(const GUInt16 *CPL_RESTRICT pSrc,
+                                         float *CPL_RESTRICT pDst,
+                                         GPtrDiff_t nWordCount);
+
+void GDALCopyWordsUInt16ToFloat64_AVX512(const GUInt16 *CPL_RESTRICT pSrc,
+                                         double *CPL_RESTRICT pDst,
+                                         GPtrDiff_t nWordCount);
+
+void GDALDeinterleave4Byte_AVX512(const GByte *CPL_RESTRICT pabySrc,
+                                  GByte *CPL_RESTRICT pabyDest0,
+                                  GByte *CPL_RESTRICT pabyDest1,
+                                  GByte *CPL_RESTRICT pabyDest2,
+                                  GByte *CPL_RESTRICT pabyDest3, size_t nIters);
+
+#endif  // HAVE_AVX512_AT_COMPILE_TIME
+
+#endif  // RASTERIO_AVX512_H_INCLUDED
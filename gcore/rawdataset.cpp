@@ -1155,7 +1155,8 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             if (pabyData == nullptr)
                 return CE_Failure;
 
-            for (int iLine = 0; iLine < nBufYSize; iLine++)
+            const auto ComputeLineOffset =
+                [this, nXOff, nYOff, dfSrcYInc](int iLine)
             {
                 const vsi_l_offset nLine =
                     static_cast<vsi_l_offset>(nYOff) +
@@ -1169,13 +1170,94 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     nOffset += nXOff * static_cast<vsi_l_offset>(nPixelOffset);
                 else
                     nOffset -= nXOff * static_cast<vsi_l_offset>(-nPixelOffset);
-                AccessBlock(nOffset, nBytesToRW, pabyData, nXSize);
+                return nOffset;
+            };
+
+            // When several scanlines are needed, gather their file ranges
+            // through a single ReadMultiRange() request per batch, so that
+            // the VSI layer can merge adjacent ranges and issue them
+            // concurrently (e.g. on /vsicurl/), instead of one Seek()+Read()
+            // pair per line. Restricted to nBufYSize <= nYSize so that each
+            // buffer line maps to a distinct source line.
+            constexpr size_t nMaxGatherBytes = 10 * 1024 * 1024;
+            int nLinesPerBatch = 1;
+            GByte *pabyGather = nullptr;
+            if (nBufYSize > 1 && nBufYSize <= nYSize && nLineOffset > 0 &&
+                nPixelOffset > 0 && nBytesToRW <= nMaxGatherBytes / 2)
+            {
+                nLinesPerBatch = std::min(
+                    nBufYSize, static_cast<int>(nMaxGatherBytes / nBytesToRW));
+                if (nLinesPerBatch > 1)
+                    pabyGather = static_cast<GByte *>(
+                        VSIMalloc(nLinesPerBatch * nBytesToRW));
+            }
+            bool bUseGather = pabyGather != nullptr;
+            int nGatherStart = 0;
+            int nGatherCount = 0;
+            std::vector<void *> apGatherData;
+            std::vector<vsi_l_offset> anGatherOffsets;
+            std::vector<size_t> anGatherSizes;
+
+            for (int iLine = 0; iLine < nBufYSize; iLine++)
+            {
+                const GByte *pabyLine = pabyData;
+                bool bLineGathered = false;
+
+                if (bUseGather)
+                {
+                    if (iLine >= nGatherStart + nGatherCount)
+                    {
+                        nGatherStart = iLine;
+                        nGatherCount =
+                            std::min(nLinesPerBatch, nBufYSize - iLine);
+                        apGatherData.clear();
+                        anGatherOffsets.clear();
+                        anGatherSizes.clear();
+                        for (int i = 0; i < nGatherCount; i++)
+                        {
+                            apGatherData.push_back(
+                                pabyGather +
+                                static_cast<size_t>(i) * nBytesToRW);
+                            anGatherOffsets.push_back(
+                                ComputeLineOffset(nGatherStart + i));
+                            anGatherSizes.push_back(nBytesToRW);
+                        }
+                        if (VSIFReadMultiRangeL(
+                                nGatherCount, apGatherData.data(),
+                                anGatherOffsets.data(), anGatherSizes.data(),
+                                fpRawL) != 0)
+                        {
+                            // Fall back to per-line AccessBlock() for the
+                            // rest of the request, which also deals with
+                            // truncated files.
+                            bUseGather = false;
+                            nGatherCount = 0;
+                        }
+                        else if (NeedsByteOrderChange())
+                        {
+                            for (int i = 0; i < nGatherCount; i++)
+                                DoByteSwap(apGatherData[i], nXSize,
+                                           std::abs(nPixelOffset), true);
+                        }
+                    }
+                    if (bUseGather)
+                    {
+                        pabyLine = pabyGather +
+                                   static_cast<size_t>(iLine - nGatherStart) *
+                                       nBytesToRW;
+                        bLineGathered = true;
+                    }
+                }
+
+                if (!bLineGathered)
+                    AccessBlock(ComputeLineOffset(iLine), nBytesToRW, pabyData,
+                                nXSize);
                 // Copy data from disk buffer to user block buffer and
                 // subsample, if needed.
                 if (nXSize == nBufXSize && nYSize == nBufYSize)
                 {
                     GDALCopyWords64(
-                        pabyData, eDataType, nPixelOffset,
+                        pabyLine, eDataType, nPixelOffset,
                         static_cast<GByte *>(pData) + iLine * nLineSpace,
                         eBufType, static_cast<int>(nPixelSpace), nXSize);
                 }
@@ -1184,7 +1266,7 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     for (int iPixel = 0; iPixel < nBufXSize; iPixel++)
                     {
                         GDALCopyWords64(
-                            pabyData + static_cast<vsi_l_offset>(
+                            pabyLine + static_cast<vsi_l_offset>(
                                            iPixel * dfSrcXInc + EPS) *
                                            nPixelOffset,
                             eDataType, nPixelOffset,
@@ -1199,11 +1281,13 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                              psExtraArg->pProgressData))
                 {
                     CPLFree(pabyData);
+                    VSIFree(pabyGather);
                     return CE_Failure;
                 }
             }
 
             CPLFree(pabyData);
+            VSIFree(pabyGather);
         }
     }
     // Write data.
@@ -1668,6 +1752,105 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                 }
             }
         }
+        // BIP source with band-separated destination: read each scanline
+        // once and unpack it with GDALDeinterleave(), which has SIMD fast
+        // paths for the common 3/4 band Byte and UInt16 cases, rather than
+        // reading the file once per band.
+        if (!bCanDirectAccessToBIPDataset && eRWFlag == GF_Read &&
+            nBandCount == nBands && nBands >= 2)
+        {
+            RawRasterBand *poBIPBand =
+                dynamic_cast<RawRasterBand *>(GetRasterBand(1));
+            bool bCanDeinterleave = poBIPBand != nullptr;
+            const auto eDT = bCanDeinterleave ? poBIPBand->GetRasterDataType()
+                                              : GDT_Unknown;
+            const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+            bCanDeinterleave =
+                bCanDeinterleave && eBufType == eDT && nPixelSpace == nDTSize &&
+                poBIPBand->nLineOffset > 0 &&
+                poBIPBand->nPixelOffset ==
+                    cpl::fits_on<int>(nBands * nDTSize) &&
+                nXSize <= std::numeric_limits<size_t>::max() /
+                              poBIPBand->nPixelOffset;
+            for (int iBandIndex = 0; bCanDeinterleave && iBandIndex < nBands;
+                 iBandIndex++)
+            {
+                RawRasterBand *poBand = dynamic_cast<RawRasterBand *>(
+                    GetRasterBand(panBandMap[iBandIndex]));
+                bCanDeinterleave =
+                    poBand != nullptr && panBandMap[iBandIndex] ==
+                                             iBandIndex + 1 &&
+                    !poBand->bNeedFileFlush && !poBand->bLoadedScanlineDirty &&
+                    !poBand->HasDirtyBlocks() &&
+                    poBand->GetRasterDataType() == eDT &&
+                    poBand->fpRawL == poBIPBand->fpRawL &&
+                    poBand->nImgOffset ==
+                        poBIPBand->nImgOffset +
+                            cpl::fits_on<int>(iBandIndex * nDTSize) &&
+                    poBand->nPixelOffset == poBIPBand->nPixelOffset &&
+                    poBand->nLineOffset == poBIPBand->nLineOffset &&
+                    poBand->eByteOrder == poBIPBand->eByteOrder;
+            }
+            if (bCanDeinterleave)
+            {
+                const size_t nLineBytes =
+                    static_cast<size_t>(nXSize) * poBIPBand->nPixelOffset;
+                GByte *pabyLine =
+                    static_cast<GByte *>(VSI_MALLOC_VERBOSE(nLineBytes));
+                if (pabyLine != nullptr)
+                {
+                    CPLDebugOnly("GDALRaw", "Deinterleaved access to "
+                                            "BIP dataset");
+                    const bool bNeedsByteOrderChange =
+                        poBIPBand->NeedsByteOrderChange();
+                    std::vector<void *> apDest(nBands);
+                    CPLErr eErr = CE_None;
+                    for (int iY = 0; iY < nYSize && eErr == CE_None; ++iY)
+                    {
+                        if (VSIFSeekL(
+                                poBIPBand->fpRawL,
+                                poBIPBand->nImgOffset +
+                                    static_cast<vsi_l_offset>(nYOff + iY) *
+                                        poBIPBand->nLineOffset +
+                                    static_cast<vsi_l_offset>(nXOff) *
+                                        poBIPBand->nPixelOffset,
+                                SEEK_SET) != 0 ||
+                            VSIFReadL(pabyLine, nLineBytes, 1,
+                                      poBIPBand->fpRawL) != 1)
+                        {
+                            CPLError(CE_Failure, CPLE_FileIO,
+                                     "Failed to read scanline %d", nYOff + iY);
+                            eErr = CE_Failure;
+                            break;
+                        }
+                        if (bNeedsByteOrderChange)
+                        {
+                            poBIPBand->DoByteSwap(
+                                pabyLine, static_cast<size_t>(nXSize) * nBands,
+                                nDTSize, true);
+                        }
+                        for (int iBand = 0; iBand < nBands; ++iBand)
+                        {
+                            apDest[iBand] = static_cast<GByte *>(pData) +
+                                            iBand * nBandSpace +
+                                            iY * nLineSpace;
+                        }
+                        GDALDeinterleave(pabyLine, eDT, nBands, apDest.data(),
+                                         eDT, static_cast<size_t>(nXSize));
+                        if (psExtraArg->pfnProgress != nullptr &&
+                            !psExtraArg->pfnProgress(1.0 * (iY + 1) / nYSize,
+                                                     "",
+                                                     psExtraArg->pProgressData))
+                        {
+                            eErr = CE_Failure;
+                        }
+                    }
+                    CPLFree(pabyLine);
+                    return eErr;
+                }
+            }
+        }
+
         if (bCanDirectAccessToBIPDataset)
         {
             CPLDebugOnly("GDALRaw", "Direct access to BIP dataset");
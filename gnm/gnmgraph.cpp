@@ -29,6 +29,9 @@
  ****************************************************************************/
 
 #include "gnmgraph.h"
+
+#include <unordered_map>
+#include <unordered_set>
 #include "gnm_priv.h"
 #include <algorithm>
 #include <limits>
@@ -458,21 +461,24 @@ void GNMGraph::DijkstraShortestPathTree(
     GNMGFID nFID, const std::map<GNMGFID, GNMStdEdge> &mstEdges,
     std::map<GNMGFID, GNMGFID> &mnPathTree)
 {
-    // Initialize all vertices in graph with infinity mark.
-    double dfInfinity = std::numeric_limits<double>::infinity();
-
-    std::map<GNMGFID, double> mMarks;
-    std::map<GNMGFID, GNMStdVertex>::iterator itv;
-    for (itv = m_mstVertices.begin(); itv != m_mstVertices.end(); ++itv)
+    const double dfInfinity = std::numeric_limits<double>::infinity();
+
+    // Sparse cost marks: a vertex absent from the map has an infinity
+    // mark. This avoids a full O(V) initialization pass per query, which
+    // dominated short routes on large networks.
+    std::unordered_map<GNMGFID, double> mMarks;
+    mMarks.reserve(64);
+    const auto GetMark = [&mMarks, dfInfinity](GNMGFID nVertId)
     {
-        mMarks[itv->first] = dfInfinity;
-    }
+        const auto oIter = mMarks.find(nVertId);
+        return oIter != mMarks.end() ? oIter->second : dfInfinity;
+    };
 
     mMarks[nFID] = 0.0;
     mnPathTree[nFID] = -1;
 
     // Initialize all vertices as unseen (there are no seen vertices).
-    std::set<GNMGFID> snSeen;
+    std::unordered_set<GNMGFID> snSeen;
 
     // We use multimap to maintain the ascending order of costs and because
     // there can be different vertices with the equal cost.
@@ -525,7 +531,7 @@ void GNMGraph::DijkstraShortestPathTree(
 
             // Update mark of the vertex if needed.
             if (snSeen.find(nTargetVertId) == snSeen.end() &&
-                dfNewVertexMark < mMarks[nTargetVertId] &&
+                dfNewVertexMark < GetMark(nTargetVertId) &&
                 !CheckVertexBlocked(nTargetVertId))
             {
                 mMarks[nTargetVertId] = dfNewVertexMark;
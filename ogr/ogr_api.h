@@ -357,6 +357,13 @@ int CPL_DLL OGRPreparedGeometryIntersects(OGRPreparedGeometryH hPreparedGeom,
 int CPL_DLL OGRPreparedGeometryContains(OGRPreparedGeometryH hPreparedGeom,
                                         OGRGeometryH hOtherGeom);
 
+int CPL_DLL OGRPreparedGeometryIntersectsXYBulk(
+    OGRPreparedGeometryH hPreparedGeom, const double *padfX,
+    const double *padfY, size_t nCount, GByte *pabyResult);
+int CPL_DLL OGRPreparedGeometryContainsXYBulk(
+    OGRPreparedGeometryH hPreparedGeom, const double *padfX,
+    const double *padfY, size_t nCount, GByte *pabyResult);
+
 /* -------------------------------------------------------------------- */
 /*      Feature related (ogr_feature.h)                                 */
 /* -------------------------------------------------------------------- */
@@ -22,6 +22,9 @@
 
 #include <cstddef>
 
+#include <mutex>
+#include <new>
+
 #include <exception>
 #include <memory>
 #include <string>
@@ -533,6 +536,10 @@ class CPL_DLL OGRFeatureDefn
     friend class TemporaryUnsealer;
     bool m_bSealed = false;
     int m_nTemporaryUnsealCount = 0;
+
+    bool m_bFeatureRecycling = false;
+    std::mutex m_oRecycledFeatureMutex{};
+    std::vector<OGRFeature *> m_apoRecycledFeatures{};
     //! @endcond
 
   public:
@@ -895,6 +902,16 @@ class CPL_DLL OGRFeatureDefn
 
     //! @cond Doxygen_Suppress
     void ReserveSpaceForFields(int nFieldCountIn);
+
+    void SetFeatureRecyclingEnabled(bool bEnabled);
+
+    bool IsFeatureRecyclingEnabled() const
+    {
+        return m_bFeatureRecycling;
+    }
+
+    OGRFeature *GetRecycledFeature();
+    bool RecycleFeature(OGRFeature *poFeature);
     //! @endcond
 
     std::vector<int> ComputeMapForSetFrom(const OGRFeatureDefn *poSrcFDefn,
@@ -1062,6 +1079,13 @@ class CPL_DLL OGRFeature
     explicit OGRFeature(const OGRFeatureDefn *);
     virtual ~OGRFeature();
 
+    //! @cond Doxygen_Suppress
+    static void *operator new(size_t nSize);
+    static void *operator new(size_t nSize, const std::nothrow_t &) noexcept;
+    static void operator delete(void *pData) noexcept;
+    static void operator delete(void *pData, const std::nothrow_t &) noexcept;
+    //! @endcond
+
     /** Field value. */
     class CPL_DLL FieldValue
     {
@@ -1244,6 +1244,61 @@ void OGRWKBTransformCache::clear()
 }
 #endif
 
+/************************************************************************/
+/*                        OGRWKBSwapDoubles()                           */
+/************************************************************************/
+
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER) &&                         \
+    (defined(__x86_64) || defined(__i386__))
+
+#define OGR_WKB_HAS_SSSE3_RUNTIME
+#include <immintrin.h>
+
+static bool OGRWKBHasSSSE3()
+{
+    static const bool bHasSSSE3 = __builtin_cpu_supports("ssse3");
+    return bHasSSSE3;
+}
+
+__attribute__((target("ssse3"))) static void
+OGRWKBSwapDoublesSSSE3(GByte *pabyData, size_t nCount)
+{
+    // Reverses the bytes of each 64-bit lane.
+    const __m128i xmmShuffle =
+        _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+    size_t i = 0;
+    for (; i + 2 <= nCount; i += 2)
+    {
+        __m128i xmm = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(pabyData + 8 * i));
+        xmm = _mm_shuffle_epi8(xmm, xmmShuffle);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyData + 8 * i), xmm);
+    }
+    if (i < nCount)
+        CPL_SWAP64PTR(pabyData + 8 * i);
+}
+
+#endif  // SSSE3 runtime support
+
+/** Byte-swap an array of 64-bit words (typically WKB coordinates), using
+ * SIMD when available at run time. pData does not need to be aligned.
+ */
+void OGRWKBSwapDoubles(void *pData, size_t nCount)
+{
+    GByte *pabyData = static_cast<GByte *>(pData);
+#ifdef OGR_WKB_HAS_SSSE3_RUNTIME
+    if (nCount >= 4 && OGRWKBHasSSSE3())
+    {
+        OGRWKBSwapDoublesSSSE3(pabyData, nCount);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        CPL_SWAP64PTR(pabyData + 8 * i);
+    }
+}
+
 /************************************************************************/
 /*                          OGRWKBTransform()                           */
 /************************************************************************/
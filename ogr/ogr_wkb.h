@@ -90,6 +90,8 @@ bool CPL_DLL OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
                              OGRWKBTransformCache &oCache,
                              OGREnvelope3D &sEnvelope);
 
+void CPL_DLL OGRWKBSwapDoubles(void *pData, size_t nCount);
+
 /************************************************************************/
 /*                           OGRAppendBuffer                            */
 /************************************************************************/
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <cmath>
 #include <cstring>
 #include <limits>
@@ -72,6 +73,8 @@ static void CPLGettimeofday(struct CPLTimeVal *tp, void * /* timezonep*/)
 
 // Cache of OGRProjCT objects
 static std::mutex g_oCTCacheMutex;
+static uint64_t g_nCTCacheHits = 0;
+static uint64_t g_nCTCacheMisses = 0;
 class OGRProjCT;
 typedef std::string CTCacheKey;
 typedef std::unique_ptr<OGRProjCT> CTCacheValue;
@@ -3733,6 +3736,16 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
 void OSRCTCleanCache()
 {
     std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
+    if (g_poCTCache != nullptr && (g_nCTCacheHits || g_nCTCacheMisses))
+    {
+        CPLDebug("OGRCT",
+                 "Coordinate transformation cache: " CPL_FRMT_GUIB
+                 " hits, " CPL_FRMT_GUIB " misses",
+                 static_cast<GUIntBig>(g_nCTCacheHits),
+                 static_cast<GUIntBig>(g_nCTCacheMisses));
+    }
+    g_nCTCacheHits = 0;
+    g_nCTCacheMisses = 0;
     delete g_poCTCache;
     g_poCTCache = nullptr;
 }
@@ -3781,7 +3794,13 @@ void OGRProjCT::InsertIntoCache(OGRProjCT *poCT)
         std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
         if (g_poCTCache == nullptr)
         {
-            g_poCTCache = new lru11::Cache<CTCacheKey, CTCacheValue>();
+            // Sized so that process-wide workloads cycling through many
+            // CRS pairs (e.g. ogr2ogr fleets) do not evict and rebuild
+            // PROJ pipelines constantly.
+            const int nCacheSize = std::max(
+                1, atoi(CPLGetConfigOption("OSR_CT_CACHE_SIZE", "256")));
+            g_poCTCache = new lru11::Cache<CTCacheKey, CTCacheValue>(
+                static_cast<size_t>(nCacheSize));
         }
     }
     const auto key = MakeCacheKey(poCT->poSRSSource, poCT->m_osSrcSRS.c_str(),
@@ -3809,7 +3828,10 @@ OGRProjCT *OGRProjCT::FindFromCache(
     {
         std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
         if (g_poCTCache == nullptr || g_poCTCache->empty())
+        {
+            g_nCTCacheMisses++;
             return nullptr;
+        }
     }
 
     const auto key =
@@ -3821,8 +3843,10 @@ OGRProjCT *OGRProjCT::FindFromCache(
     {
         auto poCT = cachedValue->release();
         g_poCTCache->remove(key);
+        g_nCTCacheHits++;
         return poCT;
     }
+    g_nCTCacheMisses++;
     return nullptr;
 }
 
@@ -28,6 +28,7 @@
 #include <limits>
 #include <map>
 #include <new>
+#include <typeinfo>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -211,7 +212,7 @@ OGRFeature::~OGRFeature()
 void OGR_F_Destroy(OGRFeatureH hFeat)
 
 {
-    delete OGRFeature::FromHandle(hFeat);
+    OGRFeature::DestroyFeature(OGRFeature::FromHandle(hFeat));
 }
 
 /************************************************************************/
@@ -237,7 +238,12 @@ void OGR_F_Destroy(OGRFeatureH hFeat)
 OGRFeature *OGRFeature::CreateFeature(const OGRFeatureDefn *poDefn)
 
 {
-    OGRFeature *poFeature = new (std::nothrow) OGRFeature(poDefn);
+    OGRFeature *poFeature =
+        const_cast<OGRFeatureDefn *>(poDefn)->GetRecycledFeature();
+    if (poFeature != nullptr)
+        return poFeature;
+
+    poFeature = new (std::nothrow) OGRFeature(poDefn);
     if (poFeature == nullptr)
         return nullptr;
 
@@ -274,9 +280,107 @@ OGRFeature *OGRFeature::CreateFeature(const OGRFeatureDefn *poDefn)
 void OGRFeature::DestroyFeature(OGRFeature *poFeature)
 
 {
+    // Subclassed features (e.g. TABFeature) carry state that Reset() does
+    // not know about, so only plain OGRFeature instances are recycled.
+    if (poFeature != nullptr &&
+        poFeature->poDefn->IsFeatureRecyclingEnabled() &&
+        typeid(*poFeature) == typeid(OGRFeature) &&
+        const_cast<OGRFeatureDefn *>(poFeature->poDefn)
+            ->RecycleFeature(poFeature))
+        return;
     delete poFeature;
 }
 
+/************************************************************************/
+/*                      operator new() / delete()                       */
+/*                                                                      */
+/*      Optional thread-local free list of feature-sized blocks, so     */
+/*      that the tight new/delete cycle of GetNextFeature() loops       */
+/*      stops hitting the system allocator.  Opt-in through the         */
+/*      OGR_FEATURE_ALLOC_POOL configuration option.                    */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+// -1: not initialized yet, 0: disabled, 1: enabled
+static int gnFeatureAllocPoolEnabled = -1;
+
+namespace
+{
+struct OGRFeatureBlockPool
+{
+    std::vector<void *> apBlocks{};
+
+    ~OGRFeatureBlockPool()
+    {
+        for (void *pBlock : apBlocks)
+            VSIFree(pBlock);
+    }
+};
+}  // namespace
+
+static thread_local OGRFeatureBlockPool goFeatureBlockPool;
+
+static bool OGRFeatureAllocPoolEnabled()
+{
+    if (gnFeatureAllocPoolEnabled < 0)
+    {
+        gnFeatureAllocPoolEnabled =
+            CPLTestBool(
+                CPLGetConfigOption("OGR_FEATURE_ALLOC_POOL", "NO"))
+                ? 1
+                : 0;
+    }
+    return gnFeatureAllocPoolEnabled == 1;
+}
+
+void *OGRFeature::operator new(size_t nSize)
+{
+    void *pData = operator new(nSize, std::nothrow);
+    if (pData == nullptr)
+        throw std::bad_alloc();
+    return pData;
+}
+
+void *OGRFeature::operator new(size_t nSize, const std::nothrow_t &) noexcept
+{
+    // Only blocks of exactly sizeof(OGRFeature) are pooled, so that
+    // derived classes go through the regular allocator.
+    if (nSize == sizeof(OGRFeature) && OGRFeatureAllocPoolEnabled() &&
+        !goFeatureBlockPool.apBlocks.empty())
+    {
+        void *pData = goFeatureBlockPool.apBlocks.back();
+        goFeatureBlockPool.apBlocks.pop_back();
+        return pData;
+    }
+    return VSIMalloc(nSize);
+}
+
+void OGRFeature::operator delete(void *pData) noexcept
+{
+    if (pData == nullptr)
+        return;
+    constexpr size_t MAX_POOLED_BLOCKS = 256;
+    // There is no portable way of knowing here whether the block was
+    // allocated for a derived class, so pool it unconditionally: blocks
+    // are handed out again only for exactly sizeof(OGRFeature) requests,
+    // and a larger block satisfies those too.
+    if (OGRFeatureAllocPoolEnabled() &&
+        goFeatureBlockPool.apBlocks.size() < MAX_POOLED_BLOCKS)
+    {
+        goFeatureBlockPool.apBlocks.push_back(pData);
+        return;
+    }
+    VSIFree(pData);
+}
+
+void OGRFeature::operator delete(void *pData, const std::nothrow_t &) noexcept
+{
+    operator delete(pData);
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                               Reset()                                */
 /************************************************************************/
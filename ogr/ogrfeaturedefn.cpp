@@ -126,13 +126,100 @@ void OGRFeatureDefn::Release()
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #endif
-    if (Dereference() <= 0)
+    const int nRef = Dereference();
+    if (nRef <= 0)
+    {
         delete this;
+    }
+    else if (m_bFeatureRecycling)
+    {
+        // If the only remaining references are the ones held by the
+        // recycled features, drain the pool, otherwise it would keep this
+        // definition (and itself) alive forever.
+        std::vector<OGRFeature *> apoToDelete;
+        {
+            std::lock_guard<std::mutex> oLock(m_oRecycledFeatureMutex);
+            if (nRef == static_cast<int>(m_apoRecycledFeatures.size()))
+                apoToDelete.swap(m_apoRecycledFeatures);
+        }
+        // The last deletion may destroy this object: do not touch members
+        // beyond this point.
+        for (OGRFeature *poFeature : apoToDelete)
+            delete poFeature;
+    }
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
 }
 
+/************************************************************************/
+/*                    SetFeatureRecyclingEnabled()                      */
+/************************************************************************/
+
+/** Enable or disable the recycling of destroyed features.
+ *
+ * When enabled, OGRFeature::DestroyFeature() resets features and parks them
+ * in a pool owned by this definition instead of deleting them, and
+ * OGRFeature::CreateFeature() hands them out again, saving the allocation
+ * of the feature, of its field array and of its geometry array in bulk
+ * read loops. Disabling drains the pool.
+ */
+void OGRFeatureDefn::SetFeatureRecyclingEnabled(bool bEnabled)
+{
+    std::vector<OGRFeature *> apoToDelete;
+    {
+        std::lock_guard<std::mutex> oLock(m_oRecycledFeatureMutex);
+        m_bFeatureRecycling = bEnabled;
+        if (!bEnabled)
+            apoToDelete.swap(m_apoRecycledFeatures);
+    }
+    for (OGRFeature *poFeature : apoToDelete)
+        delete poFeature;
+}
+
+/************************************************************************/
+/*                        GetRecycledFeature()                          */
+/************************************************************************/
+
+/** Returns a previously recycled feature of this definition, in its
+ * after-construction state, or nullptr when the pool is empty or
+ * recycling is not enabled.
+ */
+OGRFeature *OGRFeatureDefn::GetRecycledFeature()
+{
+    if (!m_bFeatureRecycling)
+        return nullptr;
+    std::lock_guard<std::mutex> oLock(m_oRecycledFeatureMutex);
+    if (m_apoRecycledFeatures.empty())
+        return nullptr;
+    OGRFeature *poFeature = m_apoRecycledFeatures.back();
+    m_apoRecycledFeatures.pop_back();
+    return poFeature;
+}
+
+/************************************************************************/
+/*                          RecycleFeature()                            */
+/************************************************************************/
+
+/** Resets poFeature and parks it in the recycling pool. Returns false,
+ * without taking ownership, when recycling is disabled or the pool is
+ * full, in which case the caller must delete the feature.
+ */
+bool OGRFeatureDefn::RecycleFeature(OGRFeature *poFeature)
+{
+    constexpr size_t MAX_RECYCLED_FEATURES = 64;
+
+    if (!m_bFeatureRecycling || poFeature == nullptr)
+        return false;
+    poFeature->Reset();
+    std::lock_guard<std::mutex> oLock(m_oRecycledFeatureMutex);
+    if (!m_bFeatureRecycling ||
+        m_apoRecycledFeatures.size() >= MAX_RECYCLED_FEATURES)
+        return false;
+    m_apoRecycledFeatures.push_back(poFeature);
+    return true;
+}
+
 /************************************************************************/
 /*                           OGR_FD_Release()                           */
 /************************************************************************/
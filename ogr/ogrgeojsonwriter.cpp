@@ -31,6 +31,7 @@
 #include "ogr_api.h"
 
 #include <algorithm>
+#include <memory>
 #include <cmath>
 #include <cstdint>
 #include <limits>
@@ -771,7 +772,13 @@ json_object *OGRGeoJSONWriteFeature(OGRFeature *poFeature,
     OGRGeometry *poGeometry = poFeature->GetGeometryRef();
     if (nullptr != poGeometry)
     {
-        poObjGeom = OGRGeoJSONWriteGeometry(poGeometry, oOptions);
+        // When no native geometry will be patched into the output, the
+        // coordinates arrays can be serialized directly as text.
+        OGRGeoJSONWriteOptions oOptionsGeom(oOptions);
+        oOptionsGeom.bAllowDirectCoordinateOutput =
+            poNativeGeom == nullptr ||
+            !oOptions.bCanPatchCoordinatesWithNativeData;
+        poObjGeom = OGRGeoJSONWriteGeometry(poGeometry, oOptionsGeom);
 
         if (bWriteBBOX && !poGeometry->IsEmpty())
         {
@@ -1566,9 +1573,159 @@ json_object *OGRGeoJSONWriteCoords(double dfX, double dfY,
 /*                      OGRGeoJSONWriteLineCoords                       */
 /************************************************************************/
 
+/************************************************************************/
+/*                    Direct line-coordinates serializer                */
+/************************************************************************/
+
+/** Userdata of the direct serializer: a flat copy of the coordinates and
+ * the formatting settings. */
+namespace
+{
+struct GeoJSONLineCoordsData
+{
+    std::vector<double> adfCoords{};
+    int nDims = 2;
+    int nXYPrecision = -1;
+    int nZPrecision = -1;
+};
+}  // namespace
+
+static void OGRGeoJSONLineCoordsFree(json_object *jso, void *pUserData)
+{
+    (void)jso;
+    delete static_cast<GeoJSONLineCoordsData *>(pUserData);
+}
+
+/** Emits "[[x,y],[x,y],...]" with each number formatted exactly like the
+ * per-double serializers, and without any whitespace, matching the
+ * JSON_C_TO_STRING_PLAIN output of the equivalent json-c array tree. */
+static int OGRGeoJSONLineCoordsToString(json_object *jso, struct printbuf *pb,
+                                        int /*level*/, int flags)
+{
+    const GeoJSONLineCoordsData *psData =
+#if (!defined(JSON_C_VERSION_NUM)) || (JSON_C_VERSION_NUM < JSON_C_VER_013)
+        static_cast<const GeoJSONLineCoordsData *>(jso->_userdata);
+#else
+        static_cast<const GeoJSONLineCoordsData *>(
+            json_object_get_userdata(jso));
+#endif
+    // Only the compact form is emitted directly; other styles (spaced,
+    // pretty) go through a transient json-c array for exact formatting.
+    if ((flags &
+         ~(JSON_C_TO_STRING_PLAIN
+#ifdef JSON_C_TO_STRING_NOSLASHESCAPE
+           | JSON_C_TO_STRING_NOSLASHESCAPE
+#endif
+           )) != 0)
+    {
+        json_object *poArray = json_object_new_array();
+        size_t iCoord = 0;
+        const size_t nPointCount =
+            psData->adfCoords.size() / psData->nDims;
+        for (size_t iPt = 0; iPt < nPointCount; ++iPt)
+        {
+            json_object *poPoint = json_object_new_array();
+            for (int iDim = 0; iDim < psData->nDims; ++iDim, ++iCoord)
+            {
+                json_object_array_add(
+                    poPoint,
+                    json_object_new_double_with_precision(
+                        psData->adfCoords[iCoord],
+                        iDim < 2 ? psData->nXYPrecision
+                                 : psData->nZPrecision));
+            }
+            json_object_array_add(poArray, poPoint);
+        }
+        const char *pszStr = json_object_to_json_string_ext(poArray, flags);
+        const int nRet =
+            printbuf_memappend(pb, pszStr, static_cast<int>(strlen(pszStr)));
+        json_object_put(poArray);
+        return nRet;
+    }
+
+    std::string osBuf;
+    osBuf.reserve(psData->adfCoords.size() * 20 + 2);
+    osBuf += '[';
+    const size_t nPoints = psData->adfCoords.size() / psData->nDims;
+    size_t i = 0;
+    for (size_t iPt = 0; iPt < nPoints; ++iPt)
+    {
+        if (iPt > 0)
+            osBuf += ',';
+        osBuf += '[';
+        for (int iDim = 0; iDim < psData->nDims; ++iDim, ++i)
+        {
+            if (iDim > 0)
+                osBuf += ',';
+            osBuf += OGRJSONFormatDoubleWithPrecision(
+                psData->adfCoords[i],
+                iDim < 2 ? psData->nXYPrecision : psData->nZPrecision);
+        }
+        osBuf += ']';
+    }
+    osBuf += ']';
+    return printbuf_memappend(pb, osBuf.data(), static_cast<int>(osBuf.size()));
+}
+
 json_object *OGRGeoJSONWriteLineCoords(const OGRSimpleCurve *poLine,
                                        const OGRGeoJSONWriteOptions &oOptions)
 {
+    /* ---------------------------------------------------------------- */
+    /*      Fast path: serialize the whole coordinates array of the     */
+    /*      line/ring through a single custom-serialized object,        */
+    /*      instead of building 3 json-c objects per point. Only taken  */
+    /*      for the precision-based formatting (the default), whose     */
+    /*      output it replicates byte for byte.                         */
+    /* ---------------------------------------------------------------- */
+    const bool bHasZFast = poLine->Is3D();
+    const bool bHasMFast = oOptions.bAllowMeasure && poLine->IsMeasured();
+    if (oOptions.bAllowDirectCoordinateOutput && !bHasMFast &&
+        (oOptions.nXYCoordPrecision >= 0 || oOptions.nSignificantFigures < 0) &&
+        (!bHasZFast || oOptions.nZCoordPrecision >= 0 ||
+         oOptions.nSignificantFigures < 0))
+    {
+        const int nCount0 = poLine->getNumPoints();
+        bool bAllFinite = true;
+        auto poData = std::make_unique<GeoJSONLineCoordsData>();
+        poData->nDims = bHasZFast ? 3 : 2;
+        poData->nXYPrecision = oOptions.nXYCoordPrecision;
+        poData->nZPrecision = oOptions.nZCoordPrecision;
+        try
+        {
+            poData->adfCoords.reserve(static_cast<size_t>(nCount0) *
+                                      poData->nDims);
+        }
+        catch (const std::exception &)
+        {
+            return nullptr;
+        }
+        for (int i = 0; i < nCount0 && bAllFinite; ++i)
+        {
+            const double dfX = poLine->getX(i);
+            const double dfY = poLine->getY(i);
+            bAllFinite = std::isfinite(dfX) && std::isfinite(dfY);
+            poData->adfCoords.push_back(dfX);
+            poData->adfCoords.push_back(dfY);
+            if (bHasZFast)
+            {
+                const double dfZ = poLine->getZ(i);
+                bAllFinite = bAllFinite && std::isfinite(dfZ);
+                poData->adfCoords.push_back(dfZ);
+            }
+        }
+        if (bAllFinite)
+        {
+            json_object *poObj = json_object_new_object();
+            json_object_set_serializer(poObj, OGRGeoJSONLineCoordsToString,
+                                       poData.release(),
+                                       OGRGeoJSONLineCoordsFree);
+            return poObj;
+        }
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Infinite or NaN coordinate encountered");
+        return nullptr;
+    }
+
     json_object *poObjCoords = json_object_new_array();
 
     const int nCount = poLine->getNumPoints();
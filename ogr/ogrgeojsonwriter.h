@@ -39,6 +39,10 @@ class CPL_DLL OGRGeoJSONWriteOptions
     int nSignificantFigures = -1;
     bool bPolygonRightHandRule = false;
     bool bCanPatchCoordinatesWithNativeData = true;
+    //! Internal: set per feature when its coordinates arrays may be
+    //! serialized directly as text (no native-data patching will inspect
+    //! them)
+    bool bAllowDirectCoordinateOutput = false;
     bool bHonourReservedRFC7946Members = false;
     CPLString osIDField{};
     bool bForceIDFieldType = false;
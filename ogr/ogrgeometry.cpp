@@ -7680,6 +7680,110 @@ int OGRPreparedGeometryContains(const OGRPreparedGeometryH hPreparedGeom,
 #endif
 }
 
+/************************************************************************/
+/*                 OGRPreparedGeometryPredicateXYBulk()                 */
+/************************************************************************/
+
+#if defined(HAVE_GEOS)
+static bool OGRPreparedGeometryPredicateXYBulk(
+    const OGRPreparedGeometryH hPreparedGeom, const double *padfX,
+    const double *padfY, size_t nCount, GByte *pabyResult,
+    char (*pfnPredicate)(GEOSContextHandle_t, const GEOSPreparedGeometry *,
+                         const GEOSGeometry *))
+{
+    if (hPreparedGeom == nullptr || padfX == nullptr || padfY == nullptr ||
+        pabyResult == nullptr)
+        return false;
+    GEOSContextHandle_t hGEOSCtxt = hPreparedGeom->hGEOSCtxt;
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        GEOSGeom hGEOSPoint =
+            GEOSGeom_createPointFromXY_r(hGEOSCtxt, padfX[i], padfY[i]);
+        if (hGEOSPoint == nullptr)
+            return false;
+        pabyResult[i] = pfnPredicate(hGEOSCtxt,
+                                     hPreparedGeom->poPreparedGEOSGeom,
+                                     hGEOSPoint) == 1;
+        GEOSGeom_destroy_r(hGEOSCtxt, hGEOSPoint);
+    }
+    return true;
+}
+#endif
+
+/************************************************************************/
+/*                OGRPreparedGeometryIntersectsXYBulk()                 */
+/************************************************************************/
+
+/** Evaluates whether each point of a coordinate batch intersects a
+ * prepared geometry.
+ *
+ * Much faster than converting each point to an OGRGeometry and calling
+ * OGRPreparedGeometryIntersects() on it.
+ *
+ * @param hPreparedGeom prepared geometry.
+ * @param padfX array of nCount X coordinates.
+ * @param padfY array of nCount Y coordinates.
+ * @param nCount number of points.
+ * @param pabyResult array of nCount bytes, set to 1 (intersects) or 0.
+ * @return TRUE on success, FALSE if an error occurred (in which case
+ * pabyResult is undefined).
+ * @since GDAL 3.14
+ */
+int OGRPreparedGeometryIntersectsXYBulk(
+    const OGRPreparedGeometryH hPreparedGeom, const double *padfX,
+    const double *padfY, size_t nCount, GByte *pabyResult)
+{
+#if defined(HAVE_GEOS)
+    return OGRPreparedGeometryPredicateXYBulk(hPreparedGeom, padfX, padfY,
+                                              nCount, pabyResult,
+                                              GEOSPreparedIntersects_r);
+#else
+    (void)hPreparedGeom;
+    (void)padfX;
+    (void)padfY;
+    (void)nCount;
+    (void)pabyResult;
+    return FALSE;
+#endif
+}
+
+/************************************************************************/
+/*                 OGRPreparedGeometryContainsXYBulk()                  */
+/************************************************************************/
+
+/** Evaluates whether each point of a coordinate batch is contained in a
+ * prepared geometry.
+ *
+ * Much faster than converting each point to an OGRGeometry and calling
+ * OGRPreparedGeometryContains() on it.
+ *
+ * @param hPreparedGeom prepared geometry.
+ * @param padfX array of nCount X coordinates.
+ * @param padfY array of nCount Y coordinates.
+ * @param nCount number of points.
+ * @param pabyResult array of nCount bytes, set to 1 (contained) or 0.
+ * @return TRUE on success, FALSE if an error occurred (in which case
+ * pabyResult is undefined).
+ * @since GDAL 3.14
+ */
+int OGRPreparedGeometryContainsXYBulk(
+    const OGRPreparedGeometryH hPreparedGeom, const double *padfX,
+    const double *padfY, size_t nCount, GByte *pabyResult)
+{
+#if defined(HAVE_GEOS)
+    return OGRPreparedGeometryPredicateXYBulk(hPreparedGeom, padfX, padfY,
+                                              nCount, pabyResult,
+                                              GEOSPreparedContains_r);
+#else
+    (void)hPreparedGeom;
+    (void)padfX;
+    (void)padfY;
+    (void)nCount;
+    (void)pabyResult;
+    return FALSE;
+#endif
+}
+
 /************************************************************************/
 /*                        OGRGeometryFromEWKB()                         */
 /************************************************************************/
@@ -14,6 +14,7 @@
 
 #include "cpl_port.h"
 #include "cpl_quad_tree.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -32,6 +33,7 @@
 
 #include "ogrgeojsongeometry.h"
 
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <cmath>
@@ -2351,20 +2353,20 @@ std::unique_ptr<OGRGeometry> OGRGeometryFactory::organizePolygons(
 
     size_t nCountTopLevel = 1;
 
-    // STEP 2.
-    for (size_t i = 1;
-         !bMixedUpGeometries && bValidTopology && i < asPolyEx.size(); i++)
-    {
-        auto &thisPoly = asPolyEx[i];
+    /* STEP 2 is done in two phases: first find, for each polygon, the
+       smallest polygon geometrically containing it. This is a read-only
+       computation that is parallelized over a thread pool for large
+       assemblies. Then derive the top-level flags from the enclosure
+       links; that depends on the status of the enclosing polygon, and is
+       thus done sequentially, in descending area order. */
 
-        if (method == METHOD_ONLY_CCW && thisPoly.bIsCW)
-        {
-            nCountTopLevel++;
-            thisPoly.bIsTopLevel = true;
-            thisPoly.poEnclosingPolygon = nullptr;
-            continue;
-        }
+    // Smallest enclosing polygon of each polygon of asPolyEx, or nullptr.
+    std::vector<const sPolyExtended *> apsEnclosing(asPolyEx.size(), nullptr);
 
+    const auto FindSmallestEnclosingPolygon =
+        [&asPolyEx, &poQuadTree, method, bUseFastVersion,
+         &bValidTopology](sPolyExtended &thisPoly) -> const sPolyExtended *
+    {
         // Look for candidate rings that intersect the current ring
         CPLRectObj aoi;
         aoi.minx = thisPoly.sEnvelope.MinX;
@@ -2522,22 +2524,7 @@ std::unique_ptr<OGRGeometry> OGRGeometryFactory::organizePolygons(
 
             if (thisInsideOther)
             {
-                if (otherPoly.bIsTopLevel)
-                {
-                    // We are a lake.
-                    thisPoly.bIsTopLevel = false;
-                    thisPoly.poEnclosingPolygon =
-                        otherPoly.poCurvePolygon.get();
-                }
-                else
-                {
-                    // We are included in a something not toplevel (a lake),
-                    // so in OGCSF we are considered as toplevel too.
-                    nCountTopLevel++;
-                    thisPoly.bIsTopLevel = true;
-                    thisPoly.poEnclosingPolygon = nullptr;
-                }
-                break;
+                return &otherPoly;
             }
             // Use Overlaps instead of Intersects to be more
             // tolerant about touching polygons.
@@ -2557,23 +2544,94 @@ std::unique_ptr<OGRGeometry> OGRGeometryFactory::organizePolygons(
                 char *wkt2 = nullptr;
                 thisPoly.poCurvePolygon->exportToWkt(&wkt1);
                 otherPoly.poCurvePolygon->exportToWkt(&wkt2);
+                const int realI = static_cast<int>(&thisPoly - &asPolyEx[0]);
                 const int realJ = static_cast<int>(&otherPoly - &asPolyEx[0]);
                 CPLDebug("OGR",
                          "Bad intersection for polygons %d and %d\n"
                          "geom %d: %s\n"
                          "geom %d: %s",
-                         static_cast<int>(i), realJ, static_cast<int>(i), wkt1,
-                         realJ, wkt2);
+                         realI, realJ, realI, wkt1, realJ, wkt2);
                 CPLFree(wkt1);
                 CPLFree(wkt2);
 #endif
             }
         }
 
-        if (j == nCandidates)
+        // Not included in anything.
+        return nullptr;
+    };
+
+    bool bParallelized = false;
+    if (!bMixedUpGeometries && bUseFastVersion && asPolyEx.size() >= 100)
+    {
+        // Only the fast version may run concurrently: its tests are pure
+        // C++ point-in-ring computations, while the GEOS based one can
+        // flag broken topologies with side effects.
+        const int nThreads =
+            std::min(static_cast<int>(asPolyEx.size() / 16), CPLGetNumCPUs());
+        CPLWorkerThreadPool oPool;
+        if (nThreads >= 2 && oPool.Setup(nThreads, nullptr, nullptr))
+        {
+            std::atomic<size_t> nCounter(1);
+            const auto Worker =
+                [&asPolyEx, &apsEnclosing, &nCounter, method,
+                 &FindSmallestEnclosingPolygon]()
+            {
+                while (true)
+                {
+                    const size_t i = nCounter.fetch_add(1);
+                    if (i >= asPolyEx.size())
+                        break;
+                    auto &thisPoly = asPolyEx[i];
+                    if (method == METHOD_ONLY_CCW && thisPoly.bIsCW)
+                        continue;
+                    apsEnclosing[i] = FindSmallestEnclosingPolygon(thisPoly);
+                }
+            };
+            for (int iThread = 0; iThread < nThreads; ++iThread)
+                oPool.SubmitJob(Worker);
+            oPool.WaitCompletion();
+            bParallelized = true;
+        }
+    }
+
+    if (!bParallelized && !bMixedUpGeometries)
+    {
+        for (size_t i = 1; bValidTopology && i < asPolyEx.size(); i++)
+        {
+            auto &thisPoly = asPolyEx[i];
+            if (method == METHOD_ONLY_CCW && thisPoly.bIsCW)
+                continue;
+            apsEnclosing[i] = FindSmallestEnclosingPolygon(thisPoly);
+        }
+    }
+
+    // STEP 2, phase 2: derive top-level flags from the enclosure links.
+    for (size_t i = 1;
+         !bMixedUpGeometries && bValidTopology && i < asPolyEx.size(); i++)
+    {
+        auto &thisPoly = asPolyEx[i];
+
+        if (method == METHOD_ONLY_CCW && thisPoly.bIsCW)
         {
-            // We come here because we are not included in anything.
-            // We are toplevel.
+            nCountTopLevel++;
+            thisPoly.bIsTopLevel = true;
+            thisPoly.poEnclosingPolygon = nullptr;
+            continue;
+        }
+
+        const sPolyExtended *psEnclosing = apsEnclosing[i];
+        if (psEnclosing != nullptr && psEnclosing->bIsTopLevel)
+        {
+            // We are a lake.
+            thisPoly.bIsTopLevel = false;
+            thisPoly.poEnclosingPolygon = psEnclosing->poCurvePolygon.get();
+        }
+        else
+        {
+            // Either we are not included in anything, or we are included
+            // in something not toplevel (a lake): in OGCSF we are
+            // considered as toplevel in both cases.
             nCountTopLevel++;
             thisPoly.bIsTopLevel = true;
             thisPoly.poEnclosingPolygon = nullptr;
@@ -5940,10 +5998,30 @@ static void OGRGeometryFactoryStrokeArc(OGRLineString *poLine, double cx,
     dfStep = nSign * fabs((alpha1 - alpha0) / nSteps);
     double alpha = alpha0 + dfStep;
 
+    // Evaluate the vertices with an incremental rotation rather than one
+    // cos()+sin() pair per vertex, re-synchronizing with the true values
+    // every 256 steps so that accumulated rounding stays below a few ulps.
+    const double dfCosStep = cos(dfStep);
+    const double dfSinStep = sin(dfStep);
+    double dfCosAlpha = cos(alpha);
+    double dfSinAlpha = sin(alpha);
+    int nIterSinceSync = 0;
+
     for (; (alpha - alpha1) * nSign < -1e-8; alpha += dfStep)
     {
-        const double dfX = cx + R * cos(alpha);
-        const double dfY = cy + R * sin(alpha);
+        if (nIterSinceSync == 256)
+        {
+            dfCosAlpha = cos(alpha);
+            dfSinAlpha = sin(alpha);
+            nIterSinceSync = 0;
+        }
+        ++nIterSinceSync;
+        const double dfX = cx + R * dfCosAlpha;
+        const double dfY = cy + R * dfSinAlpha;
+        const double dfNewCosAlpha =
+            dfCosAlpha * dfCosStep - dfSinAlpha * dfSinStep;
+        dfSinAlpha = dfSinAlpha * dfCosStep + dfCosAlpha * dfSinStep;
+        dfCosAlpha = dfNewCosAlpha;
         if (bHasZ)
         {
             const double z =
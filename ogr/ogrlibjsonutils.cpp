@@ -121,6 +121,23 @@ json_object *OGRGeoJSONFindMemberByName(json_object *poObj, const char *pszName)
 /*              OGR_json_double_with_precision_to_string()              */
 /************************************************************************/
 
+/** Formats a double exactly like the serializer installed by
+ * json_object_new_double_with_precision(), so that callers emitting JSON
+ * text directly produce byte-identical output. */
+std::string OGRJSONFormatDoubleWithPrecision(double dfVal, int nPrecisionIn)
+{
+    if (fabs(dfVal) > 1e50 && !std::isinf(dfVal))
+    {
+        char szBuffer[75] = {};
+        CPLsnprintf(szBuffer, sizeof(szBuffer), "%.17g", dfVal);
+        return szBuffer;
+    }
+    const int nPrecision = nPrecisionIn < 0 ? 15 : nPrecisionIn;
+    OGRWktOptions opts(nPrecision, /* round = */ true);
+    opts.format = OGRWktFormat::F;
+    return OGRFormatDouble(dfVal, opts, 1);
+}
+
 static int OGR_json_double_with_precision_to_string(struct json_object *jso,
                                                     struct printbuf *pb,
                                                     int /* level */,
@@ -134,27 +151,12 @@ static int OGR_json_double_with_precision_to_string(struct json_object *jso,
 #endif
     // Precision is stored as a uintptr_t content casted to void*
     const uintptr_t nPrecisionIn = reinterpret_cast<uintptr_t>(userData);
-    const double dfVal = json_object_get_double(jso);
-    if (fabs(dfVal) > 1e50 && !std::isinf(dfVal))
-    {
-        char szBuffer[75] = {};
-        const size_t nLen =
-            CPLsnprintf(szBuffer, sizeof(szBuffer), "%.17g", dfVal);
-        return printbuf_memappend(pb, szBuffer, static_cast<int>(nLen));
-    }
-    else
-    {
-        const bool bPrecisionIsNegative =
-            (nPrecisionIn >> (8 * sizeof(nPrecisionIn) - 1)) != 0;
-        const int nPrecision =
-            bPrecisionIsNegative ? 15 : static_cast<int>(nPrecisionIn);
-        OGRWktOptions opts(nPrecision, /* round = */ true);
-        opts.format = OGRWktFormat::F;
-
-        const std::string s = OGRFormatDouble(dfVal, opts, 1);
-
-        return printbuf_memappend(pb, s.data(), static_cast<int>(s.size()));
-    }
+    const bool bPrecisionIsNegative =
+        (nPrecisionIn >> (8 * sizeof(nPrecisionIn) - 1)) != 0;
+    const std::string s = OGRJSONFormatDoubleWithPrecision(
+        json_object_get_double(jso),
+        bPrecisionIsNegative ? -1 : static_cast<int>(nPrecisionIn));
+    return printbuf_memappend(pb, s.data(), static_cast<int>(s.size()));
 }
 
 /************************************************************************/
@@ -194,7 +196,6 @@ static int OGR_json_double_with_significant_figures_to_string(
     }
     else
     {
-        char szFormatting[32] = {};
         const void *userData =
 #if (!defined(JSON_C_VERSION_NUM)) || (JSON_C_VERSION_NUM < JSON_C_VER_013)
             jso->_userdata;
@@ -209,9 +210,8 @@ static int OGR_json_double_with_significant_figures_to_string(
             bSignificantFiguresIsNegative
                 ? 17
                 : static_cast<int>(nSignificantFigures);
-        CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
-                    nInitialSignificantFigures);
-        nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting, dfVal);
+        nSize = CPLFormatDoubleG(szBuffer, sizeof(szBuffer), dfVal,
+                                 nInitialSignificantFigures);
         const char *pszDot = strchr(szBuffer, '.');
 
         // Try to avoid .xxxx999999y or .xxxx000000y rounding issues by
@@ -223,10 +223,8 @@ static int OGR_json_double_with_significant_figures_to_string(
             bool bOK = false;
             for (int i = 1; i <= 3; i++)
             {
-                CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
-                            nInitialSignificantFigures - i);
-                nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting,
-                                    dfVal);
+                nSize = CPLFormatDoubleG(szBuffer, sizeof(szBuffer), dfVal,
+                                         nInitialSignificantFigures - i);
                 pszDot = strchr(szBuffer, '.');
                 if (pszDot != nullptr && strstr(pszDot, "999999") == nullptr &&
                     strstr(pszDot, "000000") == nullptr)
@@ -237,10 +235,8 @@ static int OGR_json_double_with_significant_figures_to_string(
             }
             if (!bOK)
             {
-                CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
-                            nInitialSignificantFigures);
-                nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting,
-                                    dfVal);
+                nSize = CPLFormatDoubleG(szBuffer, sizeof(szBuffer), dfVal,
+                                         nInitialSignificantFigures);
             }
         }
 
@@ -8,6 +8,8 @@
 /*! @cond Doxygen_Suppress */
 
 #include "cpl_port.h"
+
+#include <string>
 #include "cpl_json_header.h"
 
 #include "ogr_api.h"
@@ -48,6 +50,9 @@ json_object_new_double_with_significant_figures(double dfVal,
                                                 int nSignificantFigures);
 CPL_C_END
 
+std::string CPL_DLL OGRJSONFormatDoubleWithPrecision(double dfVal,
+                                                     int nPrecision);
+
 /*! @endcond */
 
 #endif
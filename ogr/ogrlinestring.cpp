@@ -12,6 +12,7 @@
  ****************************************************************************/
 
 #include "ogr_geometry.h"
+#include "ogr_wkb.h"
 #include "ogr_geos.h"
 #include "ogr_p.h"
 
@@ -1733,26 +1734,16 @@ OGRErr OGRSimpleCurve::importFromWkb(const unsigned char *pabyData,
     /* -------------------------------------------------------------------- */
     if (OGR_SWAP(eByteOrder))
     {
-        for (size_t i = 0; i < static_cast<size_t>(nPointCount); i++)
-        {
-            CPL_SWAPDOUBLE(&(paoPoints[i].x));
-            CPL_SWAPDOUBLE(&(paoPoints[i].y));
-        }
+        OGRWKBSwapDoubles(paoPoints, 2 * static_cast<size_t>(nPointCount));
 
         if (flags & OGR_G_3D)
         {
-            for (size_t i = 0; i < static_cast<size_t>(nPointCount); i++)
-            {
-                CPL_SWAPDOUBLE(padfZ + i);
-            }
+            OGRWKBSwapDoubles(padfZ, static_cast<size_t>(nPointCount));
         }
 
         if (flags & OGR_G_MEASURED)
         {
-            for (size_t i = 0; i < static_cast<size_t>(nPointCount); i++)
-            {
-                CPL_SWAPDOUBLE(padfM + i);
-            }
+            OGRWKBSwapDoubles(padfM, static_cast<size_t>(nPointCount));
         }
     }
 
@@ -1878,10 +1869,7 @@ OGRErr OGRSimpleCurve::exportToWkb(unsigned char *pabyData,
 
         const size_t nCoords =
             CoordinateDimension() * static_cast<size_t>(nPointCount);
-        for (size_t i = 0; i < nCoords; i++)
-        {
-            CPL_SWAP64PTR(pabyData + 9 + 8 * i);
-        }
+        OGRWKBSwapDoubles(pabyData + 9, nCoords);
     }
 
     return OGRERR_NONE;
@@ -2438,16 +2426,14 @@ void OGRSimpleCurve::getEnvelope(OGREnvelope *psEnvelope) const
     double dfMinY = paoPoints[0].y;
     double dfMaxY = paoPoints[0].y;
 
+    // Branch-free min/max so that the loop vectorizes to packed
+    // min/max instructions.
     for (int iPoint = 1; iPoint < nPointCount; iPoint++)
     {
-        if (dfMaxX < paoPoints[iPoint].x)
-            dfMaxX = paoPoints[iPoint].x;
-        if (dfMaxY < paoPoints[iPoint].y)
-            dfMaxY = paoPoints[iPoint].y;
-        if (dfMinX > paoPoints[iPoint].x)
-            dfMinX = paoPoints[iPoint].x;
-        if (dfMinY > paoPoints[iPoint].y)
-            dfMinY = paoPoints[iPoint].y;
+        dfMinX = std::min(dfMinX, paoPoints[iPoint].x);
+        dfMaxX = std::max(dfMaxX, paoPoints[iPoint].x);
+        dfMinY = std::min(dfMinY, paoPoints[iPoint].y);
+        dfMaxY = std::max(dfMaxY, paoPoints[iPoint].y);
     }
 
     psEnvelope->MinX = dfMinX;
@@ -2477,10 +2463,8 @@ void OGRSimpleCurve::getEnvelope(OGREnvelope3D *psEnvelope) const
 
     for (int iPoint = 1; iPoint < nPointCount; iPoint++)
     {
-        if (dfMinZ > padfZ[iPoint])
-            dfMinZ = padfZ[iPoint];
-        if (dfMaxZ < padfZ[iPoint])
-            dfMaxZ = padfZ[iPoint];
+        dfMinZ = std::min(dfMinZ, padfZ[iPoint]);
+        dfMaxZ = std::max(dfMaxZ, padfZ[iPoint]);
     }
 
     psEnvelope->MinZ = dfMinZ;
@@ -135,6 +135,7 @@ class OGRADBCLayer /* non final */ : public OGRLayer,
 
     OGRFeature *GetNextRawFeature();
     bool GetArrowStreamInternal(struct ArrowArrayStream *out_stream);
+    bool ApplyStatementOptions(struct AdbcStatement *statement);
     GIntBig GetFeatureCountSelectCountStar();
     GIntBig GetFeatureCountArrow();
     GIntBig GetFeatureCountParquet();
@@ -244,6 +245,9 @@ class OGRADBCDataset final : public GDALDataset
     bool m_bSpatialLoaded = false;
     bool m_bIsBigQuery = false;
     std::string m_osBigQueryDatasetId{};
+    // ADBC_STATEMENT_OPTION_* open options, applied through
+    // AdbcStatementSetOption() to every statement created on this dataset.
+    CPLStringList m_aosStatementOptions{};
 
   public:
     OGRADBCDataset() = default;
@@ -582,6 +582,11 @@ bool OGRADBCDataset::Open(const GDALOpenInfo *poOpenInfo)
                 return false;
             }
         }
+        else if (STARTS_WITH_CI(pszKey, "ADBC_STATEMENT_OPTION_"))
+        {
+            m_aosStatementOptions.AddNameValue(
+                pszKey + strlen("ADBC_STATEMENT_OPTION_"), pszValue);
+        }
     }
 
     if (ADBC_CALL(DatabaseInit, &m_database, error) != ADBC_STATUS_OK)
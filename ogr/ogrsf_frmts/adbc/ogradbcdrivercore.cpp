@@ -122,6 +122,9 @@ void OGRADBCDriverSetCommonMetadata(GDALDriver *poDriver)
         "description='SQL statement from which to build layer'/>"
         "  <Option name='ADBC_OPTION_*' type='string' "
         "description='Option to pass to AdbcDatabaseSetOption()'/>"
+        "  <Option name='ADBC_STATEMENT_OPTION_*' type='string' "
+        "description='Option to pass to AdbcStatementSetOption() on every "
+        "statement, e.g. to tune the record batch size'/>"
         "  <Option name='PRELUDE_STATEMENTS' type='string' description='SQL "
         "statement(s) to send on the database connection before any other "
         "ones'/>"
@@ -15,6 +15,7 @@
 #include "ogr_spatialref.h"
 #include "ogr_p.h"
 #include "cpl_json.h"
+#include "cpl_worker_thread_pool.h"
 
 #include <cassert>
 #include <cmath>
@@ -366,6 +367,9 @@ bool OGRADBCLayer::BuildLayerDefnInit(bool bCreateStream)
                      "AdbcStatementSetSqlQuery() failed: %s", error.message());
             return false;
         }
+
+        if (!ApplyStatementOptions(m_statement.get()))
+            return false;
     }
 
     if (!m_stream && bCreateStream)
@@ -618,6 +622,11 @@ bool OGRADBCLayer::ReplaceStatement(const char *pszNewStatement)
         error.clear();
         ADBC_CALL(StatementRelease, statement.get(), error);
     }
+    else if (!ApplyStatementOptions(statement.get()))
+    {
+        error.clear();
+        ADBC_CALL(StatementRelease, statement.get(), error);
+    }
     else
     {
         auto stream = std::make_unique<OGRArrowArrayStream>();
@@ -1010,6 +1019,156 @@ bool OGRADBCLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
     return GetArrowStreamInternal(out_stream);
 }
 
+/************************************************************************/
+/*                       Prefetched Arrow stream                        */
+/*                                                                      */
+/*      Wrapper around an ArrowArrayStream that fetches the next        */
+/*      record batch on a dedicated worker thread while the consumer    */
+/*      processes the current one (one batch of read ahead). All        */
+/*      accesses to the inner stream are serialized: the consumer       */
+/*      always waits for the in-flight fetch before touching it.        */
+/************************************************************************/
+
+namespace
+{
+struct PrefetchedStreamState
+{
+    struct ArrowArrayStream m_innerStream
+    {
+    };
+
+    CPLWorkerThreadPool m_oPool{};
+    struct ArrowArray m_nextArray
+    {
+    };
+
+    int m_nNextRet = 0;
+    bool m_bPending = false;
+    bool m_bEOF = false;
+
+    void StartFetch()
+    {
+        m_bPending = true;
+        m_oPool.SubmitJob(
+            [this]()
+            {
+                memset(&m_nextArray, 0, sizeof(m_nextArray));
+                m_nNextRet = m_innerStream.get_next(&m_innerStream,
+                                                    &m_nextArray);
+            });
+    }
+
+    void WaitFetch()
+    {
+        if (m_bPending)
+        {
+            m_oPool.WaitCompletion();
+            m_bPending = false;
+        }
+    }
+};
+
+int PrefetchedStreamGetNext(struct ArrowArrayStream *stream,
+                            struct ArrowArray *out)
+{
+    auto *psState = static_cast<PrefetchedStreamState *>(stream->private_data);
+    if (psState->m_bEOF)
+    {
+        memset(out, 0, sizeof(*out));
+        return psState->m_nNextRet;
+    }
+    psState->WaitFetch();
+    *out = psState->m_nextArray;
+    memset(&psState->m_nextArray, 0, sizeof(psState->m_nextArray));
+    const int ret = psState->m_nNextRet;
+    if (ret == 0 && out->release != nullptr)
+        psState->StartFetch();
+    else
+        psState->m_bEOF = true;
+    return ret;
+}
+
+int PrefetchedStreamGetSchema(struct ArrowArrayStream *stream,
+                              struct ArrowSchema *out)
+{
+    auto *psState = static_cast<PrefetchedStreamState *>(stream->private_data);
+    psState->WaitFetch();
+    return psState->m_innerStream.get_schema(&psState->m_innerStream, out);
+}
+
+const char *PrefetchedStreamGetLastError(struct ArrowArrayStream *stream)
+{
+    auto *psState = static_cast<PrefetchedStreamState *>(stream->private_data);
+    psState->WaitFetch();
+    return psState->m_innerStream.get_last_error(&psState->m_innerStream);
+}
+
+void PrefetchedStreamRelease(struct ArrowArrayStream *stream)
+{
+    auto *psState = static_cast<PrefetchedStreamState *>(stream->private_data);
+    psState->WaitFetch();
+    if (psState->m_nextArray.release)
+        psState->m_nextArray.release(&psState->m_nextArray);
+    psState->m_innerStream.release(&psState->m_innerStream);
+    delete psState;
+    stream->private_data = nullptr;
+    stream->release = nullptr;
+}
+
+// Replace, in place, the content of `stream` with a prefetching wrapper.
+void WrapStreamWithPrefetch(struct ArrowArrayStream *stream)
+{
+    auto psState = std::make_unique<PrefetchedStreamState>();
+    if (!psState->m_oPool.Setup(1, nullptr, nullptr))
+        return;
+    psState->m_innerStream = *stream;
+    stream->private_data = psState.release();
+    stream->get_next = PrefetchedStreamGetNext;
+    stream->get_schema = PrefetchedStreamGetSchema;
+    stream->get_last_error = PrefetchedStreamGetLastError;
+    stream->release = PrefetchedStreamRelease;
+    static_cast<PrefetchedStreamState *>(stream->private_data)->StartFetch();
+}
+}  // namespace
+
+/************************************************************************/
+/*                       ApplyStatementOptions()                        */
+/************************************************************************/
+
+bool OGRADBCLayer::ApplyStatementOptions(struct AdbcStatement *statement)
+{
+    if (m_poDS->m_aosStatementOptions.empty())
+        return true;
+    if (m_poDS->m_driver.StatementSetOption == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "ADBC driver does not support AdbcStatementSetOption()");
+        return false;
+    }
+    OGRADBCError error;
+    for (const char *const *papszIter = m_poDS->m_aosStatementOptions.List();
+         papszIter && *papszIter; ++papszIter)
+    {
+        char *pszKey = nullptr;
+        const char *pszValue = CPLParseNameValue(*papszIter, &pszKey);
+        if (pszKey && pszValue)
+        {
+            if (ADBC_CALL(StatementSetOption, statement, pszKey, pszValue,
+                          error) != ADBC_STATUS_OK)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "AdbcStatementSetOption(%s) failed: %s", pszKey,
+                         error.message());
+                CPLFree(pszKey);
+                return false;
+            }
+        }
+        CPLFree(pszKey);
+        error.clear();
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                       GetArrowStreamInternal()                       */
 /************************************************************************/
@@ -1026,6 +1185,15 @@ bool OGRADBCLayer::GetArrowStreamInternal(struct ArrowArrayStream *out_stream)
         return false;
     }
 
+    // Optionally overlap the fetch of the next record batch with the
+    // processing of the current one. Not enabled by default since some
+    // drivers (DuckDB) invalidate a stream when another statement runs on
+    // the same connection, and the eager read-ahead widens that window.
+    if (CPLTestBool(CPLGetConfigOption("OGR_ADBC_PREFETCH", "NO")))
+    {
+        WrapStreamWithPrefetch(out_stream);
+    }
+
     return true;
 }
 
@@ -1041,6 +1209,13 @@ GIntBig OGRADBCLayer::GetFeatureCountSelectCountStar()
     // and https://github.com/apache/arrow-adbc/blob/da58c591ed89b29c9096e4ebc0fe99d369e2bc88/docs/source/cpp/concurrency.rst
     m_bNextStreamUsageMaybeInvalid = true;
 
+    // If OGR_ADBC_PREFETCH is enabled and a background fetch is in flight
+    // on the current stream, drain it before running another statement on
+    // the same connection (get_last_error() waits for it in the wrapper,
+    // and is harmless on a plain stream).
+    if (m_stream && m_stream->get()->get_last_error)
+        CPL_IGNORE_RET_VAL(m_stream->get()->get_last_error(m_stream->get()));
+
     auto poCountLayer =
         m_poDS->CreateInternalLayer(std::string("SELECT COUNT(*) FROM (")
                                         .append(osCurStatement)
@@ -1167,6 +1342,13 @@ GIntBig OGRADBCLayer::GetFeatureCountParquet()
     // and https://github.com/apache/arrow-adbc/blob/da58c591ed89b29c9096e4ebc0fe99d369e2bc88/docs/source/cpp/concurrency.rst
     m_bNextStreamUsageMaybeInvalid = true;
 
+    // If OGR_ADBC_PREFETCH is enabled and a background fetch is in flight
+    // on the current stream, drain it before running another statement on
+    // the same connection (get_last_error() waits for it in the wrapper,
+    // and is harmless on a plain stream).
+    if (m_stream && m_stream->get()->get_last_error)
+        CPL_IGNORE_RET_VAL(m_stream->get()->get_last_error(m_stream->get()));
+
     const std::string osSQL(CPLSPrintf(
         "SELECT CAST(SUM(num_rows) AS BIGINT) FROM parquet_file_metadata('%s')",
         OGRDuplicateCharacter(m_poDS->m_osParquetFilename, '\'').c_str()));
@@ -14,6 +14,7 @@
 #define OGR_FLATGEOBUF_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "cpl_virtualmem.h"
 #include "ogr_p.h"
 #include "ogreditablelayer.h"
 
@@ -71,6 +72,9 @@ class OGRFlatGeobufLayer final : public OGRLayer,
 
     VSILFILE *m_poFp = nullptr;
     vsi_l_offset m_nFileSize = 0;
+    CPLVirtualMem *m_psMMap = nullptr;  // optional whole-file read mapping
+    const GByte *m_pabyMMapData = nullptr;
+    vsi_l_offset m_nMMapSize = 0;
 
     const FlatGeobuf::Header *m_poHeader = nullptr;
     GByte *m_headerBuf = nullptr;
@@ -65,6 +65,32 @@ OGRFlatGeobufLayer::OGRFlatGeobufLayer(const Header *poHeader, GByte *headerBuf,
     m_offset = offset;
     m_create = false;
 
+    /* -------------------------------------------------------------------- */
+    /*      For local files, try to memory map the whole file: feature and  */
+    /*      index node reads then become bounds-checked memcpy's from the   */
+    /*      mapping, without any seek/read system call per feature.         */
+    /* -------------------------------------------------------------------- */
+    if (CPLIsVirtualMemFileMapAvailable() && sizeof(void *) == 8 &&
+        CPLTestBool(CPLGetConfigOption("FGB_MMAP", "YES")))
+    {
+        VSIStatBufL sStatBuf;
+        if (VSIStatL(m_osFilename.c_str(), &sStatBuf) == 0 &&
+            sStatBuf.st_size > 0)
+        {
+            m_psMMap = CPLVirtualMemFileMapNew(
+                m_poFp, 0, static_cast<vsi_l_offset>(sStatBuf.st_size),
+                VIRTUALMEM_READONLY, nullptr, nullptr);
+            if (m_psMMap)
+            {
+                m_pabyMMapData =
+                    static_cast<const GByte *>(CPLVirtualMemGetAddr(m_psMMap));
+                m_nMMapSize = static_cast<vsi_l_offset>(sStatBuf.st_size);
+                m_nFileSize = m_nMMapSize;
+                CPLDebugOnly("FlatGeobuf", "Using memory mapped reads");
+            }
+        }
+    }
+
     m_featuresCount = m_poHeader->features_count();
     m_geometryType = m_poHeader->geometry_type();
     m_indexNodeSize = m_poHeader->index_node_size();
@@ -793,6 +819,9 @@ OGRFlatGeobufLayer::~OGRFlatGeobufLayer()
     if (m_poSRS)
         m_poSRS->Release();
 
+    if (m_psMMap)
+        CPLVirtualMemFree(m_psMMap);
+
     if (m_featureBuf)
         VSIFree(m_featureBuf);
 
@@ -939,6 +968,13 @@ OGRErr OGRFlatGeobufLayer::readIndex()
             const auto readNode =
                 [this, treeOffset](uint8_t *buf, size_t i, size_t s)
             {
+                if (m_pabyMMapData)
+                {
+                    if (treeOffset + i + s > m_nMMapSize)
+                        throw std::runtime_error("I/O read file");
+                    memcpy(buf, m_pabyMMapData + treeOffset + i, s);
+                    return;
+                }
                 if (VSIFSeekL(m_poFp, treeOffset + i, SEEK_SET) == -1)
                     throw std::runtime_error("I/O seek failure");
                 if (VSIFReadL(buf, 1, s, m_poFp) != s)
@@ -1084,18 +1120,29 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     if (m_featuresPos == 0)
         seek = true;
 
-    if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+    uint32_t featureSize;
+    if (m_pabyMMapData)
     {
-        if (VSIFEofL(m_poFp))
-            return OGRERR_NONE;
-        return CPLErrorIO("seeking to feature location");
+        // Addressing is done directly with m_offset into the mapping: no
+        // seek needed.
+        if (m_offset + sizeof(featureSize) > m_nMMapSize)
+            return OGRERR_NONE;  // regular end of iteration
+        memcpy(&featureSize, m_pabyMMapData + m_offset, sizeof(featureSize));
     }
-    uint32_t featureSize;
-    if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
+    else
     {
-        if (VSIFEofL(m_poFp))
-            return OGRERR_NONE;
-        return CPLErrorIO("reading feature size");
+        if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
+        {
+            if (VSIFEofL(m_poFp))
+                return OGRERR_NONE;
+            return CPLErrorIO("seeking to feature location");
+        }
+        if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
+        {
+            if (VSIFEofL(m_poFp))
+                return OGRERR_NONE;
+            return CPLErrorIO("reading feature size");
+        }
     }
     CPL_LSBPTR32(&featureSize);
 
@@ -1123,8 +1170,21 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     const auto err = ensureFeatureBuf(featureSize);
     if (err != OGRERR_NONE)
         return err;
-    if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
-        return CPLErrorIO("reading feature");
+    if (m_pabyMMapData)
+    {
+        // The feature buffer is still copied out of the mapping: flatbuffer
+        // scalar accesses assume an aligned buffer start, which arbitrary
+        // file offsets do not guarantee.
+        if (m_offset + sizeof(featureSize) + featureSize > m_nMMapSize)
+            return CPLErrorIO("reading feature");
+        memcpy(m_featureBuf, m_pabyMMapData + m_offset + sizeof(featureSize),
+               featureSize);
+    }
+    else
+    {
+        if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
+            return CPLErrorIO("reading feature");
+    }
     m_offset += featureSize + sizeof(featureSize);
 
     if (m_bVerifyBuffers)
@@ -0,0 +1,822 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Driver-agnostic attribute index kept in a ".gidx" sidecar file.
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_attrind.h"
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+constexpr const char GIDX_MAGIC[8] = {'O', 'G', 'R', 'G', 'I', 'D', 'X', '1'};
+
+/************************************************************************/
+/*                         OGRGenericAttrIndex                          */
+/*                                                                      */
+/*      Index on one field: a key-sorted array of (key, FID) entries,   */
+/*      looked up by binary search.                                     */
+/************************************************************************/
+
+class OGRGenericLayerAttrIndex;
+
+class OGRGenericAttrIndex final : public OGRAttrIndex
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenericAttrIndex)
+
+  public:
+    struct Entry
+    {
+        GIntBig nFID = OGRNullFID;
+        union
+        {
+            int nInt;
+            GIntBig nInt64;
+            double dfReal;
+        } u{};
+        std::string osStr{};
+    };
+
+    OGRGenericLayerAttrIndex *m_poLayerIndex;
+    int m_iField;
+    OGRFieldType m_eType;
+    std::vector<Entry> m_aoEntries{};  // sorted by key
+
+    OGRGenericAttrIndex(OGRGenericLayerAttrIndex *poLayerIndex, int iField,
+                        OGRFieldType eType)
+        : m_poLayerIndex(poLayerIndex), m_iField(iField), m_eType(eType)
+    {
+    }
+
+    bool KeyLess(const Entry &sA, const Entry &sB) const;
+    Entry EntryFromKey(const OGRField *psKey) const;
+    bool EntryFromFeature(const OGRFeature *poFeature, Entry &sEntry) const;
+    bool IsNaNKey(const Entry &sEntry) const;
+    void SortEntries();
+
+    GIntBig GetFirstMatch(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList, int *nFIDCount,
+                           int *nLength) override;
+
+    OGRErr AddEntry(OGRField *psKey, GIntBig nFID) override;
+    OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) override;
+
+    OGRErr Clear() override;
+};
+
+/************************************************************************/
+/*                       OGRGenericLayerAttrIndex                       */
+/*                                                                      */
+/*      All the field indexes of one layer, persisted together in a     */
+/*      single binary ".gidx" sidecar next to the datasource file.      */
+/************************************************************************/
+
+class OGRGenericLayerAttrIndex final : public OGRLayerAttrIndex
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenericLayerAttrIndex)
+
+    std::vector<std::unique_ptr<OGRGenericAttrIndex>> m_apoIndexes{};
+    std::string m_osIndexFilename{};
+    bool m_bModified = false;
+
+    OGRGenericAttrIndex *FindIndex(int iField) const;
+    OGRErr LoadFromFile();
+    OGRErr SaveToFile();
+
+  public:
+    OGRGenericLayerAttrIndex() = default;
+    ~OGRGenericLayerAttrIndex() override;
+
+    OGRErr Initialize(const char *pszIndexPath, OGRLayer *) override;
+
+    OGRErr CreateIndex(int iField) override;
+    OGRErr DropIndex(int iField) override;
+    OGRErr IndexAllFeatures(int iField = -1) override;
+
+    OGRErr AddToIndex(OGRFeature *poFeature, int iField = -1) override;
+    OGRErr RemoveFromIndex(OGRFeature *poFeature) override;
+
+    OGRAttrIndex *GetFieldIndex(int iField) override;
+};
+
+/************************************************************************/
+/*                              KeyLess()                               */
+/************************************************************************/
+
+bool OGRGenericAttrIndex::KeyLess(const Entry &sA, const Entry &sB) const
+{
+    switch (m_eType)
+    {
+        case OFTInteger:
+            return sA.u.nInt < sB.u.nInt;
+        case OFTInteger64:
+            return sA.u.nInt64 < sB.u.nInt64;
+        case OFTReal:
+            return sA.u.dfReal < sB.u.dfReal;
+        default:
+            return sA.osStr < sB.osStr;
+    }
+}
+
+/************************************************************************/
+/*                             IsNaNKey()                               */
+/************************************************************************/
+
+/** NaN keys are not indexed (they would break the strict weak ordering
+ * required by sorting and binary searches, and never match an equality
+ * predicate). */
+bool OGRGenericAttrIndex::IsNaNKey(const Entry &sEntry) const
+{
+    return m_eType == OFTReal && std::isnan(sEntry.u.dfReal);
+}
+
+/************************************************************************/
+/*                           EntryFromKey()                             */
+/************************************************************************/
+
+OGRGenericAttrIndex::Entry
+OGRGenericAttrIndex::EntryFromKey(const OGRField *psKey) const
+{
+    Entry sEntry;
+    switch (m_eType)
+    {
+        case OFTInteger:
+            sEntry.u.nInt = psKey->Integer;
+            break;
+        case OFTInteger64:
+            sEntry.u.nInt64 = psKey->Integer64;
+            break;
+        case OFTReal:
+            sEntry.u.dfReal = psKey->Real;
+            break;
+        default:
+            sEntry.osStr = psKey->String ? psKey->String : "";
+            break;
+    }
+    return sEntry;
+}
+
+/************************************************************************/
+/*                         EntryFromFeature()                           */
+/************************************************************************/
+
+/** Returns false for unset/null values, which are not indexed. */
+bool OGRGenericAttrIndex::EntryFromFeature(const OGRFeature *poFeature,
+                                           Entry &sEntry) const
+{
+    if (!poFeature->IsFieldSetAndNotNull(m_iField))
+        return false;
+    switch (m_eType)
+    {
+        case OFTInteger:
+            sEntry.u.nInt = poFeature->GetFieldAsInteger(m_iField);
+            break;
+        case OFTInteger64:
+            sEntry.u.nInt64 = poFeature->GetFieldAsInteger64(m_iField);
+            break;
+        case OFTReal:
+            sEntry.u.dfReal = poFeature->GetFieldAsDouble(m_iField);
+            // NaN keys would break the strict weak ordering required by
+            // sorting and binary searches, and can never match an equality
+            // predicate anyway: do not index them.
+            if (std::isnan(sEntry.u.dfReal))
+                return false;
+            break;
+        default:
+            sEntry.osStr = poFeature->GetFieldAsString(m_iField);
+            break;
+    }
+    sEntry.nFID = poFeature->GetFID();
+    return true;
+}
+
+/************************************************************************/
+/*                            SortEntries()                             */
+/************************************************************************/
+
+void OGRGenericAttrIndex::SortEntries()
+{
+    std::sort(m_aoEntries.begin(), m_aoEntries.end(),
+              [this](const Entry &sA, const Entry &sB)
+              { return KeyLess(sA, sB); });
+}
+
+/************************************************************************/
+/*                           GetFirstMatch()                            */
+/************************************************************************/
+
+GIntBig OGRGenericAttrIndex::GetFirstMatch(OGRField *psKey)
+{
+    const Entry sKey = EntryFromKey(psKey);
+    if (IsNaNKey(sKey))
+        return OGRNullFID;
+    const auto oIter =
+        std::lower_bound(m_aoEntries.begin(), m_aoEntries.end(), sKey,
+                         [this](const Entry &sA, const Entry &sB)
+                         { return KeyLess(sA, sB); });
+    if (oIter == m_aoEntries.end() || KeyLess(sKey, *oIter))
+        return OGRNullFID;
+    return oIter->nFID;
+}
+
+/************************************************************************/
+/*                           GetAllMatches()                            */
+/************************************************************************/
+
+GIntBig *OGRGenericAttrIndex::GetAllMatches(OGRField *psKey,
+                                            GIntBig *panFIDList,
+                                            int *nFIDCount, int *nLength)
+{
+    if (panFIDList == nullptr)
+    {
+        panFIDList = static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig) * 2));
+        *nFIDCount = 0;
+        *nLength = 2;
+    }
+
+    const Entry sKey = EntryFromKey(psKey);
+    if (IsNaNKey(sKey))
+    {
+        panFIDList[*nFIDCount] = OGRNullFID;
+        return panFIDList;
+    }
+    const auto oRange =
+        std::equal_range(m_aoEntries.begin(), m_aoEntries.end(), sKey,
+                         [this](const Entry &sA, const Entry &sB)
+                         { return KeyLess(sA, sB); });
+    for (auto oIter = oRange.first; oIter != oRange.second; ++oIter)
+    {
+        if (*nFIDCount >= *nLength - 1)
+        {
+            *nLength = (*nLength) * 2 + 10;
+            panFIDList = static_cast<GIntBig *>(
+                CPLRealloc(panFIDList, sizeof(GIntBig) * (*nLength)));
+        }
+        panFIDList[(*nFIDCount)++] = oIter->nFID;
+    }
+
+    panFIDList[*nFIDCount] = OGRNullFID;
+
+    return panFIDList;
+}
+
+GIntBig *OGRGenericAttrIndex::GetAllMatches(OGRField *psKey)
+{
+    int nFIDCount = 0;
+    int nLength = 0;
+    return GetAllMatches(psKey, nullptr, &nFIDCount, &nLength);
+}
+
+/************************************************************************/
+/*                             AddEntry()                               */
+/************************************************************************/
+
+OGRErr OGRGenericAttrIndex::AddEntry(OGRField *psKey, GIntBig nFID)
+{
+    if (psKey == nullptr)
+        return OGRERR_FAILURE;
+    Entry sEntry = EntryFromKey(psKey);
+    if (IsNaNKey(sEntry))
+        return OGRERR_NONE;  // NaN keys are not indexed
+    sEntry.nFID = nFID;
+    const auto oIter =
+        std::lower_bound(m_aoEntries.begin(), m_aoEntries.end(), sEntry,
+                         [this](const Entry &sA, const Entry &sB)
+                         { return KeyLess(sA, sB); });
+    m_aoEntries.insert(oIter, std::move(sEntry));
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            RemoveEntry()                             */
+/************************************************************************/
+
+OGRErr OGRGenericAttrIndex::RemoveEntry(OGRField *psKey, GIntBig nFID)
+{
+    if (psKey == nullptr)
+        return OGRERR_FAILURE;
+    const Entry sKey = EntryFromKey(psKey);
+    if (IsNaNKey(sKey))
+        return OGRERR_NONE;  // NaN keys are not indexed
+    const auto oRange =
+        std::equal_range(m_aoEntries.begin(), m_aoEntries.end(), sKey,
+                         [this](const Entry &sA, const Entry &sB)
+                         { return KeyLess(sA, sB); });
+    for (auto oIter = oRange.first; oIter != oRange.second; ++oIter)
+    {
+        if (oIter->nFID == nFID)
+        {
+            m_aoEntries.erase(oIter);
+            return OGRERR_NONE;
+        }
+    }
+    return OGRERR_FAILURE;
+}
+
+/************************************************************************/
+/*                              Clear()                                 */
+/************************************************************************/
+
+OGRErr OGRGenericAttrIndex::Clear()
+{
+    m_aoEntries.clear();
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                       OGRGenericLayerAttrIndex                       */
+/* ==================================================================== */
+/************************************************************************/
+
+/************************************************************************/
+/*                     ~OGRGenericLayerAttrIndex()                      */
+/************************************************************************/
+
+OGRGenericLayerAttrIndex::~OGRGenericLayerAttrIndex()
+{
+    if (m_bModified)
+        SaveToFile();
+}
+
+/************************************************************************/
+/*                             Initialize()                             */
+/************************************************************************/
+
+OGRErr OGRGenericLayerAttrIndex::Initialize(const char *pszIndexPathIn,
+                                            OGRLayer *poLayerIn)
+{
+    if (poLayerIn == poLayer)
+        return OGRERR_NONE;
+
+    poLayer = poLayerIn;
+    pszIndexPath = CPLStrdup(pszIndexPathIn);
+    m_osIndexFilename = CPLResetExtensionSafe(pszIndexPathIn, "gidx");
+
+    VSIStatBufL sStat;
+    if (VSIStatExL(m_osIndexFilename.c_str(), &sStat,
+                   VSI_STAT_EXISTS_FLAG) == 0)
+    {
+        // A corrupt or out-of-schema index file is not fatal: a warning has
+        // been emitted and we start over with no indexed field, so that
+        // CREATE INDEX can rebuild it.
+        CPL_IGNORE_RET_VAL(LoadFromFile());
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             FindIndex()                              */
+/************************************************************************/
+
+OGRGenericAttrIndex *OGRGenericLayerAttrIndex::FindIndex(int iField) const
+{
+    for (const auto &poIndex : m_apoIndexes)
+    {
+        if (poIndex->m_iField == iField)
+            return poIndex.get();
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                           LoadFromFile()                             */
+/************************************************************************/
+
+OGRErr OGRGenericLayerAttrIndex::LoadFromFile()
+{
+    VSILFILE *fp = VSIFOpenL(m_osIndexFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return OGRERR_FAILURE;
+
+    const auto ReadFailed = [this, fp]()
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Attribute index %s is truncated or corrupt",
+                 m_osIndexFilename.c_str());
+        CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+        m_apoIndexes.clear();
+        return OGRERR_FAILURE;
+    };
+
+    char abyMagic[8] = {};
+    if (VSIFReadL(abyMagic, 1, 8, fp) != 8 ||
+        memcmp(abyMagic, GIDX_MAGIC, 8) != 0)
+        return ReadFailed();
+
+    GUInt32 nIndexCount = 0;
+    if (VSIFReadL(&nIndexCount, sizeof(nIndexCount), 1, fp) != 1)
+        return ReadFailed();
+    CPL_LSBPTR32(&nIndexCount);
+
+    const int nFieldCount = poLayer->GetLayerDefn()->GetFieldCount();
+    for (GUInt32 i = 0; i < nIndexCount; i++)
+    {
+        GInt32 iField = 0;
+        GInt32 nType = 0;
+        GUIntBig nEntries = 0;
+        if (VSIFReadL(&iField, sizeof(iField), 1, fp) != 1 ||
+            VSIFReadL(&nType, sizeof(nType), 1, fp) != 1 ||
+            VSIFReadL(&nEntries, sizeof(nEntries), 1, fp) != 1)
+            return ReadFailed();
+        CPL_LSBPTR32(&iField);
+        CPL_LSBPTR32(&nType);
+        CPL_LSBPTR64(&nEntries);
+
+        if (iField < 0 || iField >= nFieldCount ||
+            poLayer->GetLayerDefn()->GetFieldDefn(iField)->GetType() !=
+                static_cast<OGRFieldType>(nType))
+        {
+            // Layer schema changed since the index was built: ignore it.
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Attribute index %s does not match the layer schema: "
+                     "ignoring it",
+                     m_osIndexFilename.c_str());
+            CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+            m_apoIndexes.clear();
+            return OGRERR_FAILURE;
+        }
+
+        auto poIndex = std::make_unique<OGRGenericAttrIndex>(
+            this, iField, static_cast<OGRFieldType>(nType));
+        try
+        {
+            poIndex->m_aoEntries.reserve(static_cast<size_t>(nEntries));
+        }
+        catch (const std::exception &)
+        {
+            return ReadFailed();
+        }
+        for (GUIntBig iEntry = 0; iEntry < nEntries; iEntry++)
+        {
+            OGRGenericAttrIndex::Entry sEntry;
+            if (VSIFReadL(&sEntry.nFID, sizeof(GIntBig), 1, fp) != 1)
+                return ReadFailed();
+            CPL_LSBPTR64(&sEntry.nFID);
+            switch (poIndex->m_eType)
+            {
+                case OFTInteger:
+                    if (VSIFReadL(&sEntry.u.nInt, sizeof(int), 1, fp) != 1)
+                        return ReadFailed();
+                    CPL_LSBPTR32(&sEntry.u.nInt);
+                    break;
+                case OFTInteger64:
+                    if (VSIFReadL(&sEntry.u.nInt64, sizeof(GIntBig), 1, fp) !=
+                        1)
+                        return ReadFailed();
+                    CPL_LSBPTR64(&sEntry.u.nInt64);
+                    break;
+                case OFTReal:
+                    if (VSIFReadL(&sEntry.u.dfReal, sizeof(double), 1, fp) !=
+                        1)
+                        return ReadFailed();
+                    CPL_LSBPTR64(&sEntry.u.dfReal);
+                    break;
+                default:
+                {
+                    GUInt32 nLen = 0;
+                    if (VSIFReadL(&nLen, sizeof(nLen), 1, fp) != 1)
+                        return ReadFailed();
+                    CPL_LSBPTR32(&nLen);
+                    if (nLen > 100 * 1024 * 1024)
+                        return ReadFailed();
+                    sEntry.osStr.resize(nLen);
+                    if (nLen > 0 &&
+                        VSIFReadL(&sEntry.osStr[0], 1, nLen, fp) != nLen)
+                        return ReadFailed();
+                    break;
+                }
+            }
+            poIndex->m_aoEntries.push_back(std::move(sEntry));
+        }
+        m_apoIndexes.push_back(std::move(poIndex));
+    }
+
+    CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            SaveToFile()                              */
+/************************************************************************/
+
+OGRErr OGRGenericLayerAttrIndex::SaveToFile()
+{
+    if (m_apoIndexes.empty())
+    {
+        VSIUnlink(m_osIndexFilename.c_str());
+        m_bModified = false;
+        return OGRERR_NONE;
+    }
+
+    const std::string osTmpFilename = m_osIndexFilename + ".tmp";
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_OpenFailed,
+                 "Cannot create attribute index %s",
+                 m_osIndexFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+
+    bool bOK = VSIFWriteL(GIDX_MAGIC, 1, 8, fp) == 8;
+
+    GUInt32 nIndexCount = static_cast<GUInt32>(m_apoIndexes.size());
+    CPL_LSBPTR32(&nIndexCount);
+    bOK = bOK && VSIFWriteL(&nIndexCount, sizeof(nIndexCount), 1, fp) == 1;
+
+    for (const auto &poIndex : m_apoIndexes)
+    {
+        GInt32 iField = poIndex->m_iField;
+        GInt32 nType = static_cast<GInt32>(poIndex->m_eType);
+        GUIntBig nEntries = poIndex->m_aoEntries.size();
+        CPL_LSBPTR32(&iField);
+        CPL_LSBPTR32(&nType);
+        CPL_LSBPTR64(&nEntries);
+        bOK = bOK && VSIFWriteL(&iField, sizeof(iField), 1, fp) == 1 &&
+              VSIFWriteL(&nType, sizeof(nType), 1, fp) == 1 &&
+              VSIFWriteL(&nEntries, sizeof(nEntries), 1, fp) == 1;
+
+        for (const auto &sEntry : poIndex->m_aoEntries)
+        {
+            if (!bOK)
+                break;
+            GIntBig nFID = sEntry.nFID;
+            CPL_LSBPTR64(&nFID);
+            bOK = VSIFWriteL(&nFID, sizeof(nFID), 1, fp) == 1;
+            switch (poIndex->m_eType)
+            {
+                case OFTInteger:
+                {
+                    int nVal = sEntry.u.nInt;
+                    CPL_LSBPTR32(&nVal);
+                    bOK = bOK && VSIFWriteL(&nVal, sizeof(nVal), 1, fp) == 1;
+                    break;
+                }
+                case OFTInteger64:
+                {
+                    GIntBig nVal = sEntry.u.nInt64;
+                    CPL_LSBPTR64(&nVal);
+                    bOK = bOK && VSIFWriteL(&nVal, sizeof(nVal), 1, fp) == 1;
+                    break;
+                }
+                case OFTReal:
+                {
+                    double dfVal = sEntry.u.dfReal;
+                    CPL_LSBPTR64(&dfVal);
+                    bOK = bOK && VSIFWriteL(&dfVal, sizeof(dfVal), 1, fp) == 1;
+                    break;
+                }
+                default:
+                {
+                    GUInt32 nLen = static_cast<GUInt32>(sEntry.osStr.size());
+                    CPL_LSBPTR32(&nLen);
+                    bOK = bOK && VSIFWriteL(&nLen, sizeof(nLen), 1, fp) == 1 &&
+                          VSIFWriteL(sEntry.osStr.data(), 1,
+                                     sEntry.osStr.size(),
+                                     fp) == sEntry.osStr.size();
+                    break;
+                }
+            }
+        }
+        if (!bOK)
+            break;
+    }
+
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write attribute index %s",
+                 m_osIndexFilename.c_str());
+        VSIUnlink(osTmpFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+    if (VSIRename(osTmpFilename.c_str(), m_osIndexFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+    m_bModified = false;
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            CreateIndex()                             */
+/************************************************************************/
+
+OGRErr OGRGenericLayerAttrIndex::CreateIndex(int iField)
+{
+    if (poLayer == nullptr)
+        return OGRERR_FAILURE;
+    if (iField < 0 || iField >= poLayer->GetLayerDefn()->GetFieldCount())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid field number");
+        return OGRERR_FAILURE;
+    }
+    if (FindIndex(iField) != nullptr)
+        return OGRERR_NONE;
+
+    const OGRFieldType eType =
+        poLayer->GetLayerDefn()->GetFieldDefn(iField)->GetType();
+    if (eType != OFTInteger && eType != OFTInteger64 && eType != OFTReal &&
+        eType != OFTString)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Attribute indexes only support Integer, Integer64, Real "
+                 "and String fields");
+        return OGRERR_FAILURE;
+    }
+
+    m_apoIndexes.push_back(
+        std::make_unique<OGRGenericAttrIndex>(this, iField, eType));
+    m_bModified = true;
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             DropIndex()                              */
+/************************************************************************/
+
+OGRErr OGRGenericLayerAttrIndex::DropIndex(int iField)
+{
+    for (size_t i = 0; i < m_apoIndexes.size(); i++)
+    {
+        if (m_apoIndexes[i]->m_iField == iField)
+        {
+            m_apoIndexes.erase(m_apoIndexes.begin() + i);
+            m_bModified = true;
+            return SaveToFile();
+        }
+    }
+    CPLError(CE_Failure, CPLE_AppDefined, "Field %d is not indexed", iField);
+    return OGRERR_FAILURE;
+}
+
+/************************************************************************/
+/*                          IndexAllFeatures()                          */
+/************************************************************************/
+
+OGRErr OGRGenericLayerAttrIndex::IndexAllFeatures(int iField)
+{
+    if (poLayer == nullptr)
+        return OGRERR_FAILURE;
+
+    std::vector<OGRGenericAttrIndex *> apoTargets;
+    for (const auto &poIndex : m_apoIndexes)
+    {
+        if (iField < 0 || poIndex->m_iField == iField)
+        {
+            poIndex->m_aoEntries.clear();
+            apoTargets.push_back(poIndex.get());
+        }
+    }
+    if (apoTargets.empty())
+        return OGRERR_NONE;
+
+    /* -------------------------------------------------------------------- */
+    /*      Single scan of the layer collecting the keys of all targeted    */
+    /*      fields at once.                                                 */
+    /* -------------------------------------------------------------------- */
+    poLayer->ResetReading();
+    for (auto &&poFeature : *poLayer)
+    {
+        for (auto *poIndex : apoTargets)
+        {
+            OGRGenericAttrIndex::Entry sEntry;
+            if (poIndex->EntryFromFeature(poFeature.get(), sEntry))
+                poIndex->m_aoEntries.push_back(std::move(sEntry));
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Sort each field index; the sorts are independent, so when       */
+    /*      several fields were collected, spread them over a small         */
+    /*      thread pool.                                                    */
+    /* -------------------------------------------------------------------- */
+    if (apoTargets.size() > 1 && CPLGetNumCPUs() > 1)
+    {
+        CPLWorkerThreadPool oPool;
+        if (oPool.Setup(std::min(static_cast<int>(apoTargets.size()),
+                                 CPLGetNumCPUs()),
+                        nullptr, nullptr))
+        {
+            for (auto *poIndex : apoTargets)
+            {
+                oPool.SubmitJob([poIndex]() { poIndex->SortEntries(); });
+            }
+            oPool.WaitCompletion();
+        }
+        else
+        {
+            for (auto *poIndex : apoTargets)
+                poIndex->SortEntries();
+        }
+    }
+    else
+    {
+        for (auto *poIndex : apoTargets)
+            poIndex->SortEntries();
+    }
+
+    m_bModified = true;
+    return SaveToFile();
+}
+
+/************************************************************************/
+/*                            AddToIndex()                              */
+/************************************************************************/
+
+OGRErr OGRGenericLayerAttrIndex::AddToIndex(OGRFeature *poFeature, int iField)
+{
+    for (const auto &poIndex : m_apoIndexes)
+    {
+        if (iField >= 0 && poIndex->m_iField != iField)
+            continue;
+        OGRGenericAttrIndex::Entry sEntry;
+        if (poIndex->EntryFromFeature(poFeature, sEntry))
+        {
+            const auto oIter = std::lower_bound(
+                poIndex->m_aoEntries.begin(), poIndex->m_aoEntries.end(),
+                sEntry,
+                [&poIndex](const OGRGenericAttrIndex::Entry &sA,
+                           const OGRGenericAttrIndex::Entry &sB)
+                { return poIndex->KeyLess(sA, sB); });
+            poIndex->m_aoEntries.insert(oIter, std::move(sEntry));
+            m_bModified = true;
+        }
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                         RemoveFromIndex()                            */
+/************************************************************************/
+
+OGRErr OGRGenericLayerAttrIndex::RemoveFromIndex(OGRFeature *poFeature)
+{
+    for (const auto &poIndex : m_apoIndexes)
+    {
+        OGRGenericAttrIndex::Entry sEntry;
+        if (poIndex->EntryFromFeature(poFeature, sEntry))
+        {
+            OGRField sKey;
+            switch (poIndex->m_eType)
+            {
+                case OFTInteger:
+                    sKey.Integer = sEntry.u.nInt;
+                    break;
+                case OFTInteger64:
+                    sKey.Integer64 = sEntry.u.nInt64;
+                    break;
+                case OFTReal:
+                    sKey.Real = sEntry.u.dfReal;
+                    break;
+                default:
+                    sKey.String = &sEntry.osStr[0];
+                    break;
+            }
+            if (poIndex->RemoveEntry(&sKey, poFeature->GetFID()) ==
+                OGRERR_NONE)
+                m_bModified = true;
+        }
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           GetFieldIndex()                            */
+/************************************************************************/
+
+OGRAttrIndex *OGRGenericLayerAttrIndex::GetFieldIndex(int iField)
+{
+    return FindIndex(iField);
+}
+
+/************************************************************************/
+/*                     OGRCreateGenericLayerIndex()                     */
+/************************************************************************/
+
+OGRLayerAttrIndex *OGRCreateGenericLayerIndex()
+{
+    return new OGRGenericLayerAttrIndex();
+}
+
+//! @endcond
@@ -1491,6 +1491,127 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                           HashJoinFetch()                            */
+/************************************************************************/
+
+/** Fetch the joined feature of iJoin for poSrcFeat through an in-memory
+ * hash of the secondary table, when the join is a simple equality between
+ * a primary field and a secondary field (the overwhelmingly common case).
+ * The hash is built on first use by reading the secondary table once;
+ * nested-loop evaluation (one filtered scan per primary feature) remains
+ * the fallback for other join expressions or oversized tables.
+ *
+ * Returns true if the hash path handled the fetch (poJoinFeature possibly
+ * null when there is no match, like the fallback path).
+ */
+bool OGRGenSQLResultsLayer::HashJoinFetch(
+    int iJoin, OGRFeature *poSrcFeat,
+    std::unique_ptr<OGRFeature> &poJoinFeature)
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+
+    if (m_aoHashJoins.empty())
+        m_aoHashJoins.resize(psSelectInfo->join_count);
+    HashJoin &oHashJoin = m_aoHashJoins[iJoin];
+
+    if (oHashJoin.nState == -1)
+    {
+        oHashJoin.nState = 0;
+
+        // Only simple equality between a primary field and a secondary
+        // field, on key types with unambiguous string representation.
+        const swq_expr_node *poExpr = psJoinInfo->poExpr;
+        if (poExpr->eNodeType == SNT_OPERATION &&
+            poExpr->nOperation == SWQ_EQ && poExpr->nSubExprCount == 2 &&
+            poExpr->papoSubExpr[0]->eNodeType == SNT_COLUMN &&
+            poExpr->papoSubExpr[1]->eNodeType == SNT_COLUMN)
+        {
+            const swq_expr_node *poPrimary = nullptr;
+            const swq_expr_node *poSecondary = nullptr;
+            for (int i = 0; i < 2; ++i)
+            {
+                const swq_expr_node *poSub = poExpr->papoSubExpr[i];
+                if (poSub->table_index == 0)
+                    poPrimary = poSub;
+                else if (poSub->table_index == psJoinInfo->secondary_table)
+                    poSecondary = poSub;
+            }
+            OGRLayer *poJoinLayer =
+                m_apoTableLayers[psJoinInfo->secondary_table];
+            const auto poJoinDefn = poJoinLayer->GetLayerDefn();
+            const auto poSrcDefn = m_poSrcLayer->GetLayerDefn();
+            if (poPrimary && poSecondary && poPrimary->field_index >= 0 &&
+                poPrimary->field_index < poSrcDefn->GetFieldCount() &&
+                poSecondary->field_index >= 0 &&
+                poSecondary->field_index < poJoinDefn->GetFieldCount())
+            {
+                const OGRFieldType ePrimaryType =
+                    poSrcDefn->GetFieldDefn(poPrimary->field_index)
+                        ->GetType();
+                const OGRFieldType eSecondaryType =
+                    poJoinDefn->GetFieldDefn(poSecondary->field_index)
+                        ->GetType();
+                const auto IsHashableType = [](OGRFieldType eType)
+                {
+                    return eType == OFTInteger || eType == OFTInteger64 ||
+                           eType == OFTString;
+                };
+                const GIntBig nMaxRows = CPLAtoGIntBig(CPLGetConfigOption(
+                    "OGR_HASH_JOIN_MAX_ROWS", "1000000"));
+                if (ePrimaryType == eSecondaryType &&
+                    IsHashableType(ePrimaryType) && nMaxRows > 0)
+                {
+                    // Make sure the count is cheap to obtain, and bounded
+                    const GIntBig nRows =
+                        poJoinLayer->GetFeatureCount(/* bForce = */ FALSE);
+                    if (nRows >= 0 && nRows <= nMaxRows)
+                    {
+                        poJoinLayer->SetAttributeFilter("");
+                        poJoinLayer->ResetReading();
+                        for (auto &&poFeature : *poJoinLayer)
+                        {
+                            if (!poFeature->IsFieldSetAndNotNull(
+                                    poSecondary->field_index))
+                                continue;
+                            std::string osKey(poFeature->GetFieldAsString(
+                                poSecondary->field_index));
+                            // Keep the first matching feature, like the
+                            // nested-loop path does.
+                            oHashJoin.oMap.try_emplace(
+                                std::move(osKey),
+                                std::unique_ptr<OGRFeature>(
+                                    poFeature.release()));
+                        }
+                        oHashJoin.nPrimaryFieldIdx = poPrimary->field_index;
+                        oHashJoin.nSecondaryFieldIdx =
+                            poSecondary->field_index;
+                        oHashJoin.nState = 1;
+                        CPLDebug("OGR",
+                                 "Hash join on %d rows used for join %d",
+                                 static_cast<int>(oHashJoin.oMap.size()),
+                                 iJoin);
+                    }
+                }
+            }
+        }
+    }
+
+    if (oHashJoin.nState != 1)
+        return false;
+
+    poJoinFeature.reset();
+    if (poSrcFeat->IsFieldSetAndNotNull(oHashJoin.nPrimaryFieldIdx))
+    {
+        const auto oIter = oHashJoin.oMap.find(
+            poSrcFeat->GetFieldAsString(oHashJoin.nPrimaryFieldIdx));
+        if (oIter != oHashJoin.oMap.end())
+            poJoinFeature.reset(oIter->second->Clone());
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1524,6 +1645,15 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
 
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
+        {
+            std::unique_ptr<OGRFeature> poHashJoinFeature;
+            if (HashJoinFetch(iJoin, poSrcFeat, poHashJoinFeature))
+            {
+                apoFeatures.push_back(std::move(poHashJoinFeature));
+                continue;
+            }
+        }
+
         const std::string osFilter =
             GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
                              psJoinInfo->secondary_table);
@@ -2198,6 +2328,296 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
     }
 }
 
+/************************************************************************/
+/*                    CreateOrderByIndexExternal()                      */
+/************************************************************************/
+
+/** External merge sort variant of CreateOrderByIndex(): the (key tuple,
+ * FID) records are sorted in bounded in-memory runs spilled to a VSI
+ * temporary file, then k-way merged into m_anFIDIndex, so ORDER BY no
+ * longer requires holding every key of the result set in memory.
+ * Engaged by the OGR_ORDER_BY_MEM_LIMIT configuration option.
+ * Returns false to fall back to the in-memory path.
+ */
+bool OGRGenSQLResultsLayer::CreateOrderByIndexExternal(GIntBig nMemLimit)
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    const int nOrderItems = psSelectInfo->order_specs;
+
+    // Determine which keys carry strings, that need deep serialization.
+    std::vector<bool> abKeyIsString(nOrderItems);
+    for (int iKey = 0; iKey < nOrderItems; iKey++)
+    {
+        const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+        if (psKeyDef->field_index >= m_iFIDFieldIndex)
+        {
+            if (psKeyDef->field_index >=
+                m_iFIDFieldIndex + SPECIAL_FIELD_COUNT)
+                return false;
+            abKeyIsString[iKey] =
+                SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex] ==
+                SWQ_STRING;
+        }
+        else
+        {
+            const OGRFieldDefn *poFDefn =
+                m_poSrcLayer->GetLayerDefn()->GetFieldDefn(
+                    psKeyDef->field_index);
+            if (poFDefn == nullptr)
+                return false;
+            abKeyIsString[iKey] = poFDefn->GetType() == OFTString;
+        }
+    }
+
+    // Estimated in-memory record cost, to size the runs.
+    const size_t nApproxRecordSize =
+        sizeof(OGRField) * nOrderItems + sizeof(GIntBig) + 32;
+    const size_t nRunSize = static_cast<size_t>(std::max<GIntBig>(
+        1000, nMemLimit / static_cast<GIntBig>(nApproxRecordSize)));
+
+    const std::string osTmpFilename =
+        CPLGenerateTempFilenameSafe("ogr_orderby");
+    VSILFILE *fpTmp = VSIFOpenL(osTmpFilename.c_str(), "w+b");
+    if (fpTmp == nullptr)
+        return false;
+
+    struct TmpFileCloser
+    {
+        VSILFILE *m_fp;
+        const std::string &m_osFilename;
+
+        ~TmpFileCloser()
+        {
+            CPL_IGNORE_RET_VAL(VSIFCloseL(m_fp));
+            VSIUnlink(m_osFilename.c_str());
+        }
+    };
+
+    TmpFileCloser oCloser{fpTmp, osTmpFilename};
+
+    struct Run
+    {
+        vsi_l_offset nOffset = 0;
+        GUIntBig nRecords = 0;
+    };
+
+    std::vector<Run> aoRuns;
+
+    std::vector<OGRField> asRunFields;
+    std::vector<GIntBig> anRunFIDs;
+    try
+    {
+        asRunFields.resize(nOrderItems * nRunSize);
+        anRunFIDs.reserve(nRunSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): cannot allocate run buffer");
+        return false;
+    }
+    memset(asRunFields.data(), 0, sizeof(OGRField) * asRunFields.size());
+    size_t nRunCount = 0;
+
+    const auto SerializeRun = [&]()
+    {
+        if (nRunCount == 0)
+            return true;
+        std::vector<size_t> anSorted(nRunCount);
+        for (size_t i = 0; i < nRunCount; ++i)
+            anSorted[i] = i;
+        std::sort(anSorted.begin(), anSorted.end(),
+                  [this, &asRunFields, nOrderItems](size_t a, size_t b)
+                  {
+                      return Compare(asRunFields.data() + a * nOrderItems,
+                                     asRunFields.data() + b * nOrderItems) <
+                             0;
+                  });
+
+        Run sRun;
+        sRun.nOffset = VSIFTellL(fpTmp);
+        sRun.nRecords = nRunCount;
+        bool bOK = true;
+        for (size_t i = 0; bOK && i < nRunCount; ++i)
+        {
+            const size_t iRec = anSorted[i];
+            const GIntBig nFID = anRunFIDs[iRec];
+            bOK = VSIFWriteL(&nFID, sizeof(nFID), 1, fpTmp) == 1;
+            for (int iKey = 0; bOK && iKey < nOrderItems; ++iKey)
+            {
+                const OGRField *psField =
+                    asRunFields.data() + iRec * nOrderItems + iKey;
+                bOK = VSIFWriteL(psField, sizeof(OGRField), 1, fpTmp) == 1;
+                if (bOK && abKeyIsString[iKey] &&
+                    !OGR_RawField_IsUnset(psField) &&
+                    !OGR_RawField_IsNull(psField))
+                {
+                    const int nLen =
+                        static_cast<int>(strlen(psField->String));
+                    bOK = VSIFWriteL(&nLen, sizeof(nLen), 1, fpTmp) == 1 &&
+                          VSIFWriteL(psField->String, 1, nLen, fpTmp) ==
+                              static_cast<size_t>(nLen);
+                }
+            }
+        }
+        FreeIndexFields(asRunFields.data(), nRunCount);
+        memset(asRunFields.data(), 0,
+               sizeof(OGRField) * nOrderItems * nRunCount);
+        anRunFIDs.clear();
+        nRunCount = 0;
+        if (bOK)
+            aoRuns.push_back(sRun);
+        return bOK;
+    };
+
+    for (auto &&poSrcFeat : *m_poSrcLayer)
+    {
+        ReadIndexFields(poSrcFeat.get(), nOrderItems,
+                        asRunFields.data() + nRunCount * nOrderItems);
+        anRunFIDs.push_back(poSrcFeat->GetFID());
+        nRunCount++;
+        if (nRunCount == nRunSize)
+        {
+            if (!SerializeRun())
+                return false;
+        }
+    }
+    if (!SerializeRun())
+        return false;
+
+    /* -------------------------------------------------------------------- */
+    /*      K-way merge of the sorted runs into the FID index.              */
+    /* -------------------------------------------------------------------- */
+    struct RunReader
+    {
+        vsi_l_offset nOffset = 0;
+        GUIntBig nRemaining = 0;
+        GIntBig nFID = 0;
+        std::vector<OGRField> asFields{};
+    };
+
+    std::vector<RunReader> aoReaders(aoRuns.size());
+    const auto ReadRecord = [&](RunReader &oReader)
+    {
+        if (oReader.nRemaining == 0)
+            return false;
+        bool bOK = VSIFSeekL(fpTmp, oReader.nOffset, SEEK_SET) == 0 &&
+                   VSIFReadL(&oReader.nFID, sizeof(GIntBig), 1, fpTmp) == 1;
+        for (int iKey = 0; bOK && iKey < nOrderItems; ++iKey)
+        {
+            OGRField *psField = &oReader.asFields[iKey];
+            bOK = VSIFReadL(psField, sizeof(OGRField), 1, fpTmp) == 1;
+            if (bOK && abKeyIsString[iKey] &&
+                !OGR_RawField_IsUnset(psField) &&
+                !OGR_RawField_IsNull(psField))
+            {
+                int nLen = 0;
+                bOK = VSIFReadL(&nLen, sizeof(nLen), 1, fpTmp) == 1 &&
+                      nLen >= 0;
+                if (bOK)
+                {
+                    char *pszStr =
+                        static_cast<char *>(VSI_MALLOC_VERBOSE(nLen + 1));
+                    bOK = pszStr != nullptr &&
+                          VSIFReadL(pszStr, 1, nLen, fpTmp) ==
+                              static_cast<size_t>(nLen);
+                    if (bOK)
+                    {
+                        pszStr[nLen] = 0;
+                        psField->String = pszStr;
+                    }
+                    else
+                    {
+                        VSIFree(pszStr);
+                        psField->String = nullptr;
+                        OGR_RawField_SetNull(psField);
+                    }
+                }
+            }
+        }
+        if (bOK)
+        {
+            oReader.nOffset = VSIFTellL(fpTmp);
+            oReader.nRemaining--;
+        }
+        return bOK;
+    };
+
+    const auto FreeReaderStrings = [&](RunReader &oReader)
+    {
+        FreeIndexFields(oReader.asFields.data(), 1);
+        memset(oReader.asFields.data(), 0, sizeof(OGRField) * nOrderItems);
+    };
+
+    GUIntBig nTotalRecords = 0;
+    for (size_t i = 0; i < aoRuns.size(); ++i)
+    {
+        aoReaders[i].nOffset = aoRuns[i].nOffset;
+        aoReaders[i].nRemaining = aoRuns[i].nRecords;
+        aoReaders[i].asFields.resize(nOrderItems);
+        memset(aoReaders[i].asFields.data(), 0,
+               sizeof(OGRField) * nOrderItems);
+        nTotalRecords += aoRuns[i].nRecords;
+        if (aoReaders[i].nRemaining > 0 && !ReadRecord(aoReaders[i]))
+        {
+            for (auto &oReader : aoReaders)
+                FreeReaderStrings(oReader);
+            return false;
+        }
+    }
+
+    try
+    {
+        m_anFIDIndex.reserve(static_cast<size_t>(nTotalRecords));
+    }
+    catch (const std::exception &)
+    {
+        for (auto &oReader : aoReaders)
+            FreeReaderStrings(oReader);
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): out of memory");
+        return false;
+    }
+
+    std::vector<size_t> anActive;
+    for (size_t i = 0; i < aoReaders.size(); ++i)
+    {
+        if (aoRuns[i].nRecords > 0)
+            anActive.push_back(i);
+    }
+
+    while (!anActive.empty())
+    {
+        size_t iBest = 0;
+        for (size_t i = 1; i < anActive.size(); ++i)
+        {
+            if (Compare(aoReaders[anActive[i]].asFields.data(),
+                        aoReaders[anActive[iBest]].asFields.data()) < 0)
+                iBest = i;
+        }
+        RunReader &oReader = aoReaders[anActive[iBest]];
+        m_anFIDIndex.push_back(oReader.nFID);
+        FreeReaderStrings(oReader);
+        if (oReader.nRemaining == 0)
+        {
+            anActive.erase(anActive.begin() + iBest);
+        }
+        else if (!ReadRecord(oReader))
+        {
+            for (auto &oReader2 : aoReaders)
+                FreeReaderStrings(oReader2);
+            m_anFIDIndex.clear();
+            return false;
+        }
+    }
+
+    CPLDebug("GenSQL",
+             "CreateOrderByIndex(): external merge sort of " CPL_FRMT_GUIB
+             " records in %d runs",
+             nTotalRecords, static_cast<int>(aoRuns.size()));
+    return true;
+}
+
 /************************************************************************/
 /*                         CreateOrderByIndex()                         */
 /*                                                                      */
@@ -2272,6 +2692,24 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         return;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      External merge sort when a memory budget is set.                */
+    /* -------------------------------------------------------------------- */
+    if (const char *pszMemLimit =
+            CPLGetConfigOption("OGR_ORDER_BY_MEM_LIMIT", nullptr))
+    {
+        GIntBig nMemLimit = 0;
+        bool bUnitSpecified = false;
+        if (CPLParseMemorySize(pszMemLimit, &nMemLimit, &bUnitSpecified) ==
+                CE_None &&
+            nMemLimit > 0)
+        {
+            if (CreateOrderByIndexExternal(nMemLimit))
+                return;
+            m_anFIDIndex.clear();
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate set of key values, and the output index.               */
     /* -------------------------------------------------------------------- */
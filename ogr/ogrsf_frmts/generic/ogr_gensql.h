@@ -15,6 +15,9 @@
 #define OGR_GENSQL_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+
+#include <map>
+#include <memory>
 #include "ogr_swq.h"
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
@@ -74,6 +77,28 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    /** In-memory hash of a joined table for simple equality joins: keyed
+     * on the (stringified) join key, holding the first matching feature,
+     * so the secondary table is read once instead of once per primary
+     * feature. */
+    struct HashJoin
+    {
+        //! -1: not analyzed yet, 0: not usable, 1: usable
+        int nState = -1;
+        //! Field index of the join key in the secondary table
+        int nSecondaryFieldIdx = -1;
+        //! Field index of the join key in the primary table
+        int nPrimaryFieldIdx = -1;
+        std::map<std::string, std::unique_ptr<OGRFeature>> oMap{};
+    };
+
+    std::vector<HashJoin> m_aoHashJoins{};
+
+    bool HashJoinFetch(int iJoin, OGRFeature *poSrcFeat,
+                       std::unique_ptr<OGRFeature> &poJoinFeature);
+
+    bool CreateOrderByIndexExternal(GIntBig nMemLimit);
+
     bool PrepareSummary() const;
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
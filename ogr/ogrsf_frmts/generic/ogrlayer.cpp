@@ -4398,19 +4398,35 @@ void OGR_L_ResetReading(OGRLayerH hLayer)
 /************************************************************************/
 
 //! @cond Doxygen_Suppress
-OGRErr
-OGRLayer::InitializeIndexSupport([[maybe_unused]] const char *pszFilename)
+OGRErr OGRLayer::InitializeIndexSupport(const char *pszFilename)
 
 {
-#ifdef HAVE_MITAB
-    OGRErr eErr;
-
     if (m_poAttrIndex != nullptr)
         return OGRERR_NONE;
 
-    m_poAttrIndex = OGRCreateDefaultLayerIndex();
+#ifdef HAVE_MITAB
+    /* -------------------------------------------------------------------- */
+    /*      Stick to the legacy MapInfo .ind machinery when its sidecars    */
+    /*      already exist, or when given its inline XML configuration, so   */
+    /*      that existing indexes remain usable.                            */
+    /* -------------------------------------------------------------------- */
+    if (STARTS_WITH_CI(pszFilename, "<OGRMILayerAttrIndex>"))
+    {
+        m_poAttrIndex = OGRCreateDefaultLayerIndex();
+    }
+    else
+    {
+        VSIStatBufL sStat;
+        if (VSIStatExL(CPLResetExtensionSafe(pszFilename, "idm").c_str(),
+                       &sStat, VSI_STAT_EXISTS_FLAG) == 0)
+            m_poAttrIndex = OGRCreateDefaultLayerIndex();
+    }
+#endif
 
-    eErr = m_poAttrIndex->Initialize(pszFilename, this);
+    if (m_poAttrIndex == nullptr)
+        m_poAttrIndex = OGRCreateGenericLayerIndex();
+
+    const OGRErr eErr = m_poAttrIndex->Initialize(pszFilename, this);
     if (eErr != OGRERR_NONE)
     {
         delete m_poAttrIndex;
@@ -4418,9 +4434,6 @@ OGRLayer::InitializeIndexSupport([[maybe_unused]] const char *pszFilename)
     }
 
     return eErr;
-#else
-    return OGRERR_FAILURE;
-#endif
 }
 
 //! @endcond
@@ -1047,20 +1047,67 @@ void OGRGeoJSONDataSource::LoadLayers(GDALOpenInfo *poOpenInfo,
         (!STARTS_WITH(pszUnprefixed, "/vsistdin/") ||
          (nMaxBytesFirstPass > 0 && nMaxBytesFirstPass <= 1000000)))
     {
-        const char *pszStr = strstr(pszGeoData_, "\"features\"");
-        if (pszStr)
+        const auto HasFeaturesArray = [](const char *pszText)
         {
-            pszStr += strlen("\"features\"");
-            while (*pszStr && isspace(static_cast<unsigned char>(*pszStr)))
-                pszStr++;
-            if (*pszStr == ':')
+            const char *pszStr = strstr(pszText, "\"features\"");
+            if (pszStr)
             {
-                pszStr++;
-                while (*pszStr && isspace(static_cast<unsigned char>(*pszStr)))
+                pszStr += strlen("\"features\"");
+                while (*pszStr &&
+                       isspace(static_cast<unsigned char>(*pszStr)))
                     pszStr++;
-                if (*pszStr == '[')
+                if (*pszStr == ':')
                 {
-                    bUseStreamingInterface = true;
+                    pszStr++;
+                    while (*pszStr &&
+                           isspace(static_cast<unsigned char>(*pszStr)))
+                        pszStr++;
+                    if (*pszStr == '[')
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+
+        bUseStreamingInterface = HasFeaturesArray(pszGeoData_);
+
+        if (!bUseStreamingInterface &&
+            !STARTS_WITH(pszUnprefixed, "/vsistdin/"))
+        {
+            // The "features" member may sit beyond the few KB ingested so
+            // far (e.g. after large "name"/"crs"/metadata members): probe a
+            // larger window before giving up and ingesting the whole file
+            // in memory.
+            VSILFILE *fpProbe = fp ? fp : poOpenInfo->fpL;
+            const size_t nProbeSize = static_cast<size_t>(std::max(
+                0, atoi(CPLGetConfigOption("OGR_GEOJSON_PROBE_SIZE",
+                                           "1048576"))));
+            if (fpProbe != nullptr && nProbeSize > strlen(pszGeoData_))
+            {
+                std::string osProbe;
+                try
+                {
+                    osProbe.resize(nProbeSize);
+                }
+                catch (const std::exception &)
+                {
+                }
+                if (!osProbe.empty() &&
+                    VSIFSeekL(fpProbe, 0, SEEK_SET) == 0)
+                {
+                    osProbe.resize(
+                        VSIFReadL(&osProbe[0], 1, osProbe.size(), fpProbe));
+                    // JSON text should not contain NUL bytes, but do not
+                    // let them truncate the strstr() scan.
+                    for (char &ch : osProbe)
+                    {
+                        if (ch == 0)
+                            ch = ' ';
+                    }
+                    bUseStreamingInterface =
+                        HasFeaturesArray(osProbe.c_str());
                 }
             }
         }
@@ -13,6 +13,11 @@
 
 #include "cpl_port.h"
 #include "gmlreaderp.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include "gmlreader.h"
 
 #include <climits>
@@ -193,6 +198,104 @@ void GMLReader::SetFP(VSILFILE *fp)
     fpGML = fp;
 }
 
+/************************************************************************/
+/*                          GMLChunkPrefetcher                          */
+/************************************************************************/
+
+/** Reads the GML file by PARSER_BUF_SIZE chunks on a dedicated thread,
+ * keeping a small ring of chunks ahead of the Expat parser, so that file
+ * reading (potentially involving decompression or network transfers)
+ * overlaps with XML parsing and feature assembly.
+ */
+class GMLChunkPrefetcher
+{
+  public:
+    struct Chunk
+    {
+        std::vector<char> abyData{};
+        unsigned int nLen = 0;
+        bool bLast = false;
+    };
+
+  private:
+    VSILFILE *m_fp;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<Chunk> m_oQueue{};
+    bool m_bStop = false;
+    std::thread m_oThread{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GMLChunkPrefetcher)
+
+    static constexpr size_t MAX_QUEUED_CHUNKS = 4;
+
+    void Run()
+    {
+        while (true)
+        {
+            Chunk sChunk;
+            try
+            {
+                sChunk.abyData.resize(PARSER_BUF_SIZE);
+            }
+            catch (const std::exception &)
+            {
+                sChunk.bLast = true;
+            }
+            if (!sChunk.bLast)
+            {
+                sChunk.nLen = static_cast<unsigned int>(VSIFReadL(
+                    &sChunk.abyData[0], 1, PARSER_BUF_SIZE, m_fp));
+                sChunk.bLast = sChunk.nLen < PARSER_BUF_SIZE;
+            }
+            const bool bLast = sChunk.bLast;
+            {
+                std::unique_lock<std::mutex> oLock(m_oMutex);
+                m_oCV.wait(oLock,
+                           [this]() {
+                               return m_bStop ||
+                                      m_oQueue.size() < MAX_QUEUED_CHUNKS;
+                           });
+                if (m_bStop)
+                    break;
+                m_oQueue.push_back(std::move(sChunk));
+            }
+            m_oCV.notify_all();
+            if (bLast)
+                break;
+        }
+    }
+
+  public:
+    explicit GMLChunkPrefetcher(VSILFILE *fp) : m_fp(fp)
+    {
+        m_oThread = std::thread([this]() { Run(); });
+    }
+
+    ~GMLChunkPrefetcher()
+    {
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            m_bStop = true;
+        }
+        m_oCV.notify_all();
+        if (m_oThread.joinable())
+            m_oThread.join();
+    }
+
+    /** Returns the next chunk. A chunk with bLast = true is the final
+     * one: the caller must not ask for further chunks afterwards. */
+    Chunk GetNextChunk()
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oCV.wait(oLock, [this]() { return !m_oQueue.empty(); });
+        Chunk sChunk = std::move(m_oQueue.front());
+        m_oQueue.pop_front();
+        m_oCV.notify_all();
+        return sChunk;
+    }
+};
+
 /************************************************************************/
 /*                            SetupParser()                             */
 /************************************************************************/
@@ -200,6 +303,10 @@ void GMLReader::SetFP(VSILFILE *fp)
 bool GMLReader::SetupParser()
 
 {
+    // Stop any chunk prefetching before touching the file handle.
+    m_poChunkPrefetcher.reset();
+    m_bPrefetcherFinished = false;
+
     if (fpGML == nullptr)
         fpGML = VSIFOpenL(m_pszFilename, "rt");
     if (fpGML != nullptr)
@@ -335,6 +442,12 @@ bool GMLReader::SetupParserExpat()
     if (pabyBuf == nullptr)
         return false;
 
+    if (fpGML != nullptr &&
+        CPLTestBool(CPLGetConfigOption("OGR_GML_PREFETCH_THREAD", "YES")))
+    {
+        m_poChunkPrefetcher = std::make_unique<GMLChunkPrefetcher>(fpGML);
+    }
+
     return true;
 }
 #endif
@@ -346,6 +459,10 @@ bool GMLReader::SetupParserExpat()
 void GMLReader::CleanupParser()
 
 {
+    // Must be stopped before anything else, as it reads from fpGML.
+    m_poChunkPrefetcher.reset();
+    m_bPrefetcherFinished = false;
+
 #ifdef HAVE_XERCES
     if (!bUseExpatReader && m_poSAXReader == nullptr)
         return;
@@ -475,8 +592,14 @@ GMLFeature *GMLReader::NextFeatureExpat()
         return nullptr;
     }
 
-    if (fpGML == nullptr || m_bStopParsing || VSIFEofL(fpGML) ||
-        VSIFErrorL(fpGML))
+    if (fpGML == nullptr || m_bStopParsing)
+        return nullptr;
+    if (m_poChunkPrefetcher != nullptr)
+    {
+        if (m_bPrefetcherFinished)
+            return nullptr;
+    }
+    else if (VSIFEofL(fpGML) || VSIFErrorL(fpGML))
         return nullptr;
 
     this->nFeatureTabLength = 0;
@@ -489,18 +612,34 @@ GMLFeature *GMLReader::NextFeatureExpat()
         static_cast<GMLExpatHandler *>(m_poGMLHandler)
             ->ResetDataHandlerCounter();
 
-        unsigned int nLen = static_cast<unsigned int>(
-            VSIFReadL(pabyBuf, 1, PARSER_BUF_SIZE, fpGML));
-        nDone = nLen < PARSER_BUF_SIZE;
+        unsigned int nLen;
+        const char *pabyParseBuf;
+        GMLChunkPrefetcher::Chunk sChunk;
+        if (m_poChunkPrefetcher != nullptr)
+        {
+            sChunk = m_poChunkPrefetcher->GetNextChunk();
+            nLen = sChunk.nLen;
+            nDone = sChunk.bLast;
+            if (sChunk.bLast)
+                m_bPrefetcherFinished = true;
+            pabyParseBuf = sChunk.abyData.data();
+        }
+        else
+        {
+            nLen = static_cast<unsigned int>(
+                VSIFReadL(pabyBuf, 1, PARSER_BUF_SIZE, fpGML));
+            nDone = nLen < PARSER_BUF_SIZE;
+            pabyParseBuf = pabyBuf;
+        }
 
         // Some files, such as APT_AIXM.xml from
         // https://nfdc.faa.gov/webContent/56DaySub/2015-03-05/aixm5.1.zip
         // end with trailing nul characters. This test is not fully bullet-proof
         // in case the nul characters would occur at a buffer boundary.
-        while (nDone && nLen > 0 && pabyBuf[nLen - 1] == '\0')
+        while (nDone && nLen > 0 && pabyParseBuf[nLen - 1] == '\0')
             nLen--;
 
-        if (XML_Parse(oParser, pabyBuf, nLen, nDone) == XML_STATUS_ERROR)
+        if (XML_Parse(oParser, pabyParseBuf, nLen, nDone) == XML_STATUS_ERROR)
         {
             // Defer emission of the error message until we have to return
             // nullptr
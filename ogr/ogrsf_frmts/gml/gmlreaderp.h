@@ -29,12 +29,14 @@
 #include "gmlutils.h"
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 #define PARSER_BUF_SIZE (10 * 8192)
 
 class GMLReader;
+class GMLChunkPrefetcher;
 
 typedef struct _GeometryNamesStruct GeometryNamesStruct;
 
@@ -395,6 +397,10 @@ class GMLReader final : public IGMLReader
 #endif
 
     VSILFILE *fpGML = nullptr;
+
+    std::unique_ptr<GMLChunkPrefetcher> m_poChunkPrefetcher{};
+
+    bool m_bPrefetcherFinished = false;
     bool m_bReadStarted = false;
 
     GMLReadState *m_poState = nullptr;
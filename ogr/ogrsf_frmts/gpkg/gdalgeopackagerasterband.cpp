@@ -53,6 +53,7 @@ GDALGPKGMBTilesLikePseudoDataset::GDALGPKGMBTilesLikePseudoDataset()
 
 GDALGPKGMBTilesLikePseudoDataset::~GDALGPKGMBTilesLikePseudoDataset()
 {
+    FinalizeCachedReadTileStmt();
     if (m_poParentDS == nullptr && m_hTempDB != nullptr)
     {
         sqlite3_close(m_hTempDB);
@@ -840,6 +841,20 @@ void GDALGPKGMBTilesLikePseudoDataset::GetTileOffsetAndScale(
     }
 }
 
+/************************************************************************/
+/*                     FinalizeCachedReadTileStmt()                     */
+/************************************************************************/
+
+void GDALGPKGMBTilesLikePseudoDataset::FinalizeCachedReadTileStmt()
+{
+    if (m_hCachedReadTileStmt)
+    {
+        sqlite3_finalize(m_hCachedReadTileStmt);
+        m_hCachedReadTileStmt = nullptr;
+    }
+    m_osCachedReadTileSQL.clear();
+}
+
 /************************************************************************/
 /*                              ReadTile()                              */
 /************************************************************************/
@@ -871,24 +886,37 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
 
     char *pszSQL = sqlite3_mprintf(
         "SELECT tile_data%s FROM \"%w\" "
-        "WHERE zoom_level = %d AND tile_row = %d AND tile_column = %d%s",
+        "WHERE zoom_level = ?1 AND tile_row = ?2 AND tile_column = ?3%s",
         m_eDT != GDT_UInt8 ? ", id" : "",  // MBTiles do not have an id
-        m_osRasterTable.c_str(), m_nZoomLevel,
-        GetRowFromIntoTopConvention(nRow), nCol,
+        m_osRasterTable.c_str(),
         !m_osWHERE.empty() ? CPLSPrintf(" AND (%s)", m_osWHERE.c_str()) : "");
 
 #ifdef DEBUG_VERBOSE
     CPLDebug("GPKG", "%s", pszSQL);
 #endif
 
-    sqlite3_stmt *hStmt = nullptr;
-    int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt, nullptr);
-    sqlite3_free(pszSQL);
-    if (rc != SQLITE_OK)
+    // Reuse the prepared statement across calls: only the bound zoom level
+    // and tile coordinates change from one tile to the next.
+    if (m_hCachedReadTileStmt == nullptr || m_osCachedReadTileSQL != pszSQL)
     {
-        return nullptr;
+        FinalizeCachedReadTileStmt();
+        int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1,
+                                     &m_hCachedReadTileStmt, nullptr);
+        if (rc != SQLITE_OK)
+        {
+            sqlite3_free(pszSQL);
+            return nullptr;
+        }
+        m_osCachedReadTileSQL = pszSQL;
     }
-    rc = sqlite3_step(hStmt);
+    sqlite3_free(pszSQL);
+
+    sqlite3_stmt *hStmt = m_hCachedReadTileStmt;
+    sqlite3_reset(hStmt);
+    sqlite3_bind_int(hStmt, 1, m_nZoomLevel);
+    sqlite3_bind_int(hStmt, 2, GetRowFromIntoTopConvention(nRow));
+    sqlite3_bind_int(hStmt, 3, nCol);
+    int rc = sqlite3_step(hStmt);
 
     if (rc == SQLITE_ROW && sqlite3_column_type(hStmt, 0) == SQLITE_BLOB)
     {
@@ -909,7 +937,7 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
         ReadTile(osMemFileName, pabyData, dfTileOffset, dfTileScale,
                  pbIsLossyFormat);
         VSIUnlink(osMemFileName);
-        sqlite3_finalize(hStmt);
+        sqlite3_reset(hStmt);
     }
     else if (rc == SQLITE_BUSY)
     {
@@ -917,12 +945,12 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
         CPLError(CE_Failure, CPLE_AppDefined,
                  "sqlite3_step(%s) failed (SQLITE_BUSY): %s",
                  sqlite3_sql(hStmt), sqlite3_errmsg(IGetDB()));
-        sqlite3_finalize(hStmt);
+        sqlite3_reset(hStmt);
         return pabyData;
     }
     else
     {
-        sqlite3_finalize(hStmt);
+        sqlite3_reset(hStmt);
         hStmt = nullptr;
 
         if (m_hTempDB && (m_nShiftXPixelsMod || m_nShiftYPixelsMod))
@@ -2383,11 +2411,21 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             /* Create or commit and recreate transaction */
             GDALGPKGMBTilesLikePseudoDataset *poMainDS =
                 m_poParentDS ? m_poParentDS : this;
+            if (poMainDS->m_nTileTransactionSize < 0)
+            {
+                // Larger transactions amortize the fsync/journal cost of
+                // tile seeding; the default matches the previous hardcoded
+                // batching.
+                poMainDS->m_nTileTransactionSize = std::max(
+                    1, atoi(CPLGetConfigOption("GDAL_TILE_TRANSACTION_SIZE",
+                                               "1000")));
+            }
             if (poMainDS->m_nTileInsertionCount == 0)
             {
                 poMainDS->IStartTransaction();
             }
-            else if (poMainDS->m_nTileInsertionCount == 1000)
+            else if (poMainDS->m_nTileInsertionCount >=
+                     poMainDS->m_nTileTransactionSize)
             {
                 if (poMainDS->ICommitTransaction() != OGRERR_NONE)
                 {
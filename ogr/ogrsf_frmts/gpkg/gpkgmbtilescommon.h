@@ -60,6 +60,13 @@ class GDALGPKGMBTilesLikePseudoDataset /* non final */
     double m_dfPrecision = 1.0;
     GUInt16 m_usGPKGNull = 0;
     int m_nZoomLevel = -1;
+    // Cached prepared statement of the per-tile SELECT of ReadTile(), and
+    // the SQL text it was prepared from
+    sqlite3_stmt *m_hCachedReadTileStmt = nullptr;
+    std::string m_osCachedReadTileSQL{};
+    // Number of tile inserts grouped in one transaction (lazily read from
+    // the GDAL_TILE_TRANSACTION_SIZE configuration option)
+    int m_nTileTransactionSize = -1;
     GByte *m_pabyCachedTiles = nullptr;
     CachedTileDesc m_asCachedTilesDesc[4];
     int m_nShiftXTiles = 0;
@@ -111,6 +118,10 @@ class GDALGPKGMBTilesLikePseudoDataset /* non final */
     GDALGPKGMBTilesLikePseudoDataset();
     virtual ~GDALGPKGMBTilesLikePseudoDataset();
 
+    /** To be called by implementations before closing their database
+     * connection. */
+    void FinalizeCachedReadTileStmt();
+
     void SetDataType(GDALDataType eDT);
     void SetGlobalOffsetScale(double dfOffset, double dfScale);
 
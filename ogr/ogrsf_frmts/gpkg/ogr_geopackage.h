@@ -98,12 +98,22 @@ struct OGRGPKGTableLayerFillArrowArray
     struct tm brokenDown{};
 
     sqlite3 *hDB = nullptr;
+    // Pooled read-only connection backing hDB, if any (must be returned to
+    // its dataset on destruction)
+    sqlite3 *hPooledDB = nullptr;
+    OGRSQLiteBaseDataSource *poDSForPooledDB = nullptr;
     std::mutex oMutex{};
     std::condition_variable oCV{};
     GIntBig nCurFID = 0;
     uint32_t nMemLimit = 0;
     // For spatial filtering
     const OGRLayer *poLayerForFilterGeom = nullptr;
+
+    ~OGRGPKGTableLayerFillArrowArray()
+    {
+        if (hPooledDB)
+            poDSForPooledDB->ReleaseReadOnlyDB(hPooledDB);
+    }
 };
 
 void OGR_GPKG_Intersects_Spatial_Filter(sqlite3_context *pContext, int argc,
@@ -473,6 +483,9 @@ class GDALGeoPackageDataset final : public OGRSQLiteBaseDataSource,
     bool ReOpenDB();
     bool OpenOrCreateDB(int flags);
     void InstallSQLFunctions();
+    void *InstallSQLFunctions(sqlite3 *hDBIn);
+    bool PrepareReadOnlyConnection(sqlite3 *hDBIn) override;
+    std::map<sqlite3 *, void *> m_oMapPooledConnFunctionData{};
     bool HasGDALAspatialExtension();
     std::string CreateRasterTriggersSQL(const std::string &osTableName);
 };
@@ -959,6 +972,8 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     OGRErr Truncate();
 
+    bool ClusterByHilbert();
+
     bool HasSpatialIndex() const;
 
     void SetPrecisionFlag(int bFlag)
@@ -201,8 +201,12 @@ OGRErr GDALGeoPackageDataset::SetApplicationAndUserVersionId()
 
 bool GDALGeoPackageDataset::CloseDB()
 {
+    FinalizeCachedReadTileStmt();
     OGRSQLiteUnregisterSQLFunctions(m_pSQLFunctionData);
     m_pSQLFunctionData = nullptr;
+    for (const auto &oIter : m_oMapPooledConnFunctionData)
+        OGRSQLiteUnregisterSQLFunctions(oIter.second);
+    m_oMapPooledConnFunctionData.clear();
     return OGRSQLiteBaseDataSource::CloseDB();
 }
 
@@ -7501,6 +7505,28 @@ OGRLayer *GDALGeoPackageDataset::ExecuteSQL(const char *pszSQLCommand,
         return nullptr;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Special case CLUSTER BY HILBERT command.                        */
+    /* -------------------------------------------------------------------- */
+    if (STARTS_WITH_CI(osSQLCommand, "CLUSTER BY HILBERT "))
+    {
+        const char *pszLayerName =
+            osSQLCommand.c_str() + strlen("CLUSTER BY HILBERT ");
+
+        while (*pszLayerName == ' ')
+            pszLayerName++;
+
+        int idx = FindLayerIndex(pszLayerName);
+        if (idx >= 0)
+        {
+            m_apoLayers[idx]->ClusterByHilbert();
+        }
+        else
+            CPLError(CE_Failure, CPLE_AppDefined, "Unknown layer: %s",
+                     pszLayerName);
+        return nullptr;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Intercept DROP TABLE                                            */
     /* -------------------------------------------------------------------- */
@@ -9487,6 +9513,26 @@ static void GPKG_ST_Hilbert_Geom_TableName(sqlite3_context *pContext, int argc,
 #endif
 
 void GDALGeoPackageDataset::InstallSQLFunctions()
+{
+    m_pSQLFunctionData = InstallSQLFunctions(hDB);
+}
+
+/************************************************************************/
+/*                     PrepareReadOnlyConnection()                      */
+/************************************************************************/
+
+bool GDALGeoPackageDataset::PrepareReadOnlyConnection(sqlite3 *hDBIn)
+{
+    // The SpatiaLite context is tied to the main connection: a filter
+    // referencing SpatiaLite functions could not be evaluated on the
+    // pooled connection, so do not hand out connections in that case.
+    if (hSpatialiteCtxt != nullptr)
+        return false;
+    m_oMapPooledConnFunctionData[hDBIn] = InstallSQLFunctions(hDBIn);
+    return true;
+}
+
+void *GDALGeoPackageDataset::InstallSQLFunctions(sqlite3 *hDBIn)
 {
     InitSpatialite();
 
@@ -9495,137 +9541,139 @@ void GDALGeoPackageDataset::InstallSQLFunctions()
     // explicit conversion.
     // Use sqlite3_exec() instead of SQLCommand() since we don't want verbose
     // error.
-    sqlite3_exec(hDB, "SELECT EnableGpkgMode()", nullptr, nullptr, nullptr);
+    sqlite3_exec(hDBIn, "SELECT EnableGpkgMode()", nullptr, nullptr, nullptr);
 
     /* Used by RTree Spatial Index Extension */
-    sqlite3_create_function(hDB, "ST_MinX", 1, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_MinX", 1, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTMinX, nullptr, nullptr);
-    sqlite3_create_function(hDB, "ST_MinY", 1, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_MinY", 1, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTMinY, nullptr, nullptr);
-    sqlite3_create_function(hDB, "ST_MaxX", 1, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_MaxX", 1, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTMaxX, nullptr, nullptr);
-    sqlite3_create_function(hDB, "ST_MaxY", 1, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_MaxY", 1, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTMaxY, nullptr, nullptr);
-    sqlite3_create_function(hDB, "ST_IsEmpty", 1, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_IsEmpty", 1, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTIsEmpty, nullptr, nullptr);
 
     /* Used by Geometry Type Triggers Extension */
-    sqlite3_create_function(hDB, "ST_GeometryType", 1, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_GeometryType", 1, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTGeometryType, nullptr, nullptr);
-    sqlite3_create_function(hDB, "GPKG_IsAssignable", 2, UTF8_INNOCUOUS,
+    sqlite3_create_function(hDBIn, "GPKG_IsAssignable", 2, UTF8_INNOCUOUS,
                             nullptr, OGRGeoPackageGPKGIsAssignable, nullptr,
                             nullptr);
 
     /* Used by Geometry SRS ID Triggers Extension */
-    sqlite3_create_function(hDB, "ST_SRID", 1, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_SRID", 1, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTSRID, nullptr, nullptr);
 
     /* Spatialite-like functions */
-    sqlite3_create_function(hDB, "CreateSpatialIndex", 2, SQLITE_UTF8, this,
+    sqlite3_create_function(hDBIn, "CreateSpatialIndex", 2, SQLITE_UTF8, this,
                             OGRGeoPackageCreateSpatialIndex, nullptr, nullptr);
-    sqlite3_create_function(hDB, "DisableSpatialIndex", 2, SQLITE_UTF8, this,
+    sqlite3_create_function(hDBIn, "DisableSpatialIndex", 2, SQLITE_UTF8, this,
                             OGRGeoPackageDisableSpatialIndex, nullptr, nullptr);
-    sqlite3_create_function(hDB, "HasSpatialIndex", 2, SQLITE_UTF8, this,
+    sqlite3_create_function(hDBIn, "HasSpatialIndex", 2, SQLITE_UTF8, this,
                             OGRGeoPackageHasSpatialIndex, nullptr, nullptr);
 
     // HSTORE functions
-    sqlite3_create_function(hDB, "hstore_get_value", 2, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "hstore_get_value", 2, UTF8_INNOCUOUS, nullptr,
                             GPKG_hstore_get_value, nullptr, nullptr);
 
     // Override a few Spatialite functions to work with gpkg_spatial_ref_sys
-    sqlite3_create_function(hDB, "ST_Transform", 2, UTF8_INNOCUOUS, this,
+    sqlite3_create_function(hDBIn, "ST_Transform", 2, UTF8_INNOCUOUS, this,
                             OGRGeoPackageTransform, nullptr, nullptr);
-    sqlite3_create_function(hDB, "Transform", 2, UTF8_INNOCUOUS, this,
+    sqlite3_create_function(hDBIn, "Transform", 2, UTF8_INNOCUOUS, this,
                             OGRGeoPackageTransform, nullptr, nullptr);
-    sqlite3_create_function(hDB, "SridFromAuthCRS", 2, SQLITE_UTF8, this,
+    sqlite3_create_function(hDBIn, "SridFromAuthCRS", 2, SQLITE_UTF8, this,
                             OGRGeoPackageSridFromAuthCRS, nullptr, nullptr);
 
-    sqlite3_create_function(hDB, "ST_EnvIntersects", 2, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_EnvIntersects", 2, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTEnvelopesIntersectsTwoParams,
                             nullptr, nullptr);
     sqlite3_create_function(
-        hDB, "ST_EnvelopesIntersects", 2, UTF8_INNOCUOUS, nullptr,
+        hDBIn, "ST_EnvelopesIntersects", 2, UTF8_INNOCUOUS, nullptr,
         OGRGeoPackageSTEnvelopesIntersectsTwoParams, nullptr, nullptr);
 
-    sqlite3_create_function(hDB, "ST_EnvIntersects", 5, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_EnvIntersects", 5, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTEnvelopesIntersects, nullptr,
                             nullptr);
-    sqlite3_create_function(hDB, "ST_EnvelopesIntersects", 5, UTF8_INNOCUOUS,
+    sqlite3_create_function(hDBIn, "ST_EnvelopesIntersects", 5, UTF8_INNOCUOUS,
                             nullptr, OGRGeoPackageSTEnvelopesIntersects,
                             nullptr, nullptr);
 
     // Implementation that directly hacks the GeoPackage geometry blob header
-    sqlite3_create_function(hDB, "SetSRID", 2, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "SetSRID", 2, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSetSRID, nullptr, nullptr);
 
     // GDAL specific function
-    sqlite3_create_function(hDB, "ImportFromEPSG", 1, SQLITE_UTF8, this,
+    sqlite3_create_function(hDBIn, "ImportFromEPSG", 1, SQLITE_UTF8, this,
                             OGRGeoPackageImportFromEPSG, nullptr, nullptr);
 
     // May be used by ogrmerge.py
-    sqlite3_create_function(hDB, "RegisterGeometryExtension", 3, SQLITE_UTF8,
+    sqlite3_create_function(hDBIn, "RegisterGeometryExtension", 3, SQLITE_UTF8,
                             this, OGRGeoPackageRegisterGeometryExtension,
                             nullptr, nullptr);
 
     if (OGRGeometryFactory::haveGEOS())
     {
-        sqlite3_create_function(hDB, "ST_MakeValid", 1, UTF8_INNOCUOUS, nullptr,
+        sqlite3_create_function(hDBIn, "ST_MakeValid", 1, UTF8_INNOCUOUS, nullptr,
                                 OGRGeoPackageSTMakeValid, nullptr, nullptr);
     }
 
-    sqlite3_create_function(hDB, "ST_Length", 1, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_Length", 1, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageLengthOrGeodesicLength, nullptr,
                             nullptr);
-    sqlite3_create_function(hDB, "ST_Length", 2, UTF8_INNOCUOUS, this,
+    sqlite3_create_function(hDBIn, "ST_Length", 2, UTF8_INNOCUOUS, this,
                             OGRGeoPackageLengthOrGeodesicLength, nullptr,
                             nullptr);
 
-    sqlite3_create_function(hDB, "ST_Area", 1, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_Area", 1, UTF8_INNOCUOUS, nullptr,
                             OGRGeoPackageSTArea, nullptr, nullptr);
-    sqlite3_create_function(hDB, "ST_Area", 2, UTF8_INNOCUOUS, this,
+    sqlite3_create_function(hDBIn, "ST_Area", 2, UTF8_INNOCUOUS, this,
                             OGRGeoPackageGeodesicArea, nullptr, nullptr);
 
     // Debug functions
     if (CPLTestBool(CPLGetConfigOption("GPKG_DEBUG", "FALSE")))
     {
-        sqlite3_create_function(hDB, "GDAL_GetMimeType", 1,
+        sqlite3_create_function(hDBIn, "GDAL_GetMimeType", 1,
                                 SQLITE_UTF8 | SQLITE_DETERMINISTIC, nullptr,
                                 GPKG_GDAL_GetMimeType, nullptr, nullptr);
-        sqlite3_create_function(hDB, "GDAL_GetBandCount", 1,
+        sqlite3_create_function(hDBIn, "GDAL_GetBandCount", 1,
                                 SQLITE_UTF8 | SQLITE_DETERMINISTIC, nullptr,
                                 GPKG_GDAL_GetBandCount, nullptr, nullptr);
-        sqlite3_create_function(hDB, "GDAL_HasColorTable", 1,
+        sqlite3_create_function(hDBIn, "GDAL_HasColorTable", 1,
                                 SQLITE_UTF8 | SQLITE_DETERMINISTIC, nullptr,
                                 GPKG_GDAL_HasColorTable, nullptr, nullptr);
     }
 
-    sqlite3_create_function(hDB, "gdal_get_layer_pixel_value", 5, SQLITE_UTF8,
+    sqlite3_create_function(hDBIn, "gdal_get_layer_pixel_value", 5, SQLITE_UTF8,
                             this, GPKG_gdal_get_layer_pixel_value, nullptr,
                             nullptr);
-    sqlite3_create_function(hDB, "gdal_get_layer_pixel_value", 6, SQLITE_UTF8,
+    sqlite3_create_function(hDBIn, "gdal_get_layer_pixel_value", 6, SQLITE_UTF8,
                             this, GPKG_gdal_get_layer_pixel_value, nullptr,
                             nullptr);
 
     // Function from VirtualOGR
-    sqlite3_create_function(hDB, "ogr_layer_Extent", 1, SQLITE_UTF8, this,
+    sqlite3_create_function(hDBIn, "ogr_layer_Extent", 1, SQLITE_UTF8, this,
                             GPKG_ogr_layer_Extent, nullptr, nullptr);
 
-    m_pSQLFunctionData = OGRSQLiteRegisterSQLFunctionsCommon(hDB);
+    void *pSQLFunctionData = OGRSQLiteRegisterSQLFunctionsCommon(hDBIn);
 
     // ST_Hilbert() inspired from https://duckdb.org/docs/stable/core_extensions/spatial/functions#st_hilbert
     // Override the generic version of OGRSQLiteRegisterSQLFunctionsCommon()
 
     // X,Y,table_name
-    sqlite3_create_function(hDB, "ST_Hilbert", 2 + 1, UTF8_INNOCUOUS, this,
+    sqlite3_create_function(hDBIn, "ST_Hilbert", 2 + 1, UTF8_INNOCUOUS, this,
                             GPKG_ST_Hilbert_X_Y_TableName, nullptr, nullptr);
 
     // geometry,minX,minY,maxX,maxY
-    sqlite3_create_function(hDB, "ST_Hilbert", 1 + 4, UTF8_INNOCUOUS, nullptr,
+    sqlite3_create_function(hDBIn, "ST_Hilbert", 1 + 4, UTF8_INNOCUOUS, nullptr,
                             GPKG_ST_Hilbert_Geom_BBOX, nullptr, nullptr);
 
     // geometry,table_name
-    sqlite3_create_function(hDB, "ST_Hilbert", 1 + 1, UTF8_INNOCUOUS, this,
+    sqlite3_create_function(hDBIn, "ST_Hilbert", 1 + 1, UTF8_INNOCUOUS, this,
                             GPKG_ST_Hilbert_Geom_TableName, nullptr, nullptr);
+
+    return pSQLFunctionData;
 }
 
 /************************************************************************/
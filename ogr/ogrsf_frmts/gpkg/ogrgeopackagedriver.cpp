@@ -849,6 +849,23 @@ void RegisterOGRGeoPackage()
         "  </Option>"
         "  <Option name='TABLE' type='string' scope='raster' description='Name "
         "of tile user-table'/>"
+        "  <Option name='MMAP_SIZE' type='integer' "
+        "description='Number of bytes of the database memory mapped by "
+        "SQLite (PRAGMA mmap_size). Defaults to the file size, up to 1GB, "
+        "for read-only opens of plain files'/>"
+        "  <Option name='CACHE_SIZE_MB' type='integer' "
+        "description='SQLite page cache size, in megabytes. Defaults, for "
+        "read-only opens, to a quarter of GDAL_CACHEMAX, up to 512MB'/>"
+        "  <Option name='JOURNAL_MODE' type='string-select' "
+        "description='Journal mode (PRAGMA journal_mode), e.g. WAL for "
+        "concurrent readers with a writer'>"
+        "    <Value>DELETE</Value>"
+        "    <Value>TRUNCATE</Value>"
+        "    <Value>PERSIST</Value>"
+        "    <Value>MEMORY</Value>"
+        "    <Value>WAL</Value>"
+        "    <Value>OFF</Value>"
+        "  </Option>"
         "  <Option name='ZOOM_LEVEL' type='integer' scope='raster' "
         "description='Zoom level of full resolution. If not specified, maximum "
         "non-empty zoom level'/>"
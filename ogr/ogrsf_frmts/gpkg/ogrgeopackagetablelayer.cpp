@@ -12,6 +12,7 @@
  ****************************************************************************/
 
 #include "ogr_geopackage.h"
+#include "gdal_alg.h"
 #include "ogrgeopackageutility.h"
 #include "ogrlayerarrow.h"
 #include "ogrsqliteutility.h"
@@ -2960,6 +2961,54 @@ static size_t GetMaxRAMUsageAllowedForRTree()
     return static_cast<size_t>(nMaxRAMUsageAllowed);
 }
 
+/************************************************************************/
+/*                      SortRTreeEntriesByHilbert()                     */
+/************************************************************************/
+
+/** Sort a batch of RTree entries along the Hilbert curve of the batch
+ * extent: presorted insertion packs the bulk-loaded tree better and
+ * dramatically reduces node split work, both in the in-memory bulk
+ * loader and in the SQLite RTree module fallback.
+ */
+template <class EntryType>
+static void SortRTreeEntriesByHilbert(std::vector<EntryType> &aoEntries)
+{
+    if (aoEntries.size() < 2)
+        return;
+
+    OGREnvelope sDomain;
+    for (const auto &entry : aoEntries)
+    {
+        sDomain.Merge((entry.fMinX + entry.fMaxX) / 2,
+                      (entry.fMinY + entry.fMaxY) / 2);
+    }
+
+    try
+    {
+        std::vector<std::pair<uint32_t, uint32_t>> aoCodes;
+        aoCodes.reserve(aoEntries.size());
+        for (size_t i = 0; i < aoEntries.size(); ++i)
+        {
+            const auto &entry = aoEntries[i];
+            aoCodes.emplace_back(
+                GDALHilbertCode(&sDomain, (entry.fMinX + entry.fMaxX) / 2,
+                                (entry.fMinY + entry.fMaxY) / 2),
+                static_cast<uint32_t>(i));
+        }
+        std::sort(aoCodes.begin(), aoCodes.end());
+
+        std::vector<EntryType> aoSorted;
+        aoSorted.reserve(aoEntries.size());
+        for (const auto &oCode : aoCodes)
+            aoSorted.push_back(aoEntries[oCode.second]);
+        aoEntries = std::move(aoSorted);
+    }
+    catch (const std::exception &)
+    {
+        // Not enough memory for the permutation: keep the original order.
+    }
+}
+
 /************************************************************************/
 /*                      AsyncRTreeThreadFunction()                      */
 /************************************************************************/
@@ -2973,10 +3022,14 @@ void OGRGeoPackageTableLayer::AsyncRTreeThreadFunction()
     GIntBig nCount = 0;
     while (true)
     {
-        const auto aoEntries = m_oQueueRTreeEntries.get_and_pop_front();
+        auto aoEntries = m_oQueueRTreeEntries.get_and_pop_front();
         if (aoEntries.empty())
             break;
 
+        if (CPLTestBool(
+                CPLGetConfigOption("OGR_GPKG_RTREE_HILBERT_SORT", "YES")))
+            SortRTreeEntriesByHilbert(aoEntries);
+
         constexpr int NOTIFICATION_INTERVAL = 500 * 1000;
 
         auto oIter = aoEntries.begin();
@@ -8410,7 +8463,14 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayAsynchronous(
                                                    false);
         m_poFillArrowArray->poFeatureDefn = m_poFeatureDefn;
         m_poFillArrowArray->poLayer = this;
-        m_poFillArrowArray->hDB = m_poDS->GetDB();
+        // When available, use a pooled read-only connection so that the
+        // worker's table scan does not serialize with operations issued on
+        // the main connection.
+        m_poFillArrowArray->hPooledDB = m_poDS->AcquireReadOnlyDB();
+        m_poFillArrowArray->poDSForPooledDB = m_poDS;
+        m_poFillArrowArray->hDB = m_poFillArrowArray->hPooledDB
+                                      ? m_poFillArrowArray->hPooledDB
+                                      : m_poDS->GetDB();
         memset(&m_poFillArrowArray->brokenDown, 0,
                sizeof(m_poFillArrowArray->brokenDown));
         m_poFillArrowArray->bAsynchronousMode = true;
@@ -8492,7 +8552,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayAsynchronous(
 void OGRGeoPackageTableLayer::GetNextArrowArrayAsynchronousWorker()
 {
     sqlite3_create_function(
-        m_poDS->GetDB(), "OGR_GPKG_FillArrowArray_INTERNAL", -1,
+        m_poFillArrowArray->hDB, "OGR_GPKG_FillArrowArray_INTERNAL", -1,
         SQLITE_UTF8 | SQLITE_DETERMINISTIC, m_poFillArrowArray.get(), nullptr,
         OGR_GPKG_FillArrowArray_Step, OGR_GPKG_FillArrowArray_Finalize);
 
@@ -8600,7 +8660,7 @@ void OGRGeoPackageTableLayer::GetNextArrowArrayAsynchronousWorker()
 
     char *pszErrMsg = nullptr;
     std::string osErrorMsg;
-    if (sqlite3_exec(m_poDS->GetDB(), osSQL.c_str(), nullptr, nullptr,
+    if (sqlite3_exec(m_poFillArrowArray->hDB, osSQL.c_str(), nullptr, nullptr,
                      &pszErrMsg) != SQLITE_OK)
     {
         osErrorMsg = pszErrMsg ? pszErrMsg : "unknown error";
@@ -8608,8 +8668,9 @@ void OGRGeoPackageTableLayer::GetNextArrowArrayAsynchronousWorker()
     sqlite3_free(pszErrMsg);
 
     // Delete function
-    sqlite3_create_function(m_poDS->GetDB(), "OGR_GPKG_FillArrowArray_INTERNAL",
-                            -1, SQLITE_UTF8 | SQLITE_DETERMINISTIC, nullptr,
+    sqlite3_create_function(m_poFillArrowArray->hDB,
+                            "OGR_GPKG_FillArrowArray_INTERNAL", -1,
+                            SQLITE_UTF8 | SQLITE_DETERMINISTIC, nullptr,
                             nullptr, nullptr, nullptr);
 
     std::lock_guard oLock(m_poFillArrowArray->oMutex);
@@ -9215,6 +9276,162 @@ OGRErr OGRGeoPackageTableLayer::IGetExtent3D(int iGeomField,
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                          ClusterByHilbert()                          */
+/************************************************************************/
+
+/** Rewrite the table with feature ids reassigned in Hilbert order of the
+ * geometries.
+ *
+ * The SQLite B-tree is clustered by rowid, so renumbering the feature ids
+ * in Hilbert order is what actually relocates spatially close features
+ * onto contiguous database pages: spatially filtered scans then read far
+ * fewer pages, especially on spinning or network storage. The spatial
+ * index, if any, is dropped first and rebuilt with the bulk loading path
+ * afterwards. Feature ids are renumbered starting from 1.
+ */
+bool OGRGeoPackageTableLayer::ClusterByHilbert()
+{
+    if (!m_poDS->GetUpdate())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, UNSUPPORTED_OP_READ_ONLY,
+                 "ClusterByHilbert");
+        return false;
+    }
+    if (!m_bIsTable)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "CLUSTER BY HILBERT only supported on tables");
+        return false;
+    }
+    if (m_poFeatureDefn->GetGeomFieldCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Layer %s has no geometry column",
+                 m_pszTableName);
+        return false;
+    }
+
+    ResetReading();
+    SyncToDisk();
+
+    const bool bHadSpatialIndex = HasSpatialIndex();
+    if (bHadSpatialIndex && !DropSpatialIndex())
+        return false;
+
+    bool bOK = m_poDS->SoftStartTransaction() == OGRERR_NONE;
+
+    // Column list without the feature id column, which must be reassigned
+    // rather than copied for the rows to be relocated.
+    CPLString osColumns;
+    if (bOK)
+    {
+        char *pszSQL =
+            sqlite3_mprintf("PRAGMA table_info('%q')", m_pszTableName);
+        auto oResult = SQLQuery(m_poDS->GetDB(), pszSQL);
+        sqlite3_free(pszSQL);
+        bOK = oResult != nullptr;
+        for (int i = 0; bOK && i < oResult->RowCount(); i++)
+        {
+            const char *pszName = oResult->GetValue(1, i);
+            if (pszName == nullptr)
+            {
+                bOK = false;
+                break;
+            }
+            if (oResult->GetValueAsInteger(5, i) > 0)
+                continue;
+            if (!osColumns.empty())
+                osColumns += ",";
+            osColumns += '"';
+            osColumns += SQLEscapeName(pszName);
+            osColumns += '"';
+        }
+        if (osColumns.empty())
+            bOK = false;
+    }
+
+    const char *pszT = m_pszTableName;
+    const char *pszC = m_poFeatureDefn->GetGeomFieldDefn(0)->GetNameRef();
+    const CPLString osTmpName(CPLString(pszT) + "_hilbert_cluster_tmp");
+
+    char *pszErrMsg = nullptr;
+    if (bOK)
+    {
+        // In case a previous attempt was interrupted.
+        char *pszSQL = sqlite3_mprintf("DROP TABLE IF EXISTS \"%w\"",
+                                       osTmpName.c_str());
+        bOK = sqlite3_exec(m_poDS->GetDB(), pszSQL, nullptr, nullptr,
+                           &pszErrMsg) == SQLITE_OK;
+        sqlite3_free(pszSQL);
+    }
+    if (bOK)
+    {
+        char *pszSQL =
+            sqlite3_mprintf("CREATE TABLE \"%w\" AS SELECT %s FROM \"%w\" "
+                            "ORDER BY ST_Hilbert(\"%w\", '%q')",
+                            osTmpName.c_str(), osColumns.c_str(), pszT, pszC,
+                            pszT);
+        bOK = sqlite3_exec(m_poDS->GetDB(), pszSQL, nullptr, nullptr,
+                           &pszErrMsg) == SQLITE_OK;
+        sqlite3_free(pszSQL);
+    }
+    if (bOK)
+    {
+        char *pszSQL = sqlite3_mprintf("DELETE FROM \"%w\"", pszT);
+        bOK = sqlite3_exec(m_poDS->GetDB(), pszSQL, nullptr, nullptr,
+                           &pszErrMsg) == SQLITE_OK;
+        sqlite3_free(pszSQL);
+    }
+    if (bOK && SQLGetInteger(m_poDS->GetDB(),
+                             "SELECT COUNT(*) FROM sqlite_master WHERE "
+                             "name = 'sqlite_sequence'",
+                             nullptr) == 1)
+    {
+        // Restart feature id numbering at 1 for AUTOINCREMENT tables.
+        char *pszSQL = sqlite3_mprintf(
+            "DELETE FROM sqlite_sequence WHERE name = '%q'", pszT);
+        bOK = sqlite3_exec(m_poDS->GetDB(), pszSQL, nullptr, nullptr,
+                           &pszErrMsg) == SQLITE_OK;
+        sqlite3_free(pszSQL);
+    }
+    if (bOK)
+    {
+        char *pszSQL =
+            sqlite3_mprintf("INSERT INTO \"%w\" (%s) SELECT %s FROM \"%w\"",
+                            pszT, osColumns.c_str(), osColumns.c_str(),
+                            osTmpName.c_str());
+        bOK = sqlite3_exec(m_poDS->GetDB(), pszSQL, nullptr, nullptr,
+                           &pszErrMsg) == SQLITE_OK;
+        sqlite3_free(pszSQL);
+    }
+    if (bOK)
+    {
+        char *pszSQL = sqlite3_mprintf("DROP TABLE \"%w\"", osTmpName.c_str());
+        bOK = sqlite3_exec(m_poDS->GetDB(), pszSQL, nullptr, nullptr,
+                           &pszErrMsg) == SQLITE_OK;
+        sqlite3_free(pszSQL);
+    }
+
+    if (bOK)
+    {
+        m_poDS->SoftCommitTransaction();
+    }
+    else
+    {
+        m_poDS->SoftRollbackTransaction();
+        CPLError(CE_Failure, CPLE_AppDefined, "ClusterByHilbert(%s) failed: %s",
+                 pszT, pszErrMsg ? pszErrMsg : "(unknown reason)");
+    }
+    sqlite3_free(pszErrMsg);
+
+    // Rebuild the spatial index even when the rewrite was rolled back, so
+    // that a failure does not leave the layer unindexed.
+    if (bHadSpatialIndex)
+        bOK = CreateSpatialIndex() && bOK;
+
+    return bOK;
+}
+
 /************************************************************************/
 /*                              Truncate()                              */
 /************************************************************************/
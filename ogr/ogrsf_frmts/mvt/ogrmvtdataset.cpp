@@ -5340,11 +5340,9 @@ std::string OGRMVTWriterDataset::RecodeTileLowerResolution(
 
     sqlite3_reset(hStmtLayer);
 
-    std::string oTileBuffer(oTargetTile.write());
-    if (m_bGZip)
-        GZIPCompress(oTileBuffer);
-
-    return oTileBuffer;
+    // Note: GZIP compression of the buffer is done by the caller, so that
+    // it can be spread over the worker thread pool.
+    return oTargetTile.write();
 }
 
 /************************************************************************/
@@ -5425,21 +5423,12 @@ bool OGRMVTWriterDataset::CreateOutput()
     bool bRet = true;
     GIntBig nTempTilesRead = 0;
 
-    while (sqlite3_step(hStmtZXY) == SQLITE_ROW)
+    const auto WriteTile =
+        [this, hInsertStmt, &nLastZ, &nLastX](int nZ, int nX, int nY,
+                                              const std::string &oTileBuffer)
     {
-        int nZ = sqlite3_column_int(hStmtZXY, 0);
-        int nX = sqlite3_column_int(hStmtZXY, 1);
-        int nY = sqlite3_column_int(hStmtZXY, 2);
-
-        std::string oTileBuffer(EncodeTile(nZ, nX, nY, hStmtLayer, hStmtRows,
-                                           oMapLayerProps, oSetLayers,
-                                           nTempTilesRead));
-
-        if (oTileBuffer.empty())
-        {
-            bRet = false;
-        }
-        else if (hInsertStmt)
+        bool bOK;
+        if (hInsertStmt)
         {
             sqlite3_bind_int(hInsertStmt, 1, nZ);
             sqlite3_bind_int(hInsertStmt, 2, nX);
@@ -5448,7 +5437,7 @@ bool OGRMVTWriterDataset::CreateOutput()
                               static_cast<int>(oTileBuffer.size()),
                               SQLITE_STATIC);
             const int rc = sqlite3_step(hInsertStmt);
-            bRet = (rc == SQLITE_OK || rc == SQLITE_DONE);
+            bOK = (rc == SQLITE_OK || rc == SQLITE_DONE);
             sqlite3_reset(hInsertStmt);
         }
         else
@@ -5476,22 +5465,124 @@ bool OGRMVTWriterDataset::CreateOutput()
             {
                 const size_t nRet = VSIFWriteL(oTileBuffer.data(), 1,
                                                oTileBuffer.size(), fpOut);
-                bRet = (nRet == oTileBuffer.size());
+                bOK = (nRet == oTileBuffer.size());
                 VSIFCloseL(fpOut);
             }
             else
             {
-                bRet = false;
+                bOK = false;
             }
         }
-
-        if (!bRet)
+        if (!bOK)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Error while writing tile %d/%d/%d", nZ, nX, nY);
+        }
+        return bOK;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Pipeline: tiles are encoded serially (the temporary database    */
+    /*      and the layer statistics are shared state), but their GZIP      */
+    /*      compression is spread over the worker thread pool, and the      */
+    /*      compressed buffers are written in tile order as they complete.  */
+    /* -------------------------------------------------------------------- */
+    struct CompressJob
+    {
+        int nZ = 0;
+        int nX = 0;
+        int nY = 0;
+        std::string oBuffer{};
+        bool bDone = false;
+    };
+
+    std::mutex oJobMutex;
+    std::condition_variable oJobCV;
+    std::deque<std::unique_ptr<CompressJob>> oJobQueue;
+    const bool bParallelCompress = m_bGZip && m_bThreadPoolOK;
+    const size_t nMaxPendingJobs = 64;
+
+    const auto FlushCompletedJobs = [&](bool bWaitAll)
+    {
+        while (true)
+        {
+            std::unique_ptr<CompressJob> poJob;
+            {
+                std::unique_lock<std::mutex> oLock(oJobMutex);
+                if (oJobQueue.empty())
+                    break;
+                if (bWaitAll || oJobQueue.size() >= nMaxPendingJobs)
+                {
+                    oJobCV.wait(oLock, [&oJobQueue]()
+                                { return oJobQueue.front()->bDone; });
+                }
+                if (!oJobQueue.front()->bDone)
+                    break;
+                poJob = std::move(oJobQueue.front());
+                oJobQueue.pop_front();
+            }
+            if (!WriteTile(poJob->nZ, poJob->nX, poJob->nY, poJob->oBuffer))
+                return false;
+        }
+        return true;
+    };
+
+    while (sqlite3_step(hStmtZXY) == SQLITE_ROW)
+    {
+        int nZ = sqlite3_column_int(hStmtZXY, 0);
+        int nX = sqlite3_column_int(hStmtZXY, 1);
+        int nY = sqlite3_column_int(hStmtZXY, 2);
+
+        std::string oTileBuffer(EncodeTile(nZ, nX, nY, hStmtLayer, hStmtRows,
+                                           oMapLayerProps, oSetLayers,
+                                           nTempTilesRead));
+
+        if (oTileBuffer.empty())
+        {
+            bRet = false;
+        }
+        else if (bParallelCompress)
+        {
+            auto poJob = std::make_unique<CompressJob>();
+            poJob->nZ = nZ;
+            poJob->nX = nX;
+            poJob->nY = nY;
+            poJob->oBuffer = std::move(oTileBuffer);
+            CompressJob *poJobRaw = poJob.get();
+            {
+                std::lock_guard<std::mutex> oLock(oJobMutex);
+                oJobQueue.push_back(std::move(poJob));
+            }
+            m_oThreadPool.SubmitJob(
+                [poJobRaw, &oJobMutex, &oJobCV]()
+                {
+                    GZIPCompress(poJobRaw->oBuffer);
+                    std::lock_guard<std::mutex> oLock(oJobMutex);
+                    poJobRaw->bDone = true;
+                    oJobCV.notify_all();
+                });
+            bRet = FlushCompletedJobs(false);
+        }
+        else
+        {
+            if (m_bGZip)
+                GZIPCompress(oTileBuffer);
+            bRet = WriteTile(nZ, nX, nY, oTileBuffer);
+        }
+
+        if (!bRet)
+        {
             break;
         }
     }
+
+    if (bParallelCompress)
+    {
+        if (bRet)
+            bRet = FlushCompletedJobs(true);
+        // Make sure no compression job remains before the queue is destroyed
+        m_oThreadPool.WaitCompletion();
+    }
     sqlite3_finalize(hStmtZXY);
     sqlite3_finalize(hStmtLayer);
     sqlite3_finalize(hStmtRows);
@@ -74,6 +74,7 @@ class CPL_DLL OGRLayerAttrIndex
 };
 
 OGRLayerAttrIndex CPL_DLL *OGRCreateDefaultLayerIndex();
+OGRLayerAttrIndex CPL_DLL *OGRCreateGenericLayerIndex();
 
 //! @endcond
 
@@ -1673,8 +1673,36 @@ bool FileGDBTable::SelectRow(int64_t iRow, bool bWarnOnlyOnDeletedRows)
 
         VSIFSeekL(m_fpTable, nOffsetTable, SEEK_SET);
         GByte abyBuffer[4];
-        returnErrorAndCleanupIf(VSIFReadL(abyBuffer, 4, 1, m_fpTable) != 1,
-                                m_nCurRow = -1);
+        // In read-only mode, speculatively read the row content together
+        // with its 4 byte length prefix: rows of a table tend to have
+        // similar sizes, so guessing with the previous blob length turns
+        // the usual two reads per row into a single one.
+        size_t nSpeculativeAvail = 0;
+        if (!m_bUpdate)
+        {
+            constexpr GUInt32 MAX_SPECULATIVE_READ = 65536;
+            const GUInt32 nGuess = std::min(
+                std::max(m_nLastRowBlobLength, 256U), MAX_SPECULATIVE_READ);
+            try
+            {
+                if (m_abySpeculativeBuffer.size() < 4 + nGuess)
+                    m_abySpeculativeBuffer.resize(4 + nGuess);
+            }
+            catch (const std::exception &)
+            {
+                returnErrorAndCleanupIf(true, m_nCurRow = -1);
+            }
+            const size_t nRead = VSIFReadL(m_abySpeculativeBuffer.data(), 1,
+                                           4 + nGuess, m_fpTable);
+            returnErrorAndCleanupIf(nRead < 4, m_nCurRow = -1);
+            memcpy(abyBuffer, m_abySpeculativeBuffer.data(), 4);
+            nSpeculativeAvail = nRead - 4;
+        }
+        else
+        {
+            returnErrorAndCleanupIf(VSIFReadL(abyBuffer, 4, 1, m_fpTable) != 1,
+                                    m_nCurRow = -1);
+        }
 
         m_nRowBlobLength = GetUInt32(abyBuffer, 0);
         if (m_bIsDeleted)
@@ -1825,10 +1853,30 @@ bool FileGDBTable::SelectRow(int64_t iRow, bool bWarnOnlyOnDeletedRows)
                 }
             }
 
-            returnErrorAndCleanupIf(VSIFReadL(m_abyBuffer.data(),
-                                              m_nRowBlobLength, 1,
-                                              m_fpTable) != 1,
-                                    m_nCurRow = -1);
+            if (nSpeculativeAvail >= m_nRowBlobLength)
+            {
+                memcpy(m_abyBuffer.data(), m_abySpeculativeBuffer.data() + 4,
+                       m_nRowBlobLength);
+            }
+            else
+            {
+                if (nSpeculativeAvail > 0)
+                {
+                    memcpy(m_abyBuffer.data(),
+                           m_abySpeculativeBuffer.data() + 4,
+                           nSpeculativeAvail);
+                    // Use an explicit seek, as the suspicious-length check
+                    // above may have moved the file position.
+                    VSIFSeekL(m_fpTable, nOffsetTable + 4 + nSpeculativeAvail,
+                              SEEK_SET);
+                }
+                returnErrorAndCleanupIf(
+                    VSIFReadL(m_abyBuffer.data() + nSpeculativeAvail,
+                              m_nRowBlobLength - nSpeculativeAvail, 1,
+                              m_fpTable) != 1,
+                    m_nCurRow = -1);
+            }
+            m_nLastRowBlobLength = m_nRowBlobLength;
             /* Protection for 4 ReadVarUInt64NoCheck */
             CPL_STATIC_ASSERT(ZEROES_AFTER_END_OF_BUFFER == 4);
             m_abyBuffer[m_nRowBlobLength] = 0;
@@ -512,6 +512,11 @@ class FileGDBTable
     std::vector<double> m_adfSpatialIndexGridResolution{};
 
     GUInt32 m_nRowBufferMaxSize = 0;
+    //! Blob length of the previously selected row, used as speculative
+    //! read size hint
+    GUInt32 m_nLastRowBlobLength = 0;
+    //! Scratch buffer for the speculative combined length+blob read
+    std::vector<GByte> m_abySpeculativeBuffer{};
     std::vector<GByte> m_abyBuffer{};
     std::vector<GByte> m_abyGeomBuffer{};
     std::vector<GByte> m_abyCurvePart{};
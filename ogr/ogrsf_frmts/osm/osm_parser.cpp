@@ -29,7 +29,10 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_atomic_ops.h"
 #include "cpl_worker_thread_pool.h"
+
+#include <thread>
 #include "gdal_thread_pool.h"
 
 #ifdef HAVE_EXPAT
@@ -108,6 +111,8 @@ typedef struct
     size_t nDstOffset;
     size_t nDstSize;
     bool bStatus;
+    // 0: pending, 1: done (published with a full barrier after bStatus)
+    volatile int nCompletedAtomic;
 } DecompressionJob;
 
 struct _OSMContext
@@ -152,6 +157,7 @@ struct _OSMContext
     DecompressionJob asJobs[N_MAX_JOBS];
     int nJobs;
     int iNextJob;
+    bool bDecompressionJobsInFlight;
 
 #ifdef HAVE_EXPAT
     XML_Parser hXMLParser;
@@ -1641,14 +1647,52 @@ static void DecompressFunction(void *pDataIn)
     psJob->bStatus = CPLZLibInflate(psJob->pabySrc, psJob->nSrcSize,
                                     psJob->pabyDstBase + psJob->nDstOffset,
                                     psJob->nDstSize, nullptr) != nullptr;
+    CPLAtomicAdd(&psJob->nCompletedAtomic, 1);
+}
+
+/************************************************************************/
+/*                        WaitForJobCompletion()                        */
+/************************************************************************/
+
+/** Waits until one specific decompression job has completed, so that its
+ * blob can be decoded while the other jobs are still being inflated. */
+static void WaitForJobCompletion(const OSMContext *psCtxt,
+                                 DecompressionJob &sJob)
+{
+    if (psCtxt->poWTP)
+    {
+        while (CPLAtomicAdd(&sJob.nCompletedAtomic, 0) == 0)
+            std::this_thread::yield();
+    }
+}
+
+/************************************************************************/
+/*                         WaitForAllJobs()                             */
+/************************************************************************/
+
+/** Waits for all in-flight decompression jobs: required before reusing
+ * the blob/uncompressed buffers, resetting, or closing. */
+static void WaitForAllJobs(OSMContext *psCtxt)
+{
+    if (psCtxt->poWTP && psCtxt->bDecompressionJobsInFlight)
+    {
+        psCtxt->poWTP->WaitCompletion();
+        psCtxt->bDecompressionJobsInFlight = false;
+    }
 }
 
 /************************************************************************/
 /*                        RunDecompressionJobs()                        */
 /************************************************************************/
 
-static bool RunDecompressionJobs(OSMContext *psCtxt)
+/** Submits the decompression jobs to the worker pool, without waiting
+ * for their completion: callers decode each blob as soon as its own job
+ * has completed (WaitForJobCompletion()), overlapping the serial protobuf
+ * decoding with the decompression of the remaining blobs. */
+static void RunDecompressionJobs(OSMContext *psCtxt)
 {
+    WaitForAllJobs(psCtxt);
+
     psCtxt->nTotalUncompressedSize = 0;
 
     GByte *pabyDstBase = psCtxt->pabyUncompressed;
@@ -1656,6 +1700,7 @@ static bool RunDecompressionJobs(OSMContext *psCtxt)
     for (int i = 0; i < psCtxt->nJobs; i++)
     {
         psCtxt->asJobs[i].pabyDstBase = pabyDstBase;
+        psCtxt->asJobs[i].nCompletedAtomic = 0;
         if (psCtxt->poWTP)
             ahJobs.push_back(&psCtxt->asJobs[i]);
         else
@@ -1664,15 +1709,8 @@ static bool RunDecompressionJobs(OSMContext *psCtxt)
     if (psCtxt->poWTP)
     {
         psCtxt->poWTP->SubmitJobs(DecompressFunction, ahJobs);
-        psCtxt->poWTP->WaitCompletion();
-    }
-
-    bool bRet = true;
-    for (int i = 0; bRet && i < psCtxt->nJobs; i++)
-    {
-        bRet &= psCtxt->asJobs[i].bStatus;
+        psCtxt->bDecompressionJobsInFlight = true;
     }
-    return bRet;
 }
 
 /************************************************************************/
@@ -1705,20 +1743,21 @@ static bool ProcessSingleBlob(OSMContext *psCtxt, DecompressionJob &sJob,
 static bool RunDecompressionJobsAndProcessAll(OSMContext *psCtxt,
                                               BlobType eType)
 {
-    if (!RunDecompressionJobs(psCtxt))
-    {
-        return false;
-    }
-    for (int i = 0; i < psCtxt->nJobs; i++)
+    RunDecompressionJobs(psCtxt);
+    bool bRet = true;
+    for (int i = 0; bRet && i < psCtxt->nJobs; i++)
     {
-        if (!ProcessSingleBlob(psCtxt, psCtxt->asJobs[i], eType))
+        WaitForJobCompletion(psCtxt, psCtxt->asJobs[i]);
+        if (!psCtxt->asJobs[i].bStatus ||
+            !ProcessSingleBlob(psCtxt, psCtxt->asJobs[i], eType))
         {
-            return false;
+            bRet = false;
         }
     }
+    WaitForAllJobs(psCtxt);
     psCtxt->iNextJob = 0;
     psCtxt->nJobs = 0;
-    return true;
+    return bRet;
 }
 
 /************************************************************************/
@@ -1881,12 +1920,13 @@ static bool ReadBlob(OSMContext *psCtxt, BlobType eType)
 
         if (psCtxt->nJobs > 0)
         {
-            if (!RunDecompressionJobs(psCtxt))
-            {
-                THROW_OSM_PARSING_EXCEPTION;
-            }
-            // Just process one blob at a time
-            if (!ProcessSingleBlob(psCtxt, psCtxt->asJobs[0], eType))
+            RunDecompressionJobs(psCtxt);
+            // Just process one blob at a time; the remaining ones keep
+            // being inflated by the worker pool in the meantime, and are
+            // decoded by the next OSM_ProcessBlock() calls.
+            WaitForJobCompletion(psCtxt, psCtxt->asJobs[0]);
+            if (!psCtxt->asJobs[0].bStatus ||
+                !ProcessSingleBlob(psCtxt, psCtxt->asJobs[0], eType))
             {
                 THROW_OSM_PARSING_EXCEPTION;
             }
@@ -1913,9 +1953,12 @@ static OSMRetCode PBF_ProcessBlock(OSMContext *psCtxt)
     // Process any remaining queued jobs one by one
     if (psCtxt->iNextJob < psCtxt->nJobs)
     {
-        if (!(ProcessSingleBlob(psCtxt, psCtxt->asJobs[psCtxt->iNextJob],
+        WaitForJobCompletion(psCtxt, psCtxt->asJobs[psCtxt->iNextJob]);
+        if (!psCtxt->asJobs[psCtxt->iNextJob].bStatus ||
+            !(ProcessSingleBlob(psCtxt, psCtxt->asJobs[psCtxt->iNextJob],
                                 BLOB_OSMDATA)))
         {
+            WaitForAllJobs(psCtxt);
             return OSM_ERROR;
         }
         psCtxt->iNextJob++;
@@ -2798,6 +2841,8 @@ void OSM_Close(OSMContext *psCtxt)
     if (psCtxt == nullptr)
         return;
 
+    WaitForAllJobs(psCtxt);
+
 #ifdef HAVE_EXPAT
     if (!psCtxt->bPBF)
     {
@@ -2828,6 +2873,8 @@ void OSM_Close(OSMContext *psCtxt)
 
 void OSM_ResetReading(OSMContext *psCtxt)
 {
+    WaitForAllJobs(psCtxt);
+
     VSIFSeekL(psCtxt->fp, 0, SEEK_SET);
 
     psCtxt->nBytesRead = 0;
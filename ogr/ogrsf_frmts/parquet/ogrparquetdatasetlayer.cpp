@@ -503,12 +503,18 @@ void OGRParquetDatasetLayer::BuildScanner()
         // At least this was true with some older libarrow version
         // PARQUET_THROW_NOT_OK(scannerBuilder->Pool(m_poMemoryPool));
 
-        if (m_bIsVSI)
+        const char *pszFragmentReadAhead =
+            CPLGetConfigOption("OGR_PARQUET_FRAGMENT_READ_AHEAD", nullptr);
+        if (pszFragmentReadAhead)
         {
-            const int nFragmentReadAhead = atoi(
-                CPLGetConfigOption("OGR_PARQUET_FRAGMENT_READ_AHEAD", "2"));
+            // Explicit number of part files read in parallel: honoured for
+            // all datasets, including local multi-file ones.
             PARQUET_THROW_NOT_OK(
-                scannerBuilder->FragmentReadahead(nFragmentReadAhead));
+                scannerBuilder->FragmentReadahead(atoi(pszFragmentReadAhead)));
+        }
+        else if (m_bIsVSI)
+        {
+            PARQUET_THROW_NOT_OK(scannerBuilder->FragmentReadahead(2));
         }
 
         const char *pszBatchSize =
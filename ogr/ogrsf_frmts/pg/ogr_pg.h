@@ -299,6 +299,8 @@ class OGRPGTableLayer final : public OGRPGLayer
     bool m_bUTF8ToASCII = false;
     int bPreservePrecision = true;
     int bUseCopy = USE_COPY_UNSET;
+    int bUsePipeline = USE_COPY_UNSET;
+    int nPipelinedInserts = 0;
     int bCopyActive = false;
     bool bFIDColumnInCopyFields = false;
     int bFirstInsertion = true;
@@ -361,6 +363,8 @@ class OGRPGTableLayer final : public OGRPGLayer
     OGRFeature *GetFeature(GIntBig nFeatureId) override;
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    int GetNextArrowArray(struct ArrowArrayStream *stream,
+                          struct ArrowArray *out_array) override;
     GIntBig GetFeatureCount(int) override;
 
     OGRErr ISetSpatialFilter(int iGeomField,
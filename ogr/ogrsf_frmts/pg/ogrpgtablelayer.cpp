@@ -13,6 +13,7 @@
  ****************************************************************************/
 
 #include "ogr_pg.h"
+#include "ograrrowarrayhelper.h"
 #include "cpl_conv.h"
 #include "cpl_string.h"
 #include "cpl_error.h"
@@ -224,6 +225,8 @@ OGRPGTableLayer::~OGRPGTableLayer()
         RunDeferredCreationIfNecessary();
     if (bCopyActive)
         EndCopy();
+    if (nPipelinedInserts > 0)
+        OGRPG_FlushPipeline(poDS->GetPGConn());
     UpdateSequenceIfNeeded();
     SerializeMetadata();
 
@@ -1210,6 +1213,269 @@ OGRFeature *OGRPGTableLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+int OGRPGTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                       struct ArrowArray *out_array)
+{
+    memset(out_array, 0, sizeof(*out_array));
+
+    if (bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
+        return EIO;
+    poDS->EndCopy();
+
+    /* -------------------------------------------------------------------- */
+    /*      The fast path fills the Arrow arrays directly from the cursor   */
+    /*      result, without materializing OGRFeature objects. It requires   */
+    /*      that all filtering happens server side and that the field       */
+    /*      types have a straight text-to-column conversion.                */
+    /* -------------------------------------------------------------------- */
+    bool bFastPath =
+        iFIDAsRegularColumnIndex < 0 &&
+        CPLTestBool(CPLGetConfigOption("OGR_PG_ARROW_NATIVE", "YES"));
+#if defined(BINARY_CURSOR_ENABLED)
+    if (poDS->bUseBinaryCursor)
+        bFastPath = false;
+#endif
+    if (m_poFilterGeom != nullptr &&
+        !(poDS->sPostGISVersion.nMajor >= 0 &&
+          !poDS->IsSpatialFilterIntersectionLocal()))
+    {
+        // The spatial filter must be re-evaluated client side.
+        bFastPath = false;
+    }
+    for (int i = 0; bFastPath && i < poFeatureDefn->GetFieldCount(); ++i)
+    {
+        const auto *poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        const auto eType = poFieldDefn->GetType();
+        if (eType != OFTInteger && eType != OFTInteger64 &&
+            eType != OFTReal && eType != OFTString)
+            bFastPath = false;
+    }
+    for (int i = 0; bFastPath && i < poFeatureDefn->GetGeomFieldCount(); ++i)
+    {
+        if (poFeatureDefn->GetGeomFieldDefn(i)->ePostgisType !=
+            GEOM_TYPE_GEOMETRY)
+            bFastPath = false;
+    }
+    if (!bFastPath)
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+
+    if (pszQueryStatement == nullptr)
+        ResetReading();
+
+    if (iNextShapeId < 0 || bInvalidated)
+        return 0;  // end of iteration
+
+    auto psHelper = std::make_unique<OGRArrowArrayHelper>(
+        poDS, poFeatureDefn, m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+        return ENOMEM;
+
+    PGconn *hPGConn = poDS->GetPGConn();
+    int iFeat = 0;
+    bool bErrorOccurred = false;
+    while (iFeat < psHelper->m_nMaxBatchSize)
+    {
+        /* ------------------------------------------------------------ */
+        /*      Cursor management, mirroring GetNextRawFeature().       */
+        /* ------------------------------------------------------------ */
+        if (iNextShapeId == 0 && hCursorResult == nullptr)
+            SetInitialQueryCursor();
+
+        if (hCursorResult == nullptr ||
+            PQresultStatus(hCursorResult) != PGRES_TUPLES_OK)
+        {
+            OGRPGClearResult(hCursorResult);
+            iNextShapeId = std::max<GIntBig>(1, iNextShapeId);
+            break;
+        }
+
+        if ((PQntuples(hCursorResult) == 1 ||
+             PQntuples(hCursorResult) == nCursorPage) &&
+            nResultOffset == PQntuples(hCursorResult))
+        {
+            OGRPGClearResult(hCursorResult);
+            CPLString osCommand;
+            osCommand.Printf("FETCH %d in %s", nCursorPage, pszCursorName);
+            hCursorResult = OGRPG_PQexec(hPGConn, osCommand);
+            nResultOffset = 0;
+            continue;
+        }
+
+        if (nResultOffset == PQntuples(hCursorResult))
+        {
+            CloseCursor();
+            iNextShapeId = std::max<GIntBig>(1, iNextShapeId);
+            break;
+        }
+
+        /* ------------------------------------------------------------ */
+        /*      Transfer the current record into the arrays.            */
+        /* ------------------------------------------------------------ */
+        const int iRecord = nResultOffset;
+        if (psHelper->m_panFIDValues)
+            psHelper->m_panFIDValues[iFeat] = iNextShapeId;
+
+        const int nPGFields = PQnfields(hCursorResult);
+        for (int iPGField = 0; iPGField < nPGFields && !bErrorOccurred;
+             iPGField++)
+        {
+            const char *pszFieldName = PQfname(hCursorResult, iPGField);
+            if (pszFIDColumn != nullptr &&
+                EQUAL(pszFieldName, pszFIDColumn))
+            {
+                if (psHelper->m_panFIDValues &&
+                    !PQgetisnull(hCursorResult, iRecord, iPGField))
+                {
+                    psHelper->m_panFIDValues[iFeat] = CPLAtoGIntBig(
+                        PQgetvalue(hCursorResult, iRecord, iPGField));
+                }
+                continue;
+            }
+
+            const int iOGRGeomField = m_panMapFieldNameToGeomIndex[iPGField];
+            if (iOGRGeomField >= 0)
+            {
+                const int iArrowField =
+                    psHelper->m_mapOGRGeomFieldToArrowField[iOGRGeomField];
+                if (iArrowField < 0)
+                    continue;
+                if (PQgetisnull(hCursorResult, iRecord, iPGField) ||
+                    PQgetlength(hCursorResult, iRecord, iPGField) == 0)
+                {
+                    if (!psHelper->SetNull(iArrowField, iFeat))
+                        bErrorOccurred = true;
+                    continue;
+                }
+                const char *pabyData =
+                    PQgetvalue(hCursorResult, iRecord, iPGField);
+                std::unique_ptr<OGRGeometry> poGeom(
+                    OGRGeometryFromHexEWKB(pabyData, nullptr, false));
+                if (poGeom == nullptr)
+                {
+                    if (!psHelper->SetNull(iArrowField, iFeat))
+                        bErrorOccurred = true;
+                    continue;
+                }
+                const size_t nWkbSize = poGeom->WkbSize();
+                GByte *outPtr = psHelper->GetPtrForStringOrBinary(
+                    iArrowField, iFeat, nWkbSize);
+                if (outPtr == nullptr)
+                {
+                    bErrorOccurred = true;
+                    continue;
+                }
+                poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+                continue;
+            }
+
+            const int iOGRField = m_panMapFieldNameToIndex[iPGField];
+            if (iOGRField < 0)
+                continue;
+            const int iArrowField =
+                psHelper->m_mapOGRFieldToArrowField[iOGRField];
+            if (iArrowField < 0)
+                continue;
+            auto psArray = out_array->children[iArrowField];
+            if (PQgetisnull(hCursorResult, iRecord, iPGField))
+            {
+                if (!psHelper->SetNull(iArrowField, iFeat))
+                    bErrorOccurred = true;
+                continue;
+            }
+            const char *pszValue =
+                PQgetvalue(hCursorResult, iRecord, iPGField);
+            const auto *poFieldDefn = poFeatureDefn->GetFieldDefn(iOGRField);
+            switch (poFieldDefn->GetType())
+            {
+                case OFTInteger:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTBoolean)
+                    {
+                        if (pszValue[0] == 't')
+                            OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                    }
+                    else if (poFieldDefn->GetSubType() == OFSTInt16)
+                    {
+                        OGRArrowArrayHelper::SetInt16(
+                            psArray, iFeat,
+                            static_cast<int16_t>(atoi(pszValue)));
+                    }
+                    else
+                    {
+                        OGRArrowArrayHelper::SetInt32(psArray, iFeat,
+                                                      atoi(pszValue));
+                    }
+                    break;
+                }
+                case OFTInteger64:
+                {
+                    OGRArrowArrayHelper::SetInt64(psArray, iFeat,
+                                                  CPLAtoGIntBig(pszValue));
+                    break;
+                }
+                case OFTReal:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                    {
+                        OGRArrowArrayHelper::SetFloat(
+                            psArray, iFeat,
+                            static_cast<float>(CPLAtof(pszValue)));
+                    }
+                    else
+                    {
+                        OGRArrowArrayHelper::SetDouble(psArray, iFeat,
+                                                       CPLAtof(pszValue));
+                    }
+                    break;
+                }
+                case OFTString:
+                {
+                    const size_t nLen = static_cast<size_t>(
+                        PQgetlength(hCursorResult, iRecord, iPGField));
+                    GByte *outPtr = psHelper->GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                    {
+                        bErrorOccurred = true;
+                        break;
+                    }
+                    memcpy(outPtr, pszValue, nLen);
+                    break;
+                }
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+        }
+
+        if (bErrorOccurred)
+            break;
+
+        nResultOffset++;
+        iNextShapeId++;
+        m_nFeaturesRead++;
+        iFeat++;
+    }
+
+    if (bErrorOccurred)
+    {
+        if (out_array->release)
+            out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+        return ENOMEM;
+    }
+
+    psHelper->Shrink(iFeat);
+    if (iFeat == 0)
+        psHelper->ClearArray();
+
+    return 0;
+}
+
 /************************************************************************/
 /*                            BuildFields()                             */
 /*                                                                      */
@@ -2120,8 +2386,47 @@ OGRErr OGRPGTableLayer::CreateFeatureViaInsert(OGRFeature *poFeature)
         osCommand += " ON CONFLICT DO NOTHING";
 
     /* -------------------------------------------------------------------- */
-    /*      Execute the insert.                                             */
+    /*      Execute the insert, queuing it in libpq pipeline mode when      */
+    /*      enabled, so that a stream of inserts does not pay one server    */
+    /*      round-trip each. Errors are then reported at the next           */
+    /*      synchronization point (next non-insert command, or flush).      */
     /* -------------------------------------------------------------------- */
+#ifdef LIBPQ_HAS_PIPELINING
+    if (bUsePipeline == USE_COPY_UNSET)
+        bUsePipeline = CPLTestBool(CPLGetConfigOption("PG_USE_PIPELINE", "NO"));
+    if (bUsePipeline && !bReturnRequested)
+    {
+        if (PQpipelineStatus(hPGConn) == PQ_PIPELINE_OFF &&
+            PQenterPipelineMode(hPGConn) != 1)
+        {
+            CPLDebug("PG", "PQenterPipelineMode() failed: %s",
+                     PQerrorMessage(hPGConn));
+            bUsePipeline = false;
+        }
+        else
+        {
+            if (PQsendQueryParams(hPGConn, osCommand.c_str(), 0, nullptr,
+                                  nullptr, nullptr, nullptr, 0) != 1)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "INSERT command for new feature failed.\n%s",
+                         PQerrorMessage(hPGConn));
+                OGRPG_FlushPipeline(hPGConn);
+                nPipelinedInserts = 0;
+                return OGRERR_FAILURE;
+            }
+            constexpr int MAX_PIPELINED_INSERTS = 1000;
+            if (++nPipelinedInserts >= MAX_PIPELINED_INSERTS)
+            {
+                nPipelinedInserts = 0;
+                if (!OGRPG_FlushPipeline(hPGConn))
+                    return OGRERR_FAILURE;
+            }
+            return OGRERR_NONE;
+        }
+    }
+#endif
+
     PGresult *hResult = OGRPG_PQexec(hPGConn, osCommand);
     if (bReturnRequested && PQresultStatus(hResult) == PGRES_TUPLES_OK &&
         PQntuples(hResult) == 1 && PQnfields(hResult) == 1)
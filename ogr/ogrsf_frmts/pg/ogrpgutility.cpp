@@ -13,6 +13,72 @@
 #include "ogr_pg.h"
 #include "cpl_conv.h"
 
+/************************************************************************/
+/*                        OGRPG_FlushPipeline()                         */
+/************************************************************************/
+
+/** Collects the results of all statements queued in libpq pipeline mode
+ * up to a synchronization point, and leaves pipeline mode. Returns false
+ * if any queued statement failed (reported with CPLError()). No-op when
+ * the connection is not in pipeline mode.
+ */
+bool OGRPG_FlushPipeline(PGconn *conn)
+{
+#ifdef LIBPQ_HAS_PIPELINING
+    if (PQpipelineStatus(conn) == PQ_PIPELINE_OFF)
+        return true;
+
+    bool bError = false;
+    if (PQpipelineSync(conn) != 1)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "PQpipelineSync() failed: %s",
+                 PQerrorMessage(conn));
+        bError = true;
+    }
+    else
+    {
+        while (true)
+        {
+            PGresult *hResult = PQgetResult(conn);
+            if (hResult == nullptr)
+            {
+                // NULL separates the results of the successive statements.
+                continue;
+            }
+            const auto eStatus = PQresultStatus(hResult);
+            if (eStatus == PGRES_PIPELINE_SYNC)
+            {
+                PQclear(hResult);
+                break;
+            }
+            if (eStatus != PGRES_COMMAND_OK && eStatus != PGRES_TUPLES_OK &&
+                eStatus != PGRES_PIPELINE_ABORTED)
+            {
+                if (!bError)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Pipelined INSERT command failed.\n%s",
+                             PQerrorMessage(conn));
+                }
+                bError = true;
+            }
+            PQclear(hResult);
+        }
+    }
+
+    if (PQexitPipelineMode(conn) != 1)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "PQexitPipelineMode() failed: %s", PQerrorMessage(conn));
+        bError = true;
+    }
+    return !bError;
+#else
+    (void)conn;
+    return true;
+#endif
+}
+
 /************************************************************************/
 /*                            OGRPG_PQexec()                            */
 /************************************************************************/
@@ -20,6 +86,13 @@
 PGresult *OGRPG_PQexec(PGconn *conn, const char *query,
                        int bMultipleCommandAllowed, int bErrorAsDebug)
 {
+#ifdef LIBPQ_HAS_PIPELINING
+    // Make sure previously pipelined statements are completed before
+    // running a synchronous command.
+    if (PQpipelineStatus(conn) != PQ_PIPELINE_OFF)
+        OGRPG_FlushPipeline(conn);
+#endif
+
     PGresult *hResult = bMultipleCommandAllowed
                             ? PQexec(conn, query)
                             : PQexecParams(conn, query, 0, nullptr, nullptr,
@@ -15,6 +15,8 @@
 
 #include "libpq-fe.h"
 
+bool OGRPG_FlushPipeline(PGconn *conn);
+
 PGresult *OGRPG_PQexec(PGconn *conn, const char *query,
                        int bMultipleCommandAllowed = FALSE,
                        int bErrorAsDebug = FALSE);
@@ -106,6 +106,9 @@ class OGRPMTilesDataset final : public GDALDataset
     /** Return a short-lived decompressed buffer for metadata or directory
      * entries or nullptr in case of error.
      */
+    std::shared_ptr<const std::vector<pmtiles::entryv3>>
+    ReadDirectory(uint64_t nOffset, uint64_t nSize, const char *pszDataType);
+
     const std::string *ReadInternal(uint64_t nOffset, uint64_t nSize,
                                     const char *pszDataType);
 
@@ -127,6 +130,9 @@ class OGRPMTilesDataset final : public GDALDataset
   private:
     VSIVirtualHandleUniquePtr m_poFileUniquePtr{};
 
+    //! Key prefix identifying the file in the decoded directory cache
+    std::string m_osDirCacheKeyPrefix{};
+
     VSIVirtualHandle *m_poFile = nullptr;
 
     //! PMTiles header
@@ -282,8 +288,9 @@ class OGRPMTilesTileIterator
     struct DirectoryContext
     {
         // Entries, either tiles (sEntry.run_length > 0) or subdiretories
-        // (sEntry.run_length == 0)
-        std::vector<pmtiles::entryv3> sEntries{};
+        // (sEntry.run_length == 0). Shared with the process-wide decoded
+        // directory cache.
+        std::shared_ptr<const std::vector<pmtiles::entryv3>> poEntries{};
 
         // Next index of sEntries[] to explore
         uint32_t nIdxInEntries = 0;
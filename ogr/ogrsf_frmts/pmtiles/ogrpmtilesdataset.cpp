@@ -14,6 +14,7 @@
 #include "ogr_pmtiles.h"
 
 #include "cpl_json.h"
+#include "cpl_mem_cache.h"
 
 #include "mvtutils.h"
 
@@ -126,6 +127,22 @@ bool OGRPMTilesDataset::Open(GDALOpenInfo *poOpenInfo)
 
     m_poFile = m_poFileUniquePtr.get();
 
+    // Identity of the file in the process-wide decoded directory cache:
+    // name, size and modification time.
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(poOpenInfo->pszFilename, &sStat) == 0)
+        {
+            m_osDirCacheKeyPrefix = poOpenInfo->pszFilename;
+            m_osDirCacheKeyPrefix += '|';
+            m_osDirCacheKeyPrefix +=
+                std::to_string(static_cast<uint64_t>(sStat.st_size));
+            m_osDirCacheKeyPrefix += '|';
+            m_osDirCacheKeyPrefix +=
+                std::to_string(static_cast<uint64_t>(sStat.st_mtime));
+        }
+    }
+
     // Deserizalize header
     std::string osHeader;
     osHeader.assign(reinterpret_cast<const char *>(poOpenInfo->pabyHeader),
@@ -793,6 +810,61 @@ const std::string *OGRPMTilesDataset::Read(const CPLCompressor *psDecompressor,
     }
 }
 
+/************************************************************************/
+/*                           ReadDirectory()                            */
+/************************************************************************/
+
+/** Returns the deserialized entries of the directory at [nOffset,
+ * nOffset+nSize[, through a process-wide cache, so that several handles
+ * on the same file (e.g. request handlers of a tile server) do not
+ * re-fetch, re-decompress and re-parse the same directory sections.
+ */
+std::shared_ptr<const std::vector<pmtiles::entryv3>>
+OGRPMTilesDataset::ReadDirectory(uint64_t nOffset, uint64_t nSize,
+                                 const char *pszDataType)
+{
+    typedef std::shared_ptr<const std::vector<pmtiles::entryv3>> CacheValue;
+    static std::mutex goDirCacheMutex;
+    static lru11::Cache<std::string, CacheValue> *gpoDirCache = nullptr;
+
+    std::string osKey;
+    if (!m_osDirCacheKeyPrefix.empty())
+    {
+        osKey = m_osDirCacheKeyPrefix;
+        osKey += '|';
+        osKey += std::to_string(nOffset);
+        osKey += '|';
+        osKey += std::to_string(nSize);
+
+        std::lock_guard<std::mutex> oLock(goDirCacheMutex);
+        if (gpoDirCache == nullptr)
+        {
+            const int nCacheSize = std::max(
+                1, atoi(CPLGetConfigOption("OGR_PMTILES_DIR_CACHE_SIZE",
+                                           "64")));
+            gpoDirCache = new lru11::Cache<std::string, CacheValue>(
+                static_cast<size_t>(nCacheSize));
+        }
+        CacheValue *poCached = gpoDirCache->getPtr(osKey);
+        if (poCached)
+            return *poCached;
+    }
+
+    const auto *posStr = ReadInternal(nOffset, nSize, pszDataType);
+    if (!posStr)
+        return nullptr;
+    auto poEntries = std::make_shared<std::vector<pmtiles::entryv3>>(
+        pmtiles::deserialize_directory(*posStr));
+
+    if (!osKey.empty())
+    {
+        std::lock_guard<std::mutex> oLock(goDirCacheMutex);
+        gpoDirCache->insert(osKey, poEntries);
+    }
+
+    return poEntries;
+}
+
 /************************************************************************/
 /*                            ReadInternal()                            */
 /************************************************************************/
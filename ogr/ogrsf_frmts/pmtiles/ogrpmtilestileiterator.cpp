@@ -108,17 +108,16 @@ bool OGRPMTilesTileIterator::LoadRootDirectory()
     }
 
     const auto &sHeader = m_poDS->GetHeader();
-    const auto *posStr = m_poDS->ReadInternal(
+
+    DirectoryContext sContext;
+    sContext.poEntries = m_poDS->ReadDirectory(
         sHeader.root_dir_offset, static_cast<uint32_t>(sHeader.root_dir_bytes),
         "header");
-    if (!posStr)
+    if (!sContext.poEntries)
     {
         return false;
     }
 
-    DirectoryContext sContext;
-    sContext.sEntries = pmtiles::deserialize_directory(*posStr);
-
     if (m_nZoomLevel >= 0)
     {
         if (m_nCurX >= 0)
@@ -126,7 +125,7 @@ bool OGRPMTilesTileIterator::LoadRootDirectory()
             while (true)
             {
                 const int nMinEntryIdx = find_tile_idx_lesser_or_equal(
-                    sContext.sEntries, m_nMinTileId);
+                    (*sContext.poEntries), m_nMinTileId);
                 if (nMinEntryIdx < 0)
                 {
                     m_nCurX++;
@@ -153,7 +152,7 @@ bool OGRPMTilesTileIterator::LoadRootDirectory()
         else
         {
             const int nMinEntryIdx =
-                find_tile_idx_lesser_or_equal(sContext.sEntries, m_nMinTileId);
+                find_tile_idx_lesser_or_equal((*sContext.poEntries), m_nMinTileId);
             if (nMinEntryIdx < 0)
             {
                 return false;
@@ -175,10 +174,10 @@ void OGRPMTilesTileIterator::SkipRunLength()
     if (!m_aoStack.empty())
     {
         auto &topContext = m_aoStack.top();
-        if (topContext.nIdxInEntries < topContext.sEntries.size())
+        if (topContext.nIdxInEntries < (*topContext.poEntries).size())
         {
             const auto &sCurrentEntry =
-                topContext.sEntries[topContext.nIdxInEntries];
+                (*topContext.poEntries)[topContext.nIdxInEntries];
             if (sCurrentEntry.run_length > 1)
             {
                 m_nLastTileId =
@@ -239,7 +238,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                         while (m_aoStack.size() > 1)
                             m_aoStack.pop();
                         const int nMinEntryIdx = find_tile_idx_lesser_or_equal(
-                            m_aoStack.top().sEntries, m_nMinTileId);
+                            (*m_aoStack.top().poEntries), m_nMinTileId);
                         if (nMinEntryIdx < 0)
                         {
                             continue;
@@ -257,7 +256,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
         while (true)
         {
             if (m_aoStack.top().nIdxInEntries ==
-                m_aoStack.top().sEntries.size())
+                (*m_aoStack.top().poEntries).size())
             {
                 if (m_aoStack.size() == 1 && AdvanceToNextTile())
                     continue;
@@ -268,7 +267,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                 continue;
             }
             auto &topContext = m_aoStack.top();
-            auto &sCurrentEntry = topContext.sEntries[topContext.nIdxInEntries];
+            auto &sCurrentEntry = (*topContext.poEntries)[topContext.nIdxInEntries];
             if (sCurrentEntry.run_length == 0)
             {
                 // Arbitrary limit. 5 seems to be the maximum value supported
@@ -289,10 +288,11 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                              "Invalid directory offset");
                     break;
                 }
-                const auto *posStr = m_poDS->ReadInternal(
+                DirectoryContext sContext;
+                sContext.poEntries = m_poDS->ReadDirectory(
                     sHeader.leaf_dirs_offset + sCurrentEntry.offset,
                     sCurrentEntry.length, "directory");
-                if (!posStr)
+                if (!sContext.poEntries)
                 {
                     m_bEOF = true;
                     CPLError(
@@ -306,9 +306,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                     break;
                 }
 
-                DirectoryContext sContext;
-                sContext.sEntries = pmtiles::deserialize_directory(*posStr);
-                if (sContext.sEntries.empty())
+                if (sContext.poEntries->empty())
                 {
                     m_bEOF = true;
                     // In theory empty directories could exist, but for now
@@ -320,7 +318,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                 }
 
                 if (m_nLastTileId != INVALID_LAST_TILE_ID &&
-                    sContext.sEntries[0].tile_id <= m_nLastTileId)
+                    (*sContext.poEntries)[0].tile_id <= m_nLastTileId)
                 {
                     m_bEOF = true;
                     CPLError(CE_Failure, CPLE_AppDefined,
@@ -331,7 +329,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                 if (m_nZoomLevel >= 0)
                 {
                     const int nMinEntryIdx = find_tile_idx_lesser_or_equal(
-                        sContext.sEntries, m_nMinTileId);
+                        (*sContext.poEntries), m_nMinTileId);
                     if (nMinEntryIdx < 0)
                     {
                         if (AdvanceToNextTile())
@@ -341,7 +339,7 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                     sContext.nIdxInEntries = nMinEntryIdx;
                 }
                 m_nLastTileId =
-                    sContext.sEntries[sContext.nIdxInEntries].tile_id;
+                    (*sContext.poEntries)[sContext.nIdxInEntries].tile_id;
 
                 m_aoStack.emplace(std::move(sContext));
 
@@ -369,8 +367,19 @@ pmtiles::entry_zxy OGRPMTilesTileIterator::GetNextTile(uint32_t *pnRunLength)
                             pmtiles::zxy_to_tileid(zxy.z + 1, 0, 0) - nTileId)
                     {
                         // Hit on /vsis3/us-west-2.opendata.source.coop/protomaps/openstreetmap/v4.pmtiles
-                        sCurrentEntry.run_length = static_cast<uint32_t>(
-                            pmtiles::zxy_to_tileid(zxy.z + 1, 0, 0) - nTileId);
+                        // The entries may come from the shared directory
+                        // cache: clone them before clamping the run length,
+                        // and re-enter the loop so that references rebind to
+                        // the private copy.
+                        auto poNewEntries = std::make_shared<
+                            std::vector<pmtiles::entryv3>>(
+                            *topContext.poEntries);
+                        (*poNewEntries)[topContext.nIdxInEntries].run_length =
+                            static_cast<uint32_t>(
+                                pmtiles::zxy_to_tileid(zxy.z + 1, 0, 0) -
+                                nTileId);
+                        topContext.poEntries = std::move(poNewEntries);
+                        continue;
                     }
 
                     topContext.nIdxInRunLength++;
@@ -2717,6 +2717,169 @@ OGRErr OGRShapeLayer::DropSpatialIndex()
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                  BuildSpatialIndexFromBoundsScan()                   */
+/************************************************************************/
+
+/** Builds the quadtree from a bounds-only scan of the .shp records,
+ * driven by the record offsets that shapelib keeps in memory, instead of
+ * fully deserializing every shape with SHPReadObject() as
+ * SHPCreateTree() does: only the 44 leading bytes of each record are
+ * looked at, through a large sequential readahead buffer. Returns
+ * nullptr when the fast scan cannot be used, in which case the caller
+ * falls back to SHPCreateTree().
+ */
+static SHPTree *BuildSpatialIndexFromBoundsScan(SHPHandle hSHP, int nMaxDepth)
+{
+    int nShapeCount = 0;
+    double adfMin[4] = {0.0, 0.0, 0.0, 0.0};
+    double adfMax[4] = {0.0, 0.0, 0.0, 0.0};
+    SHPGetInfo(hSHP, &nShapeCount, nullptr, adfMin, adfMax);
+    if (nShapeCount <= 0 || hSHP->fpSHP == nullptr ||
+        hSHP->panRecOffset == nullptr || hSHP->panRecSize == nullptr)
+        return nullptr;
+
+    // Same heuristic as SHPCreateTree() when no depth is given.
+    int nDepth = nMaxDepth;
+    if (nDepth == 0)
+    {
+        int nMaxNodeCount = 1;
+        while (nMaxNodeCount * 4 < nShapeCount)
+        {
+            nDepth++;
+            nMaxNodeCount *= 2;
+        }
+        if (nDepth > MAX_DEFAULT_TREE_DEPTH)
+            nDepth = MAX_DEFAULT_TREE_DEPTH;
+    }
+
+    // Process the records in file offset order, so that the scan is a
+    // single sequential pass even on files that have been edited.
+    std::vector<int> anOrder;
+    try
+    {
+        anOrder.resize(nShapeCount);
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+    for (int i = 0; i < nShapeCount; ++i)
+    {
+        // A zero offset means the lazily loaded .shx entries have not
+        // been read: let the regular code path deal with that.
+        if (hSHP->panRecOffset[i] == 0)
+            return nullptr;
+        anOrder[i] = i;
+    }
+    std::sort(anOrder.begin(), anOrder.end(),
+              [hSHP](int i, int j)
+              { return hSHP->panRecOffset[i] < hSHP->panRecOffset[j]; });
+
+    SHPTree *psTree = SHPCreateTree(nullptr, 2, nDepth, adfMin, adfMax);
+    if (psTree == nullptr)
+        return nullptr;
+
+    constexpr size_t CHUNK_SIZE = 8 * 1024 * 1024;
+    constexpr size_t HEADER_BYTES = 8 + 4 + 4 * sizeof(double);
+    std::vector<GByte> abyChunk;
+    try
+    {
+        abyChunk.resize(CHUNK_SIZE);
+    }
+    catch (const std::exception &)
+    {
+        SHPDestroyTree(psTree);
+        return nullptr;
+    }
+
+    SAOffset nChunkOff = 0;
+    size_t nChunkLen = 0;
+    SHPObject sObj;
+    for (int iShape : anOrder)
+    {
+        const SAOffset nRecOff =
+            static_cast<SAOffset>(hSHP->panRecOffset[iShape]);
+        const unsigned int nRecSize = hSHP->panRecSize[iShape];
+        if (nRecSize < 4)
+            continue;
+        const size_t nNeeded = static_cast<size_t>(
+            8 + std::min<unsigned int>(nRecSize,
+                                       4 + 4 * sizeof(double)));
+        if (!(nRecOff >= nChunkOff &&
+              static_cast<size_t>(nRecOff - nChunkOff) + nNeeded <=
+                  nChunkLen))
+        {
+            if (hSHP->sHooks.FSeek(hSHP->fpSHP, nRecOff, 0) != 0)
+            {
+                SHPDestroyTree(psTree);
+                return nullptr;
+            }
+            nChunkLen = static_cast<size_t>(hSHP->sHooks.FRead(
+                abyChunk.data(), 1, CHUNK_SIZE, hSHP->fpSHP));
+            nChunkOff = nRecOff;
+            if (nNeeded > nChunkLen)
+            {
+                // Truncated record: skip it, like SHPReadObject() would
+                // fail on it.
+                continue;
+            }
+        }
+        const GByte *pabyRec =
+            abyChunk.data() + static_cast<size_t>(nRecOff - nChunkOff);
+
+        int nType = 0;
+        memcpy(&nType, pabyRec + 8, 4);
+        CPL_LSBPTR32(&nType);
+
+        memset(&sObj, 0, sizeof(sObj));
+        sObj.nShapeId = iShape;
+
+        if (nType == SHPT_POINT || nType == SHPT_POINTZ ||
+            nType == SHPT_POINTM)
+        {
+            if (nRecSize < 4 + 2 * sizeof(double))
+                continue;
+            double dfX = 0.0;
+            double dfY = 0.0;
+            memcpy(&dfX, pabyRec + 12, sizeof(double));
+            memcpy(&dfY, pabyRec + 12 + sizeof(double), sizeof(double));
+            CPL_LSBPTR64(&dfX);
+            CPL_LSBPTR64(&dfY);
+            sObj.dfXMin = dfX;
+            sObj.dfXMax = dfX;
+            sObj.dfYMin = dfY;
+            sObj.dfYMax = dfY;
+        }
+        else if (nType == SHPT_ARC || nType == SHPT_POLYGON ||
+                 nType == SHPT_MULTIPOINT || nType == SHPT_ARCZ ||
+                 nType == SHPT_POLYGONZ || nType == SHPT_MULTIPOINTZ ||
+                 nType == SHPT_ARCM || nType == SHPT_POLYGONM ||
+                 nType == SHPT_MULTIPOINTM || nType == SHPT_MULTIPATCH)
+        {
+            if (nRecSize < 4 + 4 * sizeof(double))
+                continue;
+            double adfBounds[4];
+            memcpy(adfBounds, pabyRec + 12, 4 * sizeof(double));
+            for (int k = 0; k < 4; ++k)
+                CPL_LSBPTR64(&adfBounds[k]);
+            sObj.dfXMin = adfBounds[0];
+            sObj.dfYMin = adfBounds[1];
+            sObj.dfXMax = adfBounds[2];
+            sObj.dfYMax = adfBounds[3];
+        }
+        else
+        {
+            // Null or unknown shape: nothing to index.
+            continue;
+        }
+
+        SHPTreeAddShapeId(psTree, &sObj);
+    }
+
+    return psTree;
+}
+
 /************************************************************************/
 /*                         CreateSpatialIndex()                         */
 /************************************************************************/
@@ -2739,7 +2902,12 @@ OGRErr OGRShapeLayer::CreateSpatialIndex(int nMaxDepth)
     /*      Build a quadtree structure for this file.                       */
     /* -------------------------------------------------------------------- */
     OGRShapeLayer::SyncToDisk();
-    SHPTree *psTree = SHPCreateTree(m_hSHP, 2, nMaxDepth, nullptr, nullptr);
+    SHPTree *psTree = nullptr;
+    if (CPLTestBool(
+            CPLGetConfigOption("OGR_SHAPE_FAST_SPATIAL_INDEX", "YES")))
+        psTree = BuildSpatialIndexFromBoundsScan(m_hSHP, nMaxDepth);
+    if (psTree == nullptr)
+        psTree = SHPCreateTree(m_hSHP, 2, nMaxDepth, nullptr, nullptr);
 
     if (nullptr == psTree)
     {
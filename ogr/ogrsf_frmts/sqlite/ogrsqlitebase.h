@@ -25,6 +25,7 @@
 #define SQLITE_TRANSIENT reinterpret_cast<sqlite3_destructor_type>(-1)
 
 #include <map>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -137,10 +138,24 @@ class OGRSQLiteBaseDataSource CPL_NON_FINAL : public GDALPamDataset
                         bool bLoadExtensions);
     bool SetSynchronous();
     bool SetCacheSize();
+    bool SetMMapSize();
     void LoadExtensions();
 
     bool CloseDB();
 
+    /** Lets subclasses install their SQL functions on a freshly opened
+     * pooled read-only connection. Returning false disables the pool. */
+    virtual bool PrepareReadOnlyConnection(sqlite3 *)
+    {
+        return true;
+    }
+
+    // Pool of additional read-only connections (see AcquireReadOnlyDB())
+    std::mutex m_oReadOnlyDBPoolMutex{};
+    std::vector<sqlite3 *> m_apoReadOnlyDBPool{};
+    int m_nReadOnlyDBsIssued = 0;
+    int m_nMaxReadOnlyDBs = -1;  // -1: not initialized yet
+
     std::map<CPLString, OGREnvelope> oMapSQLEnvelope{};
 
     mutable bool m_bHasPopulatedRelationships = false;
@@ -184,6 +199,31 @@ class OGRSQLiteBaseDataSource CPL_NON_FINAL : public GDALPamDataset
         return hDB;
     }
 
+    sqlite3 *AcquireReadOnlyDB();
+    void ReleaseReadOnlyDB(sqlite3 *hReadOnlyDB);
+
+    /** RAII holder around AcquireReadOnlyDB()/ReleaseReadOnlyDB(). The
+     * handle may be null when the pool is disabled or exhausted: callers
+     * must fall back to GetDB() under the dataset mutex in that case. */
+    struct ReadOnlyDBHolder
+    {
+        OGRSQLiteBaseDataSource *m_poDS;
+        sqlite3 *m_hDB;
+
+        explicit ReadOnlyDBHolder(OGRSQLiteBaseDataSource *poDS)
+            : m_poDS(poDS), m_hDB(poDS->AcquireReadOnlyDB())
+        {
+        }
+
+        ~ReadOnlyDBHolder()
+        {
+            if (m_hDB)
+                m_poDS->ReleaseReadOnlyDB(m_hDB);
+        }
+
+        CPL_DISALLOW_COPY_ASSIGN(ReadOnlyDBHolder)
+    };
+
     sqlite3_vfs *GetVFS()
     {
         return pMyVFS;
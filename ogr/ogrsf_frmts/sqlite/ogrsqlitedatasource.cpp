@@ -562,6 +562,104 @@ OGRSQLiteBaseDataSource::~OGRSQLiteBaseDataSource()
     CPLFree(m_pszFilename);
 }
 
+/************************************************************************/
+/*                         AcquireReadOnlyDB()                          */
+/************************************************************************/
+
+/** Returns an additional read-only connection to the database, from a
+ * small pool, so that independent threads can run read queries without
+ * serializing on the main handle and the dataset mutex.
+ *
+ * Only available for read-only datasets on real files, and when the
+ * OGR_SQLITE_READ_CONNECTION_POOL_SIZE configuration option (default 0:
+ * disabled) allows it. Returns nullptr when no pooled connection can be
+ * provided; the caller must then fall back to GetDB() with its usual
+ * locking. The connection must be returned with ReleaseReadOnlyDB().
+ */
+sqlite3 *OGRSQLiteBaseDataSource::AcquireReadOnlyDB()
+{
+    if (eAccess != GA_ReadOnly)
+        return nullptr;
+
+    std::lock_guard<std::mutex> oLock(m_oReadOnlyDBPoolMutex);
+
+    if (m_nMaxReadOnlyDBs < 0)
+    {
+        m_nMaxReadOnlyDBs = 0;
+        // Pooled connections bypass our VFS: only allow them when the
+        // database is a plain file.
+        VSIStatBufL sStat;
+        if (!STARTS_WITH(m_pszFilename, "/vsi") &&
+            VSIStatExL(m_pszFilename, &sStat, VSI_STAT_NATURE_FLAG) == 0 &&
+            VSI_ISREG(sStat.st_mode))
+        {
+            m_nMaxReadOnlyDBs = std::max(
+                0, atoi(CPLGetConfigOption(
+                       "OGR_SQLITE_READ_CONNECTION_POOL_SIZE", "0")));
+        }
+    }
+
+    if (!m_apoReadOnlyDBPool.empty())
+    {
+        sqlite3 *hReadOnlyDB = m_apoReadOnlyDBPool.back();
+        m_apoReadOnlyDBPool.pop_back();
+        return hReadOnlyDB;
+    }
+
+    if (m_nReadOnlyDBsIssued >= m_nMaxReadOnlyDBs)
+        return nullptr;
+
+    sqlite3 *hReadOnlyDB = nullptr;
+    if (sqlite3_open_v2(m_pszFilename, &hReadOnlyDB,
+                        SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
+                        nullptr) != SQLITE_OK)
+    {
+        if (hReadOnlyDB)
+            sqlite3_close(hReadOnlyDB);
+        // Do not retry on every call.
+        m_nMaxReadOnlyDBs = 0;
+        return nullptr;
+    }
+
+    // Memory map the database for the fastest possible reads.
+    const char *pszMMapSize =
+        CPLGetConfigOption("OGR_SQLITE_MMAP_SIZE", "1073741824");
+    char *pszSQL =
+        sqlite3_mprintf("PRAGMA mmap_size = %q", pszMMapSize);
+    char *pszErrMsg = nullptr;
+    if (sqlite3_exec(hReadOnlyDB, pszSQL, nullptr, nullptr, &pszErrMsg) !=
+        SQLITE_OK)
+    {
+        CPLDebug("SQLITE", "PRAGMA mmap_size failed: %s",
+                 pszErrMsg ? pszErrMsg : "");
+    }
+    sqlite3_free(pszErrMsg);
+    sqlite3_free(pszSQL);
+
+    if (!PrepareReadOnlyConnection(hReadOnlyDB))
+    {
+        sqlite3_close(hReadOnlyDB);
+        m_nMaxReadOnlyDBs = 0;
+        return nullptr;
+    }
+
+    m_nReadOnlyDBsIssued++;
+    return hReadOnlyDB;
+}
+
+/************************************************************************/
+/*                         ReleaseReadOnlyDB()                          */
+/************************************************************************/
+
+/** Returns to the pool a connection obtained with AcquireReadOnlyDB(). */
+void OGRSQLiteBaseDataSource::ReleaseReadOnlyDB(sqlite3 *hReadOnlyDB)
+{
+    if (hReadOnlyDB == nullptr)
+        return;
+    std::lock_guard<std::mutex> oLock(m_oReadOnlyDBPoolMutex);
+    m_apoReadOnlyDBPool.push_back(hReadOnlyDB);
+}
+
 /************************************************************************/
 /*                              CloseDB()                               */
 /************************************************************************/
@@ -569,6 +667,22 @@ OGRSQLiteBaseDataSource::~OGRSQLiteBaseDataSource()
 bool OGRSQLiteBaseDataSource::CloseDB()
 {
     bool bOK = true;
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oReadOnlyDBPoolMutex);
+        if (m_nReadOnlyDBsIssued !=
+            static_cast<int>(m_apoReadOnlyDBPool.size()))
+        {
+            CPLDebug("SQLITE",
+                     "CloseDB() called with read-only pooled connections "
+                     "still in use");
+        }
+        for (sqlite3 *hReadOnlyDB : m_apoReadOnlyDBPool)
+            sqlite3_close(hReadOnlyDB);
+        m_apoReadOnlyDBPool.clear();
+        m_nReadOnlyDBsIssued = 0;
+        m_nMaxReadOnlyDBs = -1;
+    }
     if (hDB != nullptr)
     {
         bOK = (sqlite3_close(hDB) == SQLITE_OK);
@@ -1210,6 +1324,39 @@ void OGRSQLiteBaseDataSource::LoadExtensions()
     }
 }
 
+/************************************************************************/
+/*                            SetMMapSize()                             */
+/************************************************************************/
+
+bool OGRSQLiteBaseDataSource::SetMMapSize()
+{
+    const char *pszMMapSize = CSLFetchNameValue(papszOpenOptions, "MMAP_SIZE");
+    if (pszMMapSize == nullptr)
+        pszMMapSize = CPLGetConfigOption("OGR_SQLITE_MMAP_SIZE", nullptr);
+    std::string osDefault;
+    if (pszMMapSize == nullptr)
+    {
+        // Default: memory map read-only databases on plain files, up to
+        // 1 GB. When our VSI based VFS is used SQLite cannot map the file,
+        // and the pragma would be a no-op.
+        if (eAccess != GA_ReadOnly || pMyVFS != nullptr)
+            return true;
+        VSIStatBufL sStat;
+        if (STARTS_WITH(m_pszFilename, "/vsi") ||
+            VSIStatL(m_pszFilename, &sStat) != 0)
+            return true;
+        constexpr GIntBig MAX_DEFAULT_MMAP_SIZE = 1024 * 1024 * 1024;
+        osDefault = std::to_string(std::min<GIntBig>(
+            MAX_DEFAULT_MMAP_SIZE, static_cast<GIntBig>(sStat.st_size)));
+        pszMMapSize = osDefault.c_str();
+    }
+    char *pszSQL = sqlite3_mprintf("PRAGMA mmap_size = %q", pszMMapSize);
+    const bool bOK =
+        sqlite3_exec(hDB, pszSQL, nullptr, nullptr, nullptr) == SQLITE_OK;
+    sqlite3_free(pszSQL);
+    return bOK;
+}
+
 /************************************************************************/
 /*                            SetCacheSize()                            */
 /************************************************************************/
@@ -1217,12 +1364,28 @@ void OGRSQLiteBaseDataSource::LoadExtensions()
 bool OGRSQLiteBaseDataSource::SetCacheSize()
 {
     const char *pszSqliteCacheMB =
-        CPLGetConfigOption("OGR_SQLITE_CACHE", nullptr);
+        CSLFetchNameValue(papszOpenOptions, "CACHE_SIZE_MB");
+    if (pszSqliteCacheMB == nullptr)
+        pszSqliteCacheMB = CPLGetConfigOption("OGR_SQLITE_CACHE", nullptr);
+    GIntBig iSqliteCacheBytes = 0;
     if (pszSqliteCacheMB != nullptr)
     {
-        const GIntBig iSqliteCacheBytes =
+        iSqliteCacheBytes =
             static_cast<GIntBig>(atoi(pszSqliteCacheMB)) * 1024 * 1024;
-
+    }
+    else if (eAccess == GA_ReadOnly)
+    {
+        // Default for read-only opens: size the page cache from the GDAL
+        // block cache budget, within reasonable bounds.
+        constexpr GIntBig MAX_DEFAULT_CACHE_SIZE = 512 * 1024 * 1024;
+        constexpr GIntBig MIN_DEFAULT_CACHE_SIZE = 2 * 1024 * 1024;
+        iSqliteCacheBytes =
+            std::min(MAX_DEFAULT_CACHE_SIZE, GDALGetCacheMax64() / 4);
+        if (iSqliteCacheBytes <= MIN_DEFAULT_CACHE_SIZE)
+            return true;  // Not larger than the SQLite built-in default
+    }
+    if (iSqliteCacheBytes > 0)
+    {
         /* querying the current PageSize */
         int iSqlitePageSize = SQLGetInteger(hDB, "PRAGMA page_size", nullptr);
         if (iSqlitePageSize <= 0)
@@ -1418,7 +1581,9 @@ bool OGRSQLiteBaseDataSource::OpenOrCreateDB(int flagsIn,
 
     const char *pszSqlitePragma =
         CPLGetConfigOption("OGR_SQLITE_PRAGMA", nullptr);
-    CPLString osJournalMode = CPLGetConfigOption("OGR_SQLITE_JOURNAL", "");
+    CPLString osJournalMode = CSLFetchNameValueDef(
+        papszOpenOptions, "JOURNAL_MODE",
+        CPLGetConfigOption("OGR_SQLITE_JOURNAL", ""));
 
     if (bUseOGRVFS)
     {
@@ -1694,6 +1859,7 @@ bool OGRSQLiteBaseDataSource::OpenOrCreateDB(int flagsIn,
     }
 
     SetCacheSize();
+    SetMMapSize();
     SetSynchronous();
     if (bLoadExtensions)
         LoadExtensions();
@@ -315,6 +315,23 @@ void RegisterOGRSQLite()
         "trusted datasources to avoid potential safety issues' default='NO'/>"
         "  <Option name='PRELUDE_STATEMENTS' type='string' description='SQL "
         "statement(s) to send on the SQLite connection before any other ones'/>"
+        "  <Option name='MMAP_SIZE' type='integer' "
+        "description='Number of bytes of the database memory mapped by "
+        "SQLite (PRAGMA mmap_size). Defaults to the file size, up to 1GB, "
+        "for read-only opens of plain files'/>"
+        "  <Option name='CACHE_SIZE_MB' type='integer' "
+        "description='SQLite page cache size, in megabytes. Defaults, for "
+        "read-only opens, to a quarter of GDAL_CACHEMAX, up to 512MB'/>"
+        "  <Option name='JOURNAL_MODE' type='string-select' "
+        "description='Journal mode (PRAGMA journal_mode), e.g. WAL for "
+        "concurrent readers with a writer'>"
+        "    <Value>DELETE</Value>"
+        "    <Value>TRUNCATE</Value>"
+        "    <Value>PERSIST</Value>"
+        "    <Value>MEMORY</Value>"
+        "    <Value>WAL</Value>"
+        "    <Value>OFF</Value>"
+        "  </Option>"
 #ifdef HAVE_RASTERLITE2
         "  <Option name='1BIT_AS_8BIT' type='boolean' scope='raster' "
         "description='Whether to promote 1-bit monochrome raster as 8-bit, so "
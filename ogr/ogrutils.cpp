@@ -231,26 +231,28 @@ std::string OGRFormatDouble(double val, const OGRWktOptions &opts, int nDimIdx)
     if (std::isnan(val))
         return "nan";
 
-    static thread_local std::locale classic_locale = []()
-    { return std::locale::classic(); }();
-    std::ostringstream oss;
-    oss.imbue(classic_locale);  // Make sure we output decimal points.
+    const int nPrecision = nDimIdx < 3    ? opts.xyPrecision
+                           : nDimIdx == 3 ? opts.zPrecision
+                                          : opts.mPrecision;
     bool l_round(opts.round);
+
+    // CPLsnprintf() formats doubles with the C locale whatever the current
+    // one, and is much cheaper than the std::ostringstream machinery that
+    // was used before. %f matches std::fixed and %G the default stream
+    // float representation with std::uppercase ('E' per OGC spec).
+    char szBuffer[512];
     if (opts.format == OGRWktFormat::F ||
         (opts.format == OGRWktFormat::Default && fabs(val) < 1))
-        oss << std::fixed;
+    {
+        CPLsnprintf(szBuffer, sizeof(szBuffer), "%.*f", nPrecision, val);
+    }
     else
     {
-        // Uppercase because OGC spec says capital 'E'.
-        oss << std::uppercase;
+        CPLsnprintf(szBuffer, sizeof(szBuffer), "%.*G", nPrecision, val);
         l_round = false;
     }
-    oss << std::setprecision(nDimIdx < 3    ? opts.xyPrecision
-                             : nDimIdx == 3 ? opts.zPrecision
-                                            : opts.mPrecision);
-    oss << val;
 
-    std::string sval = oss.str();
+    std::string sval = szBuffer;
 
     if (l_round)
         intelliround(sval);
@@ -650,19 +652,69 @@ const char *OGRWktReadPointsM(const char *pszInput, OGRRawPoint **ppaoPoints,
         /*      Read the X and Y values, verify they are numeric. */
         /* --------------------------------------------------------------------
          */
-        char szTokenX[OGR_WKT_TOKEN_MAX] = {};
-        char szTokenY[OGR_WKT_TOKEN_MAX] = {};
-
-        pszInput = OGRWktReadToken(pszInput, szTokenX);
-        pszInput = OGRWktReadToken(pszInput, szTokenY);
+        double dfX = 0.0;
+        double dfY = 0.0;
+        bool bParsedInPlace = false;
+
+        /* Fast path: parse the two coordinates in place, avoiding the
+         * token buffer copies and re-scans. Any unusual input (including
+         * "nan") falls back to the token based path below, which behaves
+         * exactly as before. */
+        {
+            const auto IsWS = [](char ch)
+            { return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r'; };
+            const auto IsNumStart = [](char ch)
+            { return (ch >= '0' && ch <= '9') || ch == '-' || ch == '.'; };
+
+            const char *pszIter = pszInput;
+            while (IsWS(*pszIter))
+                ++pszIter;
+            if (IsNumStart(*pszIter))
+            {
+                char *pszEnd = nullptr;
+                dfX = CPLStrtodDelim(pszIter, &pszEnd, '.');
+                if (pszEnd != pszIter && IsWS(*pszEnd))
+                {
+                    pszIter = pszEnd;
+                    while (IsWS(*pszIter))
+                        ++pszIter;
+                    if (IsNumStart(*pszIter))
+                    {
+                        dfY = CPLStrtodDelim(pszIter, &pszEnd, '.');
+                        if (pszEnd != pszIter &&
+                            (IsWS(*pszEnd) || *pszEnd == ',' ||
+                             *pszEnd == ')' || *pszEnd == '\0'))
+                        {
+                            pszIter = pszEnd;
+                            while (IsWS(*pszIter))
+                                ++pszIter;
+                            pszInput = pszIter;
+                            bParsedInPlace = true;
+                        }
+                    }
+                }
+            }
+        }
 
-        if ((!isdigit(static_cast<unsigned char>(szTokenX[0])) &&
-             szTokenX[0] != '-' && szTokenX[0] != '.' &&
-             !EQUAL(szTokenX, "nan")) ||
-            (!isdigit(static_cast<unsigned char>(szTokenY[0])) &&
-             szTokenY[0] != '-' && szTokenY[0] != '.' &&
-             !EQUAL(szTokenY, "nan")))
-            return nullptr;
+        if (!bParsedInPlace)
+        {
+            char szTokenX[OGR_WKT_TOKEN_MAX] = {};
+            char szTokenY[OGR_WKT_TOKEN_MAX] = {};
+
+            pszInput = OGRWktReadToken(pszInput, szTokenX);
+            pszInput = OGRWktReadToken(pszInput, szTokenY);
+
+            if ((!isdigit(static_cast<unsigned char>(szTokenX[0])) &&
+                 szTokenX[0] != '-' && szTokenX[0] != '.' &&
+                 !EQUAL(szTokenX, "nan")) ||
+                (!isdigit(static_cast<unsigned char>(szTokenY[0])) &&
+                 szTokenY[0] != '-' && szTokenY[0] != '.' &&
+                 !EQUAL(szTokenY, "nan")))
+                return nullptr;
+
+            dfX = CPLAtof(szTokenX);
+            dfY = CPLAtof(szTokenY);
+        }
 
         /* --------------------------------------------------------------------
          */
@@ -693,8 +745,8 @@ const char *OGRWktReadPointsM(const char *pszInput, OGRRawPoint **ppaoPoints,
         /*      Add point to list. */
         /* --------------------------------------------------------------------
          */
-        (*ppaoPoints)[*pnPointsRead].x = CPLAtof(szTokenX);
-        (*ppaoPoints)[*pnPointsRead].y = CPLAtof(szTokenY);
+        (*ppaoPoints)[*pnPointsRead].x = dfX;
+        (*ppaoPoints)[*pnPointsRead].y = dfY;
 
         /* --------------------------------------------------------------------
          */
@@ -2298,10 +2350,19 @@ int OGRFormatFloat(char *pszBuffer, int nBufferLen, float fVal, int nPrecision,
     const int nInitialSignificantFigures =
         nPrecision >= 0 ? nPrecision : MAX_SIGNIFICANT_DIGITS_FLOAT32;
 
-    CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%d%c",
-                nInitialSignificantFigures, chConversionSpecifier);
-    nSize = CPLsnprintf(pszBuffer, nBufferLen, szFormatting,
-                        static_cast<double>(fVal));
+    if (chConversionSpecifier == 'g')
+    {
+        nSize = CPLFormatDoubleG(pszBuffer, nBufferLen,
+                                 static_cast<double>(fVal),
+                                 nInitialSignificantFigures);
+    }
+    else
+    {
+        CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%d%c",
+                    nInitialSignificantFigures, chConversionSpecifier);
+        nSize = CPLsnprintf(pszBuffer, nBufferLen, szFormatting,
+                            static_cast<double>(fVal));
+    }
     const char *pszDot = strchr(pszBuffer, '.');
 
     // Try to avoid 0.34999999 or 0.15000001 rounding issues by
@@ -870,6 +870,22 @@ swq_expr_node *swq_expr_node::Evaluate(swq_field_fetcher pfnFetcher,
                 anValueNeedsFree.push_back(TRUE);
             }
         }
+
+        // Short-circuit AND as soon as an operand evaluates to non-null
+        // FALSE: per the SWQ_AND evaluator semantics (is_null only when
+        // both operands are null), the result is then FALSE-not-null
+        // whatever the remaining operand, which does not need to be
+        // evaluated. This makes multi-clause WHERE filters stop at the
+        // first failing clause.
+        if (!bError && nOperation == SWQ_AND && i == 0 &&
+            !apoValues[0]->is_null && apoValues[0]->int_value == 0)
+        {
+            if (anValueNeedsFree[0])
+                delete apoValues[0];
+            poRetNode = new swq_expr_node(0);
+            poRetNode->field_type = SWQ_BOOLEAN;
+            return poRetNode;
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -0,0 +1,218 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Micro-benchmarks of core hot paths, with statistical
+ *           repetition and JSON output (see gdalbench.h)
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdalbench.h"
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "gdal_priv.h"
+#include "gdal_alg.h"
+#include "gdalwarper.h"
+#include "ogrsf_frmts.h"
+#include "ogr_feature.h"
+
+#include <vector>
+
+/************************************************************************/
+/*                         BenchCopyWords()                             */
+/************************************************************************/
+
+static void BenchCopyWords(GDALBench &oBench)
+{
+    constexpr size_t N = 16 * 1024 * 1024;
+    std::vector<GByte> abySrc(N, 127);
+    std::vector<float> afDst(N);
+    oBench.Run("GDALCopyWords64 Byte->Float32", N * (1 + sizeof(float)),
+               [&abySrc, &afDst]()
+               {
+                   GDALCopyWords64(abySrc.data(), GDT_Byte, 1, afDst.data(),
+                                   GDT_Float32, sizeof(float),
+                                   static_cast<GPtrDiff_t>(N));
+               });
+
+    std::vector<GUInt16> anSrc16(N, 12345);
+    std::vector<double> adfDst(N);
+    oBench.Run("GDALCopyWords64 UInt16->Float64",
+               N * (sizeof(GUInt16) + sizeof(double)),
+               [&anSrc16, &adfDst]()
+               {
+                   GDALCopyWords64(anSrc16.data(), GDT_UInt16, sizeof(GUInt16),
+                                   adfDst.data(), GDT_Float64, sizeof(double),
+                                   static_cast<GPtrDiff_t>(N));
+               });
+}
+
+/************************************************************************/
+/*                        BenchBlockCache()                             */
+/************************************************************************/
+
+static void BenchBlockCache(GDALBench &oBench)
+{
+    // Exercise block creation/eviction churn through a MEM dataset whose
+    // band largely exceeds the configured cache size.
+    CPLSetConfigOption("GDAL_CACHEMAX", "16");
+    GDALAllRegister();
+    GDALDriver *poDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poDriver)
+        return;
+    constexpr int XSIZE = 4096;
+    constexpr int YSIZE = 2048;
+    GDALDataset *poDS =
+        poDriver->Create("", XSIZE, YSIZE, 1, GDT_Byte, nullptr);
+    if (!poDS)
+        return;
+    GDALRasterBand *poBand = poDS->GetRasterBand(1);
+    // Go through GetLockedBlockRef() explicitly: the MEM driver would
+    // otherwise serve RasterIO() directly from its backing memory, without
+    // exercising block creation/eviction.
+    oBench.Run("Block cache churn (block refs)",
+               static_cast<uint64_t>(XSIZE) * YSIZE,
+               [&poBand]()
+               {
+                   for (int iLine = 0; iLine < YSIZE; ++iLine)
+                   {
+                       GDALRasterBlock *poBlock =
+                           poBand->GetLockedBlockRef(0, iLine);
+                       if (poBlock)
+                           poBlock->DropLock();
+                   }
+               });
+    GDALClose(poDS);
+    CPLSetConfigOption("GDAL_CACHEMAX", nullptr);
+}
+
+/************************************************************************/
+/*                     BenchOGRFeatureIteration()                       */
+/************************************************************************/
+
+static void BenchOGRFeatureIteration(GDALBench &oBench)
+{
+    GDALDriver *poDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poDriver)
+        return;
+    GDALDataset *poDS = poDriver->Create("", 0, 0, 0, GDT_Unknown, nullptr);
+    if (!poDS)
+        return;
+    OGRLayer *poLayer = poDS->CreateLayer("bench", nullptr, wkbPoint, nullptr);
+    OGRFieldDefn oFieldStr("name", OFTString);
+    OGRFieldDefn oFieldInt("value", OFTInteger);
+    poLayer->CreateField(&oFieldStr);
+    poLayer->CreateField(&oFieldInt);
+    constexpr int NFEATURES = 200 * 1000;
+    for (int i = 0; i < NFEATURES; ++i)
+    {
+        OGRFeature oFeat(poLayer->GetLayerDefn());
+        oFeat.SetField(0, "some attribute value");
+        oFeat.SetField(1, i);
+        OGRPoint oPoint(i, -i);
+        oFeat.SetGeometry(&oPoint);
+        CPL_IGNORE_RET_VAL(poLayer->CreateFeature(&oFeat));
+    }
+    oBench.Run("OGR feature iteration (MEM layer)", 0,
+               [&poLayer]()
+               {
+                   poLayer->ResetReading();
+                   for (auto &poFeature : *poLayer)
+                   {
+                       CPL_IGNORE_RET_VAL(poFeature->GetFieldAsInteger(1));
+                   }
+               });
+    GDALClose(poDS);
+}
+
+/************************************************************************/
+/*                          BenchVSIMem()                               */
+/************************************************************************/
+
+static void BenchVSIMem(GDALBench &oBench)
+{
+    // Stands in for remote I/O paths: measures the pure VSI layer
+    // overhead with chunked reads, as a curl simulation without network.
+    constexpr size_t FILESIZE = 64 * 1024 * 1024;
+    constexpr size_t CHUNK = 16 * 1024;
+    std::vector<GByte> abyData(FILESIZE, 1);
+    const char *pszFilename = "/vsimem/gdalbench.bin";
+    VSILFILE *fpWrite = VSIFOpenL(pszFilename, "wb");
+    if (!fpWrite)
+        return;
+    CPL_IGNORE_RET_VAL(VSIFWriteL(abyData.data(), 1, FILESIZE, fpWrite));
+    CPL_IGNORE_RET_VAL(VSIFCloseL(fpWrite));
+
+    std::vector<GByte> abyChunk(CHUNK);
+    oBench.Run("VSI chunked reads (/vsimem, 16K chunks)", FILESIZE,
+               [pszFilename, &abyChunk]()
+               {
+                   VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+                   while (VSIFReadL(abyChunk.data(), 1, abyChunk.size(), fp) ==
+                          abyChunk.size())
+                   {
+                       // loop
+                   }
+                   CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+               });
+    VSIUnlink(pszFilename);
+}
+
+/************************************************************************/
+/*                          BenchWarpKernel()                           */
+/************************************************************************/
+
+static void BenchWarpKernel(GDALBench &oBench)
+{
+    GDALDriver *poDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poDriver)
+        return;
+    constexpr int SIZE = 2048;
+    GDALDataset *poSrcDS =
+        poDriver->Create("", SIZE, SIZE, 1, GDT_UInt16, nullptr);
+    GDALDataset *poDstDS =
+        poDriver->Create("", SIZE / 3, SIZE / 3, 1, GDT_UInt16, nullptr);
+    if (!poSrcDS || !poDstDS)
+        return;
+    double adfSrcGT[6] = {0, 1, 0, 0, 0, -1};
+    double adfDstGT[6] = {0, 3, 0, 0, 0, -3};
+    poSrcDS->SetGeoTransform(adfSrcGT);
+    poDstDS->SetGeoTransform(adfDstGT);
+    oBench.Run(
+        "Warp kernel (cubic resampling, UInt16)",
+        static_cast<uint64_t>(SIZE) * SIZE * sizeof(GUInt16),
+        [&poSrcDS, &poDstDS]()
+        {
+            CPL_IGNORE_RET_VAL(GDALReprojectImage(
+                GDALDataset::ToHandle(poSrcDS), nullptr,
+                GDALDataset::ToHandle(poDstDS), nullptr, GRA_Cubic, 0.0, 0.0,
+                nullptr, nullptr, nullptr));
+        });
+    GDALClose(poSrcDS);
+    GDALClose(poDstDS);
+}
+
+/************************************************************************/
+/*                               main()                                 */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    GDALBench oBench(argc, argv);
+    GDALAllRegister();
+
+    BenchCopyWords(oBench);
+    BenchBlockCache(oBench);
+    BenchOGRFeatureIteration(oBench);
+    BenchVSIMem(oBench);
+    BenchWarpKernel(oBench);
+
+    GDALDestroyDriverManager();
+    return oBench.Finish();
+}
@@ -0,0 +1,119 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Minimal micro-benchmark harness for perftests/
+ * Author:   agent <agent@local>
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDALBENCH_H_INCLUDED
+#define GDALBENCH_H_INCLUDED
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/* Runs each registered benchmark several times, reports min/median/max
+ * wall time and effective bytes per second, as text or as a JSON array
+ * (--json), so successive releases can be compared on a given machine. */
+
+struct GDALBenchResult
+{
+    std::string osName{};
+    int nRepetitions = 0;
+    double dfMinSec = 0;
+    double dfMedianSec = 0;
+    double dfMaxSec = 0;
+    double dfBytesPerSec = 0;
+};
+
+class GDALBench
+{
+    bool m_bJSON = false;
+    int m_nRepetitions = 7;
+    std::vector<GDALBenchResult> m_aoResults{};
+
+  public:
+    GDALBench(int argc, char *argv[])
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            if (strcmp(argv[i], "--json") == 0)
+                m_bJSON = true;
+            else if (strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc)
+                m_nRepetitions = std::max(1, atoi(argv[++i]));
+        }
+    }
+
+    /** Run fn m_nRepetitions times. nBytesPerRun is the number of bytes
+     * processed by one run, used for the bytes/s metric (0 if not
+     * meaningful). */
+    void Run(const char *pszName, uint64_t nBytesPerRun,
+             const std::function<void()> &fn)
+    {
+        std::vector<double> adfTimes;
+        for (int i = 0; i < m_nRepetitions; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            fn();
+            const auto end = std::chrono::steady_clock::now();
+            adfTimes.push_back(
+                std::chrono::duration<double>(end - start).count());
+        }
+        std::sort(adfTimes.begin(), adfTimes.end());
+        GDALBenchResult sResult;
+        sResult.osName = pszName;
+        sResult.nRepetitions = m_nRepetitions;
+        sResult.dfMinSec = adfTimes.front();
+        sResult.dfMedianSec = adfTimes[adfTimes.size() / 2];
+        sResult.dfMaxSec = adfTimes.back();
+        sResult.dfBytesPerSec =
+            sResult.dfMinSec > 0 && nBytesPerRun > 0
+                ? static_cast<double>(nBytesPerRun) / sResult.dfMinSec
+                : 0.0;
+        m_aoResults.push_back(sResult);
+
+        if (!m_bJSON)
+        {
+            printf("%-40s min %10.3f ms, median %10.3f ms, max %10.3f ms",
+                   pszName, sResult.dfMinSec * 1e3, sResult.dfMedianSec * 1e3,
+                   sResult.dfMaxSec * 1e3);
+            if (sResult.dfBytesPerSec > 0)
+                printf(", %8.1f MB/s", sResult.dfBytesPerSec / (1024 * 1024));
+            printf("\n");
+        }
+    }
+
+    int Finish() const
+    {
+        if (m_bJSON)
+        {
+            printf("[\n");
+            for (size_t i = 0; i < m_aoResults.size(); ++i)
+            {
+                const GDALBenchResult &sResult = m_aoResults[i];
+                printf("  {\"name\": \"%s\", \"repetitions\": %d, "
+                       "\"min_sec\": %.9f, \"median_sec\": %.9f, "
+                       "\"max_sec\": %.9f, \"bytes_per_sec\": %.1f}%s\n",
+                       sResult.osName.c_str(), sResult.nRepetitions,
+                       sResult.dfMinSec, sResult.dfMedianSec, sResult.dfMaxSec,
+                       sResult.dfBytesPerSec,
+                       i + 1 < m_aoResults.size() ? "," : "");
+            }
+            printf("]\n");
+        }
+        return 0;
+    }
+};
+
+#endif  // GDALBENCH_H_INCLUDED
@@ -14,6 +14,9 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_conv.h"  // CPLZLibInflate()
+#include "cpl_worker_thread_pool.h"
+
+#include <atomic>
 
 #if defined(__clang__)
 #pragma clang diagnostic push
@@ -2079,6 +2082,147 @@ CPLDestroyCompressorRegistryInternal(std::vector<CPLCompressor *> *&v)
     v = nullptr;
 }
 
+/************************************************************************/
+/*                      CPLGetBatchThreadPool()                         */
+/************************************************************************/
+
+static std::mutex goBatchPoolMutex;
+static std::unique_ptr<CPLWorkerThreadPool> goBatchPool;
+
+static CPLWorkerThreadPool *CPLGetBatchThreadPool(int nThreads)
+{
+    std::lock_guard<std::mutex> oLock(goBatchPoolMutex);
+    if (goBatchPool == nullptr)
+    {
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poPool->Setup(nThreads, nullptr, nullptr))
+            return nullptr;
+        goBatchPool = std::move(poPool);
+    }
+    else if (goBatchPool->GetThreadCount() < nThreads)
+    {
+        goBatchPool->Setup(nThreads, nullptr, nullptr);
+    }
+    return goBatchPool.get();
+}
+
+/************************************************************************/
+/*                       CPLRunBatchInternal()                          */
+/************************************************************************/
+
+static bool CPLRunBatchInternal(const CPLCompressor *compressor,
+                                size_t nChunks,
+                                const void *const *apInputData,
+                                const size_t *anInputSize, void **apOutputData,
+                                size_t *anOutputSize,
+                                CSLConstList papszOptions, int nThreads)
+{
+    if (compressor == nullptr || compressor->pfnFunc == nullptr)
+        return false;
+    if (nChunks == 0)
+        return true;
+
+    if (nThreads <= 0)
+        nThreads = CPLGetNumCPUs();
+    if (static_cast<size_t>(nThreads) > nChunks)
+        nThreads = static_cast<int>(nChunks);
+
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? CPLGetBatchThreadPool(nThreads) : nullptr;
+
+    if (poPool == nullptr)
+    {
+        bool bRet = true;
+        for (size_t i = 0; i < nChunks; ++i)
+        {
+            bRet = compressor->pfnFunc(apInputData[i], anInputSize[i],
+                                       &apOutputData[i], &anOutputSize[i],
+                                       papszOptions, compressor->user_data) &&
+                   bRet;
+        }
+        return bRet;
+    }
+
+    std::atomic<bool> bSuccess{true};
+    auto poQueue = poPool->CreateJobQueue();
+    for (size_t i = 0; i < nChunks; ++i)
+    {
+        poQueue->SubmitJob(
+            [compressor, apInputData, anInputSize, apOutputData, anOutputSize,
+             papszOptions, i, &bSuccess]()
+            {
+                if (!compressor->pfnFunc(
+                        apInputData[i], anInputSize[i], &apOutputData[i],
+                        &anOutputSize[i], papszOptions,
+                        compressor->user_data))
+                {
+                    bSuccess = false;
+                }
+            });
+    }
+    poQueue->WaitCompletion();
+    return bSuccess;
+}
+
+/************************************************************************/
+/*                         CPLCompressBatch()                           */
+/************************************************************************/
+
+/** Compress a batch of independent chunks across worker threads.
+ *
+ * Each chunk is processed with the single-shot callback of the passed
+ * compressor, following the same input/output conventions as documented
+ * for CPLCompressionFunc (in particular, if apOutputData[i] is not NULL
+ * and points to a NULL pointer, the output buffer is allocated with
+ * VSIMalloc() and must be freed by the caller with VSIFree()).
+ *
+ * The compressor callback must be thread-safe, which is the case of all
+ * built-in compressors.
+ *
+ * @param compressor Compressor, as returned by CPLGetCompressor().
+ * @param nChunks Number of chunks.
+ * @param apInputData Array of nChunks input buffers.
+ * @param anInputSize Array of nChunks input sizes, in bytes.
+ * @param apOutputData Array of nChunks output data pointers.
+ * @param anOutputSize Array of nChunks output sizes.
+ * @param papszOptions NULL terminated list of options, applied to each
+ *                     chunk. Or NULL.
+ * @param nThreads Maximum number of threads, or <= 0 for the number of CPUs.
+ * @return true if all chunks were processed successfully.
+ *
+ * @since GDAL 3.14
+ */
+bool CPLCompressBatch(const CPLCompressor *compressor, size_t nChunks,
+                      const void *const *apInputData, const size_t *anInputSize,
+                      void **apOutputData, size_t *anOutputSize,
+                      CSLConstList papszOptions, int nThreads)
+{
+    return CPLRunBatchInternal(compressor, nChunks, apInputData, anInputSize,
+                               apOutputData, anOutputSize, papszOptions,
+                               nThreads);
+}
+
+/************************************************************************/
+/*                        CPLDecompressBatch()                          */
+/************************************************************************/
+
+/** Decompress a batch of independent chunks across worker threads.
+ *
+ * See CPLCompressBatch() for the calling conventions.
+ *
+ * @since GDAL 3.14
+ */
+bool CPLDecompressBatch(const CPLCompressor *decompressor, size_t nChunks,
+                        const void *const *apInputData,
+                        const size_t *anInputSize, void **apOutputData,
+                        size_t *anOutputSize, CSLConstList papszOptions,
+                        int nThreads)
+{
+    return CPLRunBatchInternal(decompressor, nChunks, apInputData, anInputSize,
+                               apOutputData, anOutputSize, papszOptions,
+                               nThreads);
+}
+
 /*! @cond Doxygen_Suppress */
 void CPLDestroyCompressorRegistry(void)
 {
@@ -2086,6 +2230,11 @@ void CPLDestroyCompressorRegistry(void)
 
     CPLDestroyCompressorRegistryInternal(gpCompressors);
     CPLDestroyCompressorRegistryInternal(gpDecompressors);
+
+    {
+        std::lock_guard<std::mutex> oLock(goBatchPoolMutex);
+        goBatchPool.reset();
+    }
 }
 
 /*! @endcond */
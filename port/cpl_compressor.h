@@ -103,6 +103,18 @@ const CPLCompressor CPL_DLL *CPLGetCompressor(const char *pszId);
 
 const CPLCompressor CPL_DLL *CPLGetDecompressor(const char *pszId);
 
+bool CPL_DLL CPLCompressBatch(const CPLCompressor *compressor, size_t nChunks,
+                              const void *const *apInputData,
+                              const size_t *anInputSize, void **apOutputData,
+                              size_t *anOutputSize, CSLConstList papszOptions,
+                              int nThreads);
+
+bool CPL_DLL CPLDecompressBatch(const CPLCompressor *decompressor,
+                                size_t nChunks, const void *const *apInputData,
+                                const size_t *anInputSize, void **apOutputData,
+                                size_t *anOutputSize, CSLConstList papszOptions,
+                                int nThreads);
+
 /*! @cond Doxygen_Suppress */
 void CPL_DLL CPLDestroyCompressorRegistry(void);
 /*! @endcond */
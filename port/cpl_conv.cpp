@@ -731,7 +731,7 @@ const char *CPLReadLine3L(VSILFILE *fp, int nMaxCars, int *pnBufLength,
     /*      the line.                                                       */
     /* -------------------------------------------------------------------- */
     char *pszRLBuffer = nullptr;
-    const size_t nChunkSize = 40;
+    constexpr size_t nChunkSize = 1024;
     char szChunk[nChunkSize] = {};
     size_t nChunkBytesRead = 0;
     size_t nChunkBytesConsumed = 0;
@@ -791,6 +791,36 @@ const char *CPLReadLine3L(VSILFILE *fp, int nMaxCars, int *pnBufLength,
         bool bBreak = false;
         while (nChunkBytesConsumed < nChunkBytesRead - 1 && !bBreak)
         {
+            // Copy in bulk up to the next end-of-line character: memchr is
+            // much faster than a per-character loop.
+            const size_t nScanLen =
+                nChunkBytesRead - 1 - nChunkBytesConsumed;
+            const char *pszStart = szChunk + nChunkBytesConsumed;
+            const char *pszLF = static_cast<const char *>(
+                memchr(pszStart, knLF, nScanLen));
+            const char *pszCR = static_cast<const char *>(
+                memchr(pszStart, knCR, pszLF ? static_cast<size_t>(
+                                                   pszLF - pszStart)
+                                             : nScanLen));
+            const char *pszEOL = pszCR ? pszCR : pszLF;
+            const size_t nToCopy =
+                pszEOL ? static_cast<size_t>(pszEOL - pszStart) : nScanLen;
+            if (nToCopy > 0)
+            {
+                if (nMaxCars >= 0 &&
+                    *pnBufLength + static_cast<int>(nToCopy) >= nMaxCars)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Maximum number of characters allowed reached.");
+                    return nullptr;
+                }
+                memcpy(pszRLBuffer + *pnBufLength, pszStart, nToCopy);
+                *pnBufLength += static_cast<int>(nToCopy);
+                nChunkBytesConsumed += nToCopy;
+            }
+            if (pszEOL == nullptr)
+                break;
+
             if ((szChunk[nChunkBytesConsumed] == knCR &&
                  szChunk[nChunkBytesConsumed + 1] == knLF) ||
                 (szChunk[nChunkBytesConsumed] == knLF &&
@@ -799,22 +829,12 @@ const char *CPLReadLine3L(VSILFILE *fp, int nMaxCars, int *pnBufLength,
                 nChunkBytesConsumed += 2;
                 bBreak = true;
             }
-            else if (szChunk[nChunkBytesConsumed] == knLF ||
-                     szChunk[nChunkBytesConsumed] == knCR)
+            else
             {
+                // Single CR or LF
                 nChunkBytesConsumed += 1;
                 bBreak = true;
             }
-            else
-            {
-                pszRLBuffer[(*pnBufLength)++] = szChunk[nChunkBytesConsumed++];
-                if (nMaxCars >= 0 && *pnBufLength == nMaxCars)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Maximum number of characters allowed reached.");
-                    return nullptr;
-                }
-            }
         }
 
         if (bBreak)
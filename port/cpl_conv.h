@@ -389,6 +389,12 @@ CPLErr CPL_DLL CPLAddFileInZip(void *hZip, const char *pszArchiveFilename,
                                CSLConstList papszOptions,
                                GDALProgressFunc pProgressFunc,
                                void *pProgressData);
+CPLErr CPL_DLL CPLAddFilesInZip(void *hZip, int nFiles,
+                                const char *const *papszArchiveFilenames,
+                                const char *const *papszInputFilenames,
+                                CSLConstList papszOptions,
+                                GDALProgressFunc pProgressFunc,
+                                void *pProgressData);
 CPLErr CPL_DLL CPLCloseZip(void *hZip);
 
 /* -------------------------------------------------------------------- */
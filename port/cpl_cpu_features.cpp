@@ -239,4 +239,61 @@ bool CPLHaveRuntimeAVX2()
 
 #endif  // defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX2)
 
+#if defined(HAVE_AVX512_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX512)
+
+/************************************************************************/
+/*                        CPLHaveRuntimeAVX512()                        */
+/************************************************************************/
+
+#if defined(__GNUC__)
+
+bool bCPLHasAVX512 = false;
+// Use 103 because CPLHaveRuntimeAVX2Initialize() uses 102, so we are run
+// afterwards
+static void CPLHaveRuntimeAVX512Initialize() __attribute__((constructor(103)));
+
+static void CPLHaveRuntimeAVX512Initialize()
+{
+    // __builtin_cpu_supports() takes care of checking OS support for the
+    // ZMM and opmask register state.
+    bCPLHasAVX512 = CPLHaveRuntimeAVX() && __builtin_cpu_supports("avx512f") &&
+                    __builtin_cpu_supports("avx512bw") &&
+                    __builtin_cpu_supports("avx512vl");
+}
+
+#else
+
+bool CPLHaveRuntimeAVX512()
+{
+    static const bool bHasAVX512 = []() -> bool
+    {
+#if defined(_MSC_VER)
+        if (!CPLHaveRuntimeAVX())
+            return false;
+
+        // Check OS support for the ZMM and opmask register state
+        // (XCR0 bits 5, 6 and 7).
+        const unsigned __int64 xcrFeatureMask =
+            _xgetbv(_XCR_XFEATURE_ENABLED_MASK);
+        constexpr unsigned __int64 BITS_ZMM_STATE = (1 << 5) | (1 << 6) | (1 << 7);
+        if ((xcrFeatureMask & BITS_ZMM_STATE) != BITS_ZMM_STATE)
+            return false;
+
+        int cpuInfo[4] = {};
+        __cpuidex(cpuInfo, 7, 0);
+        const unsigned nEBX = static_cast<unsigned>(cpuInfo[REG_EBX]);
+        return (nEBX & (1U << 16)) != 0 &&  // AVX512F
+               (nEBX & (1U << 30)) != 0 &&  // AVX512BW
+               (nEBX & (1U << 31)) != 0;    // AVX512VL
+#else
+        return false;
+#endif
+    }();
+    return bHasAVX512;
+}
+
+#endif
+
+#endif  // defined(HAVE_AVX512_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX512)
+
 //! @endcond
@@ -103,6 +103,29 @@ bool CPLHaveRuntimeAVX2();
 
 #endif
 
+// "AVX512" is understood in this API as the AVX-512 F + BW + VL subset,
+// available on all AVX-512 capable CPUs but first-generation Xeon Phi.
+#ifdef HAVE_AVX512_AT_COMPILE_TIME
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+#define HAVE_INLINE_AVX512
+
+static bool inline CPLHaveRuntimeAVX512()
+{
+    return true;
+}
+#elif defined(__GNUC__)
+extern bool bCPLHasAVX512;
+
+static bool inline CPLHaveRuntimeAVX512()
+{
+    return bCPLHasAVX512;
+}
+#else
+bool CPLHaveRuntimeAVX512();
+#endif
+
+#endif
+
 //! @endcond
 
 #endif  // CPL_CPU_FEATURES_H
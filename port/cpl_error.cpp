@@ -57,6 +57,46 @@ typedef struct errHandler
     bool bCatchDebug;
 } CPLErrorHandlerNode;
 
+/************************************************************************/
+/*                      Error handler node pool                         */
+/*                                                                      */
+/*      Preallocated per-thread pool of handler stack nodes, so that    */
+/*      the very common push/pop pattern of quiet-error probing (e.g.   */
+/*      speculative Open() or VSIStatL() attempts) does not hit the     */
+/*      allocator. The stack is strictly LIFO (nodes are only freed     */
+/*      from CPLPopErrorHandler() on the stack head), so the pool can   */
+/*      be managed as a stack too; deeper nestings fall back to heap    */
+/*      allocation.                                                     */
+/************************************************************************/
+
+constexpr int ERROR_HANDLER_NODE_POOL_SIZE = 8;
+static thread_local CPLErrorHandlerNode
+    gasErrorHandlerNodePool[ERROR_HANDLER_NODE_POOL_SIZE];
+static thread_local int gnErrorHandlerNodePoolUsed = 0;
+
+static CPLErrorHandlerNode *CPLAllocErrorHandlerNode()
+{
+    if (gnErrorHandlerNodePoolUsed < ERROR_HANDLER_NODE_POOL_SIZE)
+        return &gasErrorHandlerNodePool[gnErrorHandlerNodePoolUsed++];
+    return static_cast<CPLErrorHandlerNode *>(
+        CPLMalloc(sizeof(CPLErrorHandlerNode)));
+}
+
+static void CPLFreeErrorHandlerNode(CPLErrorHandlerNode *psNode)
+{
+    if (psNode >= gasErrorHandlerNodePool &&
+        psNode < gasErrorHandlerNodePool + ERROR_HANDLER_NODE_POOL_SIZE)
+    {
+        CPLAssert(psNode ==
+                  &gasErrorHandlerNodePool[gnErrorHandlerNodePoolUsed - 1]);
+        --gnErrorHandlerNodePoolUsed;
+    }
+    else
+    {
+        VSIFree(psNode);
+    }
+}
+
 typedef struct
 {
     CPLErrorNum nLastErrNo;
@@ -1373,8 +1413,7 @@ void CPL_STDCALL CPLPushErrorHandlerEx(CPLErrorHandler pfnErrorHandlerNew,
         return;
     }
 
-    CPLErrorHandlerNode *psNode = static_cast<CPLErrorHandlerNode *>(
-        CPLMalloc(sizeof(CPLErrorHandlerNode)));
+    CPLErrorHandlerNode *psNode = CPLAllocErrorHandlerNode();
     psNode->psNext = psCtx->psHandlerStack;
     psNode->pfnHandler = pfnErrorHandlerNew;
     psNode->pUserData = pUserData;
@@ -1411,7 +1450,7 @@ void CPL_STDCALL CPLPopErrorHandler()
         CPLErrorHandlerNode *psNode = psCtx->psHandlerStack;
 
         psCtx->psHandlerStack = psNode->psNext;
-        VSIFree(psNode);
+        CPLFreeErrorHandlerNode(psNode);
     }
 }
 
@@ -219,6 +219,120 @@ GUInt32 CPLTripleToFloat(GUInt32 iTriple)
 
 /************************************************************************/
 /*                            FloatToHalf()                             */
+/************************************************************************/
+/*                  Array-granularity half conversions                  */
+/************************************************************************/
+
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER) &&                         \
+    (defined(__x86_64) || defined(__i386__))
+
+#define CPL_HAS_F16C_RUNTIME
+#include <immintrin.h>
+
+static bool CPLHasF16C()
+{
+    static const bool bHasF16C = __builtin_cpu_supports("f16c") &&
+                                 __builtin_cpu_supports("avx");
+    return bHasF16C;
+}
+
+__attribute__((target("f16c,avx"))) static void
+CPLHalfToFloatArrayF16C(const GUInt16 *panSrc, float *pafDst, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        const __m128i xmm =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(panSrc + i));
+        _mm256_storeu_ps(pafDst + i, _mm256_cvtph_ps(xmm));
+    }
+    for (; i < nCount; ++i)
+    {
+        const GUInt32 nFloat32 = CPLHalfToFloat(panSrc[i]);
+        memcpy(&pafDst[i], &nFloat32, sizeof(float));
+    }
+}
+
+__attribute__((target("f16c,avx"))) static void
+CPLFloatToHalfArrayF16C(const float *pafSrc, GUInt16 *panDst, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        const __m256 ymm = _mm256_loadu_ps(pafSrc + i);
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i *>(panDst + i),
+            _mm256_cvtps_ph(ymm, _MM_FROUND_TO_NEAREST_INT |
+                                     _MM_FROUND_NO_EXC));
+    }
+    bool bHasWarned = true;  // overflow clamping, as hardware does
+    for (; i < nCount; ++i)
+    {
+        GUInt32 nFloat32;
+        memcpy(&nFloat32, &pafSrc[i], sizeof(float));
+        panDst[i] = CPLFloatToHalf(nFloat32, bHasWarned);
+    }
+}
+
+#endif  // F16C runtime support
+
+/************************************************************************/
+/*                        CPLHalfToFloatArray()                         */
+/************************************************************************/
+
+/** Convert an array of IEEE 754 half-precision values (given as their bit
+ * pattern) to single precision.
+ *
+ * Uses F16C hardware conversion when available at run time.
+ *
+ * @since GDAL 3.14
+ */
+void CPLHalfToFloatArray(const GUInt16 *panSrc, float *pafDst, size_t nCount)
+{
+#ifdef CPL_HAS_F16C_RUNTIME
+    if (CPLHasF16C())
+    {
+        CPLHalfToFloatArrayF16C(panSrc, pafDst, nCount);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        const GUInt32 nFloat32 = CPLHalfToFloat(panSrc[i]);
+        memcpy(&pafDst[i], &nFloat32, sizeof(float));
+    }
+}
+
+/************************************************************************/
+/*                        CPLFloatToHalfArray()                         */
+/************************************************************************/
+
+/** Convert an array of single-precision values to IEEE 754 half precision
+ * (returned as their bit pattern), with overflows clamped to +/- infinity
+ * without warning, as the hardware instruction does.
+ *
+ * Uses F16C hardware conversion when available at run time.
+ *
+ * @since GDAL 3.14
+ */
+void CPLFloatToHalfArray(const float *pafSrc, GUInt16 *panDst, size_t nCount)
+{
+#ifdef CPL_HAS_F16C_RUNTIME
+    if (CPLHasF16C())
+    {
+        CPLFloatToHalfArrayF16C(pafSrc, panDst, nCount);
+        return;
+    }
+#endif
+    bool bHasWarned = true;
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        GUInt32 nFloat32;
+        memcpy(&nFloat32, &pafSrc[i], sizeof(float));
+        panDst[i] = CPLFloatToHalf(nFloat32, bHasWarned);
+    }
+}
+
 /************************************************************************/
 
 GUInt16 CPLFloatToHalf(GUInt32 iFloat32, bool &bHasWarned)
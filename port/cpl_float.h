@@ -69,6 +69,11 @@ CPL_C_END
 
 GUInt16 CPL_DLL CPLFloatToHalf(GUInt32 iFloat32, bool &bHasWarned);
 
+void CPL_DLL CPLHalfToFloatArray(const GUInt16 *panSrc, float *pafDst,
+                                 size_t nCount);
+void CPL_DLL CPLFloatToHalfArray(const float *pafSrc, GUInt16 *panDst,
+                                 size_t nCount);
+
 GUInt16 CPL_DLL CPLConvertFloatToHalf(float fFloat32);
 float CPL_DLL CPLConvertHalfToFloat(GUInt16 nHalf);
 
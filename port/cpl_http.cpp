@@ -13,6 +13,7 @@
 
 #include "cpl_port.h"
 #include "cpl_http.h"
+#include "cpl_worker_thread_pool.h"
 
 #include <cstddef>
 #include <cstring>
@@ -20,6 +21,9 @@
 #include <algorithm>
 #include <array>
 #include <map>
+#include <condition_variable>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -1756,6 +1760,123 @@ class CPLHTTPErrorBuffer
 
 #endif  // HAVE_CURL
 
+/************************************************************************/
+/*                       CPLHTTPDownloadManager                         */
+/************************************************************************/
+
+struct _CPLHTTPDownloadManager
+{
+    std::unique_ptr<CPLWorkerThreadPool> poPool{};
+    int nMaxPerHost = 0;
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+    std::map<std::string, int> oMapHostToCount{};
+};
+
+static std::string CPLHTTPGetHostFromURL(const char *pszURL)
+{
+    const char *pszHostStart = strstr(pszURL, "://");
+    pszHostStart = pszHostStart ? pszHostStart + strlen("://") : pszURL;
+    const char *pszHostEnd = strchr(pszHostStart, '/');
+    return pszHostEnd ? std::string(pszHostStart, pszHostEnd - pszHostStart)
+                      : std::string(pszHostStart);
+}
+
+/** Create a download manager: a worker pool of nMaxConcurrency threads
+ * servicing queued downloads, with at most nMaxPerHost simultaneous
+ * requests to a given host (0 or negative for no per-host limit).
+ *
+ * Retries and backoff are handled per request by CPLHTTPFetch() through
+ * the usual MAX_RETRY/RETRY_DELAY options.
+ *
+ * @return a manager to destroy with CPLHTTPDownloadManagerDestroy(), or
+ * NULL in case of error.
+ * @since GDAL 3.14
+ */
+CPLHTTPDownloadManager *CPLHTTPDownloadManagerCreate(int nMaxConcurrency,
+                                                     int nMaxPerHost)
+{
+    if (nMaxConcurrency <= 0)
+        nMaxConcurrency = 4;
+    auto psManager = std::make_unique<_CPLHTTPDownloadManager>();
+    psManager->nMaxPerHost = nMaxPerHost;
+    psManager->poPool = std::make_unique<CPLWorkerThreadPool>();
+    if (!psManager->poPool->Setup(nMaxConcurrency, nullptr, nullptr))
+        return nullptr;
+    return psManager.release();
+}
+
+/** Wait for the completion of all queued downloads, and destroy the
+ * manager.
+ * @since GDAL 3.14
+ */
+void CPLHTTPDownloadManagerDestroy(CPLHTTPDownloadManager *psManager)
+{
+    if (psManager)
+    {
+        psManager->poPool->WaitCompletion();
+        delete psManager;
+    }
+}
+
+/** Queue the download of pszURL. pfnCompleted is invoked, from a worker
+ * thread, with the result of the fetch (whose ownership it takes).
+ *
+ * @return TRUE if the download was queued.
+ * @since GDAL 3.14
+ */
+int CPLHTTPDownloadManagerQueue(CPLHTTPDownloadManager *psManager,
+                                const char *pszURL, CSLConstList papszOptions,
+                                CPLHTTPDownloadCompletedFunc pfnCompleted,
+                                void *pUserData)
+{
+    if (!psManager || !pszURL || !pfnCompleted)
+        return FALSE;
+
+    std::string osURL(pszURL);
+    CPLStringList aosOptions(papszOptions);
+    return psManager->poPool->SubmitJob(
+        [psManager, osURL = std::move(osURL), aosOptions = std::move(aosOptions),
+         pfnCompleted, pUserData]()
+        {
+            std::string osHost;
+            if (psManager->nMaxPerHost > 0)
+            {
+                osHost = CPLHTTPGetHostFromURL(osURL.c_str());
+                std::unique_lock<std::mutex> oLock(psManager->oMutex);
+                psManager->oCV.wait(
+                    oLock, [psManager, &osHost]() {
+                        return psManager->oMapHostToCount[osHost] <
+                               psManager->nMaxPerHost;
+                    });
+                ++psManager->oMapHostToCount[osHost];
+            }
+
+            CPLHTTPResult *psResult =
+                CPLHTTPFetch(osURL.c_str(), aosOptions.List());
+
+            if (psManager->nMaxPerHost > 0)
+            {
+                std::lock_guard<std::mutex> oLock(psManager->oMutex);
+                --psManager->oMapHostToCount[osHost];
+                psManager->oCV.notify_all();
+            }
+
+            pfnCompleted(osURL.c_str(), psResult, pUserData);
+        })
+               ? TRUE
+               : FALSE;
+}
+
+/** Wait for the completion of all the downloads queued so far.
+ * @since GDAL 3.14
+ */
+void CPLHTTPDownloadManagerWaitCompletion(CPLHTTPDownloadManager *psManager)
+{
+    if (psManager)
+        psManager->poPool->WaitCompletion();
+}
+
 /************************************************************************/
 /*                         CPLHTTPMultiFetch()                          */
 /************************************************************************/
@@ -2111,6 +2232,66 @@ static int CPLHTTPCurlDebugFunction(CURL *handle, curl_infotype type,
     return 0;
 }
 
+/************************************************************************/
+/*                        CPLHTTPGetCurlShare()                         */
+/*                                                                      */
+/*      Process-wide curl share handle, so that DNS resolutions and     */
+/*      TLS session tickets are reused across all the curl handles of   */
+/*      all threads (CPLHTTPFetch() per-thread sessions as well as the  */
+/*      /vsicurl ones), cutting per-request handshake latency on        */
+/*      high-QPS metadata fetching.                                     */
+/************************************************************************/
+
+static std::mutex goCurlShareMutexes[CURL_LOCK_DATA_LAST];
+static CURLSH *ghCurlShare = nullptr;
+static std::mutex goCurlShareCreationMutex;
+
+static void CPLHTTPCurlShareLock(CURL * /*handle*/, curl_lock_data data,
+                                 curl_lock_access /*access*/,
+                                 void * /*userptr*/)
+{
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST)
+        goCurlShareMutexes[data].lock();
+}
+
+static void CPLHTTPCurlShareUnlock(CURL * /*handle*/, curl_lock_data data,
+                                   void * /*userptr*/)
+{
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST)
+        goCurlShareMutexes[data].unlock();
+}
+
+static CURLSH *CPLHTTPGetCurlShare()
+{
+    std::lock_guard<std::mutex> oLock(goCurlShareCreationMutex);
+    if (ghCurlShare == nullptr)
+    {
+        ghCurlShare = curl_share_init();
+        if (ghCurlShare)
+        {
+            curl_share_setopt(ghCurlShare, CURLSHOPT_LOCKFUNC,
+                              CPLHTTPCurlShareLock);
+            curl_share_setopt(ghCurlShare, CURLSHOPT_UNLOCKFUNC,
+                              CPLHTTPCurlShareUnlock);
+            curl_share_setopt(ghCurlShare, CURLSHOPT_SHARE,
+                              CURL_LOCK_DATA_DNS);
+            curl_share_setopt(ghCurlShare, CURLSHOPT_SHARE,
+                              CURL_LOCK_DATA_SSL_SESSION);
+#if CURL_AT_LEAST_VERSION(7, 57, 0)
+            // Sharing the connection cache across threads is more
+            // intrusive: keep it opt-in.
+            if (CPLTestBool(
+                    CPLGetConfigOption("GDAL_HTTP_SHARE_CONNECT", "NO")))
+            {
+                curl_share_setopt(ghCurlShare, CURLSHOPT_SHARE,
+                                  CURL_LOCK_DATA_CONNECT);
+            }
+#endif
+        }
+    }
+    return ghCurlShare;
+}
+
 /************************************************************************/
 /*                         CPLHTTPSetOptions()                          */
 /************************************************************************/
@@ -2131,6 +2312,12 @@ void *CPLHTTPSetOptions(void *pcurl, const char *pszURL,
 
     unchecked_curl_easy_setopt(http_handle, CURLOPT_URL, pszURL);
 
+    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_CURL_SHARE", "YES")))
+    {
+        if (CURLSH *hShare = CPLHTTPGetCurlShare())
+            unchecked_curl_easy_setopt(http_handle, CURLOPT_SHARE, hShare);
+    }
+
     if (CPLTestBool(CPLGetConfigOption("CPL_CURL_VERBOSE", "NO")))
     {
         unchecked_curl_easy_setopt(http_handle, CURLOPT_VERBOSE, 1);
@@ -2844,6 +3031,15 @@ void CPLHTTPCleanup()
     CPLDestroyMutex(hSessionMapMutex);
     hSessionMapMutex = nullptr;
 
+    {
+        std::lock_guard<std::mutex> oLock(goCurlShareCreationMutex);
+        if (ghCurlShare)
+        {
+            curl_share_cleanup(ghCurlShare);
+            ghCurlShare = nullptr;
+        }
+    }
+
 #if defined(_WIN32) && defined(HAVE_OPENSSL_CRYPTO)
     // This cleanup must be absolutely done before CPLOpenSSLCleanup()
     // for some unknown reason, but otherwise X509_free() in
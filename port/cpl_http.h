@@ -100,6 +100,27 @@ int CPL_DLL CPLHTTPParseMultipartMime(CPLHTTPResult *psResult);
 
 void CPL_DLL CPLHTTPSetDefaultUserAgent(const char *pszUserAgent);
 
+/*! Opaque type for a download manager (see CPLHTTPDownloadManagerCreate()) */
+typedef struct _CPLHTTPDownloadManager CPLHTTPDownloadManager;
+
+/** Callback invoked (from a worker thread) at completion of a download
+ * queued with CPLHTTPDownloadManagerQueue(). Ownership of psResult is
+ * transferred to the callback, which must release it with
+ * CPLHTTPDestroyResult(). */
+typedef void (*CPLHTTPDownloadCompletedFunc)(const char *pszURL,
+                                             CPLHTTPResult *psResult,
+                                             void *pUserData);
+
+CPLHTTPDownloadManager CPL_DLL *
+CPLHTTPDownloadManagerCreate(int nMaxConcurrency, int nMaxPerHost);
+void CPL_DLL CPLHTTPDownloadManagerDestroy(CPLHTTPDownloadManager *psManager);
+int CPL_DLL CPLHTTPDownloadManagerQueue(
+    CPLHTTPDownloadManager *psManager, const char *pszURL,
+    CSLConstList papszOptions, CPLHTTPDownloadCompletedFunc pfnCompleted,
+    void *pUserData);
+void CPL_DLL
+CPLHTTPDownloadManagerWaitCompletion(CPLHTTPDownloadManager *psManager);
+
 /* -------------------------------------------------------------------- */
 /* To install an alternate network layer to the default Curl one        */
 /* -------------------------------------------------------------------- */
@@ -216,6 +216,110 @@ bool CPLJSONDocument::Load(const std::string &osPath)
     return bResult;
 }
 
+/************************************************************************/
+/*                    Optional simdjson parse backend                   */
+/************************************************************************/
+
+#ifdef HAVE_SIMDJSON
+
+#include <simdjson.h>
+
+/* Convert a simdjson DOM element into a json-c object (with ownership
+ * transferred to the caller). */
+static json_object *CPLBuildJsonCFromSimdJson(
+    const simdjson::dom::element &oElt)
+{
+    switch (oElt.type())
+    {
+        case simdjson::dom::element_type::ARRAY:
+        {
+            json_object *poArray = json_object_new_array();
+            for (const simdjson::dom::element &oChild :
+                 simdjson::dom::array(oElt))
+            {
+                json_object_array_add(poArray,
+                                      CPLBuildJsonCFromSimdJson(oChild));
+            }
+            return poArray;
+        }
+        case simdjson::dom::element_type::OBJECT:
+        {
+            json_object *poObject = json_object_new_object();
+            for (const simdjson::dom::key_value_pair &oChild :
+                 simdjson::dom::object(oElt))
+            {
+                json_object_object_add_ex(
+                    poObject, std::string(oChild.key).c_str(),
+                    CPLBuildJsonCFromSimdJson(oChild.value), 0);
+            }
+            return poObject;
+        }
+        case simdjson::dom::element_type::INT64:
+            return json_object_new_int64(oElt.get_int64().value());
+        case simdjson::dom::element_type::UINT64:
+            return json_object_new_uint64(oElt.get_uint64().value());
+        case simdjson::dom::element_type::DOUBLE:
+            return json_object_new_double(oElt.get_double().value());
+        case simdjson::dom::element_type::STRING:
+        {
+            const std::string_view sView = oElt.get_string().value();
+            return json_object_new_string_len(
+                sView.data(), static_cast<int>(sView.size()));
+        }
+        case simdjson::dom::element_type::BOOL:
+            return json_object_new_boolean(oElt.get_bool().value());
+        case simdjson::dom::element_type::NULL_VALUE:
+            break;
+    }
+    return nullptr;
+}
+
+/* Attempt to parse with simdjson. Returns true if parsing was attempted
+ * (successfully or not); false if the caller should fall back to json-c. */
+static bool CPLParseWithSimdJson(const GByte *pabyData, int nLength,
+                                 json_object *&poRootOut, bool &bParsedOut)
+{
+    const char *pszBackend = CPLGetConfigOption("CPL_JSON_PARSER", "AUTO");
+    if (EQUAL(pszBackend, "JSON-C"))
+        return false;
+
+    try
+    {
+        simdjson::dom::parser oParser;
+        simdjson::dom::element oRoot;
+        const auto nErr =
+            oParser
+                .parse(simdjson::padded_string(
+                    reinterpret_cast<const char *>(pabyData),
+                    static_cast<size_t>(nLength)))
+                .get(oRoot);
+        if (nErr != simdjson::SUCCESS)
+        {
+            if (EQUAL(pszBackend, "SIMDJSON"))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "JSON parsing error: %s",
+                         simdjson::error_message(nErr));
+                poRootOut = nullptr;
+                bParsedOut = false;
+                return true;
+            }
+            // In AUTO mode, defer to json-c, in particular for its more
+            // detailed error reporting.
+            return false;
+        }
+        poRootOut = CPLBuildJsonCFromSimdJson(oRoot);
+        bParsedOut = true;
+        return true;
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+}
+
+#endif  // HAVE_SIMDJSON
+
 /**
  * Load json document from memory buffer.
  * @param  pabyData Buffer.data.
@@ -248,6 +352,18 @@ bool CPLJSONDocument::LoadMemory(const GByte *pabyData, int nLength)
         return true;
     }
 
+#ifdef HAVE_SIMDJSON
+    {
+        json_object *poRoot = nullptr;
+        bool bParsedSimd = false;
+        if (CPLParseWithSimdJson(pabyData, nLength, poRoot, bParsedSimd))
+        {
+            m_poRootJsonObject = poRoot;
+            return bParsedSimd;
+        }
+    }
+#endif
+
     json_tokener *jstok = json_tokener_new();
     m_poRootJsonObject = json_tokener_parse_ex(
         jstok, reinterpret_cast<const char *>(pabyData), nLength);
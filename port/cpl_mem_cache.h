@@ -33,8 +33,11 @@
 
 #pragma once
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <unordered_map>
@@ -347,6 +350,136 @@ class Cache final
     size_t elasticity_;
 };
 
+/**
+ * Thread-safe sharded LRU cache.
+ *
+ * The key space is split across NUM_SHARDS independent Cache segments, each
+ * protected by its own lock (the shard of a key is derived from its hash),
+ * so that concurrent accesses to different shards do not serialize on a
+ * single mutex. Eviction is striped: each shard prunes itself independently,
+ * so the eviction order is only approximately least-recently-used across
+ * the whole cache (it remains strictly LRU within a shard).
+ */
+template <class Key, class Value, class Lock = std::mutex,
+          class Map = std::unordered_map<
+              Key, typename std::list<KeyValuePair<Key, Value>>::iterator>,
+          class KeyHasher = std::hash<Key>, size_t NUM_SHARDS = 16>
+class ShardedCache final
+{
+  public:
+    /** Type of an individual shard */
+    typedef Cache<Key, Value, Lock, Map> shard_type;
+
+    /** maxSize and elasticity have the same meaning as for Cache, for the
+     * whole set of shards: each shard gets an equal part of them. */
+    explicit ShardedCache(size_t maxSize = 64, size_t elasticity = 10)
+    {
+        static_assert(NUM_SHARDS > 0, "NUM_SHARDS must be strictly positive");
+        for (auto &shard : shards_)
+        {
+            shard.reset(new shard_type(
+                maxSize == 0 ? 0 : std::max<size_t>(1, maxSize / NUM_SHARDS),
+                std::max<size_t>(1, elasticity / NUM_SHARDS)));
+        }
+    }
+
+    ~ShardedCache() = default;
+
+    size_t size() const
+    {
+        size_t ret = 0;
+        for (const auto &shard : shards_)
+            ret += shard->size();
+        return ret;
+    }
+
+    bool empty() const
+    {
+        for (const auto &shard : shards_)
+        {
+            if (!shard->empty())
+                return false;
+        }
+        return true;
+    }
+
+    void clear()
+    {
+        for (auto &shard : shards_)
+            shard->clear();
+    }
+
+    void insert(const Key &k, const Value &v)
+    {
+        getShard(k).insert(k, v);
+    }
+
+    void insert(const Key &k, Value &&v)
+    {
+        getShard(k).insert(k, std::move(v));
+    }
+
+    bool tryGet(const Key &k, Value &vOut)
+    {
+        return getShard(k).tryGet(k, vOut);
+    }
+
+    bool remove(const Key &k)
+    {
+        return getShard(k).remove(k);
+    }
+
+    bool contains(const Key &k)
+    {
+        return getShard(k).contains(k);
+    }
+
+    /** Remove the oldest entry of one of the shards, starting from the
+     * shard after the one the previous call used. */
+    bool removeAndRecycleOldestEntry(Value &vOut)
+    {
+        const size_t nFirstShard =
+            nextRecycleShard_.fetch_add(1, std::memory_order_relaxed);
+        for (size_t i = 0; i < NUM_SHARDS; ++i)
+        {
+            const size_t iShard = (nFirstShard + i) % NUM_SHARDS;
+            if (shards_[iShard]->removeAndRecycleOldestEntry(vOut))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Walk the entries, shard after shard. Each shard is locked during
+     * its own traversal only. */
+    template <typename F> void cwalk(F &f)
+    {
+        for (auto &shard : shards_)
+            shard->cwalk(f);
+    }
+
+    /** Const variant of cwalk() */
+    template <typename F> void cwalk(F &f) const
+    {
+        for (const auto &shard : shards_)
+            shard->cwalk(f);
+    }
+
+  private:
+    shard_type &getShard(const Key &k)
+    {
+        return *shards_[KeyHasher()(k) % NUM_SHARDS];
+    }
+
+    // Disallow copying.
+    ShardedCache(const ShardedCache &) = delete;
+    ShardedCache &operator=(const ShardedCache &) = delete;
+
+    std::array<std::unique_ptr<shard_type>, NUM_SHARDS> shards_{};
+    std::atomic<size_t> nextRecycleShard_{0};
+};
+
 }  // namespace lru11
 
 /*! @endcond */
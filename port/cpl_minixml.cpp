@@ -79,6 +79,50 @@ typedef struct
 static CPLXMLNode *_CPLCreateXMLNode(CPLXMLNode *poParent, CPLXMLNodeType eType,
                                      const char *pszText);
 
+/************************************************************************/
+/*                            CPLXMLArena                               */
+/*                                                                      */
+/*      Growable pool from which all the nodes and strings of a parse   */
+/*      can be allocated, and freed at once, to avoid the per-node      */
+/*      malloc/free cost of huge documents.                             */
+/************************************************************************/
+
+struct _CPLXMLArena
+{
+    std::vector<std::unique_ptr<GByte[]>> aBlocks{};
+    size_t nCurBlockSize = 0;
+    size_t nCurBlockUsed = 0;
+
+    void *Alloc(size_t nSize)
+    {
+        // Keep the natural alignment of CPLXMLNode
+        constexpr size_t ALIGNMENT = alignof(void *);
+        nSize = (nSize + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        if (aBlocks.empty() || nCurBlockUsed + nSize > nCurBlockSize)
+        {
+            constexpr size_t MIN_BLOCK_SIZE = 256 * 1024;
+            const size_t nBlockSize = std::max(nSize, MIN_BLOCK_SIZE);
+            try
+            {
+                aBlocks.emplace_back(new GByte[nBlockSize]);
+            }
+            catch (const std::exception &)
+            {
+                return nullptr;
+            }
+            nCurBlockSize = nBlockSize;
+            nCurBlockUsed = 0;
+        }
+        void *pRet = aBlocks.back().get() + nCurBlockUsed;
+        nCurBlockUsed += nSize;
+        return pRet;
+    }
+};
+
+// Arena the current thread parses into, if any (see
+// CPLParseXMLStringInArena())
+static thread_local CPLXMLArena *pstActiveXMLArena = nullptr;
+
 /************************************************************************/
 /*                              ReadChar()                              */
 /************************************************************************/
@@ -1270,6 +1314,70 @@ char *CPLSerializeXMLTree(const CPLXMLNode *psNode)
     return pszText;
 }
 
+/************************************************************************/
+/*                         CPLCreateXMLArena()                          */
+/************************************************************************/
+
+/** Create a memory arena for CPLParseXMLStringInArena().
+ *
+ * @since GDAL 3.14
+ */
+CPLXMLArena *CPLCreateXMLArena(void)
+{
+    return new _CPLXMLArena();
+}
+
+/************************************************************************/
+/*                        CPLDestroyXMLArena()                          */
+/************************************************************************/
+
+/** Destroy a memory arena, and with it all the nodes of the trees parsed
+ * into it.
+ *
+ * @since GDAL 3.14
+ */
+void CPLDestroyXMLArena(CPLXMLArena *psArena)
+{
+    delete psArena;
+}
+
+/************************************************************************/
+/*                     CPLParseXMLStringInArena()                       */
+/************************************************************************/
+
+/** Same as CPLParseXMLString(), except that all the nodes and strings of
+ * the resulting tree are allocated from the passed arena, with a single
+ * underlying allocation per large block.
+ *
+ * This avoids the one-malloc-per-node cost on huge documents (e.g. VRT
+ * files with hundreds of thousands of sources). In return, the resulting
+ * tree:
+ * <ul>
+ * <li>must NOT be passed to CPLDestroyXMLNode(): it is entirely freed by
+ * CPLDestroyXMLArena(), and must not be used after that;</li>
+ * <li>must be treated as read-only: functions that modify or take
+ * ownership of nodes (CPLSetXMLValue(), CPLAddXMLChild() with regularly
+ * allocated nodes, etc.) must not be used on it.</li>
+ * </ul>
+ *
+ * @param pszString the document to parse.
+ * @param psArena arena created with CPLCreateXMLArena().
+ * @return parsed tree, or NULL in case of error.
+ *
+ * @since GDAL 3.14
+ */
+CPLXMLNode *CPLParseXMLStringInArena(const char *pszString,
+                                     CPLXMLArena *psArena)
+{
+    if (psArena == nullptr)
+        return CPLParseXMLString(pszString);
+    CPLAssert(pstActiveXMLArena == nullptr);
+    pstActiveXMLArena = psArena;
+    CPLXMLNode *psRet = CPLParseXMLString(pszString);
+    pstActiveXMLArena = nullptr;
+    return psRet;
+}
+
 /************************************************************************/
 /*                          CPLCreateXMLNode()                          */
 /************************************************************************/
@@ -1319,22 +1427,50 @@ static CPLXMLNode *_CPLCreateXMLNode(CPLXMLNode *poParent, CPLXMLNodeType eType,
     /* -------------------------------------------------------------------- */
     /*      Create new node.                                                */
     /* -------------------------------------------------------------------- */
-    CPLXMLNode *psNode =
-        static_cast<CPLXMLNode *>(VSICalloc(sizeof(CPLXMLNode), 1));
-    if (psNode == nullptr)
+    CPLXMLNode *psNode;
+    if (pstActiveXMLArena != nullptr)
     {
-        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate CPLXMLNode");
-        return nullptr;
+        psNode = static_cast<CPLXMLNode *>(
+            pstActiveXMLArena->Alloc(sizeof(CPLXMLNode)));
+        if (psNode == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate CPLXMLNode");
+            return nullptr;
+        }
+        memset(psNode, 0, sizeof(CPLXMLNode));
+        psNode->eType = eType;
+        const size_t nValueSize = strlen(pszText ? pszText : "") + 1;
+        char *pszValue =
+            static_cast<char *>(pstActiveXMLArena->Alloc(nValueSize));
+        if (pszValue == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate psNode->pszValue");
+            return nullptr;
+        }
+        memcpy(pszValue, pszText ? pszText : "", nValueSize);
+        psNode->pszValue = pszValue;
     }
-
-    psNode->eType = eType;
-    psNode->pszValue = VSIStrdup(pszText ? pszText : "");
-    if (psNode->pszValue == nullptr)
+    else
     {
-        CPLError(CE_Failure, CPLE_OutOfMemory,
-                 "Cannot allocate psNode->pszValue");
-        VSIFree(psNode);
-        return nullptr;
+        psNode = static_cast<CPLXMLNode *>(VSICalloc(sizeof(CPLXMLNode), 1));
+        if (psNode == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate CPLXMLNode");
+            return nullptr;
+        }
+
+        psNode->eType = eType;
+        psNode->pszValue = VSIStrdup(pszText ? pszText : "");
+        if (psNode->pszValue == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate psNode->pszValue");
+            VSIFree(psNode);
+            return nullptr;
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -1401,6 +1537,12 @@ static CPLXMLNode *_CPLCreateXMLNode(CPLXMLNode *poParent, CPLXMLNodeType eType,
 void CPLDestroyXMLNode(CPLXMLNode *psNode)
 
 {
+    // Nodes parsed into an arena are owned by it: this also covers the
+    // error-cleanup path of CPLParseXMLString() when called from
+    // CPLParseXMLStringInArena().
+    if (pstActiveXMLArena != nullptr)
+        return;
+
     while (psNode != nullptr)
     {
         if (psNode->pszValue != nullptr)
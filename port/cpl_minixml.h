@@ -106,6 +106,13 @@ struct CPLXMLNode
 };
 
 CPLXMLNode CPL_DLL *CPLParseXMLString(const char *);
+
+/*! Opaque type for a memory arena usable by CPLParseXMLStringInArena() */
+typedef struct _CPLXMLArena CPLXMLArena;
+CPLXMLArena CPL_DLL *CPLCreateXMLArena(void);
+void CPL_DLL CPLDestroyXMLArena(CPLXMLArena *psArena);
+CPLXMLNode CPL_DLL *CPLParseXMLStringInArena(const char *pszString,
+                                             CPLXMLArena *psArena);
 void CPL_DLL CPLDestroyXMLNode(CPLXMLNode *);
 CPLXMLNode CPL_DLL *CPLGetXMLNode(CPLXMLNode *poRoot, const char *pszPath);
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
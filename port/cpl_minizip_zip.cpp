@@ -65,6 +65,9 @@
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
+
+#include <vector>
 
 #ifdef NO_ERRNO_H
 extern int errno;
@@ -2245,14 +2248,19 @@ CPLErr CPLCreateFileInZip(void *hZip, const char *pszFilename,
     fileinfo.tmz_date.tm_min = brokenDown.tm_min;
     fileinfo.tmz_date.tm_sec = brokenDown.tm_sec;
 
+    // RAW=YES is used internally by CPLAddFilesInZip() to write entry
+    // payloads that have already been compressed by worker threads.
+    const bool bRaw =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "RAW", "NO"));
+
     const int nErr = cpl_zipOpenNewFileInZip3(
         psZip->hZip, pszCPFilename, &fileinfo,
         abyExtra.empty() ? nullptr : abyExtra.data(),
         static_cast<uInt>(abyExtra.size()),
         abyExtra.empty() ? nullptr : abyExtra.data(),
         static_cast<uInt>(abyExtra.size()), "", bCompressed ? Z_DEFLATED : 0,
-        bCompressed ? Z_DEFAULT_COMPRESSION : 0,
-        /* raw = */ 0, -MAX_WBITS, DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY,
+        bCompressed ? Z_DEFAULT_COMPRESSION : 0, bRaw ? 1 : 0, -MAX_WBITS,
+        DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY,
         /* password = */ nullptr,
         /* crcForCtypting = */ 0, bZip64, bIncludeInCentralDirectory);
 
@@ -2602,6 +2610,215 @@ CPLErr CPLAddFileInZip(void *hZip, const char *pszArchiveFilename,
 
 /************************************************************************/
 /*                            CPLCloseZip()                             */
+/************************************************************************/
+/*                       CPLCloseFileInZipRaw()                         */
+/************************************************************************/
+
+/** Close an entry written in raw mode, providing the real uncompressed
+ * size and CRC32 of its content. */
+static CPLErr CPLCloseFileInZipRaw(void *hZip, uint64_t nUncompressedSize,
+                                   uLong nCRC)
+{
+    if (hZip == nullptr)
+        return CE_Failure;
+
+    CPLZip *psZip = static_cast<CPLZip *>(hZip);
+
+    const int nErr = cpl_zipCloseFileInZipRaw(
+        psZip->hZip, static_cast<ZPOS64_T>(nUncompressedSize), nCRC);
+
+    return nErr == ZIP_OK ? CE_None : CE_Failure;
+}
+
+/************************************************************************/
+/*                         CPLAddFilesInZip()                           */
+/************************************************************************/
+
+/** Add several files to a ZIP file, compressing their content in parallel.
+ *
+ * The content of each input file is read and compressed as an independent
+ * raw Deflate stream by the threads of a worker pool, and the
+ * precompressed entries are then appended serially (in the order of the
+ * input arrays) to the archive, so the wall clock time of writing
+ * multi-file deliverables (.kmz, .zip) is driven by the archive I/O
+ * rather than by single-core compression.
+ *
+ * Contrary to CPLAddFileInZip(), entries are always written as plain
+ * Deflate streams, without seek-optimization index. The compressed
+ * content of the files is held in memory until it is written.
+ *
+ * @param hZip ZIP file handle, as returned by CPLCreateZip()
+ * @param nFiles Number of files to add.
+ * @param papszArchiveFilenames Array of nFiles filenames in the archive.
+ * @param papszInputFilenames Array of nFiles input filenames.
+ * @param papszOptions Options accepted by CPLCreateFileInZip(), applied to
+ *                     each entry. Or NULL.
+ * @param pProgressFunc Progress callback, or NULL.
+ * @param pProgressData User data of progress callback, or NULL.
+ * @return CE_None in case of success.
+ * @since GDAL 3.14
+ */
+CPLErr CPLAddFilesInZip(void *hZip, int nFiles,
+                        const char *const *papszArchiveFilenames,
+                        const char *const *papszInputFilenames,
+                        CSLConstList papszOptions,
+                        GDALProgressFunc pProgressFunc, void *pProgressData)
+{
+    if (!hZip || nFiles < 0 || !papszArchiveFilenames || !papszInputFilenames)
+        return CE_Failure;
+    if (nFiles == 0)
+        return CE_None;
+
+    struct PrecompressedEntry
+    {
+        std::vector<GByte> abyCompressed{};
+        uint64_t nUncompressedSize = 0;
+        uLong nCRC = 0;
+        bool bOK = false;
+    };
+
+    std::vector<PrecompressedEntry> asEntries(nFiles);
+
+    const auto CompressOneFile =
+        [&asEntries, papszInputFilenames](int iFile)
+    {
+        PrecompressedEntry &sEntry = asEntries[iFile];
+        VSILFILE *fpInput = VSIFOpenL(papszInputFilenames[iFile], "rb");
+        if (fpInput == nullptr)
+            return;
+
+        VSIFSeekL(fpInput, 0, SEEK_END);
+        const uint64_t nSize = VSIFTellL(fpInput);
+        VSIFSeekL(fpInput, 0, SEEK_SET);
+
+        z_stream sStream;
+        memset(&sStream, 0, sizeof(sStream));
+        if (deflateInit2(&sStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                         -MAX_WBITS, DEF_MEM_LEVEL,
+                         Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            CPL_IGNORE_RET_VAL(VSIFCloseL(fpInput));
+            return;
+        }
+
+        bool bFailed = false;
+        int nZRet = Z_OK;
+        try
+        {
+            constexpr size_t IO_CHUNK_SIZE = 1024 * 1024;
+            std::vector<GByte> abyInput(static_cast<size_t>(
+                std::min<uint64_t>(std::max<uint64_t>(nSize, 1),
+                                   IO_CHUNK_SIZE)));
+            constexpr size_t OUT_CHUNK_SIZE = 256 * 1024;
+            sEntry.nCRC = crc32(0, nullptr, 0);
+            uint64_t nRemaining = nSize;
+            do
+            {
+                const size_t nToRead = static_cast<size_t>(
+                    std::min<uint64_t>(nRemaining, abyInput.size()));
+                const size_t nRead =
+                    nToRead ? VSIFReadL(abyInput.data(), 1, nToRead, fpInput)
+                            : 0;
+                if (nRead != nToRead)
+                {
+                    bFailed = true;
+                    break;
+                }
+                nRemaining -= nRead;
+                sEntry.nCRC = crc32(sEntry.nCRC, abyInput.data(),
+                                    static_cast<uInt>(nRead));
+                sStream.next_in = abyInput.data();
+                sStream.avail_in = static_cast<uInt>(nRead);
+                const int nFlush = nRemaining == 0 ? Z_FINISH : Z_NO_FLUSH;
+                do
+                {
+                    const size_t nOldSize = sEntry.abyCompressed.size();
+                    sEntry.abyCompressed.resize(nOldSize + OUT_CHUNK_SIZE);
+                    sStream.next_out = sEntry.abyCompressed.data() + nOldSize;
+                    sStream.avail_out = static_cast<uInt>(OUT_CHUNK_SIZE);
+                    nZRet = deflate(&sStream, nFlush);
+                    sEntry.abyCompressed.resize(nOldSize + OUT_CHUNK_SIZE -
+                                                sStream.avail_out);
+                    if (nZRet == Z_STREAM_ERROR)
+                    {
+                        bFailed = true;
+                        break;
+                    }
+                } while (sStream.avail_in > 0 ||
+                         (nFlush == Z_FINISH && nZRet != Z_STREAM_END));
+            } while (nRemaining > 0 && !bFailed);
+        }
+        catch (const std::exception &)
+        {
+            bFailed = true;
+        }
+        deflateEnd(&sStream);
+        CPL_IGNORE_RET_VAL(VSIFCloseL(fpInput));
+
+        sEntry.nUncompressedSize = nSize;
+        sEntry.bOK = !bFailed && nZRet == Z_STREAM_END;
+    };
+
+    const int nThreads = std::min(nFiles, CPLGetNumCPUs());
+    CPLWorkerThreadPool oPool;
+    if (nThreads > 1 && oPool.Setup(nThreads, nullptr, nullptr))
+    {
+        for (int i = 0; i < nFiles; ++i)
+        {
+            oPool.SubmitJob([&CompressOneFile, i]() { CompressOneFile(i); });
+        }
+        oPool.WaitCompletion();
+    }
+    else
+    {
+        for (int i = 0; i < nFiles; ++i)
+            CompressOneFile(i);
+    }
+
+    CPLStringList aosEntryOptions(papszOptions);
+    aosEntryOptions.SetNameValue("RAW", "YES");
+    // The payload is always deflated by the workers: the entry must be
+    // marked accordingly, whatever the caller requested.
+    aosEntryOptions.SetNameValue("COMPRESSED", "TRUE");
+
+    for (int i = 0; i < nFiles; ++i)
+    {
+        const PrecompressedEntry &sEntry = asEntries[i];
+        if (!sEntry.bOK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot compress %s",
+                     papszInputFilenames[i]);
+            return CE_Failure;
+        }
+        if (CPLCreateFileInZip(hZip, papszArchiveFilenames[i],
+                               aosEntryOptions.List()) != CE_None)
+            return CE_Failure;
+
+        size_t nWritten = 0;
+        while (nWritten < sEntry.abyCompressed.size())
+        {
+            const int nToWrite = static_cast<int>(
+                std::min<size_t>(sEntry.abyCompressed.size() - nWritten,
+                                 std::numeric_limits<int>::max()));
+            if (CPLWriteFileInZip(hZip, sEntry.abyCompressed.data() + nWritten,
+                                  nToWrite) != CE_None)
+                return CE_Failure;
+            nWritten += static_cast<size_t>(nToWrite);
+        }
+
+        if (CPLCloseFileInZipRaw(hZip, sEntry.nUncompressedSize,
+                                 sEntry.nCRC) != CE_None)
+            return CE_Failure;
+
+        if (pProgressFunc &&
+            !pProgressFunc(static_cast<double>(i + 1) / nFiles, "",
+                           pProgressData))
+            return CE_Failure;
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 
 /** Close ZIP file */
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstring>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -363,6 +364,114 @@ void CPLQuadTreeInsertWithBounds(CPLQuadTree *hQuadTree, void *hFeature,
     CPLQuadTreeAddFeatureInternal(hQuadTree, hFeature, psBounds);
 }
 
+/************************************************************************/
+/*                        CPLQuadTreeInsertBulk()                       */
+/************************************************************************/
+
+/** Insert several features at once, in an order that improves locality.
+ *
+ * The features are inserted by increasing Morton code of the center of
+ * their bounding box, so that features that are close spatially are
+ * inserted (and thus allocated) close to each other, which measurably
+ * reduces cache misses during later searches on trees with millions of
+ * features. The resulting tree is equivalent to inserting the features
+ * one by one.
+ *
+ * The tree must have been created with a non-null bounds-fetching
+ * callback.
+ *
+ * @param hQuadTree the quad tree
+ * @param pahFeatures array of nFeatures features
+ * @param nFeatures number of features
+ *
+ * @since GDAL 3.14
+ */
+void CPLQuadTreeInsertBulk(CPLQuadTree *hQuadTree, void **pahFeatures,
+                           int nFeatures)
+{
+    if (nFeatures <= 0)
+        return;
+    if (hQuadTree->pfnGetBounds == nullptr &&
+        hQuadTree->pfnGetBoundsEx == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "hQuadTree->pfnGetBounds == NULL");
+        return;
+    }
+
+    struct FeatureAndKey
+    {
+        void *hFeature;
+        CPLRectObj bounds;
+        GUIntBig nMortonKey;
+    };
+
+    std::vector<FeatureAndKey> asFeatures;
+    try
+    {
+        asFeatures.resize(nFeatures);
+    }
+    catch (const std::exception &)
+    {
+        // Fallback: plain insertion order
+        for (int i = 0; i < nFeatures; ++i)
+            CPLQuadTreeInsert(hQuadTree, pahFeatures[i]);
+        return;
+    }
+
+    const CPLRectObj &globalBounds = hQuadTree->psRoot->rect;
+    const double dfInvWidth =
+        globalBounds.maxx > globalBounds.minx
+            ? 65535.0 / (globalBounds.maxx - globalBounds.minx)
+            : 0.0;
+    const double dfInvHeight =
+        globalBounds.maxy > globalBounds.miny
+            ? 65535.0 / (globalBounds.maxy - globalBounds.miny)
+            : 0.0;
+
+    const auto SpreadBits = [](GUIntBig v)
+    {
+        // Spread the 16 lower bits of v on the even bit positions
+        v = (v | (v << 8)) & 0x00FF00FFU;
+        v = (v | (v << 4)) & 0x0F0F0F0FU;
+        v = (v | (v << 2)) & 0x33333333U;
+        v = (v | (v << 1)) & 0x55555555U;
+        return v;
+    };
+
+    for (int i = 0; i < nFeatures; ++i)
+    {
+        FeatureAndKey &sFK = asFeatures[i];
+        sFK.hFeature = pahFeatures[i];
+        if (hQuadTree->pfnGetBoundsEx)
+            hQuadTree->pfnGetBoundsEx(pahFeatures[i], hQuadTree->pUserData,
+                                      &sFK.bounds);
+        else
+            hQuadTree->pfnGetBounds(pahFeatures[i], &sFK.bounds);
+        const double dfX = std::min(
+            65535.0, std::max(0.0, (0.5 * (sFK.bounds.minx + sFK.bounds.maxx) -
+                                    globalBounds.minx) *
+                                       dfInvWidth));
+        const double dfY = std::min(
+            65535.0, std::max(0.0, (0.5 * (sFK.bounds.miny + sFK.bounds.maxy) -
+                                    globalBounds.miny) *
+                                       dfInvHeight));
+        sFK.nMortonKey =
+            SpreadBits(static_cast<GUIntBig>(dfX)) |
+            (SpreadBits(static_cast<GUIntBig>(dfY)) << 1);
+    }
+
+    std::sort(asFeatures.begin(), asFeatures.end(),
+              [](const FeatureAndKey &a, const FeatureAndKey &b)
+              { return a.nMortonKey < b.nMortonKey; });
+
+    for (const FeatureAndKey &sFK : asFeatures)
+    {
+        hQuadTree->nFeatures++;
+        CPLQuadTreeAddFeatureInternal(hQuadTree, sFK.hFeature, &sFK.bounds);
+    }
+}
+
 /************************************************************************/
 /*                         CPLQuadTreeRemove()                          */
 /************************************************************************/
@@ -913,6 +1022,44 @@ void **CPLQuadTreeSearch(const CPLQuadTree *hQuadTree, const CPLRectObj *pAoi,
     return ppFeatureList;
 }
 
+/************************************************************************/
+/*                     CPLQuadTreeSearchBuffered()                      */
+/************************************************************************/
+
+/**
+ * Same as CPLQuadTreeSearch(), except that the result array is stored in a
+ * caller-provided growable buffer, so repeated searches (e.g. one per
+ * output cell of a gridding operation) do not allocate and free a result
+ * array each time.
+ *
+ * @param hQuadTree the quad tree
+ * @param pAoi the pointer to the area of interest
+ * @param pnFeatureCount location to store the number of features returned.
+ * @param pppBuffer pointer to the result buffer, to initialize to NULL
+ *                  before first use and to free with CPLFree() when no
+ *                  longer needed.
+ * @param pnBufferSize pointer to the allocated size of *pppBuffer, to
+ *                  initialize to 0 before first use.
+ *
+ * @return *pppBuffer, with *pnFeatureCount valid entries.
+ */
+
+void **CPLQuadTreeSearchBuffered(const CPLQuadTree *hQuadTree,
+                                 const CPLRectObj *pAoi, int *pnFeatureCount,
+                                 void ***pppBuffer, int *pnBufferSize)
+{
+    CPLAssert(hQuadTree);
+    CPLAssert(pAoi);
+    CPLAssert(pnFeatureCount);
+    CPLAssert(pppBuffer);
+    CPLAssert(pnBufferSize);
+
+    *pnFeatureCount = 0;
+    CPLQuadTreeCollectFeatures(hQuadTree, hQuadTree->psRoot, pAoi,
+                               pnFeatureCount, pnBufferSize, pppBuffer);
+    return *pppBuffer;
+}
+
 /************************************************************************/
 /*                        CPLQuadTreeHasMatch()                         */
 /************************************************************************/
@@ -76,6 +76,8 @@ int CPL_DLL CPLQuadTreeGetAdvisedMaxDepth(int nExpectedFeatures);
 void CPL_DLL CPLQuadTreeSetMaxDepth(CPLQuadTree *hQuadtree, int nMaxDepth);
 
 void CPL_DLL CPLQuadTreeInsert(CPLQuadTree *hQuadtree, void *hFeature);
+void CPL_DLL CPLQuadTreeInsertBulk(CPLQuadTree *hQuadtree, void **pahFeatures,
+                                   int nFeatures);
 void CPL_DLL CPLQuadTreeInsertWithBounds(CPLQuadTree *hQuadtree, void *hFeature,
                                          const CPLRectObj *psBounds);
 
@@ -84,6 +86,11 @@ void CPL_DLL CPLQuadTreeRemove(CPLQuadTree *hQuadtree, void *hFeature,
 
 void CPL_DLL **CPLQuadTreeSearch(const CPLQuadTree *hQuadtree,
                                  const CPLRectObj *pAoi, int *pnFeatureCount);
+void CPL_DLL **CPLQuadTreeSearchBuffered(const CPLQuadTree *hQuadtree,
+                                         const CPLRectObj *pAoi,
+                                         int *pnFeatureCount,
+                                         void ***pppBuffer,
+                                         int *pnBufferSize);
 
 bool CPL_DLL CPLQuadTreeHasMatch(const CPLQuadTree *hQuadtree,
                                  const CPLRectObj *pAoi);
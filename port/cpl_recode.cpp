@@ -24,6 +24,11 @@
  **********************************************************************/
 
 #include "cpl_port.h"
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
 #include "cpl_string.h"
 
 #include <cstring>
@@ -91,6 +96,32 @@ char CPL_DLL *CPLRecode(const char *pszSource, const char *pszSrcEncoding,
          EQUAL(pszDstEncoding, CPL_ENC_ISO8859_1)))
         return CPLStrdup(pszSource);
 
+    // ISO-8859-1 and UTF-8 agree on pure-ASCII content, which is the vast
+    // majority of attribute values: detect it with a wide scan and shortcut
+    // the per-character conversion machinery.
+    if ((EQUAL(pszSrcEncoding, CPL_ENC_ISO8859_1) &&
+         EQUAL(pszDstEncoding, CPL_ENC_UTF8)) ||
+        (EQUAL(pszSrcEncoding, CPL_ENC_UTF8) &&
+         EQUAL(pszDstEncoding, CPL_ENC_ISO8859_1)))
+    {
+        const char *pszPtr = pszSource;
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        const size_t nLen = strlen(pszSource);
+        const char *pszEnd = pszSource + nLen;
+        while (pszPtr + 16 <= pszEnd &&
+               _mm_movemask_epi8(_mm_loadu_si128(
+                   reinterpret_cast<const __m128i *>(pszPtr))) == 0)
+        {
+            pszPtr += 16;
+        }
+#endif
+        while (*pszPtr && static_cast<unsigned char>(*pszPtr) < 0x80)
+            ++pszPtr;
+        if (*pszPtr == '\0')
+            return CPLStrdup(pszSource);
+    }
+
     // A few hard coded CPxxx/ISO-8859-x to UTF-8 tables
     if (EQUAL(pszDstEncoding, CPL_ENC_UTF8) &&
         CPLGetConversionTableToUTF8(pszSrcEncoding))
@@ -302,6 +333,21 @@ char *CPLForceToASCII(const char *pabyData, int nLen, char chReplacementChar)
     const char *pszPtr = pabyData;
     const char *pszEnd = pabyData + nRealLen;
     size_t i = 0;
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    // Copy runs of ASCII characters 16 bytes at a time
+    while (pszPtr + 16 <= pszEnd)
+    {
+        const __m128i xmm =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pszPtr));
+        if (_mm_movemask_epi8(xmm) != 0)
+            break;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pszOutputString + i),
+                         xmm);
+        pszPtr += 16;
+        i += 16;
+    }
+#endif
     while (pszPtr != pszEnd)
     {
         if (*reinterpret_cast<const unsigned char *>(pszPtr) > 127)
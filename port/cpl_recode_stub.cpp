@@ -30,6 +30,11 @@
  **********************************************************************/
 
 #include "cpl_port.h"
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
 #include "cpl_string.h"
 
 #include <cstring>
@@ -501,7 +506,31 @@ int CPLIsUTF8(const char *pabyData, int nLen)
 {
     if (nLen < 0)
         nLen = static_cast<int>(strlen(pabyData));
-    return utf8test(pabyData, static_cast<unsigned>(nLen)) != 0;
+
+    // Fast path: skip the pure-ASCII prefix 16 bytes at a time, which is
+    // the totality of most attribute strings. Validation then restarts at
+    // the first non-ASCII byte, which is necessarily the beginning of a
+    // (claimed) multi-byte sequence since everything before is ASCII.
+    int nOffset = 0;
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    while (nOffset + 16 <= nLen)
+    {
+        const __m128i xmm = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(pabyData + nOffset));
+        if (_mm_movemask_epi8(xmm) != 0)
+            break;
+        nOffset += 16;
+    }
+#endif
+    while (nOffset < nLen &&
+           static_cast<unsigned char>(pabyData[nOffset]) < 0x80)
+        ++nOffset;
+    if (nOffset == nLen)
+        return TRUE;
+
+    return utf8test(pabyData + nOffset,
+                    static_cast<unsigned>(nLen - nOffset)) != 0;
 }
 
 /************************************************************************/
@@ -41,6 +41,12 @@
 #include <cstdlib>
 #include <cstring>
 
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
 #include <limits>
 
 #include "cpl_config.h"
@@ -1370,6 +1376,35 @@ int CPLsnprintf(char *str, size_t size, CPL_FORMAT_STRING(const char *fmt), ...)
 
 #endif  //  !defined(ALIAS_CPLSNPRINTF_AS_SNPRINTF)
 
+/************************************************************************/
+/*                          CPLFormatDoubleG()                          */
+/************************************************************************/
+
+/** Formats a double like CPLsnprintf(buf, size, "%.*g", nSignificantFigures,
+ * dfVal), but using std::to_chars() when available, which implements a
+ * Ryu-class algorithm several times faster than snprintf for this job.
+ * Output is byte-identical with the %g formatting (C locale).
+ *
+ * @return the number of characters (excluding terminating nul) written in
+ * the output buffer.
+ */
+int CPLFormatDoubleG(char *pszBuffer, size_t nBufferSize, double dfVal,
+                     int nSignificantFigures)
+{
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const auto sResult =
+        std::to_chars(pszBuffer, pszBuffer + nBufferSize - 1, dfVal,
+                      std::chars_format::general, nSignificantFigures);
+    if (sResult.ec == std::errc())
+    {
+        *sResult.ptr = '\0';
+        return static_cast<int>(sResult.ptr - pszBuffer);
+    }
+#endif
+    return CPLsnprintf(pszBuffer, nBufferSize, "%.*g", nSignificantFigures,
+                       dfVal);
+}
+
 /************************************************************************/
 /*                             CPLsprintf()                             */
 /************************************************************************/
@@ -212,6 +212,9 @@ int CPL_DLL CPLvsnprintf(char *str, size_t size,
 #if defined(ALIAS_CPLSNPRINTF_AS_SNPRINTF)
 #define CPLsnprintf snprintf
 #else
+int CPL_DLL CPLFormatDoubleG(char *pszBuffer, size_t nBufferSize,
+                             double dfVal, int nSignificantFigures);
+
 int CPL_DLL CPLsnprintf(char *str, size_t size,
                         CPL_FORMAT_STRING(const char *fmt), ...)
     CPL_PRINT_FUNC_FORMAT(3, 4);
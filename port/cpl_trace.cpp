@@ -0,0 +1,103 @@
+/**********************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Lightweight tracing facility emitting chrome://tracing spans
+ * Author:   agent <agent@local>
+ *
+ **********************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_trace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+
+int gnCPLTraceEnabled = -1;
+
+static std::mutex goTraceMutex;
+static FILE *gpsTraceFile = nullptr;
+
+/************************************************************************/
+/*                       CPLTraceCheckEnabled()                         */
+/************************************************************************/
+
+/** One-time initialization: reads CPL_TRACE, and opens the output file. */
+bool CPLTraceCheckEnabled(void)
+{
+    std::lock_guard<std::mutex> oLock(goTraceMutex);
+    if (gnCPLTraceEnabled < 0)
+    {
+        int nEnabled = 0;
+        if (CPLTestBool(CPLGetConfigOption("CPL_TRACE", "NO")))
+        {
+            std::string osFilename(
+                CPLGetConfigOption("CPL_TRACE_FILE", ""));
+            if (osFilename.empty())
+            {
+                osFilename = "gdal_trace_";
+                osFilename += std::to_string(CPLGetCurrentProcessID());
+                osFilename += ".json";
+            }
+            gpsTraceFile = fopen(osFilename.c_str(), "wb");
+            if (gpsTraceFile)
+            {
+                fprintf(gpsTraceFile, "[\n");
+                nEnabled = 1;
+            }
+            else
+            {
+                CPLError(CE_Warning, CPLE_FileIO,
+                         "CPL_TRACE: cannot create %s", osFilename.c_str());
+            }
+        }
+        gnCPLTraceEnabled = nEnabled;
+    }
+    return gnCPLTraceEnabled > 0;
+}
+
+/************************************************************************/
+/*                         CPLTraceGetTimeUS()                          */
+/************************************************************************/
+
+GUIntBig CPLTraceGetTimeUS(void)
+{
+    const auto nUS =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    // 0 is reserved as the "not traced" marker of CPLTraceSpan
+    return nUS != 0 ? static_cast<GUIntBig>(nUS) : 1;
+}
+
+/************************************************************************/
+/*                           CPLTraceEmit()                             */
+/************************************************************************/
+
+/** Append one chrome://tracing complete ("ph":"X") event. */
+void CPLTraceEmit(const char *pszName, const char *pszCategory,
+                  GUIntBig nStartUS, GUIntBig nBytes)
+{
+    const GUIntBig nEndUS = CPLTraceGetTimeUS();
+    const GIntBig nTID = CPLGetPID();
+
+    std::lock_guard<std::mutex> oLock(goTraceMutex);
+    if (gpsTraceFile == nullptr)
+        return;
+    fprintf(gpsTraceFile,
+            "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\","
+            "\"ts\":" CPL_FRMT_GUIB ",\"dur\":" CPL_FRMT_GUIB
+            ",\"pid\":%d,\"tid\":" CPL_FRMT_GIB
+            ",\"args\":{\"bytes\":" CPL_FRMT_GUIB "}},\n",
+            pszName, pszCategory, nStartUS,
+            nEndUS >= nStartUS ? nEndUS - nStartUS : 0,
+            CPLGetCurrentProcessID(), nTID, nBytes);
+}
@@ -0,0 +1,85 @@
+/**********************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Lightweight tracing facility emitting chrome://tracing spans
+ * Author:   agent <agent@local>
+ *
+ **********************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_TRACE_H_INCLUDED
+#define CPL_TRACE_H_INCLUDED
+
+#include "cpl_port.h"
+
+/**
+ * \file cpl_trace.h
+ *
+ * Opt-in tracing of hot code paths (RasterIO, block cache, VSI reads,
+ * network transfers) as chrome://tracing "complete" events.
+ *
+ * Enabled by setting the CPL_TRACE configuration option to YES before the
+ * first traced event; the spans are appended to the file named by
+ * CPL_TRACE_FILE (default: "gdal_trace_<pid>.json" in the current
+ * directory), loadable in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * When not enabled, the cost of an instrumented scope is a single
+ * well-predicted branch on a global.
+ */
+
+#ifdef __cplusplus
+
+//! @cond Doxygen_Suppress
+
+// -1: not initialized yet, 0: disabled, 1: enabled
+extern int CPL_DLL gnCPLTraceEnabled;
+
+bool CPL_DLL CPLTraceCheckEnabled(void);
+GUIntBig CPL_DLL CPLTraceGetTimeUS(void);
+void CPL_DLL CPLTraceEmit(const char *pszName, const char *pszCategory,
+                          GUIntBig nStartUS, GUIntBig nBytes);
+
+/** RAII span: emits one trace event covering its scope, carrying the
+ * current thread id and an optional byte count. */
+class CPLTraceSpan
+{
+    const char *m_pszName;
+    const char *m_pszCategory;
+    GUIntBig m_nBytes;
+    GUIntBig m_nStartUS = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(CPLTraceSpan)
+
+  public:
+    CPLTraceSpan(const char *pszName, const char *pszCategory,
+                 GUIntBig nBytes = 0)
+        : m_pszName(pszName), m_pszCategory(pszCategory), m_nBytes(nBytes)
+    {
+        if (CPL_UNLIKELY(gnCPLTraceEnabled != 0))
+        {
+            if (gnCPLTraceEnabled > 0 || CPLTraceCheckEnabled())
+                m_nStartUS = CPLTraceGetTimeUS();
+        }
+    }
+
+    /** Update the byte count reported with the span */
+    void SetBytes(GUIntBig nBytes)
+    {
+        m_nBytes = nBytes;
+    }
+
+    ~CPLTraceSpan()
+    {
+        if (CPL_UNLIKELY(m_nStartUS != 0))
+            CPLTraceEmit(m_pszName, m_pszCategory, m_nStartUS, m_nBytes);
+    }
+};
+
+//! @endcond
+
+#endif  // __cplusplus
+
+#endif  // CPL_TRACE_H_INCLUDED
@@ -753,6 +753,32 @@ class VSIArchiveFilesystemHandler /* non final */ : public VSIFilesystemHandler
     virtual std::unique_ptr<VSIArchiveReader>
     CreateReader(const char *pszArchiveFileName) = 0;
 
+    // Optional support for the persistent archive index cache
+    // (CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR): formats that can serialize their
+    // entry file offsets implement both methods; the default implementations
+    // disable the cache for the format.
+    virtual bool
+    SerializeFileOffset(const VSIArchiveEntryFileOffset * /* pOffset */,
+                        std::vector<GByte> & /* abyData */) const
+    {
+        return false;
+    }
+
+    virtual std::unique_ptr<VSIArchiveEntryFileOffset>
+    DeserializeFileOffset(const GByte * /* pabyData */,
+                          size_t /* nSize */) const
+    {
+        return nullptr;
+    }
+
+  private:
+    std::unique_ptr<VSIArchiveContent>
+    TryLoadArchiveIndex(const char *archiveFilename, const VSIStatBufL &sStat);
+    void SaveArchiveIndex(const char *archiveFilename,
+                          const VSIArchiveContent &content);
+
+  protected:
+
   public:
     VSIArchiveFilesystemHandler();
     ~VSIArchiveFilesystemHandler() override;
@@ -818,7 +844,8 @@ constexpr int VSI_CACHED_DEFAULT_CHUNK_SIZE = 32768;
 VSIVirtualHandle CPL_DLL *
 VSICreateCachedFile(VSIVirtualHandle *poBaseHandle,
                     size_t nChunkSize = VSI_CACHED_DEFAULT_CHUNK_SIZE,
-                    size_t nCacheSize = 0);
+                    size_t nCacheSize = 0,
+                    const char *pszSharedCacheKey = nullptr);
 
 const int CPL_DEFLATE_TYPE_GZIP = 0;
 const int CPL_DEFLATE_TYPE_ZLIB = 1;
@@ -14,6 +14,7 @@
 
 #include "cpl_port.h"
 #include "cpl_vsi.h"
+#include "cpl_trace.h"
 
 #include <cassert>
 #include <cinttypes>
@@ -3151,6 +3152,8 @@ int VSIFFlushL(VSILFILE *fp)
 size_t VSIFReadL(void *pBuffer, size_t nSize, size_t nCount, VSILFILE *fp)
 
 {
+    CPLTraceSpan oTraceSpan("VSIFReadL", "vsi",
+                            static_cast<GUIntBig>(nSize) * nCount);
     return fp->Read(pBuffer, nSize, nCount);
 }
 
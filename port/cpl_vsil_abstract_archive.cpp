@@ -11,6 +11,7 @@
  ****************************************************************************/
 
 #include "cpl_port.h"
+#include "cpl_md5.h"
 #include "cpl_vsi_virtual.h"
 
 #include <cstring>
@@ -116,6 +117,196 @@ static void BuildDirectoryIndex(VSIArchiveContent *content)
     }
 }
 
+/************************************************************************/
+/*                    Persistent archive index cache                    */
+/*                                                                      */
+/*      Optional sidecar cache of parsed archive directories, for       */
+/*      network-hosted archives with large central directories:         */
+/*      setting CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR to a writable          */
+/*      directory persists the parsed index (names, sizes, offsets)     */
+/*      keyed by archive path, size and modification time, so that      */
+/*      new processes do not re-list the same archives.                 */
+/************************************************************************/
+
+constexpr char VSI_ARCHIVE_INDEX_MAGIC[] = "VSIARIDX";
+constexpr GUInt32 VSI_ARCHIVE_INDEX_VERSION = 1;
+
+static std::string GetArchiveIndexFilename(const char *archiveFilename)
+{
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_ARCHIVE_INDEX_CACHE_DIR", nullptr);
+    if (pszDir == nullptr)
+        return std::string();
+    const std::string osBasename =
+        std::string(CPLMD5String(archiveFilename)) + ".vsiaridx";
+    return CPLFormFilenameSafe(pszDir, osBasename.c_str(), nullptr);
+}
+
+template <class T> static bool ReadVal(VSILFILE *fp, T &val)
+{
+    return VSIFReadL(&val, sizeof(val), 1, fp) == 1;
+}
+
+template <class T> static bool WriteVal(VSILFILE *fp, const T &val)
+{
+    return VSIFWriteL(&val, sizeof(val), 1, fp) == 1;
+}
+
+std::unique_ptr<VSIArchiveContent>
+VSIArchiveFilesystemHandler::TryLoadArchiveIndex(const char *archiveFilename,
+                                                 const VSIStatBufL &sStat)
+{
+    const std::string osIndexFilename =
+        GetArchiveIndexFilename(archiveFilename);
+    if (osIndexFilename.empty())
+        return nullptr;
+    VSILFILE *fp = VSIFOpenL(osIndexFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return nullptr;
+
+    bool bOK = false;
+    auto content = std::make_unique<VSIArchiveContent>();
+    char szMagic[sizeof(VSI_ARCHIVE_INDEX_MAGIC)] = {0};
+    GUInt32 nVersion = 0;
+    GUIntBig nArchiveSize = 0;
+    GIntBig nMTime = 0;
+    GUIntBig nEntries = 0;
+    if (VSIFReadL(szMagic, strlen(VSI_ARCHIVE_INDEX_MAGIC), 1, fp) == 1 &&
+        memcmp(szMagic, VSI_ARCHIVE_INDEX_MAGIC,
+               strlen(VSI_ARCHIVE_INDEX_MAGIC)) == 0 &&
+        ReadVal(fp, nVersion) && nVersion == VSI_ARCHIVE_INDEX_VERSION &&
+        ReadVal(fp, nArchiveSize) &&
+        nArchiveSize == static_cast<GUIntBig>(sStat.st_size) &&
+        ReadVal(fp, nMTime) &&
+        nMTime == static_cast<GIntBig>(sStat.st_mtime) &&
+        ReadVal(fp, nEntries) && nEntries < 100 * 1000 * 1000)
+    {
+        bOK = true;
+        content->mTime = sStat.st_mtime;
+        content->nFileSize = static_cast<vsi_l_offset>(sStat.st_size);
+        std::string osName;
+        std::vector<GByte> abyOffset;
+        for (GUIntBig i = 0; bOK && i < nEntries; ++i)
+        {
+            GUInt32 nNameLen = 0;
+            GIntBig nEntryMTime = 0;
+            GUIntBig nSize = 0;
+            GByte byIsDir = 0;
+            GUInt32 nOffsetLen = 0;
+            bOK = ReadVal(fp, nNameLen) && nNameLen > 0 &&
+                  nNameLen < 10 * 1000 * 1000;
+            if (bOK)
+            {
+                osName.resize(nNameLen);
+                bOK = VSIFReadL(&osName[0], nNameLen, 1, fp) == 1;
+            }
+            bOK = bOK && ReadVal(fp, nEntryMTime) && ReadVal(fp, nSize) &&
+                  ReadVal(fp, byIsDir) && ReadVal(fp, nOffsetLen) &&
+                  nOffsetLen < 1000;
+            if (bOK)
+            {
+                VSIArchiveEntry entry;
+                entry.fileName = osName;
+                entry.nModifiedTime = nEntryMTime;
+                entry.uncompressed_size = static_cast<vsi_l_offset>(nSize);
+                entry.bIsDir = byIsDir != 0;
+                if (nOffsetLen > 0)
+                {
+                    abyOffset.resize(nOffsetLen);
+                    bOK = VSIFReadL(abyOffset.data(), nOffsetLen, 1, fp) == 1;
+                    if (bOK)
+                    {
+                        entry.file_pos = DeserializeFileOffset(abyOffset.data(),
+                                                               nOffsetLen);
+                        bOK = entry.file_pos != nullptr;
+                    }
+                }
+                if (bOK)
+                    content->entries.push_back(std::move(entry));
+            }
+        }
+    }
+    VSIFCloseL(fp);
+    if (!bOK)
+    {
+        CPLDebug("VSIArchive", "Invalid or stale archive index %s",
+                 osIndexFilename.c_str());
+        return nullptr;
+    }
+    BuildDirectoryIndex(content.get());
+    return content;
+}
+
+void VSIArchiveFilesystemHandler::SaveArchiveIndex(
+    const char *archiveFilename, const VSIArchiveContent &content)
+{
+    const std::string osIndexFilename =
+        GetArchiveIndexFilename(archiveFilename);
+    if (osIndexFilename.empty())
+        return;
+
+    // Check upfront that the format supports offset serialization.
+    std::vector<GByte> abyOffset;
+    for (const auto &entry : content.entries)
+    {
+        if (entry.file_pos)
+        {
+            if (!SerializeFileOffset(entry.file_pos.get(), abyOffset))
+                return;
+            break;
+        }
+    }
+
+    // Process-specific temporary name, so that concurrent processes
+    // indexing the same archive do not step on each other; the final
+    // rename makes the publication atomic.
+    const std::string osTmpFilename =
+        osIndexFilename + CPLSPrintf("." CPL_FRMT_GIB ".tmp", CPLGetPID());
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+        return;
+    bool bOK =
+        VSIFWriteL(VSI_ARCHIVE_INDEX_MAGIC, strlen(VSI_ARCHIVE_INDEX_MAGIC), 1,
+                   fp) == 1 &&
+        WriteVal(fp, VSI_ARCHIVE_INDEX_VERSION) &&
+        WriteVal(fp, static_cast<GUIntBig>(content.nFileSize)) &&
+        WriteVal(fp, static_cast<GIntBig>(content.mTime)) &&
+        WriteVal(fp, static_cast<GUIntBig>(content.entries.size()));
+    for (const auto &entry : content.entries)
+    {
+        if (!bOK)
+            break;
+        abyOffset.clear();
+        if (entry.file_pos &&
+            !SerializeFileOffset(entry.file_pos.get(), abyOffset))
+        {
+            bOK = false;
+            break;
+        }
+        const GUInt32 nNameLen = static_cast<GUInt32>(entry.fileName.size());
+        const GUInt32 nOffsetLen = static_cast<GUInt32>(abyOffset.size());
+        bOK = WriteVal(fp, nNameLen) &&
+              VSIFWriteL(entry.fileName.data(), nNameLen, 1, fp) == 1 &&
+              WriteVal(fp, static_cast<GIntBig>(entry.nModifiedTime)) &&
+              WriteVal(fp,
+                       static_cast<GUIntBig>(entry.uncompressed_size)) &&
+              WriteVal(fp, static_cast<GByte>(entry.bIsDir ? 1 : 0)) &&
+              WriteVal(fp, nOffsetLen) &&
+              (nOffsetLen == 0 ||
+               VSIFWriteL(abyOffset.data(), nOffsetLen, 1, fp) == 1);
+    }
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (bOK)
+    {
+        if (VSIRename(osTmpFilename.c_str(), osIndexFilename.c_str()) != 0)
+            VSIUnlink(osTmpFilename.c_str());
+    }
+    else
+    {
+        VSIUnlink(osTmpFilename.c_str());
+    }
+}
+
 /************************************************************************/
 /*                        GetContentOfArchive()                         */
 /************************************************************************/
@@ -148,6 +339,15 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
         }
     }
 
+    // Try the persistent sidecar index cache, if enabled.
+    if (auto loadedContent = TryLoadArchiveIndex(archiveFilename, sStat))
+    {
+        return oFileList
+            .insert(std::pair<CPLString, std::unique_ptr<VSIArchiveContent>>(
+                archiveFilename, std::move(loadedContent)))
+            .first->second.get();
+    }
+
     std::unique_ptr<VSIArchiveReader> temporaryReader;  // keep in that scope
     if (poReader == nullptr)
     {
@@ -227,6 +427,10 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
     // Build directory index for fast lookups
     BuildDirectoryIndex(content.get());
 
+    // Persist the parsed index, if the sidecar cache is enabled and the
+    // format supports it.
+    SaveArchiveIndex(archiveFilename, *content);
+
     return oFileList
         .insert(std::pair<CPLString, std::unique_ptr<VSIArchiveContent>>(
             archiveFilename, std::move(content)))
@@ -21,6 +21,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "cpl_conv.h"
@@ -32,6 +33,87 @@
 
 //! @cond Doxygen_Suppress
 
+/************************************************************************/
+/*                         VSICachedChunkCache                          */
+/************************************************************************/
+
+/* Cache of the chunks of one file. When sharing is enabled
+ * (VSI_CACHE_SHARED), one instance is shared by all the handles on the same
+ * (path, size) so that chunks are deduplicated across reader threads, and a
+ * chunk fetched by one handle is immediately visible to the others. Chunks
+ * are refcounted, so eviction by one handle cannot invalidate the data
+ * another one is copying from. */
+struct VSICachedChunkCache
+{
+    std::mutex oMutex{};
+    lru11::Cache<vsi_l_offset, std::shared_ptr<cpl::NonCopyableVector<GByte>>>
+        oCache;
+
+    explicit VSICachedChunkCache(size_t nMaxChunks) : oCache(nMaxChunks, 0)
+    {
+    }
+
+    bool Contains(vsi_l_offset iBlock)
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        return oCache.contains(iBlock);
+    }
+
+    std::shared_ptr<cpl::NonCopyableVector<GByte>> Get(vsi_l_offset iBlock)
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        std::shared_ptr<cpl::NonCopyableVector<GByte>> poData;
+        oCache.tryGet(iBlock, poData);
+        return poData;
+    }
+
+    void Insert(vsi_l_offset iBlock,
+                std::shared_ptr<cpl::NonCopyableVector<GByte>> poData)
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        oCache.insert(iBlock, std::move(poData));
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        oCache.clear();
+    }
+};
+
+/* Registry of the shared chunk caches, keyed on (path, file size, chunk
+ * size). Entries are weak: a cache lives as long as at least one handle
+ * uses it. */
+static std::mutex goSharedChunkCachesMutex;
+static std::map<std::string, std::weak_ptr<VSICachedChunkCache>>
+    goSharedChunkCaches;
+
+static std::shared_ptr<VSICachedChunkCache>
+VSIGetSharedChunkCache(const std::string &osKey, size_t nMaxChunks)
+{
+    std::lock_guard<std::mutex> oLock(goSharedChunkCachesMutex);
+    if (goSharedChunkCaches.size() > 100)
+    {
+        // Purge expired entries
+        for (auto oIter = goSharedChunkCaches.begin();
+             oIter != goSharedChunkCaches.end();)
+        {
+            if (oIter->second.expired())
+                oIter = goSharedChunkCaches.erase(oIter);
+            else
+                ++oIter;
+        }
+    }
+    auto &oWeak = goSharedChunkCaches[osKey];
+    auto poCache = oWeak.lock();
+    if (poCache == nullptr)
+    {
+        poCache = std::make_shared<VSICachedChunkCache>(nMaxChunks);
+        oWeak = poCache;
+    }
+    return poCache;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                             VSICachedFile                            */
@@ -44,7 +126,7 @@ class VSICachedFile final : public VSIVirtualHandle
 
   public:
     VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
-                  size_t nCacheSize);
+                  size_t nCacheSize, const char *pszSharedCacheKey);
 
     ~VSICachedFile() override
     {
@@ -60,8 +142,8 @@ class VSICachedFile final : public VSIVirtualHandle
     vsi_l_offset m_nFileSize = 0;
 
     size_t m_nChunkSize = 0;
-    lru11::Cache<vsi_l_offset, cpl::NonCopyableVector<GByte>>
-        m_oCache;  // can only been initialized in constructor
+    std::shared_ptr<VSICachedChunkCache>
+        m_poCache{};  // can only been initialized in constructor
 
     bool m_bEOF = false;
     bool m_bError = false;
@@ -140,13 +222,32 @@ static size_t GetCacheMax(size_t nCacheSize)
 /************************************************************************/
 
 VSICachedFile::VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
-                             size_t nCacheSize)
+                             size_t nCacheSize, const char *pszSharedCacheKey)
     : m_poBase(poBaseHandle),
-      m_nChunkSize(nChunkSize ? nChunkSize : VSI_CACHED_DEFAULT_CHUNK_SIZE),
-      m_oCache{cpl::div_round_up(GetCacheMax(nCacheSize), m_nChunkSize), 0}
+      m_nChunkSize(nChunkSize ? nChunkSize : VSI_CACHED_DEFAULT_CHUNK_SIZE)
 {
     m_poBase->Seek(0, SEEK_END);
     m_nFileSize = m_poBase->Tell();
+
+    const size_t nMaxChunks =
+        cpl::div_round_up(GetCacheMax(nCacheSize), m_nChunkSize);
+    if (pszSharedCacheKey)
+    {
+        // The file size takes the role of a generation number: a remote
+        // file updated in-place will (nearly always) change size and thus
+        // get a fresh shared cache.
+        const std::string osKey(
+            std::string(pszSharedCacheKey)
+                .append("||")
+                .append(std::to_string(m_nFileSize))
+                .append("||")
+                .append(std::to_string(m_nChunkSize)));
+        m_poCache = VSIGetSharedChunkCache(osKey, nMaxChunks);
+    }
+    else
+    {
+        m_poCache = std::make_shared<VSICachedChunkCache>(nMaxChunks);
+    }
 }
 
 /************************************************************************/
@@ -156,7 +257,7 @@ VSICachedFile::VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
 int VSICachedFile::Close()
 
 {
-    m_oCache.clear();
+    m_poCache.reset();
     m_poBase.reset();
 
     return 0;
@@ -228,16 +329,17 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
 
         try
         {
-            cpl::NonCopyableVector<GByte> oData(m_nChunkSize);
+            auto poData = std::make_shared<cpl::NonCopyableVector<GByte>>(
+                m_nChunkSize);
             const auto nDataRead =
-                m_poBase->Read(oData.data(), 1, m_nChunkSize);
+                m_poBase->Read(poData->data(), 1, m_nChunkSize);
             if (nDataRead == 0)
                 return false;
             if (nDataRead < m_nChunkSize && m_poBase->Error())
                 m_bError = true;
-            oData.resize(nDataRead);
+            poData->resize(nDataRead);
 
-            m_oCache.insert(nStartBlock, std::move(oData));
+            m_poCache->Insert(nStartBlock, std::move(poData));
         }
         catch (const std::exception &)
         {
@@ -311,12 +413,13 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
                                      : nDataRead - i * m_nChunkSize;
         try
         {
-            cpl::NonCopyableVector<GByte> oData(nDataFilled);
+            auto poData =
+                std::make_shared<cpl::NonCopyableVector<GByte>>(nDataFilled);
 
-            memcpy(oData.data(), pabyWorkBuffer + i * m_nChunkSize,
+            memcpy(poData->data(), pabyWorkBuffer + i * m_nChunkSize,
                    nDataFilled);
 
-            m_oCache.insert(iBlock, std::move(oData));
+            m_poCache->Insert(iBlock, std::move(poData));
         }
         catch (const std::exception &)
         {
@@ -368,11 +471,11 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nBytes)
 
     for (vsi_l_offset iBlock = nStartBlock; iBlock <= nEndBlock; iBlock++)
     {
-        if (!m_oCache.contains(iBlock))
+        if (!m_poCache->Contains(iBlock))
         {
             size_t nBlocksToLoad = 1;
             while (iBlock + nBlocksToLoad <= nEndBlock &&
-                   !m_oCache.contains(iBlock + nBlocksToLoad))
+                   !m_poCache->Contains(iBlock + nBlocksToLoad))
             {
                 nBlocksToLoad++;
             }
@@ -390,14 +493,17 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nBytes)
     while (nAmountCopied < nRequestedBytes)
     {
         const vsi_l_offset iBlock = (m_nOffset + nAmountCopied) / m_nChunkSize;
-        const cpl::NonCopyableVector<GByte> *poData = m_oCache.getPtr(iBlock);
+        // Hold a reference on the chunk so that a concurrent eviction from
+        // a shared cache cannot invalidate it while we copy from it.
+        std::shared_ptr<cpl::NonCopyableVector<GByte>> poData =
+            m_poCache->Get(iBlock);
         if (poData == nullptr)
         {
             // We can reach that point when the amount to read exceeds
             // the cache size.
             LoadBlocks(iBlock, 1, static_cast<GByte *>(pBuffer) + nAmountCopied,
                        std::min(nRequestedBytes - nAmountCopied, m_nChunkSize));
-            poData = m_oCache.getPtr(iBlock);
+            poData = m_poCache->Get(iBlock);
             if (poData == nullptr)
             {
                 break;
@@ -662,8 +768,11 @@ VSICachedFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
         osUnderlyingFilename.c_str(), pszAccess, bSetError, papszOptions);
     if (!fp)
         return nullptr;
-    return VSIVirtualHandleUniquePtr(
-        VSICreateCachedFile(fp.release(), nChunkSize, nCacheSize));
+    return VSIVirtualHandleUniquePtr(VSICreateCachedFile(
+        fp.release(), nChunkSize, nCacheSize,
+        CPLTestBool(CPLGetConfigOption("VSI_CACHE_SHARED", "NO"))
+            ? osUnderlyingFilename.c_str()
+            : nullptr));
 }
 
 /************************************************************************/
@@ -716,13 +825,20 @@ char **VSICachedFilesystemHandler::ReadDirEx(const char *pszDirname,
  * @param nCacheSize total size of the cache for the file, in bytes.
  *                   If 0, defaults to the value of the VSI_CACHE_SIZE
  *                   configuration option, which defaults to 25 MB.
+ * @param pszSharedCacheKey if non-null (typically the file path), and the
+ *                   VSI_CACHE_SHARED configuration option is enabled, the
+ *                   chunks are shared, for the lifetime of the handles,
+ *                   with all the other handles using the same key and
+ *                   observing the same file size.
  * @return a new handle
  */
 VSIVirtualHandle *VSICreateCachedFile(VSIVirtualHandle *poBaseHandle,
-                                      size_t nChunkSize, size_t nCacheSize)
+                                      size_t nChunkSize, size_t nCacheSize,
+                                      const char *pszSharedCacheKey)
 
 {
-    return new VSICachedFile(poBaseHandle, nChunkSize, nCacheSize);
+    return new VSICachedFile(poBaseHandle, nChunkSize, nCacheSize,
+                             pszSharedCacheKey);
 }
 
 /************************************************************************/
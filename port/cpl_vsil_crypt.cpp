@@ -737,6 +737,10 @@ class VSICryptFileHandle final : public VSIVirtualHandle
     vsi_l_offset nWBOffset = 0;
     GByte *pabyWB = nullptr;
     int nWBSize = 0;
+    // Number of sectors the working buffer can hold. Only > 1 for
+    // read-only handles, where the write path single-sector assumptions
+    // do not apply.
+    int nWBCapacitySectors = 1;
     bool bWBDirty = false;
 
     bool bLastSectorWasModified = false;
@@ -845,7 +849,18 @@ int VSICryptFileHandle::Init(const CPLString &osKey, bool bWriteHeader)
         return FALSE;
     }
 
-    pabyWB = static_cast<GByte *>(CPLCalloc(1, poHeader->nSectorSize));
+    if ((nPerms & VSICRYPT_WRITE) == 0)
+    {
+        // Batch base I/O and decryption over several sectors on read-only
+        // handles: with the default 512 byte sectors, reading and
+        // decrypting one sector at a time dominates profiles.
+        const int nTargetBytes =
+            atoi(CPLGetConfigOption("VSICRYPT_READ_BUFFER_SIZE", "65536"));
+        nWBCapacitySectors =
+            std::max(1, std::min(1024, nTargetBytes / poHeader->nSectorSize));
+    }
+    pabyWB = static_cast<GByte *>(
+        CPLCalloc(nWBCapacitySectors, poHeader->nSectorSize));
 
     if ((poHeader->nSectorSize % nBlockSize) != 0)
     {
@@ -1097,13 +1112,41 @@ size_t VSICryptFileHandle::Read(void *pBuffer, size_t const nBytes)
         vsi_l_offset nSectorOffset =
             (nCurPos / poHeader->nSectorSize) * poHeader->nSectorSize;
         poBaseHandle->Seek(poHeader->nHeaderSize + nSectorOffset, SEEK_SET);
-        if (poBaseHandle->Read(pabyWB, poHeader->nSectorSize, 1) != 1)
+
+        // Read (and then decrypt) as many sectors as both the request and
+        // the working buffer capacity justify.
+        int nSectorsToRead = 1;
+        if (nWBCapacitySectors > 1)
+        {
+            const vsi_l_offset nWantedBytes =
+                (nCurPos - nSectorOffset) + nToRead;
+            nSectorsToRead = static_cast<int>(std::min<vsi_l_offset>(
+                nWBCapacitySectors,
+                cpl::div_round_up(nWantedBytes, poHeader->nSectorSize)));
+        }
+
+        const size_t nSectorsRead = poBaseHandle->Read(
+            pabyWB, poHeader->nSectorSize, nSectorsToRead);
+        if (nSectorsRead == 0)
         {
             bEOF = poBaseHandle->Eof();
             bError = poBaseHandle->Error();
             break;
         }
-        if (!DecryptBlock(pabyWB, nSectorOffset))
+        bool bDecryptError = false;
+        for (size_t iSector = 0; iSector < nSectorsRead; ++iSector)
+        {
+            if (!DecryptBlock(
+                    pabyWB + iSector * poHeader->nSectorSize,
+                    nSectorOffset +
+                        static_cast<vsi_l_offset>(iSector) *
+                            poHeader->nSectorSize))
+            {
+                bDecryptError = true;
+                break;
+            }
+        }
+        if (bDecryptError)
         {
             bError = true;
             break;
@@ -1119,7 +1162,7 @@ size_t VSICryptFileHandle::Read(void *pBuffer, size_t const nBytes)
                        poHeader->nPayloadFileSize);
         }
         nWBOffset = nSectorOffset;
-        nWBSize = poHeader->nSectorSize;
+        nWBSize = static_cast<int>(nSectorsRead * poHeader->nSectorSize);
     }
 
     size_t nRet = nBytes - nToRead;
@@ -24,6 +24,8 @@
 #include <string_view>
 
 #include "cpl_aws.h"
+#include "cpl_md5.h"
+#include "cpl_trace.h"
 #include "cpl_json.h"
 #include "cpl_json_header.h"
 #include "cpl_minixml.h"
@@ -2141,6 +2143,9 @@ void VSICurlFilesystemHandlerBase::NotifyStopDownloadRegion(
 std::string VSICurlHandle::DownloadRegion(const vsi_l_offset startOffset,
                                           const int nBlocks)
 {
+    CPLTraceSpan oTraceSpan(
+        "VSICurlHandle::DownloadRegion", "curl",
+        static_cast<GUIntBig>(nBlocks) * VSICURLGetDownloadChunkSize());
     if (bInterrupted && bStopOnInterruptUntilUninstall)
         return std::string();
 
@@ -2585,6 +2590,11 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
              static_cast<int>(curOffset), static_cast<int>(nBufferRequestSize));
 #endif
 
+    if (curOffset != 0 && curOffset == m_nExpectedNextReadOffset)
+        ++m_nSequentialReadCount;
+    else
+        m_nSequentialReadCount = 0;
+
     vsi_l_offset iterOffset = curOffset;
     const int knMAX_REGIONS = GetMaxRegions();
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
@@ -2604,6 +2614,50 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
             break;
         }
 
+        // Serve from a window fetched asynchronously by AdviseRead() (in
+        // particular by the sequential readahead below), waiting for its
+        // completion if the download is still in flight.
+        if (!m_aoAdviseReadRanges.empty())
+        {
+            bool bFoundInAdviseRead = false;
+            for (auto &poRange : m_aoAdviseReadRanges)
+            {
+                if (iterOffset >= poRange->nStartOffset &&
+                    iterOffset < poRange->nStartOffset + poRange->nSize)
+                {
+                    {
+                        std::unique_lock<std::mutex> oLock(poRange->oMutex);
+                        // coverity[missing_lock:FALSE]
+                        while (!poRange->bDone)
+                        {
+                            poRange->oCV.wait(oLock);
+                        }
+                    }
+                    if (poRange->abyData.empty())
+                        break;
+                    const auto nRangeEndOffset =
+                        poRange->nStartOffset + poRange->abyData.size();
+                    if (iterOffset >= nRangeEndOffset)
+                        break;
+                    const size_t nToCopyFromRange =
+                        static_cast<size_t>(std::min<vsi_l_offset>(
+                            nBufferRequestSize, nRangeEndOffset - iterOffset));
+                    memcpy(pBuffer,
+                           poRange->abyData.data() +
+                               static_cast<size_t>(iterOffset -
+                                                   poRange->nStartOffset),
+                           nToCopyFromRange);
+                    pBuffer = static_cast<char *>(pBuffer) + nToCopyFromRange;
+                    iterOffset += nToCopyFromRange;
+                    nBufferRequestSize -= nToCopyFromRange;
+                    bFoundInAdviseRead = true;
+                    break;
+                }
+            }
+            if (bFoundInAdviseRead)
+                continue;
+        }
+
         const vsi_l_offset nOffsetToDownload =
             (iterOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
         std::string osRegion;
@@ -2705,6 +2759,50 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
         bEOF = true;
 
     curOffset = iterOffset;
+    m_nExpectedNextReadOffset = curOffset;
+
+    // Adaptive sequential readahead: once the access pattern is clearly
+    // sequential and the previous window (if any) is exhausted, issue the
+    // next one asynchronously through AdviseRead(), doubling its size up
+    // to CPL_VSIL_CURL_READAHEAD_MAX_SIZE. The download proceeds while the
+    // caller processes the bytes just returned, so bulk sequential
+    // consumers do not stall waiting for the next chunk.
+    if (ret > 0 && !bEOF && m_nSequentialReadCount >= 2 &&
+        curOffset >= m_nReadAheadStart + m_nReadAheadSize &&
+        CPLTestBool(
+            CPLGetConfigOption("CPL_VSIL_CURL_ADAPTIVE_READAHEAD", "NO")))
+    {
+        const GIntBig nMaxSize = std::strtoll(
+            CPLGetConfigOption("CPL_VSIL_CURL_READAHEAD_MAX_SIZE",
+                               "16777216"),
+            nullptr, 10);
+        vsi_l_offset nWindowSize =
+            m_nReadAheadSize == 0
+                ? static_cast<vsi_l_offset>(4) * knDOWNLOAD_CHUNK_SIZE
+                : m_nReadAheadSize * 2;
+        if (nMaxSize > 0 &&
+            nWindowSize > static_cast<vsi_l_offset>(nMaxSize))
+            nWindowSize = static_cast<vsi_l_offset>(nMaxSize);
+
+        vsi_l_offset nWindowStart = curOffset;
+        poFS->GetCachedFileProp(m_pszURL, oFileProp);
+        if (oFileProp.bHasComputedFileSize)
+        {
+            if (nWindowStart >= oFileProp.fileSize)
+                nWindowSize = 0;
+            else
+                nWindowSize = std::min<vsi_l_offset>(
+                    nWindowSize, oFileProp.fileSize - nWindowStart);
+        }
+
+        if (nWindowSize > 0)
+        {
+            m_nReadAheadStart = nWindowStart;
+            m_nReadAheadSize = nWindowSize;
+            const size_t nAdviseSize = static_cast<size_t>(nWindowSize);
+            AdviseRead(1, &nWindowStart, &nAdviseSize);
+        }
+    }
 
     return ret;
 }
@@ -3640,6 +3738,41 @@ static CURLM *VSICURLMultiInit()
                           atoi(pszMAX_TOTAL_CONNECTIONS));
     }
 
+    // Budget of connections to a single host: combined with HTTP/2
+    // multiplexing below, this lets many outstanding range requests be
+    // spread over a bounded set of connections per server.
+    if (const char *pszMAX_HOST_CONNECTIONS =
+            CPLGetConfigOption("GDAL_HTTP_MAX_HOST_CONNECTIONS", nullptr))
+    {
+        curl_multi_setopt(hCurlMultiHandle, CURLMOPT_MAX_HOST_CONNECTIONS,
+                          atoi(pszMAX_HOST_CONNECTIONS));
+    }
+
+#if CURL_AT_LEAST_VERSION(7, 67, 0)
+    // Cap of concurrent streams multiplexed over one HTTP/2 connection:
+    // when reached, curl opens an extra connection (within the above
+    // budgets) instead of queuing, which is what allows several
+    // connections-worth of bandwidth on large AdviseRead()/prefetch
+    // bursts.
+    if (const char *pszMAX_CONCURRENT_STREAMS =
+            CPLGetConfigOption("GDAL_HTTP_MAX_CONCURRENT_STREAMS", nullptr))
+    {
+        curl_multi_setopt(hCurlMultiHandle, CURLMOPT_MAX_CONCURRENT_STREAMS,
+                          atoi(pszMAX_CONCURRENT_STREAMS));
+    }
+#endif
+
+#ifdef CURLPIPE_MULTIPLEX
+    // Enable HTTP/2 multiplexing on every multi handle (and not only the
+    // AdviseRead() one), so that parallel range requests going through the
+    // per-thread connection cache share connections too.
+    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+    {
+        curl_multi_setopt(hCurlMultiHandle, CURLMOPT_PIPELINING,
+                          CURLPIPE_MULTIPLEX);
+    }
+#endif
+
     return hCurlMultiHandle;
 }
 
@@ -4232,6 +4365,160 @@ CURLM *VSICurlFilesystemHandlerBase::GetCurlMultiHandleFor(
     return conn.hCurlMultiHandle;
 }
 
+/************************************************************************/
+/*                      Disk cache tier helpers                         */
+/*                                                                      */
+/*      When CPL_VSIL_CURL_DISK_CACHE_DIR points to a directory, the    */
+/*      regions downloaded by ranged GETs are also stored on disk, so   */
+/*      that short-lived processes re-reading the same headers and      */
+/*      tiles are served locally. Entries are expired after             */
+/*      CPL_VSIL_CURL_DISK_CACHE_TTL seconds (default: one day), and    */
+/*      the directory is pruned to CPL_VSIL_CURL_DISK_CACHE_SIZE        */
+/*      bytes (default: 1 GB). Atomicity relies on write-to-temporary   */
+/*      plus rename, which is safe for concurrent readers and writers   */
+/*      without advisory locks.                                         */
+/************************************************************************/
+
+static std::string VSICurlGetDiskCacheDir()
+{
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    return pszDir ? std::string(pszDir) : std::string();
+}
+
+static std::string VSICurlGetDiskCachePath(const std::string &osDir,
+                                           const char *pszURL,
+                                           vsi_l_offset nOffset)
+{
+    std::string osEntry(CPLMD5String(pszURL));
+    osEntry.append("_")
+        .append(std::to_string(nOffset))
+        .append("_")
+        .append(std::to_string(VSICURLGetDownloadChunkSize()))
+        .append(".bin");
+    return CPLFormFilenameSafe(osDir.c_str(), osEntry.c_str(), nullptr);
+}
+
+static bool VSICurlReadFromDiskCache(const std::string &osDir,
+                                     const char *pszURL, vsi_l_offset nOffset,
+                                     std::string &osData)
+{
+    const std::string osPath = VSICurlGetDiskCachePath(osDir, pszURL, nOffset);
+    VSIStatBufL sStat;
+    if (VSIStatL(osPath.c_str(), &sStat) != 0)
+        return false;
+
+    const GIntBig nTTL = std::strtoll(
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_TTL", "86400"), nullptr,
+        10);
+    if (nTTL > 0 &&
+        static_cast<GIntBig>(time(nullptr)) - static_cast<GIntBig>(sStat.st_mtime) > nTTL)
+    {
+        VSIUnlink(osPath.c_str());
+        return false;
+    }
+
+    VSILFILE *fp = VSIFOpenL(osPath.c_str(), "rb");
+    if (fp == nullptr)
+        return false;
+    bool bOK = false;
+    try
+    {
+        osData.resize(static_cast<size_t>(sStat.st_size));
+        bOK = VSIFReadL(&osData[0], 1, osData.size(), fp) == osData.size();
+    }
+    catch (const std::exception &)
+    {
+    }
+    CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+    return bOK;
+}
+
+static void VSICurlPruneDiskCache(const std::string &osDir)
+{
+    GIntBig nMaxSize = std::strtoll(
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", "1073741824"),
+        nullptr, 10);
+    if (nMaxSize <= 0)
+        return;
+
+    struct Entry
+    {
+        std::string osPath{};
+        GIntBig nMTime = 0;
+        GIntBig nSize = 0;
+    };
+
+    std::vector<Entry> aoEntries;
+    GIntBig nTotalSize = 0;
+    char **papszFiles = VSIReadDir(osDir.c_str());
+    for (int i = 0; papszFiles && papszFiles[i]; ++i)
+    {
+        if (!strstr(papszFiles[i], ".bin"))
+            continue;
+        Entry sEntry;
+        sEntry.osPath =
+            CPLFormFilenameSafe(osDir.c_str(), papszFiles[i], nullptr);
+        VSIStatBufL sStat;
+        if (VSIStatL(sEntry.osPath.c_str(), &sStat) != 0)
+            continue;
+        sEntry.nMTime = static_cast<GIntBig>(sStat.st_mtime);
+        sEntry.nSize = static_cast<GIntBig>(sStat.st_size);
+        nTotalSize += sEntry.nSize;
+        aoEntries.emplace_back(std::move(sEntry));
+    }
+    CSLDestroy(papszFiles);
+
+    if (nTotalSize > nMaxSize)
+    {
+        std::sort(aoEntries.begin(), aoEntries.end(),
+                  [](const Entry &a, const Entry &b)
+                  { return a.nMTime < b.nMTime; });
+        for (const auto &sEntry : aoEntries)
+        {
+            if (nTotalSize <= nMaxSize)
+                break;
+            if (VSIUnlink(sEntry.osPath.c_str()) == 0)
+                nTotalSize -= sEntry.nSize;
+        }
+    }
+}
+
+static void VSICurlWriteToDiskCache(const std::string &osDir,
+                                    const char *pszURL, vsi_l_offset nOffset,
+                                    const char *pData, size_t nSize)
+{
+    const std::string osPath = VSICurlGetDiskCachePath(osDir, pszURL, nOffset);
+    std::string osTmpPath(osPath);
+    osTmpPath.append(".tmp_")
+        .append(std::to_string(CPLGetCurrentProcessID()))
+        .append("_")
+        .append(std::to_string(CPLGetPID()));
+
+    VSILFILE *fp = VSIFOpenL(osTmpPath.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        // Maybe the directory is missing
+        VSIMkdirRecursive(osDir.c_str(), 0755);
+        fp = VSIFOpenL(osTmpPath.c_str(), "wb");
+        if (fp == nullptr)
+            return;
+    }
+    const bool bOK = VSIFWriteL(pData, 1, nSize, fp) == nSize;
+    if (VSIFCloseL(fp) != 0 || !bOK)
+    {
+        VSIUnlink(osTmpPath.c_str());
+        return;
+    }
+    if (VSIRename(osTmpPath.c_str(), osPath.c_str()) != 0)
+        VSIUnlink(osTmpPath.c_str());
+
+    // Prune the cache directory from time to time.
+    static std::atomic<int> nWriteCounter{0};
+    if ((nWriteCounter.fetch_add(1) % 256) == 255)
+        VSICurlPruneDiskCache(osDir);
+}
+
 /************************************************************************/
 /*                           GetRegionCache()                           */
 /************************************************************************/
@@ -4239,12 +4526,12 @@ CURLM *VSICurlFilesystemHandlerBase::GetCurlMultiHandleFor(
 VSICurlFilesystemHandlerBase::RegionCacheType *
 VSICurlFilesystemHandlerBase::GetRegionCache()
 {
-    // should be called under hMutex taken
-    if (m_poRegionCacheDoNotUseDirectly == nullptr)
-    {
-        m_poRegionCacheDoNotUseDirectly.reset(
-            new RegionCacheType(static_cast<size_t>(GetMaxRegions())));
-    }
+    std::call_once(m_oRegionCacheOnceFlag,
+                   [this]()
+                   {
+                       m_poRegionCacheDoNotUseDirectly.reset(new RegionCacheType(
+                           static_cast<size_t>(GetMaxRegions())));
+                   });
     return m_poRegionCacheDoNotUseDirectly.get();
 }
 
@@ -4256,8 +4543,8 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
                                         vsi_l_offset nFileOffsetStart)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
+    // The region cache is itself thread-safe (sharded with per-shard
+    // locks): no need for hMutex here.
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
@@ -4269,6 +4556,20 @@ VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
         return out;
     }
 
+    const std::string osDiskCacheDir = VSICurlGetDiskCacheDir();
+    if (!osDiskCacheDir.empty())
+    {
+        auto poData = std::make_shared<std::string>();
+        if (VSICurlReadFromDiskCache(osDiskCacheDir, pszURL, nFileOffsetStart,
+                                     *poData))
+        {
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+                poData);
+            return poData;
+        }
+    }
+
     return nullptr;
 }
 
@@ -4280,13 +4581,16 @@ void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
                                              size_t nSize, const char *pData)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     auto value = std::make_shared<std::string>();
     value->assign(pData, nSize);
     GetRegionCache()->insert(
         FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
         std::move(value));
+
+    const std::string osDiskCacheDir = VSICurlGetDiskCacheDir();
+    if (!osDiskCacheDir.empty())
+        VSICurlWriteToDiskCache(osDiskCacheDir, pszURL, nFileOffsetStart,
+                                pData, nSize);
 }
 
 /************************************************************************/
@@ -4763,8 +5067,11 @@ VSICurlFilesystemHandlerBase::Open(const char *pszFilename,
     }
 
     if (CPLTestBool(CPLGetConfigOption("VSI_CACHE", "FALSE")))
-        return VSIVirtualHandleUniquePtr(
-            VSICreateCachedFile(poHandle.release()));
+        return VSIVirtualHandleUniquePtr(VSICreateCachedFile(
+            poHandle.release(), VSI_CACHED_DEFAULT_CHUNK_SIZE, 0,
+            CPLTestBool(CPLGetConfigOption("VSI_CACHE_SHARED", "NO"))
+                ? pszFilename
+                : nullptr));
     else
         return VSIVirtualHandleUniquePtr(poHandle.release());
 }
@@ -24,6 +24,7 @@
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_mem_cache.h"
 #include "cpl_multiproc.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "cpl_curl_priv.h"
 
@@ -170,14 +171,18 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
         }
     };
 
-    using RegionCacheType = lru11::Cache<
-        FilenameOffsetPair, std::shared_ptr<std::string>, lru11::NullLock,
+    // Sharded so that concurrent downloader threads do not serialize on a
+    // single lock for the 16KB-region cache.
+    using RegionCacheType = lru11::ShardedCache<
+        FilenameOffsetPair, std::shared_ptr<std::string>, std::mutex,
         std::unordered_map<
             FilenameOffsetPair,
             typename std::list<lru11::KeyValuePair<
                 FilenameOffsetPair, std::shared_ptr<std::string>>>::iterator,
-            FilenameOffsetPairHasher>>;
+            FilenameOffsetPairHasher>,
+        FilenameOffsetPairHasher>;
 
+    std::once_flag m_oRegionCacheOnceFlag{};
     std::unique_ptr<RegionCacheType>
         m_poRegionCacheDoNotUseDirectly{};  // do not access directly. Use
                                             // GetRegionCache();
@@ -368,6 +373,12 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
     vsi_l_offset lastDownloadedOffset = VSI_L_OFFSET_MAX;
     int nBlocksToDownload = 1;
 
+    // Adaptive sequential readahead state machine (see Read())
+    vsi_l_offset m_nExpectedNextReadOffset = 0;
+    int m_nSequentialReadCount = 0;
+    vsi_l_offset m_nReadAheadStart = 0;
+    vsi_l_offset m_nReadAheadSize = 0;
+
     bool bStopOnInterruptUntilUninstall = false;
     bool bInterrupted = false;
     VSICurlReadCbkFunc pfnReadCbk = nullptr;
@@ -601,6 +612,9 @@ class IVSIS3LikeFSHandler /* non final */
 {
     CPL_DISALLOW_COPY_ASSIGN(IVSIS3LikeFSHandler)
 
+    // For CreateHandleHelper(), used by the parallel part upload workers
+    friend class VSIMultipartWriteHandle;
+
     virtual int MkdirInternal(const char *pszDirname, long nMode,
                               bool bDoStatCheck);
 
@@ -841,9 +855,24 @@ class VSIMultipartWriteHandle final : public VSIVirtualHandle
     std::vector<std::string> m_aosEtags{};
     bool m_bError = false;
 
+    // Parallel part upload machinery, engaged when
+    // CPL_VSIL_PARALLEL_PART_UPLOADS > 1: full part buffers are handed to
+    // a worker pool, and writing continues into a recycled (or new)
+    // buffer, so compression and network transfer overlap.
+    int m_nMaxInFlightParts = 1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poUploadPool{};
+    std::mutex m_oUploadMutex{};
+    std::condition_variable m_oUploadCV{};
+    int m_nInFlightParts = 0;
+    bool m_bAsyncUploadError = false;
+    std::vector<GByte *> m_apabyFreeBuffers{};
+    std::map<int, std::string> m_oMapPartNumberToEtag{};
+
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
     bool UploadPart();
+    bool DispatchPartUpload();
+    bool WaitForPartUploadsCompletion();
     bool DoSinglePartPUT();
 
     void InvalidateParentDirectory();
@@ -178,6 +178,15 @@ class VSIGZipHandle final : public VSIVirtualHandle
     vsi_l_offset snapshot_byte_interval =
         0; /* number of compressed bytes at which we create a "snapshot" */
 
+    /* Persisted seek index (.gzidx sidecar): absolute offsets of the
+     * full-flush points written every m_nSeekIndexChunkSize uncompressed
+     * bytes (first entry is for uncompressed offset m_nSeekIndexChunkSize) */
+    std::vector<vsi_l_offset> m_anSeekIndexOffsets{};
+    vsi_l_offset m_nSeekIndexChunkSize = 0;
+    bool m_bSeekIndexJumpUsed = false;
+
+    void LoadSeekIndex();
+
     void check_header();
     int get_byte();
     bool gzseek(vsi_l_offset nOffset, int nWhence);
@@ -519,7 +528,91 @@ VSIGZipHandle::VSIGZipHandle(VSIVirtualHandleUniquePtr poBaseHandleIn,
         snapshots = static_cast<GZipSnapshot *>(CPLCalloc(
             sizeof(GZipSnapshot),
             static_cast<size_t>(compressed_size / snapshot_byte_interval + 1)));
+
+        if (offset == 0)
+            LoadSeekIndex();
+    }
+}
+
+/************************************************************************/
+/*                           LoadSeekIndex()                            */
+/************************************************************************/
+
+/* Load the ".gzidx" sidecar possibly next to the .gz file, which records
+ * the positions of the full-flush points created by the multi-threaded
+ * writer, so that random access does not require decompressing from the
+ * start of the file. */
+void VSIGZipHandle::LoadSeekIndex()
+{
+    if (m_pszBaseFileName == nullptr ||
+        !CPLTestBool(
+            CPLGetConfigOption("CPL_VSIL_GZIP_USE_SEEK_INDEX", "YES")))
+        return;
+
+    const std::string osIdxFilename =
+        std::string(m_pszBaseFileName).append(".gzidx");
+    VSIStatBufL sIdxStat;
+    if (VSIStatL(osIdxFilename.c_str(), &sIdxStat) != 0)
+        return;
+
+    // Reject an index older than the .gz file itself
+    VSIStatBufL sGZStat;
+    if (VSIStatL(m_pszBaseFileName, &sGZStat) == 0 &&
+        sIdxStat.st_mtime < sGZStat.st_mtime)
+    {
+        CPLDebug("GZIP", "Ignoring outdated seek index %s",
+                 osIdxFilename.c_str());
+        return;
+    }
+
+    VSILFILE *fp = VSIFOpenL(osIdxFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return;
+
+    const auto ReadUInt64 = [fp](uint64_t &nVal)
+    {
+        if (VSIFReadL(&nVal, 1, sizeof(nVal), fp) != sizeof(nVal))
+            return false;
+        CPL_LSBPTR64(&nVal);
+        return true;
+    };
+
+    char szMagic[8] = {};
+    uint64_t nChunkSize = 0;
+    uint64_t nUncompressedSize = 0;
+    uint64_t nCount = 0;
+    bool bOK = VSIFReadL(szMagic, 1, sizeof(szMagic), fp) == sizeof(szMagic) &&
+               memcmp(szMagic, "GZIDX001", 8) == 0 && ReadUInt64(nChunkSize) &&
+               ReadUInt64(nUncompressedSize) && ReadUInt64(nCount) &&
+               nChunkSize > 0 && nCount < 100 * 1024 * 1024;
+    if (bOK)
+    {
+        std::vector<vsi_l_offset> anOffsets;
+        vsi_l_offset nLastOffset = 0;
+        for (uint64_t i = 0; bOK && i < nCount; ++i)
+        {
+            uint64_t nOffset = 0;
+            bOK = ReadUInt64(nOffset) && nOffset > nLastOffset &&
+                  nOffset < m_compressed_size;
+            if (bOK)
+            {
+                nLastOffset = nOffset;
+                anOffsets.push_back(static_cast<vsi_l_offset>(nOffset));
+            }
+        }
+        if (bOK)
+        {
+            m_anSeekIndexOffsets = std::move(anOffsets);
+            m_nSeekIndexChunkSize = static_cast<vsi_l_offset>(nChunkSize);
+            if (m_uncompressed_size == 0)
+                m_uncompressed_size =
+                    static_cast<vsi_l_offset>(nUncompressedSize);
+            CPLDebug("GZIP", "Using seek index %s (%u points)",
+                     osIdxFilename.c_str(),
+                     static_cast<unsigned>(m_anSeekIndexOffsets.size()));
+        }
     }
+    CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
 }
 
 /************************************************************************/
@@ -860,6 +953,41 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         return false;
     }
 
+    // Use the persisted seek index, if any, to jump right before the
+    // target instead of decompressing everything in-between.
+    if (!m_anSeekIndexOffsets.empty() && m_nSeekIndexChunkSize > 0)
+    {
+        const vsi_l_offset nTarget = out + offset;
+        vsi_l_offset iPoint = nTarget / m_nSeekIndexChunkSize;
+        if (iPoint > m_anSeekIndexOffsets.size())
+            iPoint = m_anSeekIndexOffsets.size();
+        if (iPoint >= 1)
+        {
+            const vsi_l_offset nPointOut = iPoint * m_nSeekIndexChunkSize;
+            if (nPointOut > out)
+            {
+                if (m_poBaseHandle->Seek(m_anSeekIndexOffsets[iPoint - 1],
+                                         SEEK_SET) != 0)
+                {
+                    CPLError(CE_Failure, CPLE_FileIO, "Seek() failed");
+                    CPL_VSIL_GZ_RETURN(FALSE);
+                    return false;
+                }
+                // The writer issued a full flush at that point: raw
+                // inflate can restart from scratch.
+                inflateReset(&stream);
+                stream.avail_in = 0;
+                stream.next_in = inbuf;
+                // The running CRC can no longer be checked at stream end.
+                m_bSeekIndexJumpUsed = true;
+                crc = 0;
+                in = m_anSeekIndexOffsets[iPoint - 1] - startOff;
+                out = nPointOut;
+                offset = nTarget - nPointOut;
+            }
+        }
+    }
+
     for (unsigned int i = 0; i < m_compressed_size / snapshot_byte_interval + 1;
          i++)
     {
@@ -1165,7 +1293,23 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nBytes)
                          static_cast<unsigned int>(m_expected_crc));
 #endif
             }
-            if (m_expected_crc != 0 && m_expected_crc != crc)
+            if (m_bSeekIndexJumpUsed)
+            {
+                // The running CRC is meaningless since we jumped into the
+                // middle of the stream: just consume the trailer.
+                if (m_expected_crc == 0)
+                {
+                    CPL_IGNORE_RET_VAL(getLong());
+                    CPL_IGNORE_RET_VAL(getLong());
+                    check_header();
+                    if (z_err == Z_OK)
+                    {
+                        inflateReset(&(stream));
+                        crc = 0;
+                    }
+                }
+            }
+            else if (m_expected_crc != 0 && m_expected_crc != crc)
             {
                 CPLError(CE_Failure, CPLE_FileIO,
                          "CRC error. Got %X instead of %X",
@@ -2762,6 +2906,121 @@ VSIVirtualHandle *VSICreateGZipWritable(VSIVirtualHandle *poBaseHandle,
                                   bAutoCloseBaseHandle);
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                  VSIGZipWriteHandleWithSeekIndex                     */
+/* ==================================================================== */
+/************************************************************************/
+
+/** Wrapper over the multi-threaded gzip writer that records the full-flush
+ * points it creates (one every chunk) and persists them in a ".gzidx"
+ * sidecar on Close(), for later fast random access by VSIGZipHandle. */
+class VSIGZipWriteHandleWithSeekIndex final : public VSIVirtualHandle
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIGZipWriteHandleWithSeekIndex)
+
+    std::string m_osSideCarFilename;
+    std::vector<uint8_t> m_abyIndex{};
+    VSIVirtualHandleUniquePtr m_poUnderlying{};
+    size_t m_nChunkSize;
+    vsi_l_offset m_nUncompressedSize = 0;
+    bool m_bClosed = false;
+
+  public:
+    VSIGZipWriteHandleWithSeekIndex(const char *pszFilename,
+                                    VSIVirtualHandle *poBaseHandle,
+                                    int nDeflateType, size_t nChunkSize)
+        : m_osSideCarFilename(std::string(pszFilename).append(".gzidx")),
+          m_nChunkSize(nChunkSize)
+    {
+        m_poUnderlying.reset(new VSIGZipWriteHandleMT(
+            poBaseHandle, nDeflateType, /* bAutoCloseBaseHandle = */ true,
+            /* nThreads = */ 0, nChunkSize, /* nSOZIPIndexEltSize = */ 8,
+            &m_abyIndex));
+    }
+
+    ~VSIGZipWriteHandleWithSeekIndex() override
+    {
+        VSIGZipWriteHandleWithSeekIndex::Close();
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override
+    {
+        return m_poUnderlying->Seek(nOffset, nWhence);
+    }
+
+    vsi_l_offset Tell() override
+    {
+        return m_poUnderlying->Tell();
+    }
+
+    size_t Read(void *pBuffer, size_t nBytes) override
+    {
+        return m_poUnderlying->Read(pBuffer, nBytes);
+    }
+
+    size_t Write(const void *pBuffer, size_t nBytes) override
+    {
+        const size_t nRet = m_poUnderlying->Write(pBuffer, nBytes);
+        m_nUncompressedSize += nRet;
+        return nRet;
+    }
+
+    int Eof() override
+    {
+        return m_poUnderlying->Eof();
+    }
+
+    int Error() override
+    {
+        return m_poUnderlying->Error();
+    }
+
+    void ClearErr() override
+    {
+        m_poUnderlying->ClearErr();
+    }
+
+    int Flush() override
+    {
+        return m_poUnderlying->Flush();
+    }
+
+    int Close() override
+    {
+        if (m_bClosed)
+            return 0;
+        m_bClosed = true;
+        const int nRet = m_poUnderlying->Close();
+        if (nRet == 0 && (m_abyIndex.size() % 8) == 0)
+        {
+            VSILFILE *fp = VSIFOpenL(m_osSideCarFilename.c_str(), "wb");
+            if (fp != nullptr)
+            {
+                const auto WriteUInt64 = [fp](uint64_t nVal)
+                {
+                    CPL_LSBPTR64(&nVal);
+                    CPL_IGNORE_RET_VAL(
+                        VSIFWriteL(&nVal, 1, sizeof(nVal), fp));
+                };
+                CPL_IGNORE_RET_VAL(VSIFWriteL("GZIDX001", 1, 8, fp));
+                WriteUInt64(m_nChunkSize);
+                WriteUInt64(m_nUncompressedSize);
+                WriteUInt64(m_abyIndex.size() / 8);
+                // The index entries are already uint64 little-endian
+                if (!m_abyIndex.empty())
+                {
+                    CPL_IGNORE_RET_VAL(VSIFWriteL(
+                        m_abyIndex.data(), 1, m_abyIndex.size(), fp));
+                }
+                if (VSIFCloseL(fp) != 0)
+                    VSIUnlink(m_osSideCarFilename.c_str());
+            }
+        }
+        return nRet;
+    }
+};
+
 /************************************************************************/
 /*                        ~VSIGZipWriteHandle()                         */
 /************************************************************************/
@@ -3037,6 +3296,17 @@ VSIGZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
         if (poVirtualHandle == nullptr)
             return nullptr;
 
+        if (CPLTestBool(
+                CPLGetConfigOption("CPL_VSIL_GZIP_WRITE_SEEK_INDEX", "NO")))
+        {
+            return VSIVirtualHandleUniquePtr(
+                new VSIGZipWriteHandleWithSeekIndex(
+                    pszFilename + strlen("/vsigzip/"),
+                    poVirtualHandle.release(),
+                    strchr(pszAccess, 'z') != nullptr,
+                    /* nChunkSize = */ 1024 * 1024));
+        }
+
         return VSIVirtualHandleUniquePtr(
             VSICreateGZipWritable(poVirtualHandle.release(),
                                   strchr(pszAccess, 'z') != nullptr, TRUE));
@@ -3547,6 +3817,36 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     const char *GetOptions() override;
 
     void RemoveFromMap(VSIZipWriteHandle *poHandle);
+
+    bool SerializeFileOffset(const VSIArchiveEntryFileOffset *pOffset,
+                             std::vector<GByte> &abyData) const override
+    {
+        const auto *poZipOffset =
+            static_cast<const VSIZipEntryFileOffset *>(pOffset);
+        const GUIntBig anVals[2] = {
+            static_cast<GUIntBig>(
+                poZipOffset->m_file_pos.pos_in_zip_directory),
+            static_cast<GUIntBig>(poZipOffset->m_file_pos.num_of_file)};
+        abyData.resize(sizeof(anVals));
+        memcpy(abyData.data(), anVals, sizeof(anVals));
+        return true;
+    }
+
+    std::unique_ptr<VSIArchiveEntryFileOffset>
+    DeserializeFileOffset(const GByte *pabyData, size_t nSize) const override
+    {
+        GUIntBig anVals[2];
+        if (nSize != sizeof(anVals))
+            return nullptr;
+        memcpy(anVals, pabyData, sizeof(anVals));
+        unz_file_pos sPos;
+        sPos.pos_in_zip_directory = static_cast<uLong>(anVals[0]);
+        sPos.num_of_file = static_cast<uLong>(anVals[1]);
+        if (static_cast<GUIntBig>(sPos.pos_in_zip_directory) != anVals[0] ||
+            static_cast<GUIntBig>(sPos.num_of_file) != anVals[1])
+            return nullptr;
+        return std::make_unique<VSIZipEntryFileOffset>(sPos);
+    }
 };
 
 /************************************************************************/
@@ -912,6 +912,9 @@ VSIMultipartWriteHandle::VSIMultipartWriteHandle(
                  "Cannot allocate working buffer for %s",
                  m_poFS->GetFSPrefix().c_str());
     }
+
+    m_nMaxInFlightParts = std::max(
+        1, atoi(CPLGetConfigOption("CPL_VSIL_PARALLEL_PART_UPLOADS", "1")));
 }
 
 /************************************************************************/
@@ -982,8 +985,12 @@ size_t IVSIS3LikeFSHandlerWithMultipartUpload::GetUploadChunkSizeInBytes(
 VSIMultipartWriteHandle::~VSIMultipartWriteHandle()
 {
     VSIMultipartWriteHandle::Close();
+    // Join the upload workers before freeing the buffers they may use
+    m_poUploadPool.reset();
     delete m_poS3HandleHelper;
     CPLFree(m_pabyBuffer);
+    for (GByte *pabyBuffer : m_apabyFreeBuffers)
+        CPLFree(pabyBuffer);
     CPLFree(m_sWriteFuncHeaderData.pBuffer);
 }
 
@@ -1164,6 +1171,148 @@ bool VSIMultipartWriteHandle::UploadPart()
     return !osEtag.empty();
 }
 
+/************************************************************************/
+/*                        DispatchPartUpload()                          */
+/************************************************************************/
+
+bool VSIMultipartWriteHandle::DispatchPartUpload()
+{
+    if (m_nMaxInFlightParts <= 1)
+        return UploadPart();
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oUploadMutex);
+        if (m_bAsyncUploadError)
+            return false;
+    }
+
+    ++m_nPartNumber;
+    if (m_nPartNumber > m_poFS->GetMaximumPartCount())
+    {
+        m_bError = true;
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "%d parts have been uploaded for %s failed. "
+                 "This is the maximum. "
+                 "Increase VSI%s_CHUNK_SIZE to a higher value (e.g. 500 for "
+                 "500 MiB)",
+                 m_poFS->GetMaximumPartCount(), m_osFilename.c_str(),
+                 m_poFS->GetDebugKey());
+        return false;
+    }
+
+    if (!m_poUploadPool)
+    {
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poPool->Setup(m_nMaxInFlightParts, nullptr, nullptr))
+        {
+            // Fall back to the synchronous path
+            m_nMaxInFlightParts = 1;
+            --m_nPartNumber;
+            return UploadPart();
+        }
+        m_poUploadPool = std::move(poPool);
+    }
+
+    auto poHelper = std::unique_ptr<IVSIS3LikeHandleHelper>(
+        m_poFS->CreateHandleHelper(
+            m_osFilename.c_str() + m_poFS->GetFSPrefix().size(), false));
+    if (poHelper == nullptr)
+    {
+        m_bError = true;
+        return false;
+    }
+
+    // Detach the full buffer: the worker takes ownership of its content
+    // until it pushes it back to the free list.
+    GByte *pabyPartBuffer = m_pabyBuffer;
+    const size_t nPartSize = m_nBufferOff;
+    const int nPartNumber = m_nPartNumber;
+    m_nBufferOff = 0;
+    m_pabyBuffer = nullptr;
+
+    {
+        std::unique_lock<std::mutex> oLock(m_oUploadMutex);
+        // Bound the number of in-flight parts (and thus of part buffers)
+        m_oUploadCV.wait(oLock, [this]()
+                         { return m_nInFlightParts < m_nMaxInFlightParts; });
+        if (!m_apabyFreeBuffers.empty())
+        {
+            m_pabyBuffer = m_apabyFreeBuffers.back();
+            m_apabyFreeBuffers.pop_back();
+        }
+        ++m_nInFlightParts;
+    }
+    if (m_pabyBuffer == nullptr)
+        m_pabyBuffer = static_cast<GByte *>(VSIMalloc(m_nBufferSize));
+    if (m_pabyBuffer == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffer for %s",
+                 m_poFS->GetFSPrefix().c_str());
+        // Resume writing in the detached buffer once uploaded
+        m_bError = true;
+        m_pabyBuffer = pabyPartBuffer;
+        std::lock_guard<std::mutex> oLock(m_oUploadMutex);
+        --m_nInFlightParts;
+        return false;
+    }
+
+    const bool bSubmitted = m_poUploadPool->SubmitJob(
+        [this, pabyPartBuffer, nPartSize, nPartNumber,
+         poRawHelper = poHelper.release()]()
+        {
+            std::unique_ptr<IVSIS3LikeHandleHelper> poJobHelper(poRawHelper);
+            std::string osEtag = m_poFS->UploadPart(
+                m_osFilename, nPartNumber, m_osUploadID,
+                static_cast<vsi_l_offset>(m_nBufferSize) * (nPartNumber - 1),
+                pabyPartBuffer, nPartSize, poJobHelper.get(),
+                m_oRetryParameters, m_aosOptions.List());
+
+            std::lock_guard<std::mutex> oLock(m_oUploadMutex);
+            if (osEtag.empty())
+                m_bAsyncUploadError = true;
+            else
+                m_oMapPartNumberToEtag[nPartNumber] = std::move(osEtag);
+            m_apabyFreeBuffers.push_back(pabyPartBuffer);
+            --m_nInFlightParts;
+            m_oUploadCV.notify_all();
+        });
+    if (!bSubmitted)
+    {
+        m_bError = true;
+        std::lock_guard<std::mutex> oLock(m_oUploadMutex);
+        m_apabyFreeBuffers.push_back(pabyPartBuffer);
+        --m_nInFlightParts;
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   WaitForPartUploadsCompletion()                     */
+/************************************************************************/
+
+bool VSIMultipartWriteHandle::WaitForPartUploadsCompletion()
+{
+    if (!m_poUploadPool)
+        return true;
+    m_poUploadPool->WaitCompletion();
+
+    std::lock_guard<std::mutex> oLock(m_oUploadMutex);
+    if (m_bAsyncUploadError)
+        return false;
+    // Gather the etags in part order
+    m_aosEtags.clear();
+    for (int i = 1; i <= m_nPartNumber; ++i)
+    {
+        const auto oIter = m_oMapPartNumberToEtag.find(i);
+        if (oIter == m_oMapPartNumberToEtag.end())
+            return false;
+        m_aosEtags.push_back(oIter->second);
+    }
+    return true;
+}
+
 std::string IVSIS3LikeFSHandlerWithMultipartUpload::UploadPart(
     const std::string &osFilename, int nPartNumber,
     const std::string &osUploadID, vsi_l_offset /* nPosition */,
@@ -1314,12 +1463,11 @@ size_t VSIMultipartWriteHandle::Write(const void *pBuffer, size_t nBytes)
                     return 0;
                 }
             }
-            if (!UploadPart())
+            if (!DispatchPartUpload())
             {
                 m_bError = true;
                 return 0;
             }
-            m_nBufferOff = 0;
         }
     }
     return nBytes;
@@ -1863,12 +2011,18 @@ int VSIMultipartWriteHandle::Close()
         {
             if (m_bError)
             {
+                // Join the part upload workers before aborting, so that no
+                // part PUT races with the abort request.
+                if (m_poUploadPool)
+                    m_poUploadPool->WaitCompletion();
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
                                             m_poS3HandleHelper,
                                             m_oRetryParameters))
                     nRet = -1;
             }
-            else if (m_nBufferOff > 0 && !UploadPart())
+            else if (m_nBufferOff > 0 && !DispatchPartUpload())
+                nRet = -1;
+            else if (!WaitForPartUploadsCompletion())
                 nRet = -1;
             else if (m_poFS->CompleteMultipart(
                          m_osFilename, m_osUploadID, m_aosEtags, m_nCurOffset,
@@ -512,6 +512,28 @@ class VSITarFilesystemHandler final : public VSIArchiveFilesystemHandler
     VSIVirtualHandleUniquePtr Open(const char *pszFilename,
                                    const char *pszAccess, bool bSetError,
                                    CSLConstList /* papszOptions */) override;
+
+#ifndef HAVE_FUZZER_FRIENDLY_ARCHIVE
+    bool SerializeFileOffset(const VSIArchiveEntryFileOffset *pOffset,
+                             std::vector<GByte> &abyData) const override
+    {
+        const auto *poTarOffset =
+            static_cast<const VSITarEntryFileOffset *>(pOffset);
+        abyData.resize(sizeof(GUIntBig));
+        memcpy(abyData.data(), &poTarOffset->m_nOffset, sizeof(GUIntBig));
+        return true;
+    }
+
+    std::unique_ptr<VSIArchiveEntryFileOffset>
+    DeserializeFileOffset(const GByte *pabyData, size_t nSize) const override
+    {
+        if (nSize != sizeof(GUIntBig))
+            return nullptr;
+        GUIntBig nOffset = 0;
+        memcpy(&nOffset, pabyData, sizeof(GUIntBig));
+        return std::make_unique<VSITarEntryFileOffset>(nOffset);
+    }
+#endif
 };
 
 /************************************************************************/
@@ -64,6 +64,13 @@
 #ifdef HAVE_PREAD_BSD
 #include <sys/uio.h>
 #endif
+#ifdef HAVE_PREADV
+#include <sys/uio.h>
+#include <climits>
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+#endif
 
 #if defined(__MACH__) && defined(__APPLE__)
 #define HAS_CASE_INSENSITIVE_FILE_SYSTEM
@@ -76,6 +83,7 @@
 #include <array>
 #include <limits>
 #include <new>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -267,6 +275,9 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     int Seek(vsi_l_offset nOffsetIn, int nWhence) override;
     vsi_l_offset Tell() override;
     size_t Read(void *pBuffer, size_t nBytes) override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
     size_t Write(const void *pBuffer, size_t nBytes) override;
     void ClearErr() override;
     int Eof() override;
@@ -672,6 +683,127 @@ size_t VSIUnixStdioHandle::Read(void *pBuffer, size_t nBytes)
     return nBytesRead;
 }
 
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+// Keep in sync prototype between cpl_vsil_uring.cpp and
+// cpl_vsil_unix_stdio_64.cpp
+bool VSIUringReadMultiRange(int fd, int nRanges, void **ppData,
+                            const vsi_l_offset *panOffsets,
+                            const size_t *panSizes);
+
+#ifdef HAVE_PREADV
+
+/************************************************************************/
+/*                  VSIUnixStdioReadMultiRangePreadV()                  */
+/************************************************************************/
+
+/* Service the requests with one preadv() call per run of ranges that are
+ * exactly adjacent in the file (the common layout of scanline gathers),
+ * instead of one seek/read round-trip per range. Returns false on I/O
+ * error, in which case the caller falls back to the generic
+ * implementation. */
+static bool VSIUnixStdioReadMultiRangePreadV(int fd, int nRanges,
+                                             void **ppData,
+                                             const vsi_l_offset *panOffsets,
+                                             const size_t *panSizes)
+{
+    int iRange = 0;
+    while (iRange < nRanges)
+    {
+        if (panSizes[iRange] == 0)
+        {
+            ++iRange;
+            continue;
+        }
+
+        // Collect the run of exactly adjacent ranges starting at iRange.
+        std::vector<struct iovec> aIOV;
+        aIOV.push_back({ppData[iRange], panSizes[iRange]});
+        vsi_l_offset nNextOffset = panOffsets[iRange] + panSizes[iRange];
+        int iLast = iRange;
+        while (iLast + 1 < nRanges && panSizes[iLast + 1] != 0 &&
+               panOffsets[iLast + 1] == nNextOffset &&
+               aIOV.size() < static_cast<size_t>(IOV_MAX))
+        {
+            ++iLast;
+            aIOV.push_back({ppData[iLast], panSizes[iLast]});
+            nNextOffset += panSizes[iLast];
+        }
+
+        off_t nOffset = static_cast<off_t>(panOffsets[iRange]);
+        size_t iIOV = 0;
+        while (iIOV < aIOV.size())
+        {
+            const ssize_t nRead =
+                preadv(fd, aIOV.data() + iIOV,
+                       static_cast<int>(aIOV.size() - iIOV), nOffset);
+            if (nRead <= 0)
+                return false;
+            // Advance past fully and partially filled iovecs.
+            size_t nRemaining = static_cast<size_t>(nRead);
+            nOffset += nRead;
+            while (nRemaining > 0 && iIOV < aIOV.size())
+            {
+                if (nRemaining >= aIOV[iIOV].iov_len)
+                {
+                    nRemaining -= aIOV[iIOV].iov_len;
+                    ++iIOV;
+                }
+                else
+                {
+                    aIOV[iIOV].iov_base =
+                        static_cast<GByte *>(aIOV[iIOV].iov_base) + nRemaining;
+                    aIOV[iIOV].iov_len -= nRemaining;
+                    nRemaining = 0;
+                }
+            }
+        }
+
+        iRange = iLast + 1;
+    }
+
+    return true;
+}
+
+#endif  // HAVE_PREADV
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    // The io_uring and preadv() paths bypass our internal read buffer,
+    // which is only safe when no write can be pending in it.
+    if (nRanges > 1 && eAccessMode == AccessMode::READ_ONLY)
+    {
+        if (CPLTestBool(CPLGetConfigOption("CPL_VSIL_USE_IO_URING", "YES")) &&
+            VSIUringReadMultiRange(fd, nRanges, ppData, panOffsets, panSizes))
+        {
+#ifdef VSI_COUNT_BYTES_READ
+            for (int i = 0; i < nRanges; ++i)
+                nTotalBytesRead += panSizes[i];
+#endif
+            return 0;
+        }
+
+#ifdef HAVE_PREADV
+        if (VSIUnixStdioReadMultiRangePreadV(fd, nRanges, ppData, panOffsets,
+                                             panSizes))
+        {
+#ifdef VSI_COUNT_BYTES_READ
+            for (int i = 0; i < nRanges; ++i)
+                nTotalBytesRead += panSizes[i];
+#endif
+            return 0;
+        }
+#endif
+    }
+
+    return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                            panSizes);
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -998,8 +1130,11 @@ VSIUnixStdioFilesystemHandler::Open(const char *pszFilename,
     if (eAccessMode == AccessMode::READ_ONLY &&
         CPLTestBool(CPLGetConfigOption("VSI_CACHE", "FALSE")))
     {
-        return VSIVirtualHandleUniquePtr(
-            VSICreateCachedFile(poHandle.release()));
+        return VSIVirtualHandleUniquePtr(VSICreateCachedFile(
+            poHandle.release(), VSI_CACHED_DEFAULT_CHUNK_SIZE, 0,
+            CPLTestBool(CPLGetConfigOption("VSI_CACHE_SHARED", "NO"))
+                ? pszFilename
+                : nullptr));
     }
 
     return VSIVirtualHandleUniquePtr(poHandle.release());
@@ -0,0 +1,188 @@
+/**********************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  io_uring backed multi-range reads for local files
+ * Author:   agent <agent@local>
+ *
+ **********************************************************************
+ * Copyright (c) 2026, agent <agent@local>
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_vsi.h"
+
+// Keep in sync prototype between cpl_vsil_uring.cpp and
+// cpl_vsil_unix_stdio_64.cpp
+bool VSIUringReadMultiRange(int fd, int nRanges, void **ppData,
+                            const vsi_l_offset *panOffsets,
+                            const size_t *panSizes);
+
+#if defined(HAVE_LIBURING) && defined(__linux)
+
+#include <algorithm>
+#include <limits>
+
+#include <liburing.h>
+#include <unistd.h>
+
+/************************************************************************/
+/*                          CPLUringContext                             */
+/************************************************************************/
+
+namespace
+{
+/* One submission/completion ring per thread, lazily initialized on first
+ * use, so that concurrent readers do not synchronize with each other. */
+struct CPLUringContext
+{
+    static constexpr unsigned QUEUE_DEPTH = 64;
+
+    struct io_uring ring;
+    bool bInit = false;
+    bool bTriedInit = false;
+
+    bool Init()
+    {
+        if (!bTriedInit)
+        {
+            bTriedInit = true;
+            if (io_uring_queue_init(QUEUE_DEPTH, &ring, 0) == 0)
+            {
+                bInit = true;
+            }
+            else
+            {
+                CPLDebug("VSI",
+                         "io_uring not available: falling back to regular "
+                         "reads");
+            }
+        }
+        return bInit;
+    }
+
+    ~CPLUringContext()
+    {
+        if (bInit)
+            io_uring_queue_exit(&ring);
+    }
+};
+}  // namespace
+
+static thread_local CPLUringContext tlUringContext;
+
+/************************************************************************/
+/*                      VSIUringReadMultiRange()                        */
+/************************************************************************/
+
+/** Service nRanges pread-style requests on fd through io_uring.
+ *
+ * Returns false if io_uring is not available or an I/O error occurred, in
+ * which case the caller is expected to fall back to its regular
+ * ReadMultiRange() implementation (reads are idempotent, so ranges already
+ * filled do not matter).
+ */
+bool VSIUringReadMultiRange(int fd, int nRanges, void **ppData,
+                            const vsi_l_offset *panOffsets,
+                            const size_t *panSizes)
+{
+    CPLUringContext &sCtx = tlUringContext;
+    if (!sCtx.Init())
+        return false;
+
+    bool bOK = true;
+    int iRange = 0;
+    while (bOK && iRange < nRanges)
+    {
+        const int nBatch =
+            std::min(nRanges - iRange,
+                     static_cast<int>(CPLUringContext::QUEUE_DEPTH));
+        int nQueued = 0;
+        for (int i = 0; i < nBatch; ++i)
+        {
+            if (panSizes[iRange + i] == 0)
+                continue;
+            struct io_uring_sqe *psSQE = io_uring_get_sqe(&sCtx.ring);
+            if (psSQE == nullptr)
+            {
+                // Cannot happen given that we cap batches to the queue
+                // depth, but be safe.
+                bOK = false;
+                break;
+            }
+            io_uring_prep_read(
+                psSQE, fd, ppData[iRange + i],
+                static_cast<unsigned>(std::min<size_t>(
+                    panSizes[iRange + i], std::numeric_limits<unsigned>::max())),
+                static_cast<__u64>(panOffsets[iRange + i]));
+            // Not io_uring_sqe_set_data64(), which requires liburing >= 2.2
+            io_uring_sqe_set_data(
+                psSQE, reinterpret_cast<void *>(
+                           static_cast<uintptr_t>(iRange + i)));
+            ++nQueued;
+        }
+
+        if (nQueued > 0 && io_uring_submit(&sCtx.ring) != nQueued)
+        {
+            bOK = false;
+        }
+
+        for (int i = 0; i < nQueued; ++i)
+        {
+            struct io_uring_cqe *psCQE = nullptr;
+            if (io_uring_wait_cqe(&sCtx.ring, &psCQE) != 0)
+            {
+                bOK = false;
+                break;
+            }
+            const int nRes = psCQE->res;
+            const size_t iReq = static_cast<size_t>(
+                reinterpret_cast<uintptr_t>(io_uring_cqe_get_data(psCQE)));
+            io_uring_cqe_seen(&sCtx.ring, psCQE);
+
+            if (nRes < 0)
+            {
+                bOK = false;
+            }
+            else if (static_cast<size_t>(nRes) < panSizes[iReq])
+            {
+                // Short read (rare: signal or very large request):
+                // complete it with pread().
+                size_t nAlreadyRead = static_cast<size_t>(nRes);
+                while (nAlreadyRead < panSizes[iReq])
+                {
+                    const ssize_t nChunk = pread(
+                        fd, static_cast<GByte *>(ppData[iReq]) + nAlreadyRead,
+                        panSizes[iReq] - nAlreadyRead,
+                        static_cast<off_t>(panOffsets[iReq] + nAlreadyRead));
+                    if (nChunk <= 0)
+                    {
+                        bOK = false;
+                        break;
+                    }
+                    nAlreadyRead += static_cast<size_t>(nChunk);
+                }
+            }
+        }
+
+        iRange += nBatch;
+    }
+
+    return bOK;
+}
+
+#else  // !(defined(HAVE_LIBURING) && defined(__linux))
+
+bool VSIUringReadMultiRange(int /* fd */, int /* nRanges */,
+                            void ** /* ppData */,
+                            const vsi_l_offset * /* panOffsets */,
+                            const size_t * /* panSizes */)
+{
+    return false;
+}
+
+#endif  // defined(HAVE_LIBURING) && defined(__linux)
@@ -119,19 +119,26 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
  *
  * @param pfnFunc Function to run for the job.
  * @param pData User data to pass to the job function.
+ * @param ePriority Priority of the job.
  * @return true in case of success.
  */
-bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
+bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData,
+                                    CPLWorkerJobPriority ePriority)
 {
-    return SubmitJob([=] { pfnFunc(pData); });
+    return SubmitJob([=] { pfnFunc(pData); }, ePriority);
 }
 
 /** Queue a new job.
  *
  * @param task  Void function to execute.
+ * @param ePriority Priority of the job. High-priority jobs are handed to
+ *                  workers before any pending normal-priority job, so that
+ *                  latency-critical work (e.g. interactive tile decoding) is
+ *                  not stuck behind bulk jobs sharing the pool.
  * @return true in case of success.
  */
-bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
+bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task,
+                                    CPLWorkerJobPriority ePriority)
 {
 #ifdef DEBUG
     {
@@ -188,7 +195,10 @@ bool CPLWorkerThreadPool::SubmitJob(std::function<void()> task)
             aWT.emplace_back(std::move(wt));
     }
 
-    jobQueue.emplace(task);
+    if (ePriority == CPL_WORKER_JOB_PRIORITY_HIGH)
+        highPriorityJobQueue.emplace(task);
+    else
+        jobQueue.emplace(task);
     nPendingJobs++;
 
     if (psWaitingWorkerThreadsList)
@@ -483,6 +493,16 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
         if (eState == CPLWTS_STOP)
             return std::function<void()>();
 
+        if (!highPriorityJobQueue.empty())
+        {
+#if DEBUG_VERBOSE
+            CPLDebug("JOB", "%p got a high priority job", psWorkerThread);
+#endif
+            auto task = std::move(highPriorityJobQueue.front());
+            highPriorityJobQueue.pop();
+            return task;
+        }
+
         if (jobQueue.size())
         {
 #if DEBUG_VERBOSE
@@ -593,19 +613,23 @@ void CPLJobQueue::DeclareJobFinished()
  *
  * @param pfnFunc Function to run for the job.
  * @param pData User data to pass to the job function.
+ * @param ePriority Priority of the job.
  * @return true in case of success.
  */
-bool CPLJobQueue::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
+bool CPLJobQueue::SubmitJob(CPLThreadFunc pfnFunc, void *pData,
+                            CPLWorkerJobPriority ePriority)
 {
-    return SubmitJob([=] { pfnFunc(pData); });
+    return SubmitJob([=] { pfnFunc(pData); }, ePriority);
 }
 
 /** Queue a new job.
  *
  * @param task  Task to execute.
+ * @param ePriority Priority of the job.
  * @return true in case of success.
  */
-bool CPLJobQueue::SubmitJob(std::function<void()> task)
+bool CPLJobQueue::SubmitJob(std::function<void()> task,
+                            CPLWorkerJobPriority ePriority)
 {
     {
         std::lock_guard<std::mutex> oGuard(m_mutex);
@@ -619,7 +643,7 @@ bool CPLJobQueue::SubmitJob(std::function<void()> task)
         DeclareJobFinished();
     };
     // cppcheck-suppress knownConditionTrueFalse
-    return m_poPool->SubmitJob(std::move(lambda));
+    return m_poPool->SubmitJob(std::move(lambda), ePriority);
 }
 
 /************************************************************************/
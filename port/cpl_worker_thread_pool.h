@@ -59,6 +59,19 @@ class CPLJobQueue;
 /// Unique pointer to a job queue.
 using CPLJobQueuePtr = std::unique_ptr<CPLJobQueue>;
 
+/** Priority of a job submitted to CPLWorkerThreadPool.
+ *
+ * @since GDAL 3.14
+ */
+typedef enum
+{
+    /** Default priority, suited to background/bulk work. */
+    CPL_WORKER_JOB_PRIORITY_NORMAL = 0,
+    /** Latency-critical work, handed to workers before any pending
+     * normal-priority job. */
+    CPL_WORKER_JOB_PRIORITY_HIGH = 1
+} CPLWorkerJobPriority;
+
 /** Pool of worker threads */
 class CPL_DLL CPLWorkerThreadPool
 {
@@ -69,6 +82,7 @@ class CPL_DLL CPLWorkerThreadPool
     std::condition_variable m_cv{};
     volatile CPLWorkerThreadState eState = CPLWTS_OK;
     std::queue<std::function<void()>> jobQueue;
+    std::queue<std::function<void()>> highPriorityJobQueue;
     int nPendingJobs = 0;
     bool m_bNotifyEvent = false;
 
@@ -93,8 +107,10 @@ class CPL_DLL CPLWorkerThreadPool
 
     CPLJobQueuePtr CreateJobQueue();
 
-    bool SubmitJob(std::function<void()> task);
-    bool SubmitJob(CPLThreadFunc pfnFunc, void *pData);
+    bool SubmitJob(std::function<void()> task,
+                   CPLWorkerJobPriority ePriority = CPL_WORKER_JOB_PRIORITY_NORMAL);
+    bool SubmitJob(CPLThreadFunc pfnFunc, void *pData,
+                   CPLWorkerJobPriority ePriority = CPL_WORKER_JOB_PRIORITY_NORMAL);
     bool SubmitJobs(CPLThreadFunc pfnFunc, const std::vector<void *> &apData);
     void WaitCompletion(int nMaxRemainingJobs = 0);
     void WaitEvent();
@@ -130,8 +146,10 @@ class CPL_DLL CPLJobQueue
         return m_poPool;
     }
 
-    bool SubmitJob(CPLThreadFunc pfnFunc, void *pData);
-    bool SubmitJob(std::function<void()> task);
+    bool SubmitJob(CPLThreadFunc pfnFunc, void *pData,
+                   CPLWorkerJobPriority ePriority = CPL_WORKER_JOB_PRIORITY_NORMAL);
+    bool SubmitJob(std::function<void()> task,
+                   CPLWorkerJobPriority ePriority = CPL_WORKER_JOB_PRIORITY_NORMAL);
     void WaitCompletion(int nMaxRemainingJobs = 0);
     bool WaitEvent();
 };